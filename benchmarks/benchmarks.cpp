@@ -0,0 +1,580 @@
+// Microbenchmarks of the kernels that dominate a computation: the vector
+// operations, the right hand sides and Jacobian-vector products of the 2D
+// equations, single integration steps and the output. Each benchmark is
+// repeated until a sample takes at least the minimum time, the best of
+// several samples is reported.
+//
+//     benchmarks [--filter <substring>] [--json <file>] [--min-time <seconds>]
+//
+// The table is printed to the standard output, --json writes the results
+// also in a machine readable form for comparing builds and machines.
+
+#include <geometry/RectangularDomain.h>
+#include <geometry/RectangularGrid.h>
+#include <integrators/CVode.h>
+#include <integrators/DormandPrince45.h>
+#include <integrators/IntegratorStats.h>
+#include <integrators/OdeIntegratorBase.h>
+#include <integrators/RungeKuttaBase.h>
+#include <integrators/RungeKuttaChebyshev.h>
+#include <io/NetCDFWriter.h>
+#include <odesystem/AllenCahnEquation.h>
+#include <odesystem/CahnHilliardEquation.h>
+#include <odesystem/DegenerateCahnHilliardEquation.h>
+#include <odesystem/LoretiMarchEquation.h>
+#include <utils/MpiUtilities.h>
+#include <utils/ParameterHandler.h>
+#include <utils/Profiler.h>
+#include <utils/Vector.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifndef ODEITY_VERSION
+#define ODEITY_VERSION "unknown"
+#endif
+
+
+using namespace std;
+
+static const int numSamples = 5;
+
+
+
+class Benchmark
+{
+    public:
+
+        // bytesPerNode is the memory traffic of one unit of work per node,
+        // zero if the benchmark is not bound by it
+        Benchmark( const string & name, const unsigned int nodes, const double bytesPerNode )
+            :
+                name_( name ),
+                nodes_( nodes ),
+                bytesPerNode_( bytesPerNode )
+        {}
+
+        virtual ~Benchmark() {}
+
+        // does the work once and returns the number of units done, e.g.
+        // the number of accepted steps
+        virtual long int run() = 0;
+
+        const string & name() const { return name_; }
+        unsigned int nodes() const { return nodes_; }
+        double bytesPerNode() const { return bytesPerNode_; }
+
+    private:
+
+        string name_;
+        unsigned int nodes_;
+        double bytesPerNode_;
+};
+
+
+
+struct Result
+{
+    string name;
+    unsigned int nodes;
+    long int iterations;
+    double seconds;     // per unit of work
+    double gbPerSecond; // zero if not measured
+};
+
+
+
+// Two-dimensional problem with its own grid, the grid has to outlive the
+// equation attached to it.
+template<class Equation>
+class Problem
+{
+    public:
+
+        Problem( ParameterHandler & prm, const unsigned int n )
+        {
+            grid.attachToRectangularDomain( domain );
+            grid.getParameters( prm );
+            grid.setDimension( n, n );
+            grid.update();
+
+            equation.attachGrid( grid );
+            equation.getParameters( prm );
+
+            // smooth state with values in (-1,1) and nontrivial derivatives
+            state.reinit( grid.numberOfNodes() );
+            for ( unsigned int i = 0; i < grid.dimension( xDim ); i++ )
+                for ( unsigned int j = 0; j < grid.dimension( yDim ); j++ )
+                {
+                    const Point<2> p = grid( i, j );
+                    state( grid.nodeIndex( i, j ) ) = 0.9*cos( 2*M_PI*p(0) )*cos( 4*M_PI*p(1) );
+                }
+        }
+
+        RectangularDomain<2> domain;
+        RectangularGrid<2> grid;
+        Equation equation;
+        Vector<realtype> state;
+};
+
+
+
+class VectorBenchmark : public Benchmark
+{
+    public:
+
+        enum Operation { copy, add, sadd, equ, l2Norm, rmsNorm };
+
+        VectorBenchmark( const string & name, const Operation operation, const unsigned int size,
+                const double bytesPerNode )
+            :
+                Benchmark( name, size, bytesPerNode ),
+                operation_( operation ),
+                u_( size ),
+                v_( size ),
+                w_( size ),
+                sink_( 0.0 )
+        {
+            for ( unsigned int i = 0; i < size; i++ )
+            {
+                u_( i ) = 1.0 + 1e-3*( i % 7 );
+                v_( i ) = 2.0 - 1e-3*( i % 5 );
+                w_( i ) = 1.0 / ( 1.0 + 1e-3*( i % 3 ) );
+            }
+        }
+
+        long int run()
+        {
+            switch ( operation_ )
+            {
+                case copy:    u_ = v_; break;
+                case add:     u_.add( 1e-3, v_ ); break;
+                case sadd:    u_.sadd( 0.5, 0.5, v_ ); break;
+                case equ:     u_.equ( 0.5, v_, 0.5, w_ ); break;
+                case l2Norm:  sink_ += v_.l2_norm(); break;
+                case rmsNorm: sink_ += v_.rms_norm( w_ ); break;
+            }
+            return 1;
+        }
+
+    private:
+
+        Operation operation_;
+        Vector<realtype> u_, v_, w_;
+        realtype sink_;
+};
+
+
+
+template<class Equation>
+class RhsBenchmark : public Benchmark
+{
+    public:
+
+        RhsBenchmark( const string & name, ParameterHandler & prm, const unsigned int n )
+            :
+                Benchmark( name, n*n, 2*sizeof( realtype ) ),
+                problem_( prm, n ),
+                ydot_( problem_.state.size() )
+        {}
+
+        long int run()
+        {
+            problem_.equation.rhs( 0.0, problem_.state, ydot_ );
+            return 1;
+        }
+
+    private:
+
+        Problem<Equation> problem_;
+        Vector<realtype> ydot_;
+};
+
+
+
+class JacobianBenchmark : public Benchmark
+{
+    public:
+
+        JacobianBenchmark( const string & name, ParameterHandler & prm, const unsigned int n )
+            :
+                Benchmark( name, n*n, 3*sizeof( realtype ) ),
+                problem_( prm, n ),
+                v_( problem_.state ),
+                Jv_( problem_.state.size() ),
+                fy_( problem_.state.size() ),
+                tmp_( problem_.state.size() )
+        {
+            problem_.equation.rhs( 0.0, problem_.state, fy_ );
+        }
+
+        long int run()
+        {
+            problem_.equation.jacobian( v_, Jv_, 0.0, problem_.state, fy_, tmp_ );
+            return 1;
+        }
+
+    private:
+
+        Problem<CahnHilliardEquation> problem_;
+        Vector<realtype> v_, Jv_, fy_, tmp_;
+};
+
+
+
+// Accepted steps of an integrator on the Allen-Cahn equation. The solution
+// evolves from sample to sample, the equation relaxes slowly enough that
+// the step size stays comparable.
+class StepBenchmark : public Benchmark
+{
+    public:
+
+        StepBenchmark( const string & name, ParameterHandler & prm, const unsigned int n,
+                OdeIntegratorBase * solver )
+            :
+                Benchmark( name, n*n, 0.0 ),
+                problem_( prm, n ),
+                solver_( solver )
+        {
+            solver_->getParameters( prm );
+            solver_->assignExplicitOde( problem_.equation, 0.0, problem_.state );
+
+            // a few steps of the explicit methods per call
+            const realtype h = problem_.grid.spatialStep( xDim );
+            interval_ = 10*h*h;
+        }
+
+        ~StepBenchmark()
+        {
+            delete solver_;
+        }
+
+        long int run()
+        {
+            const long int before = solver_->stats().acceptedSteps();
+            solver_->integrateForwardDt( interval_ );
+            const long int steps = solver_->stats().acceptedSteps() - before;
+            return steps > 0 ? steps : 1;
+        }
+
+    private:
+
+        Problem<AllenCahnEquation> problem_;
+        OdeIntegratorBase * solver_;
+        realtype interval_;
+};
+
+
+
+// Time records of the Allen-Cahn solution written to a NetCDF file in the
+// results directory.
+class OutputBenchmark : public Benchmark
+{
+    public:
+
+        OutputBenchmark( const string & name, ParameterHandler & prm, const unsigned int n )
+            :
+                Benchmark( name, n*n, sizeof( realtype ) ),
+                problem_( prm, n ),
+                solver_( createDormandPrince45Solver() ),
+                writer_( "benchmarks", "data.nc" )
+        {
+            solver_->getParameters( prm );
+            solver_->assignExplicitOde( problem_.equation, 0.0, problem_.state );
+            writer_.initialize( &problem_.equation, solver_ );
+        }
+
+        ~OutputBenchmark()
+        {
+            delete solver_;
+        }
+
+        long int run()
+        {
+            writer_.writeTimeStep();
+            return 1;
+        }
+
+    private:
+
+        Problem<AllenCahnEquation> problem_;
+        OdeIntegratorBase * solver_;
+        NetCDFWriter<2> writer_;
+};
+
+
+
+// Seconds per unit of work: the number of calls is doubled until a sample
+// takes at least minTime, the best sample is taken.
+static Result
+measure( Benchmark & benchmark, const double minTime )
+{
+    Result result;
+    result.name = benchmark.name();
+    result.nodes = benchmark.nodes();
+
+    benchmark.run();
+
+    long int calls = 1;
+    double best = 0.0;
+    for ( int sample = 0; sample < numSamples; )
+    {
+        long int work = 0;
+        const double start = Profiler::wallClock();
+        for ( long int i = 0; i < calls; i++ )
+            work += benchmark.run();
+        const double elapsed = Profiler::wallClock() - start;
+
+        if ( elapsed < minTime && sample == 0 )
+        {
+            calls *= 2;
+            continue;
+        }
+
+        const double seconds = elapsed / work;
+        if ( sample == 0 || seconds < best )
+        {
+            best = seconds;
+            result.iterations = work;
+        }
+        sample++;
+    }
+
+    result.seconds = best;
+    result.gbPerSecond = benchmark.bytesPerNode()*benchmark.nodes() / best * 1e-9;
+    return result;
+}
+
+
+
+static void
+printResult( const Result & result )
+{
+    cout << left << setw( 40 ) << result.name << right
+        << setw( 12 ) << result.iterations
+        << setw( 16 ) << scientific << setprecision( 4 ) << result.seconds
+        << setw( 12 ) << fixed << setprecision( 3 ) << 1e9*result.seconds/result.nodes;
+    if ( result.gbPerSecond > 0.0 )
+        cout << setw( 10 ) << setprecision( 2 ) << result.gbPerSecond;
+    cout << endl;
+}
+
+
+
+static void
+writeJson( ostream & out, const vector<Result> & results )
+{
+    out << "{" << endl;
+    out << "  \"odeity_version\": \"" << ODEITY_VERSION << "\"," << endl;
+#ifdef _OPENMP
+    out << "  \"threads\": " << omp_get_max_threads() << "," << endl;
+#else
+    out << "  \"threads\": 1," << endl;
+#endif
+    out << "  \"benchmarks\": [" << endl;
+    out.precision( 9 );
+    for ( unsigned int i = 0; i < results.size(); i++ )
+    {
+        const Result & r = results[i];
+        out << "    { \"name\": \"" << r.name << "\", \"nodes\": " << r.nodes
+            << ", \"iterations\": " << r.iterations
+            << ", \"seconds_per_iteration\": " << r.seconds
+            << ", \"ns_per_node\": " << 1e9*r.seconds/r.nodes
+            << ", \"gb_per_s\": ";
+        if ( r.gbPerSecond > 0.0 )
+            out << r.gbPerSecond;
+        else
+            out << "null";
+        out << " }" << ( i+1 < results.size() ? "," : "" ) << endl;
+    }
+    out << "  ]" << endl;
+    out << "}" << endl;
+}
+
+
+
+static void
+declareParameters( ParameterHandler & prm )
+{
+    CVodeSpils::declareParameters( prm );
+    RungeKuttaBase::declareParameters( prm );
+
+    AllenCahnEquation::declareParameters( prm );
+    CahnHilliardEquation::declareParameters( prm );
+    DegenerateCahnHilliardEquation::declareParameters( prm );
+    LoretiMarchEquation::declareParameters( prm );
+
+    RectangularGrid<2>::declareParameters( prm );
+    RectangularDomain<2>::declareParameters( prm );
+}
+
+
+
+static string
+sizeName( const unsigned int n )
+{
+    ostringstream name;
+    name << n << "x" << n;
+    return name.str();
+}
+
+
+
+// The benchmarks are constructed only if selected by the filter, some of
+// them allocate large grids or create files.
+static void
+runBenchmarks( ParameterHandler & prm, const string & filter, const double minTime,
+        vector<Result> & results )
+{
+    vector<string> names;
+
+    const unsigned int vectorSizes[] = { 1 << 10, 1 << 16, 1 << 22 };
+    const char * vectorOperations[] = { "copy", "add", "sadd", "equ", "l2_norm", "rms_norm" };
+    // bytes read and written per element
+    const double vectorBytes[] = { 16, 24, 24, 24, 8, 16 };
+    const unsigned int gridSizes[] = { 64, 256, 1024 };
+
+    for ( unsigned int op = 0; op < 6; op++ )
+        for ( unsigned int s = 0; s < 3; s++ )
+        {
+            ostringstream name;
+            name << "vector/" << vectorOperations[op] << "/" << vectorSizes[s];
+            if ( name.str().find( filter ) == string::npos )
+                continue;
+            VectorBenchmark benchmark( name.str(), VectorBenchmark::Operation( op ),
+                    vectorSizes[s], vectorBytes[op] );
+            results.push_back( measure( benchmark, minTime ) );
+            printResult( results.back() );
+        }
+
+    for ( unsigned int s = 0; s < 3; s++ )
+    {
+        const unsigned int n = gridSizes[s];
+        names.clear();
+        names.push_back( "rhs/AllenCahn/" + sizeName( n ) );
+        names.push_back( "rhs/CahnHilliard/" + sizeName( n ) );
+        names.push_back( "rhs/LoretiMarch/" + sizeName( n ) );
+        names.push_back( "rhs/DegenerateCahnHilliard/" + sizeName( n ) );
+        names.push_back( "jacobian/CahnHilliard/" + sizeName( n ) );
+
+        for ( unsigned int i = 0; i < names.size(); i++ )
+        {
+            if ( names[i].find( filter ) == string::npos )
+                continue;
+
+            Benchmark * benchmark = 0;
+            switch ( i )
+            {
+                case 0: benchmark = new RhsBenchmark<AllenCahnEquation>( names[i], prm, n ); break;
+                case 1: benchmark = new RhsBenchmark<CahnHilliardEquation>( names[i], prm, n ); break;
+                case 2: benchmark = new RhsBenchmark<LoretiMarchEquation>( names[i], prm, n ); break;
+                case 3: benchmark = new RhsBenchmark<DegenerateCahnHilliardEquation>( names[i], prm, n ); break;
+                case 4: benchmark = new JacobianBenchmark( names[i], prm, n ); break;
+            }
+            results.push_back( measure( *benchmark, minTime ) );
+            printResult( results.back() );
+            delete benchmark;
+        }
+    }
+
+    const unsigned int stepSize = 256;
+    names.clear();
+    names.push_back( "step/DP45/AllenCahn/" + sizeName( stepSize ) );
+    names.push_back( "step/RKC/AllenCahn/" + sizeName( stepSize ) );
+    names.push_back( "step/CVodeGMRES/AllenCahn/" + sizeName( stepSize ) );
+    for ( unsigned int i = 0; i < names.size(); i++ )
+    {
+        if ( names[i].find( filter ) == string::npos )
+            continue;
+
+        OdeIntegratorBase * solver = 0;
+        switch ( i )
+        {
+            case 0: solver = createDormandPrince45Solver(); break;
+            case 1: solver = createRungeKuttaChebyshevSolver(); break;
+            case 2: solver = createCVodeGMRESSolver(); break;
+        }
+        StepBenchmark benchmark( names[i], prm, stepSize, solver );
+        results.push_back( measure( benchmark, minTime ) );
+        printResult( results.back() );
+    }
+
+    const string outputName = "output/NetCDF/" + sizeName( stepSize );
+    if ( outputName.find( filter ) != string::npos )
+    {
+        OutputBenchmark benchmark( outputName, prm, stepSize );
+        results.push_back( measure( benchmark, minTime ) );
+        printResult( results.back() );
+    }
+}
+
+
+
+int main( int argc, char * argv[] )
+{
+    mpiInitialize( &argc, &argv );
+
+    string filter;
+    string jsonFileName;
+    double minTime = 0.1;
+
+    for ( int i = 1; i < argc; i++ )
+    {
+        if ( strcmp( argv[i], "--filter" ) == 0 && i+1 < argc )
+            filter = argv[++i];
+        else if ( strcmp( argv[i], "--json" ) == 0 && i+1 < argc )
+            jsonFileName = argv[++i];
+        else if ( strcmp( argv[i], "--min-time" ) == 0 && i+1 < argc )
+            minTime = atof( argv[++i] );
+        else
+        {
+            cerr << "Usage: " << argv[0]
+                << " [--filter <substring>] [--json <file>] [--min-time <seconds>]" << endl;
+            mpiFinalize();
+            return EXIT_FAILURE;
+        }
+    }
+
+    vector<Result> results;
+    try
+    {
+        // all parameters at their default values
+        ParameterHandler prm;
+        declareParameters( prm );
+
+        cout << left << setw( 40 ) << "Benchmark" << right
+            << setw( 12 ) << "Iterations"
+            << setw( 16 ) << "Time [s]"
+            << setw( 12 ) << "ns/node"
+            << setw( 10 ) << "GB/s" << endl;
+        cout << string( 90, '-' ) << endl;
+
+        runBenchmarks( prm, filter, minTime, results );
+    }
+    catch( std::exception &exc )
+    {
+        cerr << endl << "Exception encountered: " << endl << exc.what() << endl;
+        mpiFinalize();
+        return EXIT_FAILURE;
+    }
+
+    if ( not jsonFileName.empty() )
+    {
+        ofstream jsonFile( jsonFileName.c_str() );
+        writeJson( jsonFile, results );
+    }
+
+    mpiFinalize();
+    return EXIT_SUCCESS;
+}
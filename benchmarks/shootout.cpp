@@ -0,0 +1,651 @@
+// Comparison of the solvers on the computations of the example parameter
+// files. Each 2D problem is integrated up to its final time with every
+// solver at every tolerance, on the grid of the file and on grids scaled
+// from it, and the result is compared with a reference solution computed
+// at a tight tolerance. Together with the cost (wall time, steps, right
+// hand side evaluations and Jacobian-vector products, peak memory) this
+// shows the cheapest solver for a required accuracy.
+//
+//     shootout [options] <parameter file>...
+//
+//     --equation <name>            allencahn, cahnhilliard, loretimarch or
+//                                  degcahnhilliard, by default the name of
+//                                  the parameter file as in examples/
+//     --solvers <list>             comma separated, by default all
+//     --tolerances <list>          relative and absolute tolerances
+//     --scales <list>              factors of the grid spacing refinement
+//     --final-time <time>          instead of the one in the file
+//     --reference-solver <name>
+//     --reference-tolerance <tol>
+//     --csv <file>, --json <file>  the table in a machine readable form
+//
+// The output settings of the files are ignored, nothing is written to the
+// results directory.
+
+#include <functions/WavyCircleFunction.h>
+#include <functions/ZeroFunction.h>
+#include <functions/RandomFunction.h>
+#include <functions/SincFunction.h>
+#include <functions/MathevalFunction.h>
+#include <functions/TwoScaleSineFunction.h>
+#include <functions/RectangleFunction.h>
+#include <functions/TwoRectanglesFunction.h>
+#include <functions/ZigZagFunction.h>
+#include <geometry/RectangularDomain.h>
+#include <geometry/RectangularGrid.h>
+#include <integrators/CVode.h>
+#include <integrators/DormandPrince45.h>
+#include <integrators/IntegratorStats.h>
+#include <integrators/LowStorageRungeKutta23.h>
+#include <integrators/LowStorageRungeKutta34.h>
+#include <integrators/Rock2.h>
+#include <integrators/Rock4.h>
+#include <integrators/RungeKutta23.h>
+#include <integrators/RungeKuttaBase.h>
+#include <integrators/RungeKuttaChebyshev.h>
+#include <integrators/RungeKuttaMerson45.h>
+#include <integrators/StiffnessSwitching.h>
+#include <odesystem/AllenCahnEquation.h>
+#include <odesystem/CahnHilliardEquation.h>
+#include <odesystem/DegenerateCahnHilliardEquation.h>
+#include <odesystem/LoretiMarchEquation.h>
+#include <utils/Factory.h>
+#include <utils/MpiUtilities.h>
+#include <utils/ParameterHandler.h>
+#include <utils/Profiler.h>
+#include <utils/Vector.h>
+
+#include <sys/resource.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifndef ODEITY_VERSION
+#define ODEITY_VERSION "unknown"
+#endif
+
+
+using namespace std;
+
+
+
+struct Options
+{
+    Options()
+        :
+            tolerances( "1e-3,1e-4,1e-5,1e-6" ),
+            scales( "1" ),
+            solvers( "CVodeGMRES,CVodeBiCG,CVodeTFQMR,RK23,RKM45,DP45,LSRK23,LSRK34,RKC,ROCK2,ROCK4" ),
+            finalTime( -1.0 ),
+            referenceSolver( "CVodeGMRES" ),
+            referenceTolerance( 1e-10 )
+    {}
+
+    string equation;
+    string tolerances;
+    string scales;
+    string solvers;
+    realtype finalTime;
+    string referenceSolver;
+    realtype referenceTolerance;
+    string csvFileName;
+    string jsonFileName;
+    vector<string> parameterFiles;
+};
+
+
+
+struct Run
+{
+    string equation;
+    unsigned int xdim, ydim;
+    string solver;
+    realtype tolerance;
+    bool failed;
+    double wallTime;
+    long int acceptedSteps;
+    long int rejectedSteps;
+    long int rhsEvaluations;
+    long int jacobianProducts;
+    long int peakMemory;   // kB
+    realtype errorRms;
+    realtype errorMax;
+};
+
+
+
+static MolOdeSystem<2> * createAllenCahnEquation() { return new AllenCahnEquation(); }
+static MolOdeSystem<2> * createCahnHilliardEquation() { return new CahnHilliardEquation(); }
+static MolOdeSystem<2> * createLoretiMarchEquation() { return new LoretiMarchEquation(); }
+static MolOdeSystem<2> * createDegenerateCahnHilliardEquation() { return new DegenerateCahnHilliardEquation(); }
+
+
+
+static vector<string>
+splitList( const string & list )
+{
+    vector<string> items;
+    string::size_type begin = 0;
+    while ( begin <= list.size() )
+    {
+        string::size_type end = list.find( ',', begin );
+        if ( end == string::npos )
+            end = list.size();
+        if ( end > begin )
+            items.push_back( list.substr( begin, end - begin ) );
+        begin = end + 1;
+    }
+    return items;
+}
+
+
+
+// examples/allencahn.prm belongs to the equation "allencahn"
+static string
+equationOfFile( const string & fileName )
+{
+    string name = fileName.substr( fileName.find_last_of( '/' ) + 1 );
+    return name.substr( 0, name.find( '.' ) );
+}
+
+
+
+// The high-water mark of the resident set size is reset before each run
+// where the kernel allows it, otherwise it is the peak of the whole process.
+static void
+resetPeakMemory()
+{
+    ofstream clearRefs( "/proc/self/clear_refs" );
+    if ( clearRefs )
+        clearRefs << "5" << endl;
+}
+
+
+
+static long int
+peakMemory()
+{
+    ifstream status( "/proc/self/status" );
+    string line;
+    while ( getline( status, line ) )
+        if ( line.compare( 0, 6, "VmHWM:" ) == 0 )
+            return atol( line.c_str() + 6 );
+
+    rusage usage;
+    getrusage( RUSAGE_SELF, &usage );
+    return usage.ru_maxrss;
+}
+
+
+
+// The computation of one parameter file on one grid.
+class Problem
+{
+    public:
+
+        Problem( ParameterHandler & prm, const Factory<MolOdeSystem<2>,string> & equations,
+                const Factory<Function<2>,string> & initialConditions, const string & equation,
+                const realtype scale );
+        ~Problem();
+
+        RectangularDomain<2> domain;
+        RectangularGrid<2> grid;
+        MolOdeSystem<2> * equation;
+        Vector<realtype> initialState;
+
+    private:
+
+        Problem( const Problem& );
+        Problem& operator = ( const Problem& );
+};
+
+
+
+// The grid is refined keeping the nodes of the original one for integer
+// scales.
+Problem::Problem( ParameterHandler & prm, const Factory<MolOdeSystem<2>,string> & equations,
+        const Factory<Function<2>,string> & initialConditions, const string & name,
+        const realtype scale )
+    :
+        equation( 0 )
+{
+    domain.getParameters( prm );
+    grid.attachToRectangularDomain( domain );
+    grid.getParameters( prm );
+    grid.update();
+    const unsigned int xdim = (unsigned int)( scale*( grid.globalDimension( xDim ) - 1 ) + 0.5 ) + 1;
+    const unsigned int ydim = (unsigned int)( scale*( grid.globalDimension( yDim ) - 1 ) + 0.5 ) + 1;
+    grid.setDimension( xdim, ydim );
+    grid.update();
+
+    equation = equations.createObject( name );
+    equation->attachGrid( grid );
+    equation->getParameters( prm );
+
+    prm.enter_subsection( "Initial condition" );
+        Function<2> * initialCondition = initialConditions.createObject( prm.get( "type" ) );
+        initialCondition->getParameters( prm );
+    prm.leave_subsection();
+
+    initialState.reinit( grid.numberOfNodes() );
+    for ( unsigned int i = 0; i < grid.dimension( xDim ); i++ )
+        for ( unsigned int j = 0; j < grid.dimension( yDim ); j++ )
+            initialState( grid.nodeIndex( i, j ) ) = (*initialCondition)( grid( i, j ) );
+    delete initialCondition;
+}
+
+
+
+Problem::~Problem()
+{
+    delete equation;
+}
+
+
+
+class Shootout
+{
+    public:
+
+        Shootout( const Options & options );
+
+        void run();
+
+    private:
+
+        const Options & options_;
+        ParameterHandler prm_;
+        Factory<MolOdeSystem<2>,string> equations_;
+        Factory<Function<2>,string> initialConditions_;
+        Factory<OdeIntegratorBase,string> solvers_;
+        vector<Run> runs_;
+
+        void declareParameters();
+        void integrate( Problem & problem, const string & solverName, const realtype tolerance,
+                const realtype finalTime, Run & run, Vector<realtype> & solution );
+
+        void printHeader() const;
+        void printRun( const Run & run ) const;
+        void writeCsv( ostream & out ) const;
+        void writeJson( ostream & out ) const;
+};
+
+
+
+Shootout::Shootout( const Options & options )
+    :
+        options_( options )
+{
+    equations_.registerCreator( "allencahn", createAllenCahnEquation );
+    equations_.registerCreator( "cahnhilliard", createCahnHilliardEquation );
+    equations_.registerCreator( "loretimarch", createLoretiMarchEquation );
+    equations_.registerCreator( "degcahnhilliard", createDegenerateCahnHilliardEquation );
+
+    initialConditions_.registerCreator( "Wavy circle", createWavyCircleFunction );
+    initialConditions_.registerCreator( "Zero", createZeroFunction );
+    initialConditions_.registerCreator( "Random", createRandomFunction );
+    initialConditions_.registerCreator( "Sinc", createSincFunction );
+    initialConditions_.registerCreator( "Matheval", createMathevalFunction );
+    initialConditions_.registerCreator( "Two-scale sine", createTwoScaleSineFunction );
+    initialConditions_.registerCreator( "Rectangle", createRectangleFunction );
+    initialConditions_.registerCreator( "Two rectangles", createTwoRectanglesFunction );
+    initialConditions_.registerCreator( "Zig-zag", createZigZagFunction );
+
+    solvers_.registerCreator( "CVodeGMRES", createCVodeGMRESSolver );
+    solvers_.registerCreator( "CVodeBiCG", createCVodeBiCGSolver );
+    solvers_.registerCreator( "CVodeTFQMR", createCVodeTFQMRSolver );
+    solvers_.registerCreator( "CVodeBand", createCVodeBandSolver );
+    solvers_.registerCreator( "CVodeDense", createCVodeDenseSolver );
+    solvers_.registerCreator( "CVodeAdams", createCVodeAdamsSolver );
+    solvers_.registerCreator( "RK23", createRungeKutta23Solver );
+    solvers_.registerCreator( "RKM45", createRungeKuttaMerson45Solver );
+    solvers_.registerCreator( "DP45", createDormandPrince45Solver );
+    solvers_.registerCreator( "LSRK23", createLowStorageRungeKutta23Solver );
+    solvers_.registerCreator( "LSRK34", createLowStorageRungeKutta34Solver );
+    solvers_.registerCreator( "RKC", createRungeKuttaChebyshevSolver );
+    solvers_.registerCreator( "ROCK2", createRock2Solver );
+    solvers_.registerCreator( "ROCK4", createRock4Solver );
+    solvers_.registerCreator( "Switching", createStiffnessSwitchingSolver );
+
+    declareParameters();
+}
+
+
+
+// The same parameters as those of the example programs in 2D, so that
+// their files are read as they are.
+void
+Shootout::declareParameters()
+{
+    prm_.declare_entry( "computation name", "", Patterns::Anything() );
+    prm_.declare_entry( "final time", "10.0", Patterns::Double() );
+    prm_.declare_entry( "number of output points", "1", Patterns::Integer() );
+    prm_.declare_entry( "save results", "true", Patterns::Bool() );
+    prm_.declare_entry( "save history", "false", Patterns::Bool() );
+    prm_.declare_entry( "status interval", "10.0", Patterns::Double() );
+    prm_.declare_entry( "solver", "CVodeGMRES", Patterns::Selection("CVodeGMRES|CVodeBiCG|CVodeTFQMR|CVodeBand|CVodeDense|CVodeAdams|RK23|RKM45|DP45|LSRK23|LSRK34|RKC|ROCK2|ROCK4|Switching") );
+
+    CVodeSpils::declareParameters( prm_ );
+    CVodeDls::declareParameters( prm_ );
+    CVodeAdams::declareParameters( prm_ );
+    StiffnessSwitching::declareParameters( prm_ );
+    RungeKuttaBase::declareParameters( prm_ );
+
+    AllenCahnEquation::declareParameters( prm_ );
+    CahnHilliardEquation::declareParameters( prm_ );
+    DegenerateCahnHilliardEquation::declareParameters( prm_ );
+    LoretiMarchEquation::declareParameters( prm_ );
+
+    prm_.enter_subsection( "Initial condition" );
+        prm_.declare_entry( "type", "Wavy circle", Patterns::Selection("Wavy circle|Random|Zero|Sinc|Matheval|Two-scale sine|Rectangle|Two rectangles|Zig-zag") );
+        WavyCircleFunction::declareParameters( prm_ );
+        RandomFunction<2>::declareParameters( prm_ );
+        MathevalFunction<2>::declareParameters( prm_ );
+        TwoScaleSineFunction::declareParameters( prm_ );
+        RectangleFunction::declareParameters( prm_ );
+        TwoRectanglesFunction::declareParameters( prm_ );
+    prm_.leave_subsection();
+
+    RectangularGrid<2>::declareParameters( prm_ );
+    RectangularDomain<2>::declareParameters( prm_ );
+}
+
+
+
+void
+Shootout::run()
+{
+    const vector<string> solverNames = splitList( options_.solvers );
+    const vector<string> tolerances = splitList( options_.tolerances );
+    const vector<string> scales = splitList( options_.scales );
+
+    if ( mpiRank() == 0 )
+        printHeader();
+
+    for ( unsigned int f = 0; f < options_.parameterFiles.size(); f++ )
+    {
+        const string & fileName = options_.parameterFiles[f];
+        const string equation = options_.equation.empty() ? equationOfFile( fileName ) : options_.equation;
+
+        prm_.read_input( fileName );
+        const realtype finalTime = options_.finalTime > 0.0 ? options_.finalTime : prm_.get_double( "final time" );
+
+        for ( unsigned int s = 0; s < scales.size(); s++ )
+        {
+            Problem problem( prm_, equations_, initialConditions_, equation, atof( scales[s].c_str() ) );
+
+            Run reference;
+            Vector<realtype> referenceSolution;
+            integrate( problem, options_.referenceSolver, options_.referenceTolerance, finalTime,
+                    reference, referenceSolution );
+            AssertThrow( not reference.failed,
+                    ExcMessage( "The reference solution could not be computed" ) );
+
+            const realtype numberOfNodes = problem.grid.numberOfGlobalNodes();
+            Vector<realtype> difference( referenceSolution.size() );
+            for ( unsigned int i = 0; i < solverNames.size(); i++ )
+                for ( unsigned int t = 0; t < tolerances.size(); t++ )
+                {
+                    Run run;
+                    run.equation = equation;
+                    Vector<realtype> solution;
+                    integrate( problem, solverNames[i], atof( tolerances[t].c_str() ), finalTime,
+                            run, solution );
+
+                    if ( not run.failed )
+                    {
+                        difference.equ( 1.0, solution, -1.0, referenceSolution );
+                        run.errorRms = globalL2Norm( difference ) / sqrt( numberOfNodes );
+                        run.errorMax = mpiMax( difference.linfty_norm() );
+                    }
+
+                    runs_.push_back( run );
+                    if ( mpiRank() == 0 )
+                        printRun( run );
+                }
+        }
+    }
+
+    if ( mpiRank() != 0 )
+        return;
+
+    if ( not options_.csvFileName.empty() )
+    {
+        ofstream csvFile( options_.csvFileName.c_str() );
+        writeCsv( csvFile );
+    }
+    if ( not options_.jsonFileName.empty() )
+    {
+        ofstream jsonFile( options_.jsonFileName.c_str() );
+        writeJson( jsonFile );
+    }
+}
+
+
+
+// A solver failing to reach the final time, e.g. for exceeding the maximum
+// number of steps, is recorded as failed.
+void
+Shootout::integrate( Problem & problem, const string & solverName, const realtype tolerance,
+        const realtype finalTime, Run & run, Vector<realtype> & solution )
+{
+    run.xdim = problem.grid.globalDimension( xDim );
+    run.ydim = problem.grid.globalDimension( yDim );
+    run.solver = solverName;
+    run.tolerance = tolerance;
+    run.failed = false;
+    run.wallTime = 0.0;
+    run.acceptedSteps = run.rejectedSteps = run.rhsEvaluations = run.jacobianProducts = 0;
+    run.errorRms = run.errorMax = 0.0;
+
+    OdeIntegratorBase * solver = solvers_.createObject( solverName );
+    solver->getParameters( prm_ );
+    solver->setRelativeTolerance( tolerance );
+    solver->setAbsoluteTolerance( tolerance );
+
+    resetPeakMemory();
+    const double start = Profiler::wallClock();
+    try
+    {
+        solver->assignExplicitOde( *problem.equation, 0.0, problem.initialState );
+        solver->integrateTo( finalTime );
+    }
+    catch( std::exception & )
+    {
+        run.failed = true;
+    }
+    run.wallTime = Profiler::wallClock() - start;
+    run.peakMemory = peakMemory();
+
+    const IntegratorStatsBase & stats = solver->stats();
+    run.acceptedSteps = stats.acceptedSteps();
+    run.rejectedSteps = stats.rejectedSteps();
+    run.rhsEvaluations = stats.rhsEvaluations();
+    run.jacobianProducts = stats.jacobianProducts();
+
+    solution.reinit( solver->currentState().size(), true );
+    solution = solver->currentState();
+    delete solver;
+}
+
+
+
+void
+Shootout::printHeader() const
+{
+    cout << left << setw( 16 ) << "Equation" << setw( 12 ) << "Grid" << setw( 12 ) << "Solver" << right
+        << setw( 10 ) << "Tolerance"
+        << setw( 12 ) << "Time [s]"
+        << setw( 10 ) << "Steps"
+        << setw( 10 ) << "Rejected"
+        << setw( 12 ) << "RHS"
+        << setw( 12 ) << "Jv"
+        << setw( 12 ) << "Peak [kB]"
+        << setw( 12 ) << "RMS error"
+        << setw( 12 ) << "Max error" << endl;
+    cout << string( 150, '-' ) << endl;
+}
+
+
+
+void
+Shootout::printRun( const Run & run ) const
+{
+    ostringstream grid;
+    grid << run.xdim << "x" << run.ydim;
+
+    cout << left << setw( 16 ) << run.equation << setw( 12 ) << grid.str() << setw( 12 ) << run.solver << right
+        << setw( 10 ) << scientific << setprecision( 0 ) << run.tolerance
+        << setw( 12 ) << fixed << setprecision( 3 ) << run.wallTime
+        << setw( 10 ) << run.acceptedSteps
+        << setw( 10 ) << run.rejectedSteps
+        << setw( 12 ) << run.rhsEvaluations
+        << setw( 12 ) << run.jacobianProducts
+        << setw( 12 ) << run.peakMemory;
+    if ( run.failed )
+        cout << setw( 24 ) << "failed";
+    else
+        cout << setw( 12 ) << scientific << setprecision( 3 ) << run.errorRms
+            << setw( 12 ) << run.errorMax;
+    cout << endl;
+}
+
+
+
+void
+Shootout::writeCsv( ostream & out ) const
+{
+    out << "equation,xdim,ydim,solver,tolerance,status,wall_time,accepted_steps,rejected_steps,"
+        << "rhs_evaluations,jacobian_products,peak_memory_kb,error_rms,error_max" << endl;
+    out.precision( 9 );
+    for ( unsigned int i = 0; i < runs_.size(); i++ )
+    {
+        const Run & r = runs_[i];
+        out << r.equation << "," << r.xdim << "," << r.ydim << "," << r.solver << ","
+            << r.tolerance << "," << ( r.failed ? "failed" : "ok" ) << "," << r.wallTime << ","
+            << r.acceptedSteps << "," << r.rejectedSteps << "," << r.rhsEvaluations << ","
+            << r.jacobianProducts << "," << r.peakMemory << ",";
+        if ( not r.failed )
+            out << r.errorRms << "," << r.errorMax;
+        else
+            out << ",";
+        out << endl;
+    }
+}
+
+
+
+void
+Shootout::writeJson( ostream & out ) const
+{
+    out << "{" << endl;
+    out << "  \"odeity_version\": \"" << ODEITY_VERSION << "\"," << endl;
+    out << "  \"processes\": " << mpiSize() << "," << endl;
+    out << "  \"reference_solver\": \"" << options_.referenceSolver << "\"," << endl;
+    out << "  \"reference_tolerance\": " << options_.referenceTolerance << "," << endl;
+    out << "  \"runs\": [" << endl;
+    out.precision( 9 );
+    for ( unsigned int i = 0; i < runs_.size(); i++ )
+    {
+        const Run & r = runs_[i];
+        out << "    { \"equation\": \"" << r.equation << "\", \"xdim\": " << r.xdim
+            << ", \"ydim\": " << r.ydim << ", \"solver\": \"" << r.solver
+            << "\", \"tolerance\": " << r.tolerance
+            << ", \"status\": \"" << ( r.failed ? "failed" : "ok" )
+            << "\", \"wall_time\": " << r.wallTime
+            << ", \"accepted_steps\": " << r.acceptedSteps
+            << ", \"rejected_steps\": " << r.rejectedSteps
+            << ", \"rhs_evaluations\": " << r.rhsEvaluations
+            << ", \"jacobian_products\": " << r.jacobianProducts
+            << ", \"peak_memory_kb\": " << r.peakMemory << ", \"error_rms\": ";
+        if ( r.failed )
+            out << "null, \"error_max\": null";
+        else
+            out << r.errorRms << ", \"error_max\": " << r.errorMax;
+        out << " }" << ( i+1 < runs_.size() ? "," : "" ) << endl;
+    }
+    out << "  ]" << endl;
+    out << "}" << endl;
+}
+
+
+
+static bool
+parseOptions( int argc, char * argv[], Options & options )
+{
+    for ( int i = 1; i < argc; i++ )
+    {
+        const string option = argv[i];
+        if ( option.compare( 0, 2, "--" ) != 0 )
+        {
+            options.parameterFiles.push_back( option );
+            continue;
+        }
+        if ( i+1 == argc )
+            return false;
+
+        const string value = argv[++i];
+        if ( option == "--equation" )
+            options.equation = value;
+        else if ( option == "--solvers" )
+            options.solvers = value;
+        else if ( option == "--tolerances" )
+            options.tolerances = value;
+        else if ( option == "--scales" )
+            options.scales = value;
+        else if ( option == "--final-time" )
+            options.finalTime = atof( value.c_str() );
+        else if ( option == "--reference-solver" )
+            options.referenceSolver = value;
+        else if ( option == "--reference-tolerance" )
+            options.referenceTolerance = atof( value.c_str() );
+        else if ( option == "--csv" )
+            options.csvFileName = value;
+        else if ( option == "--json" )
+            options.jsonFileName = value;
+        else
+            return false;
+    }
+    return not options.parameterFiles.empty();
+}
+
+
+
+int main( int argc, char * argv[] )
+{
+    mpiInitialize( &argc, &argv );
+
+    Options options;
+    if ( not parseOptions( argc, argv, options ) )
+    {
+        if ( mpiRank() == 0 )
+            cerr << "Usage: " << argv[0] << " [--equation <name>] [--solvers <list>]"
+                << " [--tolerances <list>] [--scales <list>] [--final-time <time>]"
+                << " [--reference-solver <name>] [--reference-tolerance <tol>]"
+                << " [--csv <file>] [--json <file>] <parameter file>..." << endl;
+        mpiFinalize();
+        return EXIT_FAILURE;
+    }
+
+    try
+    {
+        Shootout shootout( options );
+        shootout.run();
+    }
+    catch( std::exception &exc )
+    {
+        cerr << endl << "Exception encountered: " << endl << exc.what() << endl;
+        mpiFinalize();
+        return EXIT_FAILURE;
+    }
+
+    mpiFinalize();
+    return EXIT_SUCCESS;
+}
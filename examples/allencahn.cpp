@@ -5,13 +5,13 @@
 
 using namespace std;
 
-class AllenCahnApplication : public OdeityApplication
+class AllenCahnApplication : public OdeityApplication<2>
 {
     public:
 
         AllenCahnApplication( int argc, char * argv[] )
             :
-                OdeityApplication( argc, argv )
+                OdeityApplication<2>( argc, argv )
         {}
 
     private:
@@ -24,7 +24,7 @@ class AllenCahnApplication : public OdeityApplication
 
         void writeGlobalAttributes()
         {
-            OdeityApplication::writeGlobalAttributes();
+            OdeityApplication<2>::writeGlobalAttributes();
 
             AllenCahnEquation * eq = (AllenCahnEquation*) molProblem;
             writer->writeGlobalAtt( "xi", eq->interfaceWidth() );
@@ -40,6 +40,7 @@ int main( int argc, char * argv[])
         AllenCahnApplication * app = new AllenCahnApplication( argc, argv );
         app->initialize();
         app->run();
+        delete app;
     }
     catch( std::exception &exc )
     {
@@ -0,0 +1,70 @@
+#include <io/NetCDFWriter.h>
+#include <odesystem/AllenCahnEquation3D.h>
+#include <utils/OdeityApplication.h>
+
+
+using namespace std;
+
+class AllenCahnApplication : public OdeityApplication<3>
+{
+    public:
+
+        AllenCahnApplication( int argc, char * argv[] )
+            :
+                OdeityApplication<3>( argc, argv )
+        {}
+
+    private:
+
+        MolOdeSystem<3>* createMolProblem() const
+        {
+            return new AllenCahnEquation3D();
+        }
+
+
+        void writeGlobalAttributes()
+        {
+            OdeityApplication<3>::writeGlobalAttributes();
+
+            AllenCahnEquation3D * eq = (AllenCahnEquation3D*) molProblem;
+            writer->writeGlobalAtt( "xi", eq->interfaceWidth() );
+            writer->writeGlobalAtt( "F", eq->forcingTerm() );
+        }
+};
+
+
+int main( int argc, char * argv[])
+{
+    try
+    {
+        AllenCahnApplication * app = new AllenCahnApplication( argc, argv );
+        app->initialize();
+        app->run();
+        delete app;
+    }
+    catch( std::exception &exc )
+    {
+        std::cerr << std::endl << std::endl
+                  << "--------------------------------------------------"
+                  << std::endl
+                  << "Exception encountered: " << std::endl
+                  << exc.what() << std::endl
+                  << "Aborting" << std::endl
+                  << "--------------------------------------------------"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+    catch(...)
+    {
+        std::cerr << std::endl << std::endl
+                  << "--------------------------------------------------"
+                  << std::endl
+                  << "Unknown exception encountered" << std::endl
+                  << "Aborting" << std::endl
+                  << "--------------------------------------------------"
+                  << std::endl;
+
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
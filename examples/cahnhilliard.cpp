@@ -3,13 +3,13 @@
 #include <utils/OdeityApplication.h>
 
 
-class CahnHilliardApplication : public OdeityApplication
+class CahnHilliardApplication : public OdeityApplication<2>
 {
     public:
 
         CahnHilliardApplication( int argc, char * argv[] )
             :
-                OdeityApplication( argc, argv )
+                OdeityApplication<2>( argc, argv )
         { }
 
 
@@ -22,7 +22,7 @@ class CahnHilliardApplication : public OdeityApplication
 
         void writeGlobalAttributes()
         {
-            OdeityApplication::writeGlobalAttributes();
+            OdeityApplication<2>::writeGlobalAttributes();
 
             CahnHilliardEquation * eq = (CahnHilliardEquation*) molProblem;
             writer->writeGlobalAtt( "xi", eq->interfaceWidth() );
@@ -36,5 +36,7 @@ int main( int argc, char * argv[] )
   CahnHilliardApplication * app = new CahnHilliardApplication( argc, argv );
 
   app->initialize();
-  return app->run();
+  const int status = app->run();
+  delete app;
+  return status;
 }
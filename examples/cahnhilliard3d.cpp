@@ -0,0 +1,42 @@
+#include <io/NetCDFWriter.h>
+#include <odesystem/CahnHilliardEquation3D.h>
+#include <utils/OdeityApplication.h>
+
+
+class CahnHilliardApplication : public OdeityApplication<3>
+{
+    public:
+
+        CahnHilliardApplication( int argc, char * argv[] )
+            :
+                OdeityApplication<3>( argc, argv )
+        { }
+
+
+    private:
+
+        MolOdeSystem<3>* createMolProblem() const
+        {
+            return new CahnHilliardEquation3D();
+        }
+
+        void writeGlobalAttributes()
+        {
+            OdeityApplication<3>::writeGlobalAttributes();
+
+            CahnHilliardEquation3D * eq = (CahnHilliardEquation3D*) molProblem;
+            writer->writeGlobalAtt( "xi", eq->interfaceWidth() );
+            writer->writeGlobalAtt( "a", eq->potentialCoefficient() );
+        }
+};
+
+
+int main( int argc, char * argv[] )
+{
+  CahnHilliardApplication * app = new CahnHilliardApplication( argc, argv );
+
+  app->initialize();
+  const int status = app->run();
+  delete app;
+  return status;
+}
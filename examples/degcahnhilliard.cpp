@@ -3,13 +3,13 @@
 #include <odesystem/DegenerateCahnHilliardEquation.h>
 
 
-class DegenerateCahnHilliardApplication : public OdeityApplication
+class DegenerateCahnHilliardApplication : public OdeityApplication<2>
 {
     public:
 
         DegenerateCahnHilliardApplication( int argc, char * argv[] )
             :
-                OdeityApplication( argc, argv )
+                OdeityApplication<2>( argc, argv )
         {}
 
     private:
@@ -22,7 +22,7 @@ class DegenerateCahnHilliardApplication : public OdeityApplication
 
         void writeGlobalAttributes()
         {
-            OdeityApplication::writeGlobalAttributes();
+            OdeityApplication<2>::writeGlobalAttributes();
 
             DegenerateCahnHilliardEquation * eq = (DegenerateCahnHilliardEquation*) molProblem;
             writer->writeGlobalAtt( "xi", eq->interfaceWidth() );
@@ -37,6 +37,8 @@ int main( int argc, char * argv[] )
   DegenerateCahnHilliardApplication * app = new DegenerateCahnHilliardApplication( argc, argv );
 
   app->initialize();
-  return app->run();
+  const int status = app->run();
+  delete app;
+  return status;
 }
 
@@ -0,0 +1,67 @@
+#include <integrators/EnsembleDormandPrince45.h>
+#include <odesystem/RobertsonEquation.h>
+#include <odesystem/TestSystem03.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+// Integrates a batch of van der Pol oscillators (TestSystem03) started from
+// points on a circle, and a batch of Robertson problems with perturbed rate
+// constants, each batch in a single call.
+int main( int argc, char * argv[] )
+{
+    const unsigned int lanes = ( argc > 1 ) ? std::atoi( argv[1] ) : 4096;
+
+    {
+        EnsembleDormandPrince45<TestSystem03> solver( lanes );
+        solver.setTolerances( 1.0e-8, 1.0e-8 );
+
+        std::vector<realtype> y( 2 * lanes );
+        for ( unsigned int l = 0; l < lanes; l++ )
+        {
+            const realtype phi = 2.0 * M_PI * l / lanes;
+            y[l] = 2.0 * std::cos( phi );
+            y[lanes + l] = 2.0 * std::sin( phi );
+        }
+
+        solver.solve( 0.0, 20.0, &y[0] );
+
+        unsigned long accepted = 0, rejected = 0;
+        for ( unsigned int l = 0; l < lanes; l++ )
+        {
+            accepted += solver.acceptedSteps( l );
+            rejected += solver.rejectedSteps( l );
+        }
+
+        std::cout << "van der Pol, " << lanes << " instances" << std::endl;
+        std::cout << "  y(20) of instance 0: " << y[0] << " " << y[lanes] << std::endl;
+        std::cout << "  accepted steps: " << accepted << ", rejected steps: " << rejected
+            << ", batched rhs evaluations: " << solver.rhsEvaluations() << std::endl;
+    }
+
+    {
+        EnsembleDormandPrince45<RobertsonEquation> solver( lanes );
+        solver.setTolerances( 1.0e-6, 1.0e-10 );
+
+        std::vector<realtype> y( 3 * lanes, 0.0 );
+        std::vector<realtype> k( 3 * lanes );
+        std::srand( 1 );
+        for ( unsigned int l = 0; l < lanes; l++ )
+        {
+            y[l] = 1.0;
+            k[l] = 0.04 * ( 0.9 + 0.2 * std::rand() / (realtype) RAND_MAX );
+            k[lanes + l] = 1.0e4;
+            k[2*lanes + l] = 3.0e7;
+        }
+
+        solver.solve( 0.0, 0.3, &y[0], &k[0] );
+
+        std::cout << "Robertson, " << lanes << " instances" << std::endl;
+        std::cout << "  y(0.3) of instance 0: " << y[0] << " " << y[lanes] << " " << y[2*lanes] << std::endl;
+        std::cout << "  batched rhs evaluations: " << solver.rhsEvaluations() << std::endl;
+    }
+
+    return 0;
+}
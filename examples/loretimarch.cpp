@@ -3,13 +3,13 @@
 #include <utils/OdeityApplication.h>
 
 
-class LoretiMarchApplication : public OdeityApplication
+class LoretiMarchApplication : public OdeityApplication<2>
 {
     public:
 
         LoretiMarchApplication( int argc, char * argv[] )
             :
-                OdeityApplication( argc, argv )
+                OdeityApplication<2>( argc, argv )
         { }
 
 
@@ -22,7 +22,7 @@ class LoretiMarchApplication : public OdeityApplication
 
         void writeGlobalAttributes()
         {
-            OdeityApplication::writeGlobalAttributes();
+            OdeityApplication<2>::writeGlobalAttributes();
 
             LoretiMarchEquation * eq = (LoretiMarchEquation*) molProblem;
             writer->writeGlobalAtt( "xi", eq->interfaceWidth() );
@@ -36,5 +36,7 @@ int main( int argc, char * argv[] )
   LoretiMarchApplication * app = new LoretiMarchApplication( argc, argv );
 
   app->initialize();
-  return app->run();
+  const int status = app->run();
+  delete app;
+  return status;
 }
@@ -6,10 +6,38 @@
 #include "../utils/Exceptions.h"
 #include "../utils/ParameterHandler.h"
 #include "../utils/LogStream.h"
+#include "../utils/MpiUtilities.h"
+#include "../utils/Profiler.h"
 
 #include <sundials/sundials_types.h>
 
+#include <algorithm>
 
+
+// Boundary condition on all sides of the domain. With Neumann condition the
+// ghost nodes mirror the nodes inside the domain about the boundary node.
+// With periodic condition the node at the upper extent is identified with
+// the one at the lower extent, the spatial step is then size/n instead of
+// size/(n-1). With Dirichlet condition the grid is cell-centred: the spatial
+// step is size/n, the nodes lie at the centres of the cells and the boundary
+// value g is imposed on the faces of the domain by the ghost value 2g - u of
+// the node mirrored about the face.
+enum BoundaryCondition
+{
+  neumannBoundary,
+  periodicBoundary,
+  dirichletBoundary
+};
+
+
+
+// In a distributed run the grid is split into slabs along x, one for each
+// process. The methods describing the nodes, such as dimension(),
+// numberOfNodes(), nodeIndex() and the padded storage, then refer to the
+// slab owned by this process, while globalDimension() and globalOffset()
+// relate it to the whole grid. The ghost layers at the sides of the slab
+// shared with the neighbouring processes are filled by exchanging the
+// outermost planes with them.
 template<int dim>
 class RectangularGrid
 {
@@ -26,6 +54,8 @@ class RectangularGrid
     void update();
 
     unsigned int dimension( const unsigned int index ) const;
+    unsigned int globalDimension( const unsigned int index ) const;
+    unsigned int globalOffset( const unsigned int index ) const;
     void setDimension( const unsigned int xdim );
     void setDimension( const unsigned int xdim, const unsigned int ydim );
     void setDimension( const unsigned int xdim, const unsigned int ydim, const unsigned int zdim );
@@ -40,10 +70,47 @@ class RectangularGrid
     Point<dim> operator () ( const unsigned int xindex, const unsigned int yindex, const unsigned int zindex ) const;
 
     unsigned int numberOfNodes() const;
+    unsigned int numberOfGlobalNodes() const;
     unsigned int nodeIndex( const unsigned int xindex ) const;
     unsigned int nodeIndex( const unsigned int xindex, const unsigned int yindex ) const;
     unsigned int nodeIndex( const unsigned int xindex, const unsigned int yindex, const unsigned int zindex ) const;
 
+    BoundaryCondition boundaryCondition() const;
+    BoundaryCondition auxiliaryBoundaryCondition() const;
+    realtype boundaryValue() const;
+    bool isCellCentred() const;
+    void setBoundaryCondition( const BoundaryCondition bc, const realtype value = 0.0 );
+
+    // Padded storage: the nodes are surrounded by ghostLayers layers of ghost
+    // nodes, so that stencils can be applied in the whole grid without
+    // testing for the boundary. The ghost nodes are set by fillGhostLayers()
+    // according to the boundary condition. Implemented in 2D. The state itself
+    // is not padded: copyToPadded() copies all nodes, i.e. O(n) memory
+    // traffic on every evaluation of the right hand side, only the filling of
+    // the ghost layers is proportional to the perimeter.
+    static const unsigned int ghostLayers = 1;
+
+    unsigned int paddedDimension( const unsigned int index ) const;
+    unsigned int numberOfPaddedNodes() const;
+    unsigned int paddedNodeIndex( const int xindex, const int yindex ) const;
+    int boundaryImage( const int index, const unsigned int d, const BoundaryCondition bc ) const;
+
+    void copyToPadded( const realtype * v, realtype * padded ) const;
+    void fillGhostLayers( realtype * padded ) const;
+    void fillGhostLayers( realtype * padded, const BoundaryCondition bc ) const;
+    void beginFillGhostLayers( realtype * padded, const BoundaryCondition bc, MpiRequests & requests ) const;
+    void endFillGhostLayers( realtype * padded, const BoundaryCondition bc, MpiRequests & requests ) const;
+
+    bool isDistributed() const;
+    bool hasLowerNeighbour() const;
+    bool hasUpperNeighbour() const;
+    void exchangeWithNeighbours( const realtype * sendLower, realtype * recvLower,
+        const realtype * sendUpper, realtype * recvUpper, const unsigned int count ) const;
+    void beginExchangeWithNeighbours( const realtype * sendLower, realtype * recvLower,
+        const realtype * sendUpper, realtype * recvUpper, const unsigned int count,
+        MpiRequests & requests ) const;
+    void endExchangeWithNeighbours( MpiRequests & requests ) const;
+
     static void declareParameters( ParameterHandler &prm );
     virtual void getParameters( ParameterHandler &prm );
 
@@ -55,12 +122,22 @@ class RectangularGrid
 
   private:
 
+    unsigned int globalNumNodes_[dim];
     unsigned int numNodes_[dim];
     realtype spatialStep_[dim];
     realtype spatialStepInv_[dim];
     realtype spatialStepPow2Inv_[dim];
     realtype spatialStepPow4Inv_[dim];
 
+    BoundaryCondition boundaryCondition_;
+    realtype boundaryValue_;
+
+    // first node of the slab in x and the ranks of the processes owning the
+    // neighbouring slabs, negative if there is none
+    unsigned int offset_;
+    int lowerNeighbour_;
+    int upperNeighbour_;
+
     bool updated_;
 
     const RectangularDomain<dim>* domain_;
@@ -71,6 +148,11 @@ class RectangularGrid
 template<int dim>
 inline
 RectangularGrid<dim>::RectangularGrid() :
+  boundaryCondition_( neumannBoundary ),
+  boundaryValue_( 0.0 ),
+  offset_( 0 ),
+  lowerNeighbour_( -1 ),
+  upperNeighbour_( -1 ),
   updated_( false ),
   domain_( 0 )
 {
@@ -78,6 +160,7 @@ RectangularGrid<dim>::RectangularGrid() :
 
   for( unsigned int i = 0; i < dim; i++ )
   {
+    globalNumNodes_[i] = 0;
     numNodes_[i] = 0;
     spatialStep_[i] = 0.0;
   }  
@@ -88,6 +171,12 @@ RectangularGrid<dim>::RectangularGrid() :
 template<int dim>
 inline
 RectangularGrid<dim>::RectangularGrid( const RectangularDomain<dim>& domain )
+  :
+  boundaryCondition_( neumannBoundary ),
+  boundaryValue_( 0.0 ),
+  offset_( 0 ),
+  lowerNeighbour_( -1 ),
+  upperNeighbour_( -1 )
 {
   Assert( 1 <= dim && dim <= 3, ExcIncorrectDimension( dim ) );
 
@@ -119,13 +208,37 @@ RectangularGrid<dim>::dimension( const unsigned int index ) const
 
 
 
+template<int dim>
+inline
+unsigned int
+RectangularGrid<dim>::globalDimension( const unsigned int index ) const
+{
+  Assert( index < dim, ExcIndexRange( index, 0, dim ) );
+  Assert( updated_ == true, ExcMessage("Grid is not up to date") );
+  return globalNumNodes_[index];
+}
+
+
+
+template<int dim>
+inline
+unsigned int
+RectangularGrid<dim>::globalOffset( const unsigned int index ) const
+{
+  Assert( index < dim, ExcIndexRange( index, 0, dim ) );
+  Assert( updated_ == true, ExcMessage("Grid is not up to date") );
+  return ( index == xDim ) ? offset_ : 0;
+}
+
+
+
 template<>
 inline
 void
 RectangularGrid<1>::setDimension( const unsigned int xdim )
 {
   Assert( dim == 1, ExcImpossibleInDim(dim) );
-  numNodes_[0] = xdim;
+  globalNumNodes_[0] = xdim;
   updated_ = false;
 }
 
@@ -137,8 +250,8 @@ void
 RectangularGrid<2>::setDimension( const unsigned int xdim, const unsigned int ydim )
 {
   Assert( dim == 2, ExcImpossibleInDim(dim) );
-  numNodes_[0] = xdim;
-  numNodes_[1] = ydim;
+  globalNumNodes_[0] = xdim;
+  globalNumNodes_[1] = ydim;
   updated_ = false;
 }
 
@@ -150,9 +263,9 @@ void
 RectangularGrid<3>::setDimension( const unsigned int xdim, const unsigned int ydim, const unsigned int zdim )
 {
   Assert( dim == 3, ExcImpossibleInDim(dim) );
-  numNodes_[0] = xdim;
-  numNodes_[1] = ydim;
-  numNodes_[2] = zdim;
+  globalNumNodes_[0] = xdim;
+  globalNumNodes_[1] = ydim;
+  globalNumNodes_[2] = zdim;
   updated_ = false;
 }
 
@@ -217,10 +330,36 @@ RectangularGrid<dim>::update()
 {
   Assert( domain_ != 0, ExcMessage("Grid is not attached to any domain") );
 
+  // slab of this process, the remainder of the nodes goes to the first
+  // processes
+  const unsigned int size = mpiSize();
+  const unsigned int rank = mpiRank();
+  const unsigned int n = globalNumNodes_[0];
+
   for( unsigned int i = 0; i < dim; i++ )
+    numNodes_[i] = globalNumNodes_[i];
+  numNodes_[0] = n/size + ( rank < n%size ? 1 : 0 );
+  offset_ = rank*(n/size) + std::min( rank, n%size );
+  AssertThrow( numNodes_[0] >= 2*ghostLayers,
+      ExcMessage("Too few grid nodes in x for the number of processes") );
+
+  lowerNeighbour_ = ( rank > 0 ) ? (int)rank - 1 : -1;
+  upperNeighbour_ = ( rank + 1 < size ) ? (int)rank + 1 : -1;
+  if ( boundaryCondition_ == periodicBoundary && size > 1 )
   {
-    Assert( numNodes_[i] != 0, ExcZero() );
-    spatialStep_[i] = domain_->size( i ) / ( numNodes_[i] - 1 );
+    if ( rank == 0 )
+      lowerNeighbour_ = size - 1;
+    if ( rank == size - 1 )
+      upperNeighbour_ = 0;
+  }
+
+  for( unsigned int i = 0; i < dim; i++ )
+  {
+    Assert( globalNumNodes_[i] != 0, ExcZero() );
+    if ( boundaryCondition_ == periodicBoundary || boundaryCondition_ == dirichletBoundary )
+      spatialStep_[i] = domain_->size( i ) / globalNumNodes_[i];
+    else
+      spatialStep_[i] = domain_->size( i ) / ( globalNumNodes_[i] - 1 );
     spatialStepInv_[i] = 1.0 / spatialStep_[i];
     spatialStepPow2Inv_[i] = 1.0 / (spatialStep_[i]*spatialStep_[i]);
     spatialStepPow4Inv_[i] = 1.0 / (spatialStep_[i]*spatialStep_[i]*spatialStep_[i]*spatialStep_[i]);
@@ -240,7 +379,9 @@ RectangularGrid<dim>::operator () ( const unsigned int xindex ) const
   Assert( updated_ == true, ExcMessage("Grid is not up to date") );
   Assert( xindex < numNodes_[0], ExcIndexRange( xindex, 0, numNodes_[0] ) );
 
-  return Point<dim>( domain_->minExtent(0) + xindex*spatialStep_[0] );
+  const realtype shift = isCellCentred() ? 0.5 : 0.0;
+
+  return Point<dim>( domain_->minExtent(0) + (offset_ + xindex + shift)*spatialStep_[0] );
 }
 
 
@@ -255,8 +396,10 @@ RectangularGrid<dim>::operator () ( const unsigned int xindex, const unsigned in
   Assert( xindex < numNodes_[0], ExcIndexRange( xindex, 0, numNodes_[0] ) );
   Assert( yindex < numNodes_[1], ExcIndexRange( yindex, 0, numNodes_[1] ) );
 
-  return Point<dim>( domain_->minExtent(0) + xindex*spatialStep_[0],
-                     domain_->minExtent(1) + yindex*spatialStep_[1] );
+  const realtype shift = isCellCentred() ? 0.5 : 0.0;
+
+  return Point<dim>( domain_->minExtent(0) + (offset_ + xindex + shift)*spatialStep_[0],
+                     domain_->minExtent(1) + (yindex + shift)*spatialStep_[1] );
 }
 
 
@@ -272,9 +415,11 @@ RectangularGrid<dim>::operator () ( const unsigned int xindex, const unsigned in
   Assert( yindex < numNodes_[1], ExcIndexRange( yindex, 0, numNodes_[1] ) );
   Assert( zindex < numNodes_[2], ExcIndexRange( zindex, 0, numNodes_[2] ) );
 
-  return Point<dim>( domain_->minExtent(0) + xindex*spatialStep_[0],
-                     domain_->minExtent(1) + yindex*spatialStep_[1],
-                     domain_->minExtent(2) + zindex*spatialStep_[2] );
+  const realtype shift = isCellCentred() ? 0.5 : 0.0;
+
+  return Point<dim>( domain_->minExtent(0) + (offset_ + xindex + shift)*spatialStep_[0],
+                     domain_->minExtent(1) + (yindex + shift)*spatialStep_[1],
+                     domain_->minExtent(2) + (zindex + shift)*spatialStep_[2] );
 }
 
 
@@ -294,6 +439,21 @@ RectangularGrid<dim>::numberOfNodes() const
 
 
 
+template<int dim>
+inline
+unsigned int
+RectangularGrid<dim>::numberOfGlobalNodes() const
+{
+  Assert( updated_ == true, ExcMessage("Grid is not up to date") );
+
+  unsigned int num = 1;
+  for( int i = 0; i < dim; i++ )
+    num *= globalNumNodes_[i];
+  return num;
+}
+
+
+
 template<int dim>
 inline
 unsigned int
@@ -339,6 +499,344 @@ RectangularGrid<dim>::nodeIndex( const unsigned int xindex, const unsigned int y
 
 
 
+template<int dim>
+inline
+BoundaryCondition
+RectangularGrid<dim>::boundaryCondition() const
+{
+  return boundaryCondition_;
+}
+
+
+
+// Boundary condition for quantities derived from the solution, such as the
+// chemical potential or the mobility. These are periodic with a periodic
+// solution, otherwise they satisfy the no-flux (Neumann) condition.
+template<int dim>
+inline
+BoundaryCondition
+RectangularGrid<dim>::auxiliaryBoundaryCondition() const
+{
+  return ( boundaryCondition_ == periodicBoundary ) ? periodicBoundary : neumannBoundary;
+}
+
+
+
+template<int dim>
+inline
+realtype
+RectangularGrid<dim>::boundaryValue() const
+{
+  return boundaryValue_;
+}
+
+
+
+// The nodes lie at the centres of the cells under Dirichlet condition, see
+// BoundaryCondition, otherwise the first one lies at the lower extent.
+template<int dim>
+inline
+bool
+RectangularGrid<dim>::isCellCentred() const
+{
+  return boundaryCondition_ == dirichletBoundary;
+}
+
+
+
+template<int dim>
+inline
+void
+RectangularGrid<dim>::setBoundaryCondition( const BoundaryCondition bc, const realtype value )
+{
+  boundaryCondition_ = bc;
+  boundaryValue_ = value;
+  updated_ = false;
+}
+
+
+
+template<int dim>
+inline
+unsigned int
+RectangularGrid<dim>::paddedDimension( const unsigned int index ) const
+{
+  Assert( index < dim, ExcIndexRange( index, 0, dim ) );
+  Assert( updated_ == true, ExcMessage("Grid is not up to date") );
+
+  return numNodes_[index] + 2*ghostLayers;
+}
+
+
+
+template<int dim>
+inline
+unsigned int
+RectangularGrid<dim>::numberOfPaddedNodes() const
+{
+  Assert( updated_ == true, ExcMessage("Grid is not up to date") );
+
+  unsigned int num = 1;
+  for( int i = 0; i < dim; i++ )
+    num *= numNodes_[i] + 2*ghostLayers;
+  return num;
+}
+
+
+
+// Index of node (xindex,yindex) in padded storage. The nodes in the domain
+// have the same indices as in nodeIndex(), the ghost nodes have indices from
+// -ghostLayers to -1 and from n to n+ghostLayers-1.
+template<int dim>
+inline
+unsigned int
+RectangularGrid<dim>::paddedNodeIndex( const int xindex, const int yindex ) const
+{
+  Assert( updated_ == true, ExcMessage("Grid is not up to date") );
+  Assert( dim == 2, ExcImpossibleInDim(dim) );
+  Assert( xindex + (int)ghostLayers >= 0 && xindex < (int)(numNodes_[0] + ghostLayers),
+      ExcIndexRange( xindex, -(int)ghostLayers, numNodes_[0] + ghostLayers ) );
+  Assert( yindex + (int)ghostLayers >= 0 && yindex < (int)(numNodes_[1] + ghostLayers),
+      ExcIndexRange( yindex, -(int)ghostLayers, numNodes_[1] + ghostLayers ) );
+
+  return ( xindex + ghostLayers )*( numNodes_[1] + 2*ghostLayers ) + yindex + ghostLayers;
+}
+
+
+
+// Node inside the domain that the ghost node with the given index in
+// direction d mirrors: under Neumann condition it takes its value, under
+// Dirichlet condition the value 2g - u of it, under periodic condition it is
+// the same node. On the cell-centred grid of the Dirichlet condition the
+// mirror is the boundary face instead of the boundary node, also for the
+// Neumann condition of the auxiliary quantities. Indices inside the domain
+// are returned unchanged, and so are the indices of ghost nodes that belong
+// to the slab of a neighbouring process.
+template<int dim>
+inline
+int
+RectangularGrid<dim>::boundaryImage( const int index, const unsigned int d, const BoundaryCondition bc ) const
+{
+  Assert( d < dim, ExcIndexRange( d, 0, dim ) );
+
+  const int n = numNodes_[d];
+
+  if ( d == xDim && ( ( index < 0 && lowerNeighbour_ >= 0 ) || ( index >= n && upperNeighbour_ >= 0 ) ) )
+    return index;
+  if ( index < 0 )
+    return ( bc == periodicBoundary ) ? index + n : ( isCellCentred() ? -index - 1 : -index );
+  if ( index >= n )
+    return ( bc == periodicBoundary ) ? index - n : ( isCellCentred() ? 2*n - 1 - index : 2*(n-1) - index );
+  return index;
+}
+
+
+
+template<int dim>
+inline
+void
+RectangularGrid<dim>::copyToPadded( const realtype * v, realtype * padded ) const
+{
+  Assert( updated_ == true, ExcMessage("Grid is not up to date") );
+  Assert( dim == 2, ExcImpossibleInDim(dim) );
+
+  for ( unsigned int x = 0; x < numNodes_[0]; x++ )
+    std::copy( v + nodeIndex(x,0), v + nodeIndex(x,0) + numNodes_[1],
+        padded + paddedNodeIndex(x,0) );
+}
+
+
+
+template<int dim>
+inline
+void
+RectangularGrid<dim>::fillGhostLayers( realtype * padded ) const
+{
+  fillGhostLayers( padded, boundaryCondition_ );
+}
+
+
+
+template<int dim>
+inline
+void
+RectangularGrid<dim>::fillGhostLayers( realtype * padded, const BoundaryCondition bc ) const
+{
+  MpiRequests requests;
+  beginFillGhostLayers( padded, bc, requests );
+  endFillGhostLayers( padded, bc, requests );
+}
+
+
+
+// The ghost nodes along y are filled row by row, then the ghost rows along
+// x are copied including their ghost nodes, which takes care of the corners.
+// The work is proportional to the perimeter of the grid. Ghost rows at the
+// sides shared with a neighbouring slab are received from its process: the
+// exchange is started here and endFillGhostLayers() completes it, the rows
+// from ghostLayers to n-ghostLayers-1 can be worked on in between.
+template<int dim>
+inline
+void
+RectangularGrid<dim>::beginFillGhostLayers( realtype * padded, const BoundaryCondition bc,
+    MpiRequests & requests ) const
+{
+  Assert( updated_ == true, ExcMessage("Grid is not up to date") );
+  Assert( dim == 2, ExcImpossibleInDim(dim) );
+
+  const int xdim = numNodes_[0];
+  const int ydim = numNodes_[1];
+  const int g = ghostLayers;
+  const unsigned int rowLength = ydim + 2*g;
+
+  for ( int x = 0; x < xdim; x++ )
+  {
+    realtype * const row = padded + paddedNodeIndex(x,0);
+    for ( int k = 1; k <= g; k++ )
+    {
+      if ( bc == dirichletBoundary )
+      {
+        row[-k] = 2.0*boundaryValue_ - row[boundaryImage( -k, yDim, bc )];
+        row[ydim-1+k] = 2.0*boundaryValue_ - row[boundaryImage( ydim-1+k, yDim, bc )];
+      }
+      else
+      {
+        row[-k] = row[boundaryImage( -k, yDim, bc )];
+        row[ydim-1+k] = row[boundaryImage( ydim-1+k, yDim, bc )];
+      }
+    }
+  }
+
+  beginExchangeWithNeighbours( padded + paddedNodeIndex(0,-g), padded + paddedNodeIndex(-g,-g),
+      padded + paddedNodeIndex(xdim-g,-g), padded + paddedNodeIndex(xdim,-g), g*rowLength,
+      requests );
+}
+
+
+
+template<int dim>
+inline
+void
+RectangularGrid<dim>::endFillGhostLayers( realtype * padded, const BoundaryCondition bc,
+    MpiRequests & requests ) const
+{
+  const int xdim = numNodes_[0];
+  const int ydim = numNodes_[1];
+  const int g = ghostLayers;
+  const unsigned int rowLength = ydim + 2*g;
+
+  endExchangeWithNeighbours( requests );
+
+  for ( int k = 1; k <= g; k++ )
+  {
+    realtype * const lower = padded + paddedNodeIndex(-k,-g);
+    realtype * const upper = padded + paddedNodeIndex(xdim-1+k,-g);
+    if ( bc == dirichletBoundary )
+    {
+      if ( lowerNeighbour_ < 0 )
+      {
+        const realtype * const lowerImage = padded + paddedNodeIndex( boundaryImage( -k, xDim, bc ), -g );
+        for ( unsigned int i = 0; i < rowLength; i++ )
+          lower[i] = 2.0*boundaryValue_ - lowerImage[i];
+      }
+      if ( upperNeighbour_ < 0 )
+      {
+        const realtype * const upperImage = padded + paddedNodeIndex( boundaryImage( xdim-1+k, xDim, bc ), -g );
+        for ( unsigned int i = 0; i < rowLength; i++ )
+          upper[i] = 2.0*boundaryValue_ - upperImage[i];
+      }
+    }
+    else
+    {
+      if ( lowerNeighbour_ < 0 )
+      {
+        const realtype * const lowerImage = padded + paddedNodeIndex( boundaryImage( -k, xDim, bc ), -g );
+        std::copy( lowerImage, lowerImage + rowLength, lower );
+      }
+      if ( upperNeighbour_ < 0 )
+      {
+        const realtype * const upperImage = padded + paddedNodeIndex( boundaryImage( xdim-1+k, xDim, bc ), -g );
+        std::copy( upperImage, upperImage + rowLength, upper );
+      }
+    }
+  }
+}
+
+
+
+template<int dim>
+inline
+bool
+RectangularGrid<dim>::isDistributed() const
+{
+  return lowerNeighbour_ >= 0 || upperNeighbour_ >= 0;
+}
+
+
+
+template<int dim>
+inline
+bool
+RectangularGrid<dim>::hasLowerNeighbour() const
+{
+  return lowerNeighbour_ >= 0;
+}
+
+
+
+template<int dim>
+inline
+bool
+RectangularGrid<dim>::hasUpperNeighbour() const
+{
+  return upperNeighbour_ >= 0;
+}
+
+
+
+// Sends count values from sendLower and sendUpper to the processes owning
+// the lower and upper neighbouring slabs and receives count values from them
+// to recvLower and recvUpper. Sides without a neighbour are left alone.
+template<int dim>
+inline
+void
+RectangularGrid<dim>::exchangeWithNeighbours( const realtype * sendLower, realtype * recvLower,
+    const realtype * sendUpper, realtype * recvUpper, const unsigned int count ) const
+{
+  if ( isDistributed() )
+    mpiExchange( lowerNeighbour_, sendLower, recvLower, upperNeighbour_, sendUpper, recvUpper, count );
+}
+
+
+
+template<int dim>
+inline
+void
+RectangularGrid<dim>::beginExchangeWithNeighbours( const realtype * sendLower, realtype * recvLower,
+    const realtype * sendUpper, realtype * recvUpper, const unsigned int count,
+    MpiRequests & requests ) const
+{
+  if ( isDistributed() )
+    mpiStartExchange( lowerNeighbour_, sendLower, recvLower, upperNeighbour_, sendUpper, recvUpper,
+        count, requests );
+}
+
+
+
+template<int dim>
+inline
+void
+RectangularGrid<dim>::endExchangeWithNeighbours( MpiRequests & requests ) const
+{
+  if ( isDistributed() )
+  {
+    ODEITY_PROBE( "halo exchange" );
+    mpiFinishExchange( requests );
+  }
+}
+
+
+
 template<int dim>
 void
 RectangularGrid<dim>::declareParameters( ParameterHandler &prm )
@@ -352,6 +850,9 @@ RectangularGrid<dim>::declareParameters( ParameterHandler &prm )
     if ( dim == 3 )
         prm.declare_entry( "z-dimension", "100", Patterns::Integer(), "Number of grid nodes in z" );
 
+    prm.declare_entry( "boundary condition", "Neumann", Patterns::Selection("Neumann|Periodic|Dirichlet"), "Boundary condition on all sides of the domain" );
+    prm.declare_entry( "boundary value", "0.0", Patterns::Double(), "Value of the Dirichlet boundary condition" );
+
     prm.leave_subsection();
 }
 
@@ -386,6 +887,14 @@ RectangularGrid<dim>::getParameters( ParameterHandler &prm )
     setDimension( xdim, ydim, zdim );
   }
 
+  const std::string bc = prm.get( "boundary condition" );
+  if ( bc == "Periodic" )
+    setBoundaryCondition( periodicBoundary );
+  else if ( bc == "Dirichlet" )
+    setBoundaryCondition( dirichletBoundary, prm.get_double( "boundary value" ) );
+  else
+    setBoundaryCondition( neumannBoundary );
+
   prm.leave_subsection();
 }
 
@@ -409,7 +918,7 @@ RectangularGrid<dim>::printInfo() const
     logger << "[ ";
     for( unsigned int i = 0; i < dim ; i++ )
     {
-      logger << numNodes_[i];
+      logger << globalNumNodes_[i];
       if ( i != dim - 1 )
         logger << ", ";
     }
@@ -423,6 +932,15 @@ RectangularGrid<dim>::printInfo() const
         logger << ", ";
     }
     logger << " ]" << endl;
+    if ( mpiSize() > 1 )
+      logger << "*Processes*:: " << mpiSize() << " (slabs along x)" << endl;
+    logger << "*Boundary condition*:: ";
+    if ( boundaryCondition_ == periodicBoundary )
+      logger << "periodic" << endl;
+    else if ( boundaryCondition_ == dirichletBoundary )
+      logger << "Dirichlet, value " << boundaryValue_ << endl;
+    else
+      logger << "Neumann" << endl;
   }
   else
   {
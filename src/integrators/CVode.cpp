@@ -1,21 +1,154 @@
 #include "CVode.h"
+#include "SparsePreconditioner.h"
 #include "../odesystem/ExplicitOde.h"
+#include "../odesystem/JacobianMatrix.h"
+#include "../utils/AlignedMemory.h"
 #include "../utils/Vector.h"
 #include "../utils/LogStream.h"
+#include "../utils/MpiUtilities.h"
+#include "../utils/Profiler.h"
+#include "../utils/SerialVectorView.h"
+#include "../utils/Timer.h"
 
 #include <cvode/cvode.h>                  /* main integrator header file */
 #include <cvode/cvode_spgmr.h>            /* prototypes & constants for CVSPGMR solver */
 #include <cvode/cvode_spbcgs.h>           /* prototypes & constants for CVSPBCG solver */
 #include <cvode/cvode_sptfqmr.h>          /* prototypes & constants for CVSTFQMR solver */
 #include <cvode/cvode_bandpre.h>
+#include <cvode/cvode_bbdpre.h>
+#include <cvode/cvode_dense.h>            /* prototypes & constants for CVDENSE solver */
+#include <cvode/cvode_band.h>             /* prototypes & constants for CVBAND solver */
+#if SUNDIALS_BLAS_LAPACK
+#include <cvode/cvode_lapack.h>           /* CVLapackDense and CVLapackBand */
+#endif
+
+#include <cstdlib>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+#ifdef ODEITY_WITH_INSTRUMENTATION
+#include <cvode_impl.h>
+#include <map>
+#include <utility>
+#endif
+
+
+// Serial N_Vector sharing the data of the part of an N_Vector owned by this
+// process, which is what Vector can wrap. Without MPI the N_Vectors are
+// serial and are used directly. The callbacks below wrap up to five vectors
+// per call, so the view is a SerialVectorView in the object, on the stack of
+// the callback, and no memory is allocated.
+class LocalPart
+{
+    public:
+#ifdef ODEITY_WITH_MPI
+        explicit LocalPart( N_Vector nv )
+            :
+                view_( NV_DATA_P( nv ), NV_LOCLENGTH_P( nv ) )
+        {}
+
+        operator N_Vector () { return view_; }
+#else
+        explicit LocalPart( N_Vector nv )
+            :
+                nv_( nv )
+        {}
+
+        operator N_Vector () { return nv_; }
+#endif
+
+    private:
+#ifdef ODEITY_WITH_MPI
+        SerialVectorView view_;
+#else
+        N_Vector nv_;
+#endif
+
+        LocalPart( const LocalPart& );
+        LocalPart& operator = ( const LocalPart& );
+};
+
+
+
+// CVODE allocates its work vectors (the Nordsieck history, the weights,
+// the corrections and the Krylov basis) by cloning the N_Vector of the
+// state. Its operations are replaced by these, which take the data from
+// allocateAligned(); the clones copy the operations, so they are used for
+// all the vectors down the line. No exception may pass through CVODE, a
+// failed allocation returns 0, which CVODE reports as CV_MEM_FAIL.
+#ifdef ODEITY_WITH_MPI
+static N_Vector
+cloneAligned( N_Vector w )
+{
+    N_Vector v = N_VCloneEmpty_Parallel( w );
+    if ( v == 0 )
+        return 0;
+    try
+    {
+        NV_DATA_P( v ) = allocateAligned( NV_LOCLENGTH_P( w ) );
+    }
+    catch ( ... )
+    {
+        N_VDestroy_Parallel( v );
+        return 0;
+    }
+    NV_OWN_DATA_P( v ) = TRUE;
+    return v;
+}
+
+
+
+static void
+destroyAligned( N_Vector v )
+{
+    if ( NV_OWN_DATA_P( v ) )
+        freeAligned( NV_DATA_P( v ) );
+    NV_OWN_DATA_P( v ) = FALSE;
+    N_VDestroy_Parallel( v );
+}
+#else
+static N_Vector
+cloneAligned( N_Vector w )
+{
+    N_Vector v = N_VCloneEmpty_Serial( w );
+    if ( v == 0 )
+        return 0;
+    try
+    {
+        NV_DATA_S( v ) = allocateAligned( NV_LENGTH_S( w ) );
+    }
+    catch ( ... )
+    {
+        N_VDestroy_Serial( v );
+        return 0;
+    }
+    NV_OWN_DATA_S( v ) = TRUE;
+    return v;
+}
+
+
+
+static void
+destroyAligned( N_Vector v )
+{
+    if ( NV_OWN_DATA_S( v ) )
+        freeAligned( NV_DATA_S( v ) );
+    NV_OWN_DATA_S( v ) = FALSE;
+    N_VDestroy_Serial( v );
+}
+#endif
+
 
 
 extern "C"
 int ExplicitOdeRhs( double t, N_Vector nvY, N_Vector nvYdot, void * f_data )
 {
-    Vector<realtype> y( nvY );
-    Vector<realtype> ydot( nvYdot );
-    ExplicitOde * explicitOde = ( ExplicitOde * ) f_data;
+    LocalPart localY( nvY );
+    LocalPart localYdot( nvYdot );
+    Vector<realtype> y( localY );
+    Vector<realtype> ydot( localYdot );
+    ExplicitOde * explicitOde = ( ( CVodeUserData * ) f_data )->ode;
 
     return explicitOde->rhs( t, y , ydot );
 }
@@ -27,18 +160,132 @@ int ExplicitOdeJacobian( N_Vector nvV, N_Vector nvJv,
         realtype t, N_Vector nvY, N_Vector nvFy,
         void *jac_data, N_Vector nvTmp )
 {
-    Vector<realtype> v( nvV );
-    Vector<realtype> Jv( nvJv );
-    Vector<realtype> y( nvY );
-    Vector<realtype> fy( nvFy );
-    Vector<realtype> tmp( nvTmp );
-    ExplicitOde * explicitOde = ( ExplicitOde * ) jac_data;
+    LocalPart localV( nvV );
+    LocalPart localJv( nvJv );
+    LocalPart localY( nvY );
+    LocalPart localFy( nvFy );
+    LocalPart localTmp( nvTmp );
+    Vector<realtype> v( localV );
+    Vector<realtype> Jv( localJv );
+    Vector<realtype> y( localY );
+    Vector<realtype> fy( localFy );
+    Vector<realtype> tmp( localTmp );
+    ExplicitOde * explicitOde = ( ( CVodeUserData * ) jac_data )->ode;
 
     return explicitOde->jacobian( v, Jv, t, y, fy, tmp );
 }
 
 
 
+// Local right hand side for the BBD preconditioner. It is the full right
+// hand side, whose halo exchange is collective. That is safe because the
+// preconditioner evaluates it the same number of times on all processes,
+// given by the bandwidths, so no separate communication function is needed.
+extern "C"
+int ExplicitOdeLocalRhs( int nLocal, realtype t, N_Vector nvY, N_Vector nvG, void * f_data )
+{
+    return ExplicitOdeRhs( t, nvY, nvG, f_data );
+}
+
+
+
+// The Jacobian matrix is saved by the preconditioner, jok tells whether it
+// may be reused.
+extern "C"
+int ExplicitOdePrecSetup( realtype t, N_Vector nvY, N_Vector nvFy, booleantype jok,
+        booleantype * jcurPtr, realtype gamma, void * user_data,
+        N_Vector nvTmp1, N_Vector nvTmp2, N_Vector nvTmp3 )
+{
+    LocalPart localY( nvY );
+    LocalPart localFy( nvFy );
+    Vector<realtype> y( localY );
+    Vector<realtype> fy( localFy );
+    CVodeUserData * data = ( CVodeUserData * ) user_data;
+
+    bool jacobianCurrent;
+    const int flag = data->preconditioner->setup( *data->ode, t, y, fy, jok, jacobianCurrent, gamma );
+    *jcurPtr = jacobianCurrent ? TRUE : FALSE;
+
+    return flag;
+}
+
+
+
+extern "C"
+int ExplicitOdePrecSolve( realtype t, N_Vector nvY, N_Vector nvFy, N_Vector nvR, N_Vector nvZ,
+        realtype gamma, realtype delta, int lr, void * user_data, N_Vector nvTmp )
+{
+    LocalPart localR( nvR );
+    LocalPart localZ( nvZ );
+    Vector<realtype> r( localR );
+    Vector<realtype> z( localZ );
+    CVodeUserData * data = ( CVodeUserData * ) user_data;
+
+    data->preconditioner->solve( r.data(), z.data() );
+
+    return 0;
+}
+
+
+
+extern "C"
+int ExplicitOdeDenseJacobian( int N, realtype t, N_Vector nvY, N_Vector nvFy, DlsMat Jac,
+        void * jac_data, N_Vector nvTmp1, N_Vector nvTmp2, N_Vector nvTmp3 )
+{
+    LocalPart localY( nvY );
+    LocalPart localFy( nvFy );
+    Vector<realtype> y( localY );
+    Vector<realtype> fy( localFy );
+    JacobianMatrix J( Jac );
+    ExplicitOde * explicitOde = ( ( CVodeUserData * ) jac_data )->ode;
+
+    return explicitOde->jacobianMatrix( t, y, fy, J );
+}
+
+
+
+extern "C"
+int ExplicitOdeBandJacobian( int N, int mupper, int mlower, realtype t, N_Vector nvY, N_Vector nvFy,
+        DlsMat Jac, void * jac_data, N_Vector nvTmp1, N_Vector nvTmp2, N_Vector nvTmp3 )
+{
+    return ExplicitOdeDenseJacobian( N, t, nvY, nvFy, Jac, jac_data, nvTmp1, nvTmp2, nvTmp3 );
+}
+
+
+
+#ifdef ODEITY_WITH_INSTRUMENTATION
+// CVODE has no hooks around its linear solver, so the setup and solve
+// functions of the attached solver are replaced in the integrator memory
+// by wrappers timing them. The original functions are kept per integrator.
+typedef int (*LinearSetup)( CVodeMem, int, N_Vector, N_Vector, booleantype *,
+        N_Vector, N_Vector, N_Vector );
+typedef int (*LinearSolve)( CVodeMem, N_Vector, N_Vector, N_Vector, N_Vector );
+
+static std::map<CVodeMem, std::pair<LinearSetup, LinearSolve> > linearSolvers;
+
+
+
+static int
+profiledLinearSetup( CVodeMem cvodeMem, int convfail, N_Vector ypred, N_Vector fpred,
+        booleantype * jcurPtr, N_Vector vtemp1, N_Vector vtemp2, N_Vector vtemp3 )
+{
+    ODEITY_PROBE( "linear setup" );
+    return linearSolvers[cvodeMem].first( cvodeMem, convfail, ypred, fpred, jcurPtr,
+            vtemp1, vtemp2, vtemp3 );
+}
+
+
+
+static int
+profiledLinearSolve( CVodeMem cvodeMem, N_Vector b, N_Vector weight, N_Vector ycur, N_Vector fcur )
+{
+    ODEITY_PROBE( "linear solve" );
+    return linearSolvers[cvodeMem].second( cvodeMem, b, weight, ycur, fcur );
+}
+#endif
+
+
+
 OdeIntegratorBase * createCVodeGMRESSolver()
 {
     return new CVodeGMRES();
@@ -60,23 +307,84 @@ OdeIntegratorBase * createCVodeTFQMRSolver()
 
 
 
+OdeIntegratorBase * createCVodeBandSolver()
+{
+    return new CVodeBand();
+}
+
+
+
+OdeIntegratorBase * createCVodeDenseSolver()
+{
+    return new CVodeDense();
+}
+
+
+
+OdeIntegratorBase * createCVodeAdamsSolver()
+{
+    return new CVodeAdams();
+}
+
+
+
+// Comma separated list of numbers.
+static std::vector<realtype>
+parseList( const std::string & list )
+{
+    std::vector<realtype> values;
+    std::istringstream in( list );
+    realtype value;
+    while ( in >> value )
+    {
+        values.push_back( value );
+        char comma;
+        in >> comma;
+    }
+    return values;
+}
+
+
+
 // ------------------------------------------------------------------ CVodeBase
 
-CVodeBase::CVodeBase()
+CVodeBase::CVodeBase( const int multistepMethod, const int iteration )
     :
+        multistepMethod_( multistepMethod ),
+        iteration_( iteration ),
         initialized_( false ),
-        maxNumSteps_( 10000 )
+        nvCurrentState_( 0 ),
+        linearSolverAttached_( false ),
+        maxNumSteps_( 10000 ),
+        maxOrder_( 5 ),
+        initialStep_( 0.0 ),
+        maxStep_( 0.0 ),
+        maxErrTestFails_( 20 ),
+        maxConvFails_( 50 ),
+        nonlinConvCoef_( 0.1 ),
+        stabilityLimitDetection_( false )
 {
-    cvodeMem_ = CVodeCreate( CV_BDF, CV_NEWTON );
+    cvodeMem_ = CVodeCreate( multistepMethod_, iteration_ );
     AssertThrow( cvodeMem_ != 0, ExcCVodeCreateError( "CVodeCreate failed" ) );
+
+    userData_.ode = 0;
+    userData_.preconditioner = 0;
 }
 
 
 
 CVodeBase::~CVodeBase()
 {
+#ifdef ODEITY_WITH_INSTRUMENTATION
+    linearSolvers.erase( ( CVodeMem ) cvodeMem_ );
+#endif
+    // CVodeFree also frees the vectors allocated by CVodeInit
     if ( initialized_ )
         CVodeFree( &cvodeMem_ );
+    else
+        free( cvodeMem_ );
+    if ( nvCurrentState_ != 0 )
+        N_VDestroy( nvCurrentState_ );
 }
 
 
@@ -84,18 +392,31 @@ CVodeBase::~CVodeBase()
 void
 CVodeBase::integrateTo( const realtype tOut )
 {
-    if ( saveHistory() )
+    ODEITY_PROBE( "CVode" );
+
+    // Single steps up to tOut and the interpolation back to it take the
+    // same steps as CV_NORMAL, so the results do not depend on whether the
+    // steps are recorded.
+    if ( recordSteps() )
     {
-        int flag = CVodeSetStopTime( cvodeMem_, tOut );
+        realtype tn;
+        int flag = CVodeGetCurrentTime( cvodeMem_, &tn );
         AssertThrow( flag == CV_SUCCESS, ExcCVodeError( flag ) );
 
-        while( currentTime_ != tOut )
+        for ( int steps = 0; tn < tOut; steps++ )
         {
-            flag = CVode( cvodeMem_, tOut, nvCurrentState_, &currentTime_, CV_ONE_STEP );
-            AssertThrow( flag == CV_SUCCESS || flag == CV_TSTOP_RETURN, ExcCVodeError( flag ) );
+            AssertThrow( steps < maxNumSteps_, ExcCVodeError( CV_TOO_MUCH_WORK ) );
+
+            flag = CVode( cvodeMem_, tOut, nvCurrentState_, &tn, CV_ONE_STEP );
+            AssertThrow( flag == CV_SUCCESS, ExcCVodeError( flag ) );
 
-            updateHistory();
+            currentTime_ = tn;
+            stepTaken();
         }
+
+        flag = CVodeGetDky( cvodeMem_, tOut, 0, nvCurrentState_ );
+        AssertThrow( flag == CV_SUCCESS, ExcCVodeError( flag ) );
+        currentTime_ = tOut;
     }
     else
     {
@@ -106,6 +427,25 @@ CVodeBase::integrateTo( const realtype tOut )
 
 
 
+// Called after a linear solver has been attached, records the time spent
+// in its setup and solve functions.
+void
+CVodeBase::instrumentLinearSolver()
+{
+#ifdef ODEITY_WITH_INSTRUMENTATION
+    CVodeMem cvodeMem = ( CVodeMem ) cvodeMem_;
+    if ( cvodeMem->cv_lsolve == profiledLinearSolve )
+        return;
+
+    linearSolvers[cvodeMem] = std::make_pair( cvodeMem->cv_lsetup, cvodeMem->cv_lsolve );
+    if ( cvodeMem->cv_lsetup != 0 )
+        cvodeMem->cv_lsetup = profiledLinearSetup;
+    cvodeMem->cv_lsolve = profiledLinearSolve;
+#endif
+}
+
+
+
 void
 CVodeBase::setRelativeTolerance( realtype relTol )
 {
@@ -134,31 +474,84 @@ CVodeBase::assignExplicitOde(
         const realtype initialTime,
         const Vector<realtype> &initialState )
 {
+    const long int previousLength = currentState_.size();
     OdeIntegratorBase::assignExplicitOde( odeProblem, initialTime, initialState );
 
-    nvCurrentState_ = N_VMake_Serial( currentState_.size(), currentState_.data() );
+    // A problem of the same size on all processes reuses the memory of
+    // CVODE, including the linear solver and its workspace. The vector of
+    // the state may have been reallocated, the N_Vector is pointed to it.
+    const long int localLength = currentState_.size();
+    const bool sameSize = mpiMin( realtype( localLength == previousLength ) ) > 0.0;
 
-    if ( initialized_ )
-        CVodeFree( &cvodeMem_ );
+    if ( initialized_ && sameSize )
+    {
+        N_VSetArrayPointer( currentState_.data(), nvCurrentState_ );
 
-    int flag = CVodeInit( cvodeMem_, ExplicitOdeRhs, currentTime_, nvCurrentState_ );
-    AssertThrow( flag == CV_SUCCESS, ExcCVodeInitError( flag ) );
-    initialized_ = true;
+        int flag = CVodeReInit( cvodeMem_, currentTime_, nvCurrentState_ );
+        AssertThrow( flag == CV_SUCCESS, ExcCVodeReInitError( flag ) );
+    }
+    else
+    {
+        if ( initialized_ )
+        {
+#ifdef ODEITY_WITH_INSTRUMENTATION
+            linearSolvers.erase( ( CVodeMem ) cvodeMem_ );
+#endif
+            CVodeFree( &cvodeMem_ );
+            cvodeMem_ = CVodeCreate( multistepMethod_, iteration_ );
+            AssertThrow( cvodeMem_ != 0, ExcCVodeCreateError( "CVodeCreate failed" ) );
+            linearSolverAttached_ = false;
+        }
+        if ( nvCurrentState_ != 0 )
+            N_VDestroy( nvCurrentState_ );
+
+#ifdef ODEITY_WITH_MPI
+        nvCurrentState_ = N_VMake_Parallel( mpiCommunicator(), localLength, mpiSum( localLength ),
+                currentState_.data() );
+#else
+        nvCurrentState_ = N_VMake_Serial( localLength, currentState_.data() );
+#endif
+        nvCurrentState_->ops->nvclone = cloneAligned;
+        nvCurrentState_->ops->nvdestroy = destroyAligned;
+
+        int flag = CVodeInit( cvodeMem_, ExplicitOdeRhs, currentTime_, nvCurrentState_ );
+        AssertThrow( flag == CV_SUCCESS, ExcCVodeInitError( flag ) );
+        initialized_ = true;
+    }
 
     setRelativeTolerance( relTol_ );
     setAbsoluteTolerance( absTol_ );
 
-    flag = CVodeSetUserData( cvodeMem_, (void*) odeProblem_ );
+    userData_.ode = odeProblem_;
+    int flag = CVodeSetUserData( cvodeMem_, (void*) &userData_ );
     Assert( flag == CV_SUCCESS, ExcCVodeSetUserDataError( flag ) );
 
     flag = CVodeSetMaxNumSteps( cvodeMem_, maxNumSteps_ );
     Assert( flag == CV_SUCCESS, ExcMessage("Call to CVodeSetMaxNumSteps failed"));
     
-    flag = CVodeSetMaxErrTestFails( cvodeMem_, 20 );
+    flag = CVodeSetMaxErrTestFails( cvodeMem_, maxErrTestFails_ );
     Assert( flag == CV_SUCCESS, ExcMessage("Call to CVodeSetMaxErrTestFails failed"));
     
-    flag = CVodeSetMaxConvFails( cvodeMem_, 50 );
+    flag = CVodeSetMaxConvFails( cvodeMem_, maxConvFails_ );
     Assert( flag == CV_SUCCESS, ExcMessage("Call to CVodeSetMaxConvFails failed"));
+
+    flag = CVodeSetMaxOrd( cvodeMem_, maxOrder_ );
+    AssertThrow( flag == CV_SUCCESS, ExcMessage("Call to CVodeSetMaxOrd failed"));
+
+    flag = CVodeSetInitStep( cvodeMem_, initialStep_ );
+    Assert( flag == CV_SUCCESS, ExcMessage("Call to CVodeSetInitStep failed"));
+
+    flag = CVodeSetMaxStep( cvodeMem_, maxStep_ );
+    AssertThrow( flag == CV_SUCCESS, ExcMessage("Call to CVodeSetMaxStep failed"));
+
+    flag = CVodeSetNonlinConvCoef( cvodeMem_, nonlinConvCoef_ );
+    Assert( flag == CV_SUCCESS, ExcMessage("Call to CVodeSetNonlinConvCoef failed"));
+
+    if ( multistepMethod_ == CV_BDF )
+    {
+        flag = CVodeSetStabLimDet( cvodeMem_, stabilityLimitDetection_ );
+        AssertThrow( flag == CV_SUCCESS, ExcMessage("Call to CVodeSetStabLimDet failed"));
+    }
 }
 
 
@@ -171,6 +564,20 @@ CVodeBase::declareParameters( ParameterHandler & prm )
     prm.enter_subsection( "ODE integrator" );
     prm.enter_subsection( "CVode" );
         prm.declare_entry( "maximum number of steps", "100000", Patterns::Integer() );
+        prm.declare_entry( "maximum order", "5", Patterns::Integer(),
+                "Maximum order of the BDF formulas, 1 to 5" );
+        prm.declare_entry( "initial step", "0.0", Patterns::Double(),
+                "0 lets CVODE estimate it" );
+        prm.declare_entry( "maximum step", "0.0", Patterns::Double(),
+                "0 for no limit" );
+        prm.declare_entry( "maximum error test failures", "20", Patterns::Integer(),
+                "Per step" );
+        prm.declare_entry( "maximum convergence failures", "50", Patterns::Integer(),
+                "Of the nonlinear solver per step" );
+        prm.declare_entry( "nonlinear convergence coefficient", "0.1", Patterns::Double(),
+                "Safety factor of the Newton iteration relative to the local error test" );
+        prm.declare_entry( "stability limit detection", "false", Patterns::Bool(),
+                "Reduce the order when BDF formulas of order 3 and above become unstable" );
     prm.leave_subsection();
     prm.leave_subsection();
 }
@@ -185,9 +592,18 @@ CVodeBase::getParameters( ParameterHandler & prm )
     prm.enter_subsection( "ODE integrator" );
     prm.enter_subsection( "CVode" );
         maxNumSteps_ = prm.get_integer( "maximum number of steps" );
+        maxOrder_ = prm.get_integer( "maximum order" );
+        initialStep_ = prm.get_double( "initial step" );
+        maxStep_ = prm.get_double( "maximum step" );
+        maxErrTestFails_ = prm.get_integer( "maximum error test failures" );
+        maxConvFails_ = prm.get_integer( "maximum convergence failures" );
+        nonlinConvCoef_ = prm.get_double( "nonlinear convergence coefficient" );
+        stabilityLimitDetection_ = prm.get_bool( "stability limit detection" );
     prm.leave_subsection();
     prm.leave_subsection();
 
+    // the settings of the linear solver may have changed
+    linearSolverAttached_ = false;
 }
 
 
@@ -198,6 +614,15 @@ CVodeBase::printInfo() const
     OdeIntegratorBase::printInfo();
 
     logger << "*Maximum number of steps to t_out*:: " << maxNumSteps_ << std::endl;
+    logger << "*Maximum order*:: " << maxOrder_ << std::endl;
+    if ( initialStep_ > 0.0 )
+        logger << "*Initial step*:: " << initialStep_ << std::endl;
+    if ( maxStep_ > 0.0 )
+        logger << "*Maximum step*:: " << maxStep_ << std::endl;
+    logger << "*Maximum error test failures*:: " << maxErrTestFails_ << std::endl;
+    logger << "*Maximum convergence failures*:: " << maxConvFails_ << std::endl;
+    logger << "*Nonlinear convergence coefficient*:: " << nonlinConvCoef_ << std::endl;
+    logger << "*Stability limit detection*:: " << stabilityLimitDetection_ << std::endl;
 }
 
 
@@ -206,13 +631,26 @@ CVodeBase::printInfo() const
 CVodeSpils::CVodeSpils()
     :
         precond_( false ),
-        krylovSubspaceDim_( 5 )
+        krylovSubspaceDim_( 5 ),
+        epsLin_( 0.05 ),
+        gramSchmidt_( "modified" ),
+        preconditionerType_( "band" ),
+        fillLevel_( 0 ),
+        ordering_( "natural" ),
+        sparsePreconditioner_( 0 ),
+        autoTune_( false ),
+        autoTuned_( false ),
+        autoTuneSteps_( 100 ),
+        autoTuneKrylovDims_( "10, 20, 30, 45" ),
+        autoTuneEpsLins_( "0.05, 0.2, 0.5" )
 {}
 
 
 
 CVodeSpils::~CVodeSpils()
-{}
+{
+    delete sparsePreconditioner_;
+}
 
 
 void
@@ -220,9 +658,141 @@ CVodeSpils::assignExplicitOde(
         ExplicitOde& odeProblem,
         const realtype initialTime,
         const Vector<realtype> &initialState )
+{
+    initialize( odeProblem, initialTime, initialState );
+
+    if ( autoTune_ && not autoTuned_ )
+    {
+        autoTune( initialTime, initialState );
+        autoTuned_ = true;
+    }
+}
+
+
+
+void
+CVodeSpils::initialize(
+        ExplicitOde& odeProblem,
+        const realtype initialTime,
+        const Vector<realtype> &initialState )
 {
     CVodeBase::assignExplicitOde( odeProblem, initialTime, initialState );
     stats_.reset();
+
+    if ( not linearSolverAttached_ )
+    {
+        attachLinearSolver( precond_ ? PREC_RIGHT : PREC_NONE );
+        if ( precond_ )
+            initPreconditioner();
+        instrumentLinearSolver();
+        linearSolverAttached_ = true;
+    }
+    else if ( sparsePreconditioner_ != 0 )
+        sparsePreconditioner_->resetCounters();
+
+    int flag = CVSpilsSetEpsLin( cvodeMem_, epsLin_ );
+    AssertThrow( flag == CVSPILS_SUCCESS, ExcMessage("Call to CVSpilsSetEpsLin failed"));
+
+    // a problem without Jacobian times vector leaves it to difference quotients
+    flag = CVSpilsSetJacTimesVecFn( cvodeMem_, odeProblem_->useJacobian() ? ExplicitOdeJacobian : 0 );
+    Assert( flag == CVSPILS_SUCCESS, ExcMessage("Call to SpilsSetJactimesVecFn failed"));
+}
+
+
+
+// The configured setting takes the given number of steps, which fixes the
+// time of the probe. Then the problem is integrated to that time with each
+// pair of Krylov subspace dimension and linear convergence factor of the
+// lists. The fastest pair is kept and the problem is restarted from the
+// initial state. Candidates that fail do not count. In a distributed run
+// the slowest process decides.
+void
+CVodeSpils::autoTune( const realtype initialTime, const Vector<realtype> & initialState )
+{
+    ODEITY_PROBE( "auto-tune" );
+
+    const std::vector<realtype> dims = parseList( autoTuneKrylovDims_ );
+    const std::vector<realtype> epsLins = parseList( autoTuneEpsLins_ );
+
+    realtype probeTime = initialTime;
+    for ( int step = 0; step < autoTuneSteps_; step++ )
+    {
+        int flag = CVode( cvodeMem_, initialTime + 1.0, nvCurrentState_, &probeTime, CV_ONE_STEP );
+        AssertThrow( flag == CV_SUCCESS, ExcCVodeError( flag ) );
+    }
+
+    int bestDim = krylovSubspaceDim_;
+    realtype bestEpsLin = epsLin_;
+    realtype bestTime = std::numeric_limits<realtype>::max();
+
+    for ( unsigned int i = 0; i < dims.size(); i++ )
+        for ( unsigned int j = 0; j < epsLins.size(); j++ )
+        {
+            krylovSubspaceDim_ = int( dims[i] );
+            epsLin_ = epsLins[j];
+            linearSolverAttached_ = false;
+            initialize( *odeProblem_, initialTime, initialState );
+
+            Timer timer;
+            timer.start();
+            realtype t;
+            const int flag = CVode( cvodeMem_, probeTime, nvCurrentState_, &t, CV_NORMAL );
+            timer.stop();
+
+            const realtype time = mpiMax( realtype( timer.wall_time() ) );
+            const bool failed = mpiMax( realtype( flag < 0 ) ) > 0.0;
+            if ( not failed && time < bestTime )
+            {
+                bestTime = time;
+                bestDim = krylovSubspaceDim_;
+                bestEpsLin = epsLin_;
+            }
+        }
+
+    krylovSubspaceDim_ = bestDim;
+    epsLin_ = bestEpsLin;
+    linearSolverAttached_ = false;
+    initialize( *odeProblem_, initialTime, initialState );
+}
+
+
+
+// The band preconditioner has half-bandwidths 1, in a distributed run it is
+// block diagonal with one band block per process (BBDPRE). The sparse
+// preconditioners factorize the stencil Jacobian of the problem.
+void
+CVodeSpils::initPreconditioner()
+{
+    delete sparsePreconditioner_;
+    sparsePreconditioner_ = 0;
+    userData_.preconditioner = 0;
+
+    if ( preconditionerType_ != "band" )
+    {
+        AssertThrow( odeProblem_->hasSparseJacobian(),
+                ExcMessage("The problem provides no sparse Jacobian for the preconditioner") );
+
+        sparsePreconditioner_ = new SparsePreconditioner(
+                preconditionerType_ == "ILU" ? SparsePreconditioner::incompleteLU
+                    : SparsePreconditioner::lineBlockJacobi,
+                fillLevel_,
+                ordering_ == "natural" ? SparsePreconditioner::naturalOrdering
+                    : SparsePreconditioner::reverseCuthillMcKee );
+        userData_.preconditioner = sparsePreconditioner_;
+
+        int flag = CVSpilsSetPreconditioner( cvodeMem_, ExplicitOdePrecSetup, ExplicitOdePrecSolve );
+        AssertThrow( flag == CVSPILS_SUCCESS, ExcMessage("Call to CVSpilsSetPreconditioner failed") );
+        return;
+    }
+
+#ifdef ODEITY_WITH_MPI
+    int flag = CVBBDPrecInit( cvodeMem_, odeProblem_->numberOfEquations(), 1, 1, 1, 1, 0.0,
+            ExplicitOdeLocalRhs, 0 );
+    AssertThrow( flag == CVSPILS_SUCCESS, ExcMessage("Failed to allocate BBD preconditioner") );
+#else
+    int flag = CVBandPrecInit( cvodeMem_, odeProblem_->numberOfEquations(), 1, 1 );
+    AssertThrow( flag == CVSPILS_SUCCESS, ExcMessage("Failed to allocate BAND preconditioner") );
+#endif
 }
 
 
@@ -231,6 +801,8 @@ IntegratorStatsBase&
 CVodeSpils::stats()
 {
     stats_.update( cvodeMem_ );
+    if ( sparsePreconditioner_ != 0 )
+        stats_.npjevals = sparsePreconditioner_->jacobianEvaluations();
     return stats_;
 }
 
@@ -259,6 +831,22 @@ CVodeSpils::declareParameters( ParameterHandler & prm )
     prm.enter_subsection( "CVodeSpils" );
         prm.declare_entry( "precondition", "false", Patterns::Bool() );
         prm.declare_entry( "Krylov subspace dimension", "30", Patterns::Integer() );
+        prm.declare_entry( "linear convergence factor", "0.05", Patterns::Double(),
+                "Tolerance of the Krylov iteration relative to the one of the Newton iteration" );
+        prm.declare_entry( "Gram-Schmidt", "modified", Patterns::Selection("modified|classical"),
+                "Orthogonalization of GMRES" );
+        prm.declare_entry( "preconditioner", "band", Patterns::Selection("band|ILU|line block Jacobi"),
+                "Band preconditioner of CVODE or a factorization of the stencil Jacobian: "
+                "incomplete LU or exact LU of the grid lines" );
+        prm.declare_entry( "ILU fill level", "0", Patterns::Integer() );
+        prm.declare_entry( "ILU ordering", "natural", Patterns::Selection("natural|reverse Cuthill-McKee") );
+        prm.declare_entry( "auto-tune", "false", Patterns::Bool(),
+                "Choose the Krylov subspace dimension and the linear convergence factor "
+                "by probe integrations of the first problem" );
+        prm.declare_entry( "auto-tune steps", "100", Patterns::Integer(),
+                "Steps of the configured setting that fix the length of the probes" );
+        prm.declare_entry( "auto-tune Krylov subspace dimensions", "10, 20, 30, 45", Patterns::Anything() );
+        prm.declare_entry( "auto-tune linear convergence factors", "0.05, 0.2, 0.5", Patterns::Anything() );
     prm.leave_subsection();
     prm.leave_subsection();
     prm.leave_subsection();
@@ -276,9 +864,20 @@ CVodeSpils::getParameters( ParameterHandler & prm )
     prm.enter_subsection( "CVodeSpils" );
         precond_ = prm.get_bool( "precondition" );
         krylovSubspaceDim_ = prm.get_integer( "Krylov subspace dimension" );
+        epsLin_ = prm.get_double( "linear convergence factor" );
+        gramSchmidt_ = prm.get( "Gram-Schmidt" );
+        preconditionerType_ = prm.get( "preconditioner" );
+        fillLevel_ = prm.get_integer( "ILU fill level" );
+        ordering_ = prm.get( "ILU ordering" );
+        autoTune_ = prm.get_bool( "auto-tune" );
+        autoTuneSteps_ = prm.get_integer( "auto-tune steps" );
+        autoTuneKrylovDims_ = prm.get( "auto-tune Krylov subspace dimensions" );
+        autoTuneEpsLins_ = prm.get( "auto-tune linear convergence factors" );
     prm.leave_subsection();
     prm.leave_subsection();
     prm.leave_subsection();
+
+    autoTuned_ = false;
 }
 
 
@@ -289,7 +888,21 @@ CVodeSpils::printInfo() const
     CVodeBase::printInfo();
 
     logger << "*Maximum dimension of Krylov subspace*:: " << krylovSubspaceDim_ << std::endl;
-    logger << "*Using preconditioning BANDPRE*:: " << precond_ << std::endl;
+    logger << "*Linear convergence factor*:: " << epsLin_ << std::endl;
+    logger << "*Auto-tuned*:: " << autoTuned_ << std::endl;
+    if ( preconditionerType_ == "ILU" )
+    {
+        logger << "*Using preconditioning ILU(" << fillLevel_ << ")*:: " << precond_ << std::endl;
+        logger << "*ILU ordering*:: " << ordering_ << std::endl;
+    }
+    else if ( preconditionerType_ == "line block Jacobi" )
+        logger << "*Using preconditioning line block Jacobi*:: " << precond_ << std::endl;
+    else
+#ifdef ODEITY_WITH_MPI
+        logger << "*Using preconditioning BBDPRE*:: " << precond_ << std::endl;
+#else
+        logger << "*Using preconditioning BANDPRE*:: " << precond_ << std::endl;
+#endif
 }
 
 
@@ -304,33 +917,23 @@ CVodeGMRES::CVodeGMRES()
 
 
 void
-CVodeGMRES::assignExplicitOde( 
-        ExplicitOde& odeProblem,
-        const realtype initialTime,
-        const Vector<realtype> &initialState )
+CVodeGMRES::attachLinearSolver( const int preconditioning )
 {
-    CVodeSpils::assignExplicitOde( odeProblem, initialTime, initialState );
+    int flag = CVSpgmr( cvodeMem_, preconditioning, krylovSubspaceDim_ );
+    AssertThrow( flag == CV_SUCCESS, ExcCVSpgmrError( flag ) );
 
-    if ( not precond_ )
-    {
-        int flag = CVSpgmr( cvodeMem_, PREC_NONE, krylovSubspaceDim_ );
-        AssertThrow( flag == CV_SUCCESS, ExcCVSpgmrError( flag ) );
-    }
-    else
-    {
-        int flag = CVSpgmr( cvodeMem_, PREC_RIGHT, krylovSubspaceDim_ );
-        AssertThrow( flag == CV_SUCCESS, ExcCVSpgmrError( flag ) );
+    flag = CVSpilsSetGSType( cvodeMem_, gramSchmidt_ == "classical" ? CLASSICAL_GS : MODIFIED_GS );
+    AssertThrow( flag == CVSPILS_SUCCESS, ExcMessage("Call to CVSpilsSetGSType failed"));
+}
 
-        flag = CVBandPrecInit( cvodeMem_, odeProblem_->numberOfEquations(), 1, 1 );
-        AssertThrow( flag == CVSPILS_SUCCESS, ExcMessage("Failed to allocate BAND preconditioner") );
-    }
 
-    if ( odeProblem_->useJacobian() )
-    {
-        int flag;
-        flag = CVSpilsSetJacTimesVecFn( cvodeMem_, ExplicitOdeJacobian );
-        Assert( flag == CV_SUCCESS, ExcMessage("Call to SpilsSetJactimesVecFn failed"));
-    }
+
+void
+CVodeGMRES::printInfo() const
+{
+    CVodeSpils::printInfo();
+
+    logger << "*Gram-Schmidt*:: " << gramSchmidt_ << std::endl;
 }
 
 
@@ -345,76 +948,306 @@ CVodeBiCG::CVodeBiCG()
 
 
 void
-CVodeBiCG::assignExplicitOde( 
+CVodeBiCG::attachLinearSolver( const int preconditioning )
+{
+    int flag = CVSpbcg( cvodeMem_, preconditioning, krylovSubspaceDim_ );
+    AssertThrow( flag == CV_SUCCESS, ExcCVSpbcgError( flag ) );
+}
+
+
+
+// ----------------------------------------------------------------- CVodeTFQMR
+
+CVodeTFQMR::CVodeTFQMR()
+{
+    solverName_ = "CVODE with TFQMR";
+}
+
+
+
+void
+CVodeTFQMR::attachLinearSolver( const int preconditioning )
+{
+    int flag = CVSptfqmr( cvodeMem_, preconditioning, krylovSubspaceDim_ );
+    AssertThrow( flag == CV_SUCCESS, ExcCVSptfqmrError( flag ) );
+}
+
+
+
+// ------------------------------------------------------------------- CVodeDls
+
+CVodeDls::CVodeDls()
+    :
+        assembleJacobian_( true )
+{}
+
+
+
+CVodeDls::~CVodeDls()
+{}
+
+
+
+void
+CVodeDls::assignExplicitOde(
         ExplicitOde& odeProblem,
         const realtype initialTime,
         const Vector<realtype> &initialState )
 {
-    CVodeSpils::assignExplicitOde( odeProblem, initialTime, initialState );
+    AssertThrow( mpiSize() == 1, ExcMessage("The direct linear solvers of CVODE run on a single process") );
 
-    if ( not precond_ )
-    {
-        int flag = CVSpbcg( cvodeMem_, PREC_NONE, krylovSubspaceDim_ );
-        AssertThrow( flag == CV_SUCCESS, ExcCVSpbcgError( flag ) );
-    }
-    else
-    {
-        int flag = CVSpbcg( cvodeMem_, PREC_RIGHT, krylovSubspaceDim_ );
-        AssertThrow( flag == CV_SUCCESS, ExcCVSpbcgError( flag ) );
+    CVodeBase::assignExplicitOde( odeProblem, initialTime, initialState );
+    stats_.reset();
+}
 
-        flag = CVBandPrecInit( cvodeMem_, odeProblem_->numberOfEquations(), 1, 1 );
-        AssertThrow( flag == CVSPILS_SUCCESS, ExcMessage("Failed to allocate BAND preconditioner") );
-    }
 
-    if ( odeProblem_->useJacobian() )
-    {
-        int flag;
-        flag = CVSpilsSetJacTimesVecFn( cvodeMem_, ExplicitOdeJacobian );
-        Assert( flag == CV_SUCCESS, ExcMessage("Call to SpilsSetJactimesVecFn failed"));
-    }
 
+bool
+CVodeDls::useJacobianMatrix() const
+{
+    return assembleJacobian_ && odeProblem_->hasJacobianMatrix();
 }
 
 
 
-// ----------------------------------------------------------------- CVodeTFQMR
+IntegratorStatsBase&
+CVodeDls::stats()
+{
+    stats_.update( cvodeMem_ );
+    return stats_;
+}
 
-CVodeTFQMR::CVodeTFQMR()
+
+
+void
+CVodeDls::updateHistory()
 {
-    solverName_ = "CVODE with TFQMR";
+    realtype hlast;
+    int flag = CVodeGetLastStep( cvodeMem_, &hlast);
+
+    int qlast;
+    flag = CVodeGetLastOrder( cvodeMem_, &qlast);
+
+    stats_.updateHistory( currentTime_, hlast, qlast );
+}
+
+
+
+void
+CVodeDls::declareParameters( ParameterHandler & prm )
+{
+    CVodeBase::declareParameters( prm );
+
+    prm.enter_subsection( "ODE integrator" );
+    prm.enter_subsection( "CVode" );
+    prm.enter_subsection( "CVodeDls" );
+        prm.declare_entry( "assemble Jacobian", "true", Patterns::Bool(),
+                "Let the problem assemble the Jacobian matrix, analytically or by colored "
+                "differences, otherwise CVODE approximates it column by column" );
+    prm.leave_subsection();
+    prm.leave_subsection();
+    prm.leave_subsection();
 }
 
 
 
 void
-CVodeTFQMR::assignExplicitOde( 
+CVodeDls::getParameters( ParameterHandler & prm )
+{
+    CVodeBase::getParameters( prm );
+
+    prm.enter_subsection( "ODE integrator" );
+    prm.enter_subsection( "CVode" );
+    prm.enter_subsection( "CVodeDls" );
+        assembleJacobian_ = prm.get_bool( "assemble Jacobian" );
+    prm.leave_subsection();
+    prm.leave_subsection();
+    prm.leave_subsection();
+}
+
+
+
+void
+CVodeDls::printInfo() const
+{
+    CVodeBase::printInfo();
+
+    logger << "*Jacobian matrix assembled by the problem*:: " << useJacobianMatrix() << std::endl;
+#if SUNDIALS_BLAS_LAPACK
+    logger << "*Factorization*:: LAPACK" << std::endl;
+#else
+    logger << "*Factorization*:: SUNDIALS" << std::endl;
+#endif
+}
+
+
+
+// ------------------------------------------------------------------ CVodeBand
+
+CVodeBand::CVodeBand()
+    :
+        lowerBandwidth_( 0 ),
+        upperBandwidth_( 0 )
+{
+    solverName_ = "CVODE with banded direct solver";
+}
+
+
+
+void
+CVodeBand::assignExplicitOde(
         ExplicitOde& odeProblem,
         const realtype initialTime,
         const Vector<realtype> &initialState )
 {
-    CVodeSpils::assignExplicitOde( odeProblem, initialTime, initialState );
+    CVodeDls::assignExplicitOde( odeProblem, initialTime, initialState );
 
-    if ( not precond_ )
+    // the band matrix is kept if the new problem has the same bandwidths
+    int lower, upper;
+    odeProblem_->jacobianBandwidths( lower, upper );
+    if ( not linearSolverAttached_ || lower != lowerBandwidth_ || upper != upperBandwidth_ )
     {
-        int flag;
-        flag = CVSptfqmr( cvodeMem_, PREC_NONE, krylovSubspaceDim_ );
-        AssertThrow( flag == CV_SUCCESS, ExcCVSptfqmrError( flag ) );
+        lowerBandwidth_ = lower;
+        upperBandwidth_ = upper;
+
+        const int n = odeProblem_->numberOfEquations();
+#if SUNDIALS_BLAS_LAPACK
+        int flag = CVLapackBand( cvodeMem_, n, upperBandwidth_, lowerBandwidth_ );
+#else
+        int flag = CVBand( cvodeMem_, n, upperBandwidth_, lowerBandwidth_ );
+#endif
+        AssertThrow( flag == CVDLS_SUCCESS, ExcCVBandError( flag ) );
+        instrumentLinearSolver();
+        linearSolverAttached_ = true;
     }
-    else
-    {
-        int flag;
-        flag = CVSptfqmr( cvodeMem_, PREC_RIGHT, krylovSubspaceDim_ );
-        AssertThrow( flag == CV_SUCCESS, ExcCVSptfqmrError( flag ) );
 
-        flag = CVBandPrecInit( cvodeMem_, odeProblem_->numberOfEquations(), 1, 1 );
-        AssertThrow( flag == CVSPILS_SUCCESS, ExcMessage("Failed to allocate BAND preconditioner") );
-    }
+    int flag = CVDlsSetBandJacFn( cvodeMem_, useJacobianMatrix() ? ExplicitOdeBandJacobian : 0 );
+    Assert( flag == CVDLS_SUCCESS, ExcMessage("Call to CVDlsSetBandJacFn failed"));
+}
+
+
+
+void
+CVodeBand::printInfo() const
+{
+    CVodeDls::printInfo();
+
+    logger << "*Lower bandwidth*:: " << lowerBandwidth_ << std::endl;
+    logger << "*Upper bandwidth*:: " << upperBandwidth_ << std::endl;
+}
+
+
+
+// ----------------------------------------------------------------- CVodeDense
 
-    if ( odeProblem_->useJacobian() )
+CVodeDense::CVodeDense()
+{
+    solverName_ = "CVODE with dense direct solver";
+}
+
+
+
+void
+CVodeDense::assignExplicitOde(
+        ExplicitOde& odeProblem,
+        const realtype initialTime,
+        const Vector<realtype> &initialState )
+{
+    CVodeDls::assignExplicitOde( odeProblem, initialTime, initialState );
+
+    if ( not linearSolverAttached_ )
     {
-        int flag;
-        flag = CVSpilsSetJacTimesVecFn( cvodeMem_, ExplicitOdeJacobian );
-        Assert( flag == CV_SUCCESS, ExcMessage("Call to SpilsSetJactimesVecFn failed"));
+        const int n = odeProblem_->numberOfEquations();
+#if SUNDIALS_BLAS_LAPACK
+        int flag = CVLapackDense( cvodeMem_, n );
+#else
+        int flag = CVDense( cvodeMem_, n );
+#endif
+        AssertThrow( flag == CVDLS_SUCCESS, ExcCVDenseError( flag ) );
+        instrumentLinearSolver();
+        linearSolverAttached_ = true;
     }
 
+    int flag = CVDlsSetDenseJacFn( cvodeMem_, useJacobianMatrix() ? ExplicitOdeDenseJacobian : 0 );
+    Assert( flag == CVDLS_SUCCESS, ExcMessage("Call to CVDlsSetDenseJacFn failed"));
+}
+
+
+
+// ----------------------------------------------------------------- CVodeAdams
+
+CVodeAdams::CVodeAdams()
+    :
+        CVodeBase( CV_ADAMS, CV_FUNCTIONAL )
+{
+    solverName_ = "CVODE with Adams formulas";
+    maxOrder_ = 12;
+}
+
+
+
+void
+CVodeAdams::assignExplicitOde(
+        ExplicitOde& odeProblem,
+        const realtype initialTime,
+        const Vector<realtype> &initialState )
+{
+    CVodeBase::assignExplicitOde( odeProblem, initialTime, initialState );
+    stats_.reset();
+}
+
+
+
+IntegratorStatsBase&
+CVodeAdams::stats()
+{
+    stats_.update( cvodeMem_ );
+    return stats_;
+}
+
+
+
+void
+CVodeAdams::updateHistory()
+{
+    realtype hlast;
+    int flag = CVodeGetLastStep( cvodeMem_, &hlast);
+
+    int qlast;
+    flag = CVodeGetLastOrder( cvodeMem_, &qlast);
+
+    stats_.updateHistory( currentTime_, hlast, qlast );
+}
+
+
+
+void
+CVodeAdams::declareParameters( ParameterHandler & prm )
+{
+    CVodeBase::declareParameters( prm );
+
+    prm.enter_subsection( "ODE integrator" );
+    prm.enter_subsection( "CVode" );
+    prm.enter_subsection( "CVodeAdams" );
+        prm.declare_entry( "maximum order", "12", Patterns::Integer(),
+                "Maximum order of the Adams formulas, 1 to 12" );
+    prm.leave_subsection();
+    prm.leave_subsection();
+    prm.leave_subsection();
+}
+
+
+
+void
+CVodeAdams::getParameters( ParameterHandler & prm )
+{
+    CVodeBase::getParameters( prm );
+
+    prm.enter_subsection( "ODE integrator" );
+    prm.enter_subsection( "CVode" );
+    prm.enter_subsection( "CVodeAdams" );
+        maxOrder_ = prm.get_integer( "maximum order" );
+    prm.leave_subsection();
+    prm.leave_subsection();
+    prm.leave_subsection();
 }
@@ -5,8 +5,24 @@
 #include "IntegratorStats.h"
 
 #include <nvector/nvector_serial.h>       /* serial N_Vector types , fct . and macros */
+#include <sundials/sundials_direct.h>     /* DlsMat of the direct linear solvers */
+#ifdef ODEITY_WITH_MPI
+#include <mpi.h>                          /* outside the extern "C" block of nvector_parallel.h */
+#include <nvector/nvector_parallel.h>     /* parallel N_Vector for distributed runs */
+#endif
 
 #include <fstream>
+#include <string>
+
+class SparsePreconditioner;
+
+// Passed by CVODE to the functions below: the problem and, for the Krylov
+// solvers, the sparse preconditioner, if there is one.
+struct CVodeUserData
+{
+    ExplicitOde * ode;
+    SparsePreconditioner * preconditioner;
+};
 
 extern "C"
 int
@@ -18,10 +34,38 @@ ExplicitOdeJacobian( N_Vector nvV, N_Vector nvJv,
         realtype t, N_Vector nvY, N_Vector nvFy,
         void *jac_data, N_Vector nvTmp );
 
+extern "C"
+int
+ExplicitOdeLocalRhs( int nLocal, realtype t, N_Vector nvY, N_Vector nvG, void * f_data );
+
+extern "C"
+int
+ExplicitOdePrecSetup( realtype t, N_Vector nvY, N_Vector nvFy, booleantype jok,
+        booleantype * jcurPtr, realtype gamma, void * user_data,
+        N_Vector nvTmp1, N_Vector nvTmp2, N_Vector nvTmp3 );
+
+extern "C"
+int
+ExplicitOdePrecSolve( realtype t, N_Vector nvY, N_Vector nvFy, N_Vector nvR, N_Vector nvZ,
+        realtype gamma, realtype delta, int lr, void * user_data, N_Vector nvTmp );
+
+extern "C"
+int
+ExplicitOdeDenseJacobian( int N, realtype t, N_Vector nvY, N_Vector nvFy, DlsMat Jac,
+        void * jac_data, N_Vector nvTmp1, N_Vector nvTmp2, N_Vector nvTmp3 );
+
+extern "C"
+int
+ExplicitOdeBandJacobian( int N, int mupper, int mlower, realtype t, N_Vector nvY, N_Vector nvFy,
+        DlsMat Jac, void * jac_data, N_Vector nvTmp1, N_Vector nvTmp2, N_Vector nvTmp3 );
+
 
 OdeIntegratorBase * createCVodeGMRESSolver();
 OdeIntegratorBase * createCVodeBiCGSolver();
 OdeIntegratorBase * createCVodeTFQMRSolver();
+OdeIntegratorBase * createCVodeBandSolver();
+OdeIntegratorBase * createCVodeDenseSolver();
+OdeIntegratorBase * createCVodeAdamsSolver();
 
 class CVodeBase : public OdeIntegratorBase
 {
@@ -49,21 +93,38 @@ class CVodeBase : public OdeIntegratorBase
 
     protected:
 
-        CVodeBase();
+        // BDF with Newton iteration or Adams with functional iteration
+        CVodeBase( const int multistepMethod = CV_BDF, const int iteration = CV_NEWTON );
 
         void assignExplicitOde( 
                 ExplicitOde& odeProblem,
                 const realtype initialTime,
                 const Vector<realtype> &initialState );
+        void instrumentLinearSolver();
 
+        const int multistepMethod_;
+        const int iteration_;
         void * cvodeMem_;
         bool initialized_;
         N_Vector nvCurrentState_;
+        CVodeUserData userData_;
+
+        // Set by the derived classes once they attached the linear solver.
+        // It stays attached while assignExplicitOde() reinitializes CVODE
+        // for problems of the same size, until getParameters() is called.
+        bool linearSolverAttached_;
 
         std::ofstream stepsizeHistoryFile_;
         std::ofstream orderHistoryFile_;
 
         int maxNumSteps_;
+        int maxOrder_;
+        realtype initialStep_;
+        realtype maxStep_;
+        int maxErrTestFails_;
+        int maxConvFails_;
+        realtype nonlinConvCoef_;
+        bool stabilityLimitDetection_;
 
         // no copy constructor
         CVodeBase( const CVodeBase& );
@@ -71,11 +132,20 @@ class CVodeBase : public OdeIntegratorBase
 
 
 
+// Newton iteration with a Krylov method, optionally with a preconditioner.
+// With auto-tuning the Krylov subspace dimension and the linear convergence
+// factor are chosen by timing short probe integrations of the first problem
+// assigned; the setting is kept for the following ones.
 class CVodeSpils : public CVodeBase
 {
     public:
         virtual ~CVodeSpils();
 
+        void assignExplicitOde(
+                ExplicitOde& odeProblem,
+                const realtype initialTime,
+                const Vector<realtype> &initialState );
+
         IntegratorStatsBase& stats();
         void updateHistory();
 
@@ -91,18 +161,39 @@ class CVodeSpils : public CVodeBase
     protected:
 
         CVodeSpils();
-        void assignExplicitOde( 
-                ExplicitOde& odeProblem,
-                const realtype initialTime,
-                const Vector<realtype> &initialState );
+
+        // attaches the Krylov method with PREC_NONE or PREC_RIGHT
+        virtual void attachLinearSolver( const int preconditioning ) = 0;
 
         bool precond_;
         int krylovSubspaceDim_;
+        realtype epsLin_;
+        // "modified" or "classical", GMRES only
+        std::string gramSchmidt_;
+
+        // "band" (BANDPRE or BBDPRE), "ILU" or "line block Jacobi"
+        std::string preconditionerType_;
+        int fillLevel_;
+        std::string ordering_;
+        SparsePreconditioner * sparsePreconditioner_;
 
     private:
 
         CVodeSpilsStats stats_;
 
+        bool autoTune_;
+        bool autoTuned_;
+        int autoTuneSteps_;
+        std::string autoTuneKrylovDims_;
+        std::string autoTuneEpsLins_;
+
+        void initialize(
+                ExplicitOde& odeProblem,
+                const realtype initialTime,
+                const Vector<realtype> &initialState );
+        void initPreconditioner();
+        void autoTune( const realtype initialTime, const Vector<realtype> & initialState );
+
         CVodeSpils( const CVodeSpils& );
         CVodeSpils& operator = ( const CVodeSpils& );
 };
@@ -114,36 +205,140 @@ class CVodeGMRES : public CVodeSpils
     public:
         CVodeGMRES();
 
-        void assignExplicitOde( 
+        void printInfo() const;
+
+    protected:
+
+        void attachLinearSolver( const int preconditioning );
+};
+
+
+
+class CVodeBiCG : public CVodeSpils
+{
+    public:
+        CVodeBiCG();
+
+    protected:
+
+        void attachLinearSolver( const int preconditioning );
+};
+
+
+
+class CVodeTFQMR : public CVodeSpils
+{
+    public:
+        CVodeTFQMR();
+
+    protected:
+
+        void attachLinearSolver( const int preconditioning );
+};
+
+
+
+// Newton iteration with a direct linear solver, for problems small enough
+// to store and factorize the Jacobian matrix. It is assembled by the
+// problem if it implements ExplicitOde::jacobianMatrix(), analytically or
+// by colored differences, otherwise CVODE approximates it by difference
+// quotients. The factorization uses LAPACK if SUNDIALS was built with it.
+// Serial runs only.
+class CVodeDls : public CVodeBase
+{
+    public:
+        virtual ~CVodeDls();
+
+        IntegratorStatsBase& stats();
+        void updateHistory();
+
+        static void declareParameters( ParameterHandler & prm );
+        void getParameters( ParameterHandler & prm );
+
+        void printInfo() const;
+
+        DeclException1( ExcCVDenseError, int, << "CVDense failed with error code: " << arg1 );
+        DeclException1( ExcCVBandError, int, << "CVBand failed with error code: " << arg1 );
+
+    protected:
+
+        CVodeDls();
+        void assignExplicitOde(
                 ExplicitOde& odeProblem,
                 const realtype initialTime,
                 const Vector<realtype> &initialState );
+        bool useJacobianMatrix() const;
+
+        bool assembleJacobian_;
+
+    private:
+
+        CVodeDlsStats stats_;
+
+        CVodeDls( const CVodeDls& );
+        CVodeDls& operator = ( const CVodeDls& );
 };
 
 
 
-class CVodeBiCG : public CVodeSpils
+// Banded matrix with the bandwidths given by the problem, e.g. a stencil
+// radius times the number of nodes in a slice of constant x of the grid.
+class CVodeBand : public CVodeDls
 {
     public:
-        CVodeBiCG();
+        CVodeBand();
 
-        void assignExplicitOde( 
+        void assignExplicitOde(
                 ExplicitOde& odeProblem,
                 const realtype initialTime,
                 const Vector<realtype> &initialState );
+
+        void printInfo() const;
+
+    private:
+
+        int lowerBandwidth_;
+        int upperBandwidth_;
 };
 
 
 
-class CVodeTFQMR : public CVodeSpils
+class CVodeDense : public CVodeDls
 {
     public:
-        CVodeTFQMR();
+        CVodeDense();
 
-        void assignExplicitOde( 
+        void assignExplicitOde(
                 ExplicitOde& odeProblem,
                 const realtype initialTime,
-                const Vector<realtype> &initialState );    
+                const Vector<realtype> &initialState );
+};
+
+
+
+// Adams-Moulton formulas of order up to 12 with functional iteration, so
+// without a linear solver. Cheap per step on non-stiff problems; on stiff
+// ones the iteration only converges for steps of about the inverse of the
+// spectral radius of the Jacobian.
+class CVodeAdams : public CVodeBase
+{
+    public:
+        CVodeAdams();
+
+        void assignExplicitOde(
+                ExplicitOde& odeProblem,
+                const realtype initialTime,
+                const Vector<realtype> &initialState );
+
+        IntegratorStatsBase& stats();
+        void updateHistory();
+
+        static void declareParameters( ParameterHandler & prm );
+        void getParameters( ParameterHandler & prm );
+
+    private:
+
+        CVodeAdamsStats stats_;
 };
 
 
@@ -0,0 +1,78 @@
+#ifndef ENSEMBLE_DORMAND_PRINCE_45_H
+#define ENSEMBLE_DORMAND_PRINCE_45_H
+
+#include "../utils/Exceptions.h"
+
+#include <sundials/sundials_types.h>
+
+#include <vector>
+
+// Dormand-Prince 5(4) integrator for a batch of independent instances of a
+// small ODE system, e.g. for parameter sweeps or Monte Carlo runs.
+//
+// System has to provide the static members `equations`, `parameters` and
+// `evaluate( t, y, ydot, p, stride )` working on plain arrays with component
+// i at y[i*stride] (see TestSystem01 - TestSystem06 and RobertsonEquation).
+// The instances are stored in structure-of-arrays layout: component i of
+// instance l is at index i*lanes + l, likewise parameter k of instance l.
+// The right hand side is then evaluated for all instances in a single
+// vectorizable loop without virtual calls.
+//
+// Every instance (lane) has its own time, stepsize and error control. Lanes
+// whose step is rejected keep their state, lanes that have reached the end
+// time are masked out until the whole batch is finished.
+template<class System>
+class EnsembleDormandPrince45
+{
+    public:
+
+        EnsembleDormandPrince45( const unsigned int lanes );
+
+        void setTolerances( const realtype relTol, const realtype absTol );
+        void setMaxSteps( const unsigned int maxSteps );
+        unsigned int lanes() const { return lanes_; }
+
+        // Integrate all instances from t0 to tEnd. On input y holds the
+        // initial conditions, on output the solutions at tEnd.
+        void solve( const realtype t0, const realtype tEnd,
+                    realtype * y, const realtype * parameters = 0 );
+
+        unsigned long acceptedSteps( const unsigned int lane ) const { return accepted_[lane]; }
+        unsigned long rejectedSteps( const unsigned int lane ) const { return rejected_[lane]; }
+        unsigned long rhsEvaluations() const { return rhsEvaluations_; } // for the whole batch
+
+        DeclException2( ExcMaxStepsExceeded,
+                unsigned int, unsigned int,
+                << "Maximum number of steps (" << arg1 << ") exceeded with "
+                << arg2 << " instances not finished" );
+
+    private:
+
+        unsigned int lanes_;
+        realtype relTol_;
+        realtype absTol_;
+        unsigned int maxSteps_;
+
+        std::vector<realtype> t_;
+        std::vector<realtype> stepsize_;
+        std::vector<realtype> actualStepsize_; // stepsize_ clipped to the end time, 0 in masked lanes
+        std::vector<realtype> errorNorm_;
+        std::vector<int> active_;
+        std::vector<int> accept_;
+
+        std::vector<realtype> k_[7];
+        std::vector<realtype> stage_;
+        std::vector<realtype> temp_;
+
+        std::vector<unsigned long> accepted_;
+        std::vector<unsigned long> rejected_;
+        unsigned long rhsEvaluations_;
+
+        void evaluate( const realtype c, const realtype * y, realtype * ydot,
+                       const realtype * parameters );
+        void initialStepsize( const realtype tEnd, const realtype * y );
+};
+
+#include "EnsembleDormandPrince45.impl.h"
+
+#endif // ENSEMBLE_DORMAND_PRINCE_45_H
@@ -0,0 +1,263 @@
+#include "EnsembleDormandPrince45.h"
+
+#include <algorithm>
+#include <cmath>
+
+
+
+template<class System>
+EnsembleDormandPrince45<System>::EnsembleDormandPrince45( const unsigned int lanes )
+:
+    lanes_( lanes ),
+    relTol_( 1.0e-6 ),
+    absTol_( 1.0e-6 ),
+    maxSteps_( 100000 ),
+    t_( lanes ),
+    stepsize_( lanes ),
+    actualStepsize_( lanes ),
+    errorNorm_( lanes ),
+    active_( lanes ),
+    accept_( lanes ),
+    stage_( System::equations * lanes ),
+    temp_( lanes ),
+    accepted_( lanes ),
+    rejected_( lanes ),
+    rhsEvaluations_( 0 )
+{
+    Assert( lanes > 0, ExcZero() );
+
+    for ( int s = 0; s < 7; s++ )
+        k_[s].resize( System::equations * lanes );
+}
+
+
+
+template<class System>
+void EnsembleDormandPrince45<System>::setTolerances( const realtype relTol, const realtype absTol )
+{
+    Assert( relTol >= 0.0 && absTol >= 0.0, ExcMessage( "Tolerances must be nonnegative" ) );
+    relTol_ = relTol;
+    absTol_ = absTol;
+}
+
+
+
+template<class System>
+void EnsembleDormandPrince45<System>::setMaxSteps( const unsigned int maxSteps )
+{
+    maxSteps_ = maxSteps;
+}
+
+
+
+template<class System>
+void EnsembleDormandPrince45<System>::evaluate( const realtype c,
+        const realtype * y, realtype * ydot, const realtype * parameters )
+{
+    const unsigned int L = lanes_;
+    const realtype * const t = &t_[0];
+    const realtype * const h = &actualStepsize_[0];
+
+    // the system is evaluated directly on the lanes with stride L, after
+    // inlining this loop vectorizes across the instances
+#pragma omp simd
+    for ( unsigned int l = 0; l < L; l++ )
+        System::evaluate( t[l] + c * h[l], y + l, ydot + l,
+                parameters ? parameters + l : 0, L );
+
+    rhsEvaluations_++;
+}
+
+
+
+template<class System>
+void EnsembleDormandPrince45<System>::initialStepsize( const realtype tEnd, const realtype * y )
+{
+    // Hairer, Norsett, Wanner, starting step size without the second
+    // evaluation of f
+    const int n = System::equations;
+    const unsigned int L = lanes_;
+
+    for ( unsigned int l = 0; l < L; l++ )
+    {
+        realtype d0 = 0.0;
+        realtype d1 = 0.0;
+        for ( int i = 0; i < n; i++ )
+        {
+            const realtype sc = absTol_ + relTol_ * std::fabs( y[i*L + l] );
+            d0 += ( y[i*L + l] / sc ) * ( y[i*L + l] / sc );
+            d1 += ( k_[0][i*L + l] / sc ) * ( k_[0][i*L + l] / sc );
+        }
+        d0 = std::sqrt( d0 / n );
+        d1 = std::sqrt( d1 / n );
+
+        realtype h = ( d0 < 1.0e-5 || d1 < 1.0e-5 ) ? 1.0e-6 : 0.01 * d0 / d1;
+        stepsize_[l] = std::min( h, tEnd - t_[l] );
+    }
+}
+
+
+
+template<class System>
+void EnsembleDormandPrince45<System>::solve( const realtype t0, const realtype tEnd,
+        realtype * y, const realtype * parameters )
+{
+    Assert( tEnd > t0, ExcMessage( "End time has to be greater than initial time" ) );
+    Assert( System::parameters == 0 || parameters != 0,
+            ExcMessage( "The system requires parameters" ) );
+
+    static const realtype c[7] = { 0.0, 1.0/5.0, 3.0/10.0, 4.0/5.0, 8.0/9.0, 1.0, 1.0 };
+    static const realtype a[7][6] = {
+        { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 },
+        { 1.0/5.0, 0.0, 0.0, 0.0, 0.0, 0.0 },
+        { 3.0/40.0, 9.0/40.0, 0.0, 0.0, 0.0, 0.0 },
+        { 44.0/45.0, -56.0/15.0, 32.0/9.0, 0.0, 0.0, 0.0 },
+        { 19372.0/6561.0, -25360.0/2187.0, 64448.0/6561.0, -212.0/729.0, 0.0, 0.0 },
+        { 9017.0/3168.0, -355.0/33.0, 46732.0/5247.0, 49.0/176.0, -5103.0/18656.0, 0.0 },
+        { 35.0/384.0, 0.0, 500.0/1113.0, 125.0/192.0, -2187.0/6784.0, 11.0/84.0 } };
+    static const realtype e[7] = { 71.0/57600.0, 0.0, -71.0/16695.0, 71.0/1920.0,
+        -17253.0/339200.0, 22.0/525.0, -1.0/40.0 };
+
+    const int n = System::equations;
+    const unsigned int L = lanes_;
+
+    for ( unsigned int l = 0; l < L; l++ )
+    {
+        t_[l] = t0;
+        actualStepsize_[l] = 0.0;
+        active_[l] = 1;
+        accepted_[l] = 0;
+        rejected_[l] = 0;
+    }
+    rhsEvaluations_ = 0;
+
+    evaluate( 0.0, y, &k_[0][0], parameters );
+    initialStepsize( tEnd, y );
+
+    unsigned int remaining = L;
+    unsigned int step;
+    for ( step = 0; step < maxSteps_ && remaining > 0; step++ )
+    {
+        // masked lanes get a zero step, which leaves them unchanged
+        for ( unsigned int l = 0; l < L; l++ )
+            actualStepsize_[l] = active_[l] ? std::min( stepsize_[l], tEnd - t_[l] ) : 0.0;
+        const realtype * const h = &actualStepsize_[0];
+
+        // stages 2 to 7, the input of the last one is the new solution
+        for ( int s = 1; s < 7; s++ )
+        {
+            for ( int i = 0; i < n; i++ )
+            {
+                realtype * const g = &stage_[i*L];
+                const realtype * const yi = y + i*L;
+
+                const realtype * const k0 = &k_[0][i*L];
+                const realtype a0 = a[s][0];
+#pragma omp simd
+                for ( unsigned int l = 0; l < L; l++ )
+                    g[l] = a0 * k0[l];
+
+                for ( int j = 1; j < s; j++ )
+                {
+                    const realtype * const kj = &k_[j][i*L];
+                    const realtype aj = a[s][j];
+#pragma omp simd
+                    for ( unsigned int l = 0; l < L; l++ )
+                        g[l] += aj * kj[l];
+                }
+
+#pragma omp simd
+                for ( unsigned int l = 0; l < L; l++ )
+                    g[l] = yi[l] + h[l] * g[l];
+            }
+
+            evaluate( c[s], &stage_[0], &k_[s][0], parameters );
+        }
+
+        // weighted rms norm of the difference to the embedded solution,
+        // the error vector is accumulated in temp_
+        for ( unsigned int l = 0; l < L; l++ )
+            errorNorm_[l] = 0.0;
+
+        for ( int i = 0; i < n; i++ )
+        {
+            const realtype * const yi = y + i*L;
+            const realtype * const g = &stage_[i*L];
+            realtype * const err = &temp_[0];
+
+#pragma omp simd
+            for ( unsigned int l = 0; l < L; l++ )
+                err[l] = 0.0;
+
+            for ( int j = 0; j < 7; j++ )
+            {
+                const realtype * const kj = &k_[j][i*L];
+                const realtype ej = e[j];
+#pragma omp simd
+                for ( unsigned int l = 0; l < L; l++ )
+                    err[l] += ej * kj[l];
+            }
+
+#pragma omp simd
+            for ( unsigned int l = 0; l < L; l++ )
+            {
+                const realtype sc = absTol_
+                    + relTol_ * std::max( std::fabs( yi[l] ), std::fabs( g[l] ) );
+                const realtype r = h[l] * err[l] / sc;
+                errorNorm_[l] += r * r;
+            }
+        }
+
+        for ( unsigned int l = 0; l < L; l++ )
+        {
+            if ( not active_[l] )
+            {
+                accept_[l] = 0;
+                continue;
+            }
+
+            const realtype err = std::sqrt( errorNorm_[l] / n );
+            accept_[l] = ( err <= 1.0 );
+
+            realtype factor = ( err > 0.0 ) ? 0.9 * std::pow( err, -0.2 ) : 5.0;
+            if ( accept_[l] )
+            {
+                factor = std::min( 5.0, std::max( 0.2, factor ) );
+                accepted_[l]++;
+
+                if ( actualStepsize_[l] == tEnd - t_[l] )
+                {
+                    t_[l] = tEnd;
+                    active_[l] = 0;
+                    remaining--;
+                }
+                else
+                    t_[l] += actualStepsize_[l];
+            }
+            else
+            {
+                factor = std::min( 1.0, std::max( 0.1, factor ) );
+                rejected_[l]++;
+            }
+            stepsize_[l] = actualStepsize_[l] * factor;
+        }
+
+        // masked update of the accepted lanes, FSAL
+        for ( int i = 0; i < n; i++ )
+        {
+            realtype * const yi = y + i*L;
+            const realtype * const g = &stage_[i*L];
+            realtype * const k0 = &k_[0][i*L];
+            const realtype * const k6 = &k_[6][i*L];
+
+#pragma omp simd
+            for ( unsigned int l = 0; l < L; l++ )
+            {
+                yi[l] = accept_[l] ? g[l] : yi[l];
+                k0[l] = accept_[l] ? k6[l] : k0[l];
+            }
+        }
+    }
+
+    AssertThrow( remaining == 0, ExcMaxStepsExceeded( maxSteps_, remaining ) );
+}
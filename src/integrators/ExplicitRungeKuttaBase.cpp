@@ -1,6 +1,8 @@
 #include "ExplicitRungeKuttaBase.h"
 #include "../odesystem/ExplicitOde.h"
 #include "../utils/LogStream.h"
+#include "../utils/MpiUtilities.h"
+#include "../utils/Profiler.h"
 
 #include <cmath>
 
@@ -49,10 +51,7 @@ ExplicitRungeKuttaBase::assignExplicitOde(
 
     stats_.reset();
 
-    int neq = odeProblem.numberOfEquations();
-
-    for ( int i = 0; i < stages_; i++ )
-        k_[i].reinit( neq );
+    allocateStages( odeProblem.numberOfEquations() );
 
     computeTooSmall();
 
@@ -62,6 +61,15 @@ ExplicitRungeKuttaBase::assignExplicitOde(
 
 
 
+void
+ExplicitRungeKuttaBase::allocateStages( const int neq )
+{
+    for ( int i = 0; i < stages_; i++ )
+        k_[i].reinit( neq );
+}
+
+
+
 IntegratorStatsBase&
 ExplicitRungeKuttaBase::stats()
 {
@@ -101,6 +109,7 @@ ExplicitRungeKuttaBase::estimateInitialStepsize( )
         if ( ypk * std::pow( stepsize_, 5.0 ) > tol )
             stepsize_ = std::pow( tol/ypk, 0.2 );
     }
+    stepsize_ = mpiMin( stepsize_ );
 
     stepsize_ = std::max( minStepsize_, std::min( stepsize_, endTime_ - currentTime_) );
 }
@@ -131,10 +140,13 @@ ExplicitRungeKuttaBase::calculateSolutionPoint()
 {
     for ( int s = 1; s < stages_; s++ )
     {
-        newState_ = currentState_;
-        for ( int i = 0; i < s; i++ )
-            if ( a_(s,i) != 0.0 )
-                newState_.add( stepsize_ * a_(s,i), k_[i] );
+        {
+            ODEITY_PROBE( "vector kernels" );
+            newState_ = currentState_;
+            for ( int i = 0; i < s; i++ )
+                if ( a_(s,i) != 0.0 )
+                    newState_.add( stepsize_ * a_(s,i), k_[i] );
+        }
 
         odeProblem_->rhs( currentTime_ + stepsize_*c_(s), newState_, k_[s] );
         stats_.incRhsEvaluations();
@@ -144,6 +156,7 @@ ExplicitRungeKuttaBase::calculateSolutionPoint()
 
     if ( not fsal_ )
     {
+        ODEITY_PROBE( "vector kernels" );
         newState_ = currentState_;
         for ( int s = 0; s < stages_; s++ )
             if ( b_(s) != 0.0 )
@@ -161,7 +174,7 @@ ExplicitRungeKuttaBase::estimateError()
         if ( e_(s) != 0.0 )
             newLocalError_.add( e_(s), k_[s] );
     newLocalError_ *= stepsize_;
-    newLocalErrorNorm_ = newLocalError_.rms_norm( weights_ );
+    newLocalErrorNorm_ = globalRmsNorm( newLocalError_, weights_ );
 }
 
 
@@ -64,6 +64,7 @@ class ExplicitRungeKuttaBase : public RungeKuttaBase
     void updateHistory();
 
     void computeTooSmall();
+    virtual void allocateStages( const int neq );
 };
 
 #endif // EXPLICIT_RUNGE_KUTTA_BASE_H
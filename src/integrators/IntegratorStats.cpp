@@ -1,4 +1,5 @@
 #include "IntegratorStats.h"
+#include "StepHistory.h"
 #include "../utils/LogStream.h"
 #include "../utils/Exceptions.h"
 
@@ -9,14 +10,13 @@
 #include <cvode/cvode_band.h>
 #include <cvode/cvode_bandpre.h>
 
-#include <fstream>
 #include <iomanip>
 
 /* --------------------------------------------------------------------------*/
 
 IntegratorStatsBase::IntegratorStatsBase()
     :
-        historyFile_( 0 )
+        history_( 0 )
 {
     reset();
 }
@@ -24,27 +24,27 @@ IntegratorStatsBase::IntegratorStatsBase()
 
 
 void
-IntegratorStatsBase::setHistoryFile( std::ofstream & historyFile )
+IntegratorStatsBase::setHistory( StepHistory & history )
 {
-    historyFile_ = &historyFile;
-    historyFile_->width( 18 );
-    historyFile_->precision( 12 );
-    historyFile_->setf( std::ios::scientific, std::ios::floatfield );
+    history_ = &history;
 }
 
 
 
+// In a distributed run only process 0 keeps the history, the others just
+// collect the statistics.
 void
-IntegratorStatsBase::updateTimeStepsize( realtype time, realtype stepsize )
+IntegratorStatsBase::updateTimeStepsize( realtype time, realtype stepsize, int value )
 {
-    Assert( historyFile_ != 0, ExcNotInitialized() );
-
     if ( stepsize > maxTimeStepsize_ )
         maxTimeStepsize_ = stepsize;
     if ( stepsize < minTimeStepsize_ )
         minTimeStepsize_ = stepsize;
+    lastStepsize_ = stepsize;
+    lastStepValue_ = value;
 
-    *historyFile_ << std::endl << time << " " << stepsize;
+    if ( history_ != 0 )
+        history_->record( time, stepsize, value );
 }
 
 
@@ -54,6 +54,8 @@ IntegratorStatsBase::reset()
 {
     maxTimeStepsize_ = 0.0;
     minTimeStepsize_ = 1.0;
+    lastStepsize_ = 0.0;
+    lastStepValue_ = 0;
 }
 
 
@@ -127,13 +129,10 @@ void RungeKuttaChebyshevStats::reset()
 void
 RungeKuttaChebyshevStats::updateHistory( realtype time, realtype stepsize, int stage )
 {
-    Assert( historyFile_ != 0, ExcNotInitialized() );
-
     if ( stage > maxStage_ )
         maxStage_ = stage;
 
-    RungeKuttaStats::updateHistory( time, stepsize );
-    *historyFile_ << " " << stage;
+    updateTimeStepsize( time, stepsize, stage );
 }
 
 
@@ -179,14 +178,10 @@ void CVodeStats::reset()
 void
 CVodeStats::updateHistory( realtype time, realtype stepsize, int order )
 {
-    Assert( historyFile_ != 0, ExcNotInitialized() );
-
-    updateTimeStepsize( time, stepsize );
-
     if ( order > maxOrder_ )
         maxOrder_ = order;
 
-    *historyFile_ << " " << order;
+    updateTimeStepsize( time, stepsize, order );
 }
 
 
@@ -235,6 +230,36 @@ CVodeStats::printInfo() const
 }
 
 
+// -------------------------------------------------------------- CVodeDlsStats
+void
+CVodeDlsStats::update( void * cvodeMem )
+{
+    CVodeStats::update( cvodeMem );
+
+    int flag = CVDlsGetNumJacEvals( cvodeMem, &njevals );
+    Assert( flag == CVDLS_SUCCESS, ExcMessage("Call to CVDlsGetNumJacEvals failed"));
+
+    flag = CVDlsGetNumRhsEvals( cvodeMem, &nfevalsLS );
+    Assert( flag == CVDLS_SUCCESS, ExcMessage("Call to CVDlsGetNumRhsEvals failed"));
+}
+
+
+
+void
+CVodeDlsStats::printInfo() const
+{
+    using namespace std;
+
+    CVodeStats::printInfo();
+    logger << "Jacobian evaluations            " << setw( 15 ) << njevals << endl;
+    logger << "RHS evals for FD Jacobian       " << setw( 15 ) << nfevalsLS << endl;
+    logger << "-----------------------------------------------" << endl;
+    logger << "Total number of RHS calls       " << setw( 15 ) << nfevalsLS+nfevals << endl;
+    logger << "-----------------------------------------------" << endl;
+}
+
+
+
 // ------------------------------------------------------------ CVodeSpilsStats
 void
 CVodeSpilsStats::update( void * cvodeMem )
@@ -288,8 +313,122 @@ CVodeSpilsStats::printInfo() const
     logger << "Jacobian-vector evaluations     " << setw( 15 ) << njvevals << endl;
     logger << "RHS evals for FD Jac-vec prod.  " << setw( 15 ) << nfevalsLS << endl;
     logger << "RHS calls in BANDPRE            " << setw( 15 ) << nfevalsBP << endl;
+    logger << "Preconditioner Jacobians        " << setw( 15 ) << npjevals << endl;
     logger << "-----------------------------------------------" << endl;
     logger << "Total number of RHS calls       " << setw( 15 ) << nfevalsLS+nfevals+nfevalsBP << endl;
     logger << "-----------------------------------------------" << endl;
 }
 
+
+
+
+// ------------------------------------------------------------ CVodeAdamsStats
+void
+CVodeAdamsStats::printInfo() const
+{
+    CVodeStats::printInfo();
+}
+
+
+
+// ---------------------------------------------------- StiffnessSwitchingStats
+StiffnessSwitchingStats::StiffnessSwitchingStats()
+{
+    reset();
+}
+
+
+
+void
+StiffnessSwitchingStats::reset()
+{
+    IntegratorStatsBase::reset();
+
+    active_ = 0;
+    stiff_ = false;
+    acceptedSteps_ = 0;
+    rejectedSteps_ = 0;
+    rhsEvaluations_ = 0;
+    jacobianProducts_ = 0;
+    stiffSteps_ = 0;
+    spectralRadiusRhs_ = 0;
+    switchesToStiff_ = 0;
+    switchesToNonStiff_ = 0;
+    lastStiffnessRatio_ = 0.0;
+}
+
+
+
+void
+StiffnessSwitchingStats::endPeriod( const IntegratorStatsBase & stats )
+{
+    acceptedSteps_ += stats.acceptedSteps();
+    rejectedSteps_ += stats.rejectedSteps();
+    rhsEvaluations_ += stats.rhsEvaluations();
+    jacobianProducts_ += stats.jacobianProducts();
+    if ( stiff_ )
+        stiffSteps_ += stats.acceptedSteps();
+}
+
+
+
+long int
+StiffnessSwitchingStats::acceptedSteps() const
+{
+    return acceptedSteps_ + ( active_ != 0 ? active_->acceptedSteps() : 0 );
+}
+
+
+
+long int
+StiffnessSwitchingStats::rejectedSteps() const
+{
+    return rejectedSteps_ + ( active_ != 0 ? active_->rejectedSteps() : 0 );
+}
+
+
+
+long int
+StiffnessSwitchingStats::rhsEvaluations() const
+{
+    return rhsEvaluations_ + spectralRadiusRhs_ + ( active_ != 0 ? active_->rhsEvaluations() : 0 );
+}
+
+
+
+long int
+StiffnessSwitchingStats::jacobianProducts() const
+{
+    return jacobianProducts_ + ( active_ != 0 ? active_->jacobianProducts() : 0 );
+}
+
+
+
+void
+StiffnessSwitchingStats::printInfo() const
+{
+    using namespace std;
+
+    const long int stiffSteps = stiffSteps_ + ( stiff_ && active_ != 0 ? active_->acceptedSteps() : 0 );
+
+    logger << endl;
+    logger << "Stiffness switching statistics" << endl;
+    logger << "------------------------------" << endl;
+    logger << endl;
+    logger << "[frame=\"topbot\",grid=\"rows\"]" << endl;
+    logger << "`-------------------------------'--------------" << endl;
+    logger << "RHS evaluations                 " << setw( 15 ) << rhsEvaluations() << endl;
+    logger << "RHS evals for spectral radius   " << setw( 15 ) << spectralRadiusRhs_ << endl;
+    logger << "Accepted steps                  " << setw( 15 ) << acceptedSteps() << endl;
+    logger << "Steps of the stiff solver       " << setw( 15 ) << stiffSteps << endl;
+    logger << "Rejected steps                  " << setw( 15 ) << rejectedSteps() << endl;
+    logger << "Jacobian-vector evaluations     " << setw( 15 ) << jacobianProducts() << endl;
+    logger << "Switches to the stiff solver    " << setw( 15 ) << switchesToStiff_ << endl;
+    logger << "Switches to the non-stiff solver" << setw( 15 ) << switchesToNonStiff_ << endl;
+    logger << "Last spectral radius * step     " << setw( 15 ) << setprecision( 8 ) << lastStiffnessRatio_ << endl;
+    if ( maxTimeStepsize_ > 0.0 )
+        logger << "Maximum stepsize                " << setw( 15 ) << setprecision( 8 ) << maxTimeStepsize_ << endl;
+    if ( minTimeStepsize_ < 1.0 )
+        logger << "Minimum stepsize                " << setw( 15 ) << setprecision( 8 ) << minTimeStepsize_ << endl;
+    logger << "-----------------------------------------------" << endl;
+}
@@ -7,9 +7,10 @@
 #include <cvode/cvode_spbcgs.h>           /* prototypes & constants for CVSPBCG solver */
 #include <cvode/cvode_sptfqmr.h>          /* prototypes & constants for CVSTFQMR solver */
 #include <cvode/cvode_band.h>
+#include <cvode/cvode_direct.h>
 #include <cvode/cvode_bandpre.h>
 
-#include <iosfwd>
+class StepHistory;
 
 class IntegratorStatsBase
 {
@@ -17,16 +18,32 @@ class IntegratorStatsBase
         IntegratorStatsBase();
 
         virtual void printInfo() const = 0;
-        void setHistoryFile( std::ofstream & historyFile );
+        // the accepted steps are recorded in history, if there is one
+        void setHistory( StepHistory & history );
+
+        // counts since the problem was assigned: successful and rejected
+        // steps, evaluations of the right hand side including those made
+        // by the linear solvers, and Jacobian-vector products
+        virtual long int acceptedSteps() const = 0;
+        virtual long int rejectedSteps() const = 0;
+        virtual long int rhsEvaluations() const = 0;
+        virtual long int jacobianProducts() const;
+
+        // size of the last recorded step and its order (CVODE) or number
+        // of stages (RKC, ROCK), zero for the other methods
+        realtype lastStepsize() const;
+        int lastStepValue() const;
 
     protected:
 
-        void updateTimeStepsize( realtype time, realtype stepsize );
+        void updateTimeStepsize( realtype time, realtype stepsize, int value = 0 );
         virtual void reset();
 
-        std::ofstream * historyFile_;
+        StepHistory * history_;
         realtype maxTimeStepsize_;
         realtype minTimeStepsize_;
+        realtype lastStepsize_;
+        int lastStepValue_;
 };
 
 
@@ -36,6 +53,9 @@ class RungeKuttaStats : public IntegratorStatsBase
     public:
 
         void printInfo() const;
+        long int acceptedSteps() const;
+        long int rejectedSteps() const;
+        long int rhsEvaluations() const;
 
     protected:
 
@@ -61,6 +81,7 @@ class RungeKuttaStats : public IntegratorStatsBase
         int rejectedSteps_;
 
         friend class ExplicitRungeKuttaBase;
+        friend class LowStorageRungeKuttaBase;
 };
 
 
@@ -81,13 +102,22 @@ class RungeKuttaChebyshevStats : public RungeKuttaStats
         void updateHistory( realtype time, realtype stepsize, int stage );
         void reset();
 
+        friend class StabilizedRungeKuttaBase;
         friend class RungeKuttaChebyshev;
+        friend class Rock2;
+        friend class Rock4;
 };
 
 
 
 class CVodeStats : public IntegratorStatsBase
 {
+    public:
+
+        long int acceptedSteps() const;
+        long int rejectedSteps() const;
+        long int rhsEvaluations() const;
+
     protected:
 
         CVodeStats();
@@ -112,18 +142,20 @@ class CVodeStats : public IntegratorStatsBase
 
 
 
-class CVodeBandStats : public CVodeStats
+class CVodeDlsStats : public CVodeStats
 {
     public:
 
         void printInfo() const;
+        long int rhsEvaluations() const;
 
     protected:
 
-        CVodeBandStats() { reset(); }
+        CVodeDlsStats() { reset(); }
 
         void reset()
         {
+            CVodeStats::reset();
             njevals = 0;
             nfevalsLS = 0;
         }
@@ -133,7 +165,7 @@ class CVodeBandStats : public CVodeStats
         long int njevals;
         long int nfevalsLS;
 
-        friend class CVodeBand;
+        friend class CVodeDls;
 };
 
 
@@ -143,6 +175,8 @@ class CVodeSpilsStats : public CVodeStats
     public:
 
         void printInfo() const;
+        long int rhsEvaluations() const;
+        long int jacobianProducts() const;
 
     protected:
 
@@ -157,6 +191,7 @@ class CVodeSpilsStats : public CVodeStats
             njvevals = 0;
             nfevalsLS = 0;
             nfevalsBP = 0;
+            npjevals = 0;
         }
 
         void update( void * cvodeMem );
@@ -172,13 +207,90 @@ class CVodeSpilsStats : public CVodeStats
         // BANDPRE stats
         long int nfevalsBP;
 
+        // Jacobian matrices of the sparse preconditioners
+        long int npjevals;
+
         friend class CVodeSpils;
 };
 
 
 
+class CVodeAdamsStats : public CVodeStats
+{
+    public:
+
+        void printInfo() const;
+
+    protected:
+
+        CVodeAdamsStats() { reset(); }
+
+        friend class CVodeAdams;
+};
+
+
+
+// Counts of the solvers run by StiffnessSwitching, summed over the periods
+// of each solver, including the current one, and the switches between them.
+class StiffnessSwitchingStats : public IntegratorStatsBase
+{
+    public:
+
+        void printInfo() const;
+        long int acceptedSteps() const;
+        long int rejectedSteps() const;
+        long int rhsEvaluations() const;
+        long int jacobianProducts() const;
+
+    protected:
+
+        StiffnessSwitchingStats();
+
+        void reset();
+        // adds the counts of the solver that is replaced
+        void endPeriod( const IntegratorStatsBase & stats );
+
+        const IntegratorStatsBase * active_;
+        bool stiff_;
+
+        // finished periods
+        long int acceptedSteps_;
+        long int rejectedSteps_;
+        long int rhsEvaluations_;
+        long int jacobianProducts_;
+        long int stiffSteps_;
+
+        long int spectralRadiusRhs_;
+        int switchesToStiff_;
+        int switchesToNonStiff_;
+        realtype lastStiffnessRatio_;
+
+        friend class StiffnessSwitching;
+};
+
+
+
 /* ------------------ Inline functions -------------------- */
 
+inline
+long int IntegratorStatsBase::jacobianProducts() const
+{
+    return 0;
+}
+
+inline
+realtype IntegratorStatsBase::lastStepsize() const
+{
+    return lastStepsize_;
+}
+
+inline
+int IntegratorStatsBase::lastStepValue() const
+{
+    return lastStepValue_;
+}
+
+
 inline
 void RungeKuttaStats::setRhsEvaluations( int numRhsEval )
 {
@@ -216,6 +328,62 @@ int RungeKuttaStats::getAcceptedSteps() const
     return acceptedSteps_;
 }
 
+inline
+long int RungeKuttaStats::acceptedSteps() const
+{
+    return acceptedSteps_;
+}
+
+inline
+long int RungeKuttaStats::rejectedSteps() const
+{
+    return rejectedSteps_;
+}
+
+inline
+long int RungeKuttaStats::rhsEvaluations() const
+{
+    return rhsEvaluations_;
+}
+
+inline
+long int CVodeStats::acceptedSteps() const
+{
+    return nsteps;
+}
+
+// steps rejected by the error test, the convergence failures of the
+// nonlinear solver also lead to a retry with a smaller step
+inline
+long int CVodeStats::rejectedSteps() const
+{
+    return netfails + nncfails;
+}
+
+inline
+long int CVodeStats::rhsEvaluations() const
+{
+    return nfevals;
+}
+
+inline
+long int CVodeDlsStats::rhsEvaluations() const
+{
+    return nfevals + nfevalsLS;
+}
+
+inline
+long int CVodeSpilsStats::rhsEvaluations() const
+{
+    return nfevals + nfevalsLS + nfevalsBP;
+}
+
+inline
+long int CVodeSpilsStats::jacobianProducts() const
+{
+    return njvevals;
+}
+
 inline
 void RungeKuttaStats::setRejectedSteps( int numRejSteps )
 {
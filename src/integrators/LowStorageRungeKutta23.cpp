@@ -0,0 +1,38 @@
+#include "LowStorageRungeKutta23.h"
+
+LowStorageRungeKutta23::LowStorageRungeKutta23()
+  : LowStorageRungeKuttaBase( 2, 4 ) // 2nd order, 4 stages
+{
+  solverName_ = "Low-storage Runge-Kutta 3(2)4[2R+]C (Kennedy, Carpenter, Lewis)";
+
+  b_(0) = 1017324711453.0/9774461848756.0;
+  b_(1) = 8237718856693.0/13685301971492.0;
+  b_(2) = 57731312506979.0/19404895981398.0;
+  b_(3) = -101169746363290.0/37734290219643.0;
+
+  e_(0) = 15763415370699.0/46270243929542.0 - b_(0);
+  e_(1) = 514528521746.0/5659431552419.0 - b_(1);
+  e_(2) = 27030193851939.0/9429696342944.0 - b_(2);
+  e_(3) = -69544964788955.0/30262026368149.0 - b_(3);
+
+  // 2R structure: below the subdiagonal A repeats the weights
+  for ( int i = 0; i < 4; i++ )
+    for ( int j = 0; j < 4; j++ )
+      a_(i,j) = j < i-1 ? b_(j) : 0.0;
+  a_(1,0) = 11847461282814.0/36547543011857.0;
+  a_(2,1) = 3943225443063.0/7078155732230.0;
+  a_(3,2) = -346793006927.0/4029903576067.0;
+
+  for ( int i = 0; i < 4; i++ )
+  {
+    c_(i) = 0.0;
+    for ( int j = 0; j < i; j++ )
+      c_(i) += a_(i,j);
+  }
+}
+
+
+OdeIntegratorBase * createLowStorageRungeKutta23Solver()
+{
+    return new LowStorageRungeKutta23();
+}
@@ -0,0 +1,13 @@
+#ifndef LOW_STORAGE_RUNGE_KUTTA_23_H
+#define LOW_STORAGE_RUNGE_KUTTA_23_H
+
+#include "LowStorageRungeKuttaBase.h"
+
+class LowStorageRungeKutta23 : public LowStorageRungeKuttaBase {
+  public:
+    LowStorageRungeKutta23();
+};
+
+OdeIntegratorBase * createLowStorageRungeKutta23Solver();
+
+#endif // LOW_STORAGE_RUNGE_KUTTA_23_H
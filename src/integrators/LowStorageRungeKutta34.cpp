@@ -0,0 +1,41 @@
+#include "LowStorageRungeKutta34.h"
+
+LowStorageRungeKutta34::LowStorageRungeKutta34()
+  : LowStorageRungeKuttaBase( 3, 5 ) // 3rd order, 5 stages
+{
+  solverName_ = "Low-storage Runge-Kutta 4(3)5[2R+]C (Kennedy, Carpenter, Lewis)";
+
+  b_(0) = 1153189308089.0/22510343858157.0;
+  b_(1) = 1772645290293.0/4653164025191.0;
+  b_(2) = -1672844663538.0/4480602732383.0;
+  b_(3) = 2114624349019.0/3568978502595.0;
+  b_(4) = 5198255086312.0/14908931495163.0;
+
+  e_(0) = 1016888040809.0/7410784769900.0 - b_(0);
+  e_(1) = 11231460423587.0/58533540763752.0 - b_(1);
+  e_(2) = -1563879915014.0/6823010717585.0 - b_(2);
+  e_(3) = 606302364029.0/971179775848.0 - b_(3);
+  e_(4) = 1097981568119.0/3980877426909.0 - b_(4);
+
+  // 2R structure: below the subdiagonal A repeats the weights
+  for ( int i = 0; i < 5; i++ )
+    for ( int j = 0; j < 5; j++ )
+      a_(i,j) = j < i-1 ? b_(j) : 0.0;
+  a_(1,0) = 970286171893.0/4311952581923.0;
+  a_(2,1) = 6584761158862.0/12103376702013.0;
+  a_(3,2) = 2251764453980.0/15575788980749.0;
+  a_(4,3) = 26877169314380.0/34165994151039.0;
+
+  for ( int i = 0; i < 5; i++ )
+  {
+    c_(i) = 0.0;
+    for ( int j = 0; j < i; j++ )
+      c_(i) += a_(i,j);
+  }
+}
+
+
+OdeIntegratorBase * createLowStorageRungeKutta34Solver()
+{
+    return new LowStorageRungeKutta34();
+}
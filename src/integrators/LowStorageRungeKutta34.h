@@ -0,0 +1,13 @@
+#ifndef LOW_STORAGE_RUNGE_KUTTA_34_H
+#define LOW_STORAGE_RUNGE_KUTTA_34_H
+
+#include "LowStorageRungeKuttaBase.h"
+
+class LowStorageRungeKutta34 : public LowStorageRungeKuttaBase {
+  public:
+    LowStorageRungeKutta34();
+};
+
+OdeIntegratorBase * createLowStorageRungeKutta34Solver();
+
+#endif // LOW_STORAGE_RUNGE_KUTTA_34_H
@@ -0,0 +1,92 @@
+#include "LowStorageRungeKuttaBase.h"
+#include "../odesystem/ExplicitOde.h"
+#include "../utils/LogStream.h"
+#include "../utils/MpiUtilities.h"
+#include "../utils/Profiler.h"
+
+LowStorageRungeKuttaBase::LowStorageRungeKuttaBase(
+        const int orderError,
+        const int stages )
+:
+    ExplicitRungeKuttaBase( orderError, stages, false )
+{}
+
+
+
+void
+LowStorageRungeKuttaBase::printInfo() const
+{
+    using namespace std;
+
+    ExplicitRungeKuttaBase::printInfo();
+
+    logger << "*Stage registers*:: 2 (low-storage 2R scheme)" << endl << endl;
+}
+
+
+
+// only the first stage vector is used, as the register of the stage derivatives
+void
+LowStorageRungeKuttaBase::allocateStages( const int neq )
+{
+    k_[0].reinit( neq );
+    stage_.reinit( neq );
+}
+
+
+
+void
+LowStorageRungeKuttaBase::calculateSolutionPoint()
+{
+    const realtype h = stepsize_;
+
+    {
+        ODEITY_PROBE( "vector kernels" );
+        newState_ = currentState_;
+        newLocalError_.equ( h * e_(0), k_[0] );
+    }
+
+    for ( int s = 1; s < stages_; s++ )
+    {
+        {
+            ODEITY_PROBE( "vector kernels" );
+            stage_.equ( 1.0, newState_, h * a_(s,s-1), k_[0] );
+            newState_.add( h * b_(s-1), k_[0] );
+        }
+
+        odeProblem_->rhs( currentTime_ + stepsize_*c_(s), stage_, k_[0] );
+        stats_.incRhsEvaluations();
+
+        {
+            ODEITY_PROBE( "vector kernels" );
+            newLocalError_.add( h * e_(s), k_[0] );
+        }
+    }
+
+    {
+        ODEITY_PROBE( "vector kernels" );
+        newState_.add( h * b_(stages_-1), k_[0] );
+    }
+
+    newTime_ = currentTime_ + stepsize_;
+}
+
+
+
+// the error has been accumulated with the stages
+void
+LowStorageRungeKuttaBase::estimateError()
+{
+    newLocalErrorNorm_ = globalRmsNorm( newLocalError_, weights_ );
+}
+
+
+
+void
+LowStorageRungeKuttaBase::handleRejectedStep()
+{
+    ExplicitRungeKuttaBase::handleRejectedStep();
+
+    odeProblem_->rhs( currentTime_, currentState_, k_[0] );
+    stats_.incRhsEvaluations();
+}
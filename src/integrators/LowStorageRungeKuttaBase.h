@@ -0,0 +1,46 @@
+#ifndef LOW_STORAGE_RUNGE_KUTTA_BASE_H
+#define LOW_STORAGE_RUNGE_KUTTA_BASE_H
+
+#include "ExplicitRungeKuttaBase.h"
+
+/* Embedded Runge-Kutta pairs of the 2R class of van der Houwen
+ * (Kennedy, Carpenter, Lewis: Low-storage, explicit Runge-Kutta schemes for
+ * the compressible Navier-Stokes equations, Appl. Numer. Math. 35, 2000).
+ * Below the subdiagonal the rows of A repeat the weights,
+ *
+ * 	A(i,j) = B(j)  for j < i-1,
+ *
+ * so the stage Y(i+1) is the partial sum of the new solution plus a
+ * multiple of the last stage derivative,
+ *
+ * 	Y(i+1) = X(i) + h A(i+1,i) f(Y(i)),   X(i+1) = X(i) + h B(i) f(Y(i)),
+ *
+ * and the stages are computed in two registers, k_[0] for f(Y(i)) and
+ * stage_ for Y(i), instead of one vector per stage. The error estimate is
+ * accumulated stage by stage in newLocalError_. Together with the current
+ * and the new state and the weights the integrator holds six vectors,
+ * whatever the number of stages.
+ *
+ * The derived classes fill a_ completely, but only the subdiagonal is used.
+ * k_[0] no longer holds f(y) at the start of the step after a rejected
+ * step, so it is evaluated again.
+ */
+class LowStorageRungeKuttaBase : public ExplicitRungeKuttaBase
+{
+  public:
+
+    void printInfo() const;
+
+  protected:
+
+    Vector<realtype> stage_;
+
+    LowStorageRungeKuttaBase( const int orderError, const int stages );
+
+    void allocateStages( const int neq );
+    void calculateSolutionPoint();
+    void estimateError();
+    void handleRejectedStep();
+};
+
+#endif // LOW_STORAGE_RUNGE_KUTTA_BASE_H
@@ -1,4 +1,5 @@
 #include "OdeIntegratorBase.h"
+#include "StepMonitor.h"
 #include "../odesystem/ExplicitOde.h"
 #include "../utils/ParameterHandler.h"
 #include "../utils/LogStream.h"
@@ -18,6 +19,7 @@ OdeIntegratorBase::OdeIntegratorBase()
     cubicEpsilon_( std::pow( std::numeric_limits<realtype>::epsilon(), 3.0 ) ),
     tiny_( std::sqrt( std::numeric_limits<realtype>::min() ) ),
     saveHistory_( false ),
+    stepMonitor_( 0 ),
     maxTol_( 0.1 ),
     minTol_( 10*std::numeric_limits<realtype>::epsilon() )
 { }
@@ -102,6 +104,26 @@ OdeIntegratorBase::saveHistory() const
 
 
 
+void
+OdeIntegratorBase::setStepMonitor( StepMonitor * monitor )
+{
+    stepMonitor_ = monitor;
+}
+
+
+
+// The history updates the statistics of the last step the monitor may
+// look at, so it is updated first.
+void
+OdeIntegratorBase::stepTaken()
+{
+    updateHistory();
+    if ( stepMonitor_ != 0 )
+        stepMonitor_->stepTaken( *this );
+}
+
+
+
 void
 OdeIntegratorBase::declareParameters( ParameterHandler & prm )
 {
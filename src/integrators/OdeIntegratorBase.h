@@ -13,6 +13,7 @@
 class ParameterHandler;
 class IntegratorStatsBase;
 class ExplicitOde;
+class StepMonitor;
 
 class OdeIntegratorBase
 {
@@ -43,6 +44,9 @@ class OdeIntegratorBase
 
         void setSaveHistory( bool save );
         bool saveHistory() const;
+
+        // monitor notified after every accepted step, zero for none
+        void setStepMonitor( StepMonitor * monitor );
         
         virtual void printInfo() const;
         virtual void getParameters( ParameterHandler &prm );
@@ -89,9 +93,14 @@ class OdeIntegratorBase
 
         std::string solverName_;
 
+        // whether the integrator has to call stepTaken() after each step
+        bool recordSteps() const;
+        void stepTaken();
+
     private:
 
         bool saveHistory_;
+        StepMonitor * stepMonitor_;
         const realtype maxTol_;
         const realtype minTol_;
 };
@@ -105,6 +114,14 @@ OdeIntegratorBase::integrateForwardDt( const realtype dt )
 }
 
 
+inline
+bool
+OdeIntegratorBase::recordSteps() const
+{
+    return saveHistory_ || stepMonitor_ != 0;
+}
+
+
 inline
 realtype
 OdeIntegratorBase::currentTime() const
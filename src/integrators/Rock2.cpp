@@ -0,0 +1,133 @@
+#include "Rock2.h"
+#include "RockCoefficients.h"
+#include "../odesystem/ExplicitOde.h"
+#include "../utils/MpiUtilities.h"
+#include "../utils/Profiler.h"
+
+#include <cmath>
+
+
+Rock2::Rock2()
+  :
+    StabilizedRungeKuttaBase( 1 ),
+    degree_( 0 )
+{
+  solverName_ = "Stabilized orthogonal Runge-Kutta-Chebyshev ROCK2";
+  maxStage_ = rock2Stages[rock2NumberOfDegrees - 1];
+}
+
+
+
+void Rock2::assignExplicitOde( ExplicitOde& odeProblem,
+    const realtype initialTime,
+    const Vector<realtype>& initialState )
+{
+  StabilizedRungeKuttaBase::assignExplicitOde( odeProblem, initialTime, initialState );
+
+  yjm1_.reinit( odeProblem.numberOfEquations() );
+  yjm2_.reinit( odeProblem.numberOfEquations() );
+}
+
+
+
+void Rock2::startStep()
+{
+  updateSpectralRadius();
+
+  // smallest tabulated degree whose stability interval covers h*rho
+  const realtype hrho = stepsize_ * spectralRadius_;
+  degree_ = 0;
+  while ( degree_ < rock2NumberOfDegrees - 1 && rock2StabilityBound[degree_] < hrho )
+    degree_++;
+
+  if ( rock2StabilityBound[degree_] < hrho )
+  {
+    stepsize_ = rock2StabilityBound[degree_] / spectralRadius_;
+    last_ = false;
+  }
+
+  stages_ = rock2Stages[degree_];
+}
+
+
+
+void Rock2::calculateSolutionPoint()
+{
+  const int m = stages_ - 2;
+  const realtype * const mu = rock2Mu + rock2Offset[degree_];
+  const realtype * const kappa = rock2Kappa + rock2Offset[degree_];
+  const realtype sigma = rock2Finishing[degree_][0];
+  const realtype tau = rock2Finishing[degree_][1];
+
+  // stage j lives in stage[j%3], stage 0 is the current state
+  Vector<realtype>* stage[3] = { &yjm2_, &yjm1_, &newState_ };
+
+  // first stage, nu_0 = 0
+  stage[1]->equ( 1.0, currentState_, stepsize_ * mu[0], fn_ );
+  realtype cjm2 = 0.0;
+  realtype cjm1 = mu[0];
+
+  for ( int j = 2; j <= m; j++ )
+  {
+    Vector<realtype>& yj = *stage[j%3];
+    const Vector<realtype>& yjm1 = *stage[(j-1)%3];
+    const Vector<realtype>& yjm2 = ( j == 2 ) ? currentState_ : *stage[(j-2)%3];
+    const realtype nu = 1.0 - kappa[j-1];
+
+    odeProblem_->rhs( currentTime_ + stepsize_ * cjm1, yjm1, yj );
+    stats_.incRhsEvaluations();
+
+    {
+      ODEITY_PROBE( "vector kernels" );
+      yj.sadd( stepsize_ * mu[j-1], kappa[j-1], yjm1, nu, yjm2 );
+    }
+
+    const realtype cj = kappa[j-1] * cjm1 + nu * cjm2 + mu[j-1];
+    cjm2 = cjm1;
+    cjm1 = cj;
+  }
+
+  // two-stage finishing procedure
+  Vector<realtype>& g = *stage[m%3];
+  Vector<realtype>& f0 = *stage[(m+1)%3];
+  Vector<realtype>& y = *stage[(m+2)%3];
+
+  odeProblem_->rhs( currentTime_ + stepsize_ * cjm1, g, f0 );
+  stats_.incRhsEvaluations();
+
+  y.equ( 1.0, g, stepsize_ * sigma, f0 );
+
+  Vector<realtype>& f1 = g;
+  odeProblem_->rhs( currentTime_ + stepsize_ * ( cjm1 + sigma ), y, f1 );
+  stats_.incRhsEvaluations();
+
+  const realtype e = stepsize_ * sigma * ( 1.0 - tau / ( sigma * sigma ) );
+  newLocalError_.equ( e, f1, -e, f0 );
+  y.add( stepsize_ * sigma, f1, -1.0, newLocalError_ );
+
+  if ( &y != &newState_ )
+    swap( newState_, y );
+
+  newTime_ = currentTime_ + stepsize_;
+
+  odeProblem_->rhs( newTime_, newState_, temp1_ );
+  stats_.incRhsEvaluations();
+}
+
+
+
+void Rock2::estimateError()
+{
+  temp2_.maxabs( currentState_, newState_ );
+  calculateWeights( temp2_ );
+
+  // the local error has been computed together with the finishing stages
+  newLocalErrorNorm_ = globalRmsNorm( newLocalError_, weights_ );
+}
+
+
+
+OdeIntegratorBase * createRock2Solver()
+{
+    return new Rock2();
+}
@@ -0,0 +1,36 @@
+#ifndef ROCK2_H
+#define ROCK2_H
+
+#include "StabilizedRungeKuttaBase.h"
+
+class ExplicitOde;
+
+// Second order orthogonal-Runge-Kutta-Chebyshev method ROCK2 (Abdulle,
+// Medovikov 2001). The internal stages follow the three-term recurrence of
+// orthogonal polynomials, the last two stages form a composition that
+// realizes the second order finishing polynomial and provides an embedded
+// first order error estimate.
+class Rock2 : public StabilizedRungeKuttaBase
+{
+  public:
+    Rock2();
+
+    void assignExplicitOde( ExplicitOde& odeProblem,
+                            const realtype initialTime,
+                            const Vector<realtype>& initialState );
+
+  private:
+
+    int degree_; // index into the coefficient tables
+
+    Vector<realtype> yjm1_;
+    Vector<realtype> yjm2_;
+
+    void startStep();
+    void calculateSolutionPoint();
+    void estimateError();
+};
+
+OdeIntegratorBase * createRock2Solver();
+
+#endif // ROCK2_H
@@ -0,0 +1,149 @@
+#include "Rock4.h"
+#include "RockCoefficients.h"
+#include "../odesystem/ExplicitOde.h"
+#include "../utils/MpiUtilities.h"
+#include "../utils/Profiler.h"
+
+#include <cmath>
+
+
+Rock4::Rock4()
+  :
+    StabilizedRungeKuttaBase( 3 ),
+    degree_( 0 )
+{
+  solverName_ = "Stabilized orthogonal Runge-Kutta-Chebyshev ROCK4";
+  maxStage_ = rock4Stages[rock4NumberOfDegrees - 1];
+}
+
+
+
+void Rock4::assignExplicitOde( ExplicitOde& odeProblem,
+    const realtype initialTime,
+    const Vector<realtype>& initialState )
+{
+  StabilizedRungeKuttaBase::assignExplicitOde( odeProblem, initialTime, initialState );
+
+  yjm1_.reinit( odeProblem.numberOfEquations() );
+  yjm2_.reinit( odeProblem.numberOfEquations() );
+  for ( int i = 0; i < 4; i++ )
+    k_[i].reinit( odeProblem.numberOfEquations() );
+}
+
+
+
+void Rock4::startStep()
+{
+  updateSpectralRadius();
+
+  // smallest tabulated degree whose stability interval covers h*rho
+  const realtype hrho = stepsize_ * spectralRadius_;
+  degree_ = 0;
+  while ( degree_ < rock4NumberOfDegrees - 1 && rock4StabilityBound[degree_] < hrho )
+    degree_++;
+
+  if ( rock4StabilityBound[degree_] < hrho )
+  {
+    stepsize_ = rock4StabilityBound[degree_] / spectralRadius_;
+    last_ = false;
+  }
+
+  stages_ = rock4Stages[degree_];
+}
+
+
+
+void Rock4::calculateSolutionPoint()
+{
+  const int m = stages_ - 4;
+  const realtype * const mu = rock4Mu + rock4Offset[degree_];
+  const realtype * const kappa = rock4Kappa + rock4Offset[degree_];
+  const realtype * const a = rock4Finishing[degree_];
+  const realtype * const b = a + 6;
+  const realtype * const bh = a + 10;
+  const realtype h = stepsize_;
+
+  // stage j lives in stage[j%3], stage 0 is the current state
+  Vector<realtype>* stage[3] = { &yjm2_, &yjm1_, &newState_ };
+
+  // first stage, nu_0 = 0
+  stage[1]->equ( 1.0, currentState_, h * mu[0], fn_ );
+  realtype cjm2 = 0.0;
+  realtype cjm1 = mu[0];
+
+  for ( int j = 2; j <= m; j++ )
+  {
+    Vector<realtype>& yj = *stage[j%3];
+    const Vector<realtype>& yjm1 = *stage[(j-1)%3];
+    const Vector<realtype>& yjm2 = ( j == 2 ) ? currentState_ : *stage[(j-2)%3];
+    const realtype nu = 1.0 - kappa[j-1];
+
+    odeProblem_->rhs( currentTime_ + h * cjm1, yjm1, yj );
+    stats_.incRhsEvaluations();
+
+    {
+      ODEITY_PROBE( "vector kernels" );
+      yj.sadd( h * mu[j-1], kappa[j-1], yjm1, nu, yjm2 );
+    }
+
+    const realtype cj = kappa[j-1] * cjm1 + nu * cjm2 + mu[j-1];
+    cjm2 = cjm1;
+    cjm1 = cj;
+  }
+
+  // four-stage finishing procedure
+  Vector<realtype>& g = *stage[m%3];
+  Vector<realtype>& y = *stage[(m+1)%3];
+  const realtype c = currentTime_ + h * cjm1;
+
+  odeProblem_->rhs( c, g, k_[0] );
+  stats_.incRhsEvaluations();
+
+  y.equ( 1.0, g, h * a[0], k_[0] );
+  odeProblem_->rhs( c + h * a[0], y, k_[1] );
+  stats_.incRhsEvaluations();
+
+  y.equ( 1.0, g, h * a[1], k_[0] );
+  y.add( h * a[2], k_[1] );
+  odeProblem_->rhs( c + h * ( a[1] + a[2] ), y, k_[2] );
+  stats_.incRhsEvaluations();
+
+  y.equ( 1.0, g, h * a[3], k_[0] );
+  y.add( h * a[4], k_[1], h * a[5], k_[2] );
+  odeProblem_->rhs( c + h * ( a[3] + a[4] + a[5] ), y, k_[3] );
+  stats_.incRhsEvaluations();
+
+  g.add( h * b[0], k_[0], h * b[1], k_[1] );
+  g.add( h * b[2], k_[2], h * b[3], k_[3] );
+
+  if ( &g != &newState_ )
+    swap( newState_, g );
+
+  newTime_ = currentTime_ + h;
+
+  odeProblem_->rhs( newTime_, newState_, temp1_ );
+  stats_.incRhsEvaluations();
+
+  // difference to the embedded third order solution
+  newLocalError_.equ( h * ( b[0] - bh[0] ), k_[0], h * ( b[1] - bh[1] ), k_[1] );
+  newLocalError_.add( h * ( b[2] - bh[2] ), k_[2], h * ( b[3] - bh[3] ), k_[3] );
+  newLocalError_.add( - h * bh[4], temp1_ );
+}
+
+
+
+void Rock4::estimateError()
+{
+  temp2_.maxabs( currentState_, newState_ );
+  calculateWeights( temp2_ );
+
+  // the local error has been computed together with the finishing stages
+  newLocalErrorNorm_ = globalRmsNorm( newLocalError_, weights_ );
+}
+
+
+
+OdeIntegratorBase * createRock4Solver()
+{
+    return new Rock4();
+}
@@ -0,0 +1,37 @@
+#ifndef ROCK4_H
+#define ROCK4_H
+
+#include "StabilizedRungeKuttaBase.h"
+
+class ExplicitOde;
+
+// Fourth order orthogonal-Runge-Kutta-Chebyshev method ROCK4 (Abdulle 2002).
+// The internal stages follow the three-term recurrence of orthogonal
+// polynomials and are completed by a four-stage explicit finishing procedure
+// which gives the method order four. The error is estimated by an embedded
+// third order method that also uses f at the new solution point.
+class Rock4 : public StabilizedRungeKuttaBase
+{
+  public:
+    Rock4();
+
+    void assignExplicitOde( ExplicitOde& odeProblem,
+                            const realtype initialTime,
+                            const Vector<realtype>& initialState );
+
+  private:
+
+    int degree_; // index into the coefficient tables
+
+    Vector<realtype> yjm1_;
+    Vector<realtype> yjm2_;
+    Vector<realtype> k_[4];
+
+    void startStep();
+    void calculateSolutionPoint();
+    void estimateError();
+};
+
+OdeIntegratorBase * createRock4Solver();
+
+#endif // ROCK4_H
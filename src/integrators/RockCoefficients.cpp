@@ -0,0 +1,3870 @@
+#include "RockCoefficients.h"
+
+// Coefficients of the ROCK2 and ROCK4 methods for a selection of degrees.
+//
+// For a degree s, the first s-2 (ROCK2) or s-4 (ROCK4) stages follow the
+// three-term recurrence of polynomials orthogonal with respect to the weight
+// w(z)^2/sqrt(1-x^2), z = l(x-1)/2, on the stability interval [-l,0]. The
+// recurrence is stored as mu_j and kappa_j, nu_j = 1 - kappa_j, with the
+// entries of a degree starting at the position given by the offset table.
+// The stability bound l is the largest one for which the damping of the
+// stability polynomial stays below 0.95 away from the origin.
+//
+// ROCK2 finishing: sigma and tau, where w(z) = 1 + 2 sigma z + tau z^2.
+// ROCK4 finishing: a21, a31, a32, a41, a42, a43, b1, b2, b3, b4 of the
+// explicit four-stage finishing procedure, followed by the weights
+// bh1, ..., bh5 of the embedded third order method (bh5 multiplies the
+// right hand side at the new solution point).
+
+
+// ROCK2, degrees 3 to 200.
+
+const int rock2NumberOfDegrees = 53;
+
+
+
+const int rock2Stages[53] =
+{
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+    13, 14, 15, 16, 17, 18, 19, 20, 22, 24,
+    26, 28, 30, 32, 34, 36, 38, 40, 44, 48,
+    52, 56, 60, 64, 68, 72, 76, 80, 88, 96,
+    104, 112, 120, 128, 136, 144, 152, 160, 168, 176,
+    184, 192, 200
+};
+
+
+
+const realtype rock2StabilityBound[53] =
+{
+    6.0671623509104560e+00, 1.1714530541813140e+01, 1.8950673851735694e+01,
+    2.7786050370119547e+01, 3.8223916216840607e+01, 5.0265571637289824e+01,
+    6.3911622169655331e+01, 7.9162381678588631e+01, 9.6018026322678793e+01,
+    1.1447866127499040e+02, 1.3454435251579901e+02, 1.5621514315516029e+02,
+    1.7949106233463743e+02, 2.0437213033084754e+02, 2.3085836160745862e+02,
+    2.5894976670734991e+02, 2.8864635346287287e+02, 3.1994812779151829e+02,
+    3.8736725631107851e+02, 4.6120717792420521e+02, 5.4146790879625587e+02,
+    6.2814945952329742e+02, 7.2125183728604657e+02, 8.2077504709071445e+02,
+    9.2671909251408169e+02, 1.0390839761668235e+03, 1.1578696999900990e+03,
+    1.2830762654524874e+03, 1.5527519255513721e+03, 1.8481109628389563e+03,
+    2.1691533813375027e+03, 2.5158791836855553e+03, 2.8882883716684582e+03,
+    3.2863809465366589e+03, 3.7101569091816264e+03, 4.1596162602546428e+03,
+    4.6347590002403558e+03, 5.1355851295035663e+03, 6.2142875569277694e+03,
+    7.3957235441198927e+03, 8.6798930920831153e+03, 1.0066796201463223e+04,
+    1.1556432872753965e+04, 1.3148803106213505e+04, 1.4843906902076835e+04,
+    1.6641744260529558e+04, 1.8542315181678896e+04, 2.0545619665598722e+04,
+    2.2651657712384062e+04, 2.4860429322097661e+04, 2.7171934494745205e+04,
+    2.9586173230401051e+04, 3.2103145528908855e+04
+};
+
+
+
+const int rock2Offset[53] =
+{
+    0, 1, 3, 6, 10, 15, 21, 28, 36, 45,
+    55, 66, 78, 91, 105, 120, 136, 153, 171, 191,
+    213, 237, 263, 291, 321, 353, 387, 423, 461, 503,
+    549, 599, 653, 711, 773, 839, 909, 983, 1061, 1147,
+    1241, 1343, 1453, 1571, 1697, 1831, 1973, 2123, 2281, 2447,
+    2621, 2803, 2993
+};
+
+
+
+const realtype rock2Mu[3191] =
+{
+    1.8230338155208828e-01, 9.3910132875565086e-02, 1.2838480799525168e-01,
+    5.8205862144228793e-02, 7.8231134196170490e-02, 9.6468228206783885e-02,
+    3.9775458625292796e-02, 5.3649310573886513e-02, 6.4299900260201173e-02,
+    7.5205867438675328e-02, 2.8951682010944387e-02, 3.9205669206007938e-02,
+    4.6871855454785671e-02, 5.3186650270642274e-02, 6.0215876333060421e-02,
+    2.2035630356654925e-02, 2.9931342067705542e-02, 3.5822463365657753e-02,
+    4.0418736694987079e-02, 4.4477593739008565e-02, 4.9244767163904503e-02,
+    1.7341629820632538e-02, 2.3608837815295079e-02, 2.8296532132725743e-02,
+    3.1905133475054644e-02, 3.4855483855527412e-02, 3.7624547050263919e-02,
+    4.0981690427072351e-02, 1.4007177728098737e-02, 1.9101741149422091e-02,
+    2.2924078673984480e-02, 2.5858709787987946e-02, 2.8198654406665101e-02,
+    3.0200410364485692e-02, 3.2175585792987418e-02, 3.4610812228740531e-02,
+    1.1552251006965660e-02, 1.5774366015141993e-02, 1.8951071631716949e-02,
+    2.1391057412365803e-02, 2.3320579009183856e-02, 2.4913058288266694e-02,
+    2.6333257469635968e-02, 2.7790907469801261e-02, 2.9600812070755943e-02,
+    9.6919252338968521e-03, 1.3247474763198649e-02, 1.5929111678407076e-02,
+    1.7991526088538191e-02, 1.9618443908164820e-02, 2.0942319743524961e-02,
+    2.2071108155903484e-02, 2.3115660010319422e-02, 2.4220460514741228e-02,
+    2.5593475292627631e-02, 8.2482058652940549e-03, 1.1283110578621233e-02,
+    1.3576695766276551e-02, 1.5343263694173112e-02, 1.6736341862675246e-02,
+    1.7863548417093162e-02, 1.8805711089742206e-02, 1.9633648723743412e-02,
+    2.0424669804337072e-02, 2.1280207162693129e-02, 2.2340351104278219e-02,
+    7.1051619016622106e-03, 9.7257163569125730e-03, 1.1709503520850432e-02,
+    1.3239614061355235e-02, 1.4446801366850646e-02, 1.5421504260391143e-02,
+    1.6228889701224283e-02, 1.6920773469794922e-02, 1.7545758948204416e-02,
+    1.8159250021802468e-02, 1.8833603627626889e-02, 1.9664909763487205e-02,
+    6.1846163998772099e-03, 8.4700723619660113e-03, 1.0202631384368074e-02,
+    1.1540673841824939e-02, 1.2597135672177516e-02, 1.3449612598816633e-02,
+    1.4152848149373311e-02, 1.4748062148255794e-02, 1.5270053595667989e-02,
+    1.5753415442516093e-02, 1.6238693189497912e-02, 1.6778233231287756e-02,
+    1.7439059871109545e-02, 5.4322778919313544e-03, 7.4429204942670071e-03,
+    8.9689633284299863e-03, 1.0148846550041382e-02, 1.1081214283062557e-02,
+    1.1833605188022766e-02, 1.2453141856629357e-02, 1.2974262139267053e-02,
+    1.3424200648566448e-02, 1.3827293493204681e-02, 1.4208876488311850e-02,
+    1.4599117769207833e-02, 1.5036370053415123e-02, 1.5568116992391849e-02,
+    4.8094785921559118e-03, 6.5919731676420063e-03, 7.9462210013570116e-03,
+    8.9943163254964775e-03, 9.8232245393861817e-03, 1.0492372681409970e-02,
+    1.1042973588213063e-02, 1.1504653280619139e-02, 1.1899954437648816e-02,
+    1.2247607130982873e-02, 1.2565215981107436e-02, 1.2871757973830241e-02,
+    1.3189987600681604e-02, 1.3548333021322826e-02, 1.3980923716631097e-02,
+    4.2880678917183524e-03, 5.8790960020528591e-03, 7.0889187442919376e-03,
+    8.0260513510190465e-03, 8.7677739761102894e-03, 9.3668358760099144e-03,
+    9.8596932825091542e-03, 1.0272309393771972e-02, 1.0623999976501220e-02,
+    1.0930087919317868e-02, 1.1203917458851893e-02, 1.1458581120552867e-02,
+    1.1708548090916241e-02, 1.1971180528780866e-02, 1.2267778127248063e-02,
+    1.2623203434182793e-02, 3.8471540502043283e-03, 5.2759447369166669e-03,
+    6.3632057634056384e-03, 7.2060417018030122e-03, 7.8736017343118258e-03,
+    8.4130529775493512e-03, 8.8569275283269557e-03, 9.2282682099202214e-03,
+    9.5439923126515933e-03, 9.8171416498585851e-03, 1.0058495805864274e-02,
+    1.0277854603926613e-02, 1.0485176046523314e-02, 1.0691651887375985e-02,
+    1.0910664140137034e-02, 1.1158332479194094e-02, 1.1452996362175998e-02,
+    3.4709666192757073e-03, 4.7610954000730952e-03, 5.7434676931183122e-03,
+    6.5055027514221795e-03, 7.1094518660664427e-03, 7.5977588549371901e-03,
+    7.9996615284082771e-03, 8.3358016809819187e-03, 8.6212137262462844e-03,
+    8.8672859453756882e-03, 9.0831147568777339e-03, 9.2765193236986360e-03,
+    9.4548832396842766e-03, 9.6259197168653172e-03, 9.7983887105907493e-03,
+    9.9826978609435131e-03, 1.0191161864654231e-02, 1.0437466888776233e-02,
+    2.8671229839874230e-03, 3.9342083197916608e-03, 4.7475916000207135e-03,
+    5.3792386211602029e-03, 5.8803986887568252e-03, 6.2859980390141453e-03,
+    6.6200641901433674e-03, 6.8995040813043069e-03, 7.1365341225021871e-03,
+    7.3402451086740034e-03, 7.5176409485299116e-03, 7.6743634143765236e-03,
+    7.8152341527543568e-03, 7.9446959038106668e-03, 8.0672025627152033e-03,
+    8.1875807483577159e-03, 8.3113534215586028e-03, 8.4449682316212714e-03,
+    8.5958018062236990e-03, 8.7717230102373304e-03, 2.4082583513547868e-03,
+    3.3054627039447431e-03, 3.9899061539733129e-03, 4.5218851154660445e-03,
+    4.9443423021407456e-03, 5.2865366486392548e-03, 5.5685846469678306e-03,
+    5.8046209097093260e-03, 6.0048249450339285e-03, 6.1767168228660319e-03,
+    6.3260034795501949e-03, 6.4571507527896085e-03, 6.5737881782496925e-03,
+    6.6790129013482753e-03, 6.7756346367892819e-03, 6.8663879359970896e-03,
+    6.9541260062217641e-03, 7.0419979267551313e-03, 7.1335945387730904e-03,
+    7.2330241782014321e-03, 7.3448469362693202e-03, 7.4737624562150702e-03,
+    2.0513970457751774e-03, 2.8162500595848377e-03, 3.4000982703115972e-03,
+    3.8542051358879657e-03, 4.2150833881899946e-03, 4.5076081649719092e-03,
+    4.7488766238530716e-03, 4.9508935544704327e-03, 5.1222915301276858e-03,
+    5.2694272128054149e-03, 5.3970925940887834e-03, 5.5089891011618685e-03,
+    5.6080544521267739e-03, 5.6966974904905116e-03, 5.7769757005967873e-03,
+    5.8507376940992190e-03, 5.9197450084410410e-03, 5.9857817410581219e-03,
+    6.0507551498829044e-03, 6.1167838930836224e-03, 6.1862616868609780e-03,
+    6.2618719444175550e-03, 6.3465142235883476e-03, 6.4430909056383606e-03,
+    1.7683897338411317e-03, 2.4281355599866006e-03, 2.9320067130794380e-03,
+    3.3241286717389778e-03, 3.6359327203278214e-03, 3.8888309035764123e-03,
+    4.0975375511745410e-03, 4.2723805425712675e-03, 4.4207809610914131e-03,
+    4.5481948586930934e-03, 4.6587223894275333e-03, 4.7555113071842117e-03,
+    4.8410317781623175e-03, 4.9172695578910018e-03, 4.9858668905306087e-03,
+    5.0482299009374683e-03, 5.1056147512844232e-03, 5.1592006423938127e-03,
+    5.2101547447487209e-03, 5.2596915681194728e-03, 5.3091264848667613e-03,
+    5.3599195313667513e-03, 5.4137007570896206e-03, 5.4722621890636938e-03,
+    5.5374948461571699e-03, 5.6112450609896196e-03, 1.5401712328724337e-03,
+    2.1150632172903076e-03, 2.5543100243257439e-03, 2.8962970975222528e-03,
+    3.1683690661528014e-03, 3.3891534396344792e-03, 3.5714496663875363e-03,
+    3.7242396741063036e-03, 3.8539747464369271e-03, 3.9653940823603778e-03,
+    4.0620534864667475e-03, 4.1466745390591458e-03, 4.2213810247252372e-03,
+    4.2878633498935571e-03, 4.3474962599904026e-03, 4.4014259499099732e-03,
+    4.4506370505155929e-03, 4.4960064670586776e-03, 4.5383487576009509e-03,
+    4.5784561215454879e-03, 4.6171347453435492e-03, 4.6552379311399633e-03,
+    4.6936948563055256e-03, 4.7335317526220038e-03, 4.7758796251806054e-03,
+    4.8219594857515187e-03, 4.8730331438202254e-03, 4.9303065163508342e-03,
+    1.3534557273280517e-03, 1.8588618224772606e-03, 2.2451493070400680e-03,
+    2.5460179028289971e-03, 2.7854758813224967e-03, 2.9798777315098971e-03,
+    3.1404602954209562e-03, 3.2751079144794060e-03, 3.3894821564195233e-03,
+    3.4877402020375699e-03, 3.5729985101728640e-03, 3.6476385902642441e-03,
+    3.7135134449415709e-03, 3.7720903588737273e-03, 3.8245521556393397e-03,
+    3.8718709401725383e-03, 3.9148634163949456e-03, 3.9542338106162136e-03,
+    3.9906084832267126e-03, 4.0245650232855817e-03, 4.0566577118372827e-03,
+    4.0874405206316354e-03, 4.1174881399658964e-03, 4.1474147805455660e-03,
+    4.1778895612666778e-03, 4.2096460968169972e-03, 4.2434824282457685e-03,
+    4.2802458522241144e-03, 4.3207959587259221e-03, 4.3659391896348617e-03,
+    1.1987545159925085e-03, 1.6465455220445848e-03, 1.9888941771811519e-03,
+    2.2556248994908597e-03, 2.4679863814439902e-03, 2.6404531851769403e-03,
+    2.7829700511235035e-03, 2.9025141157712105e-03, 3.0040947444104934e-03,
+    3.0913892277927828e-03, 3.1671529291046156e-03, 3.2334895562863009e-03,
+    3.2920333615926059e-03, 3.3440748071534815e-03, 3.3906492307439243e-03,
+    3.4326008658413744e-03, 3.4706302033447873e-03, 3.5053299747630131e-03,
+    3.5372133222958129e-03, 3.5667366091335969e-03, 3.5943185776993541e-03,
+    3.6203570361215006e-03, 3.6452438442687142e-03, 3.6693786064214088e-03,
+    3.6931810972176105e-03, 3.7171019971648680e-03, 3.7416309492232071e-03,
+    3.7673002463129855e-03, 3.7946816492590834e-03, 3.8243730422322965e-03,
+    3.8569711457515435e-03, 3.8930268256479363e-03, 1.0691441048785999e-03,
+    1.4686342716288127e-03, 1.7741284445763497e-03, 2.0122090834544595e-03,
+    2.2018161007978758e-03, 2.3558513046665697e-03, 2.4831786080668399e-03,
+    2.5900164832739427e-03, 2.6808291524315769e-03, 2.7588931702272790e-03,
+    2.8266629094922564e-03, 2.8860113042903685e-03, 2.9383920109322570e-03,
+    2.9849510823849925e-03, 3.0266055472994630e-03, 3.0640998808565711e-03,
+    3.0980474588235664e-03, 3.1289616704943610e-03, 3.1572798382885872e-03,
+    3.1833821055092938e-03, 3.2076068025480727e-03, 3.2302633590659499e-03,
+    3.2516435147868176e-03, 3.2720313402737587e-03, 3.2917123718286126e-03,
+    3.3109819596115150e-03, 3.3301526975420153e-03, 3.3495605235858740e-03,
+    3.3695687330438087e-03, 3.3905687353627976e-03, 3.4129759399126156e-03,
+    3.4372187688756837e-03, 3.4637186416496810e-03, 3.4928591304737274e-03,
+    9.5947668049184713e-04, 1.3180763905089059e-03, 1.5923567615615274e-03,
+    1.8061605167587335e-03, 1.9764762929029558e-03, 2.1148767143678647e-03,
+    2.2293123403323654e-03, 2.3253606481373310e-03, 2.4070254158775482e-03,
+    2.4772449214442750e-03, 2.5382197329721474e-03, 2.5916285731507963e-03,
+    2.6387736563171114e-03, 2.6806806917384117e-03, 2.7181691429662576e-03,
+    2.7519025867316763e-03, 2.7824255183358558e-03, 2.8101907818866372e-03,
+    2.8355804321597614e-03, 2.8589219504485987e-03, 2.8805011552913875e-03,
+    2.9005727585447228e-03, 2.9193692481720604e-03, 2.9371085863858252e-03,
+    2.9540010650157124e-03, 2.9702555371572811e-03, 2.9860851279134761e-03,
+    3.0017124025597977e-03, 3.0173738247532664e-03, 3.0333231601978321e-03,
+    3.0498332679441274e-03, 3.0671954793986518e-03, 3.0857155223786427e-03,
+    3.1057047656629392e-03, 3.1274655445554535e-03, 3.1512696325073902e-03,
+    8.6586026246761587e-04, 1.1895385747944080e-03, 1.4371517272801356e-03,
+    1.6302061253794448e-03, 1.7840263298510945e-03, 1.9090514359889294e-03,
+    2.0124531467468859e-03, 2.0992624038987328e-03, 2.1730904785592616e-03,
+    2.2365873914454862e-03, 2.2917375793181233e-03, 2.3400545789700384e-03,
+    2.3827120698529129e-03, 2.4206339974946708e-03, 2.4545578359131018e-03,
+    2.4850798625235134e-03, 2.5126881638520802e-03, 2.5377871330976337e-03,
+    2.5607159824657124e-03, 2.5817629949023558e-03, 2.6011767155431137e-03,
+    2.6191749324659128e-03, 2.6359520571075760e-03, 2.6516853476337781e-03,
+    2.6665402979455287e-03, 2.6806754233636653e-03, 2.6942465987289028e-03,
+    2.7074110358684920e-03, 2.7203309168831453e-03, 2.7331766202913278e-03,
+    2.7461293826783195e-03, 2.7593831252141960e-03, 2.7731450426216695e-03,
+    2.7876344102245147e-03, 2.8030789340337636e-03, 2.8197078898733966e-03,
+    2.8377413340651527e-03, 2.8573749051360228e-03, 7.1549749311659503e-04,
+    9.8305619497609793e-04, 1.1877952052436677e-03, 1.3474730617677199e-03,
+    1.4747446049910137e-03, 1.5782303977350972e-03, 1.6638526981269308e-03,
+    1.7357657998623875e-03, 1.7969515158419806e-03, 1.8495977466700534e-03,
+    1.8953426340528490e-03, 1.9354353063559566e-03, 1.9708440504291342e-03,
+    2.0023306711617170e-03, 2.0305026447489135e-03, 2.0558503891982397e-03,
+    2.0787743691085148e-03, 2.0996051345115044e-03, 2.1186183702567940e-03,
+    2.1360463724517187e-03, 2.1520869350261256e-03, 2.1669103398850695e-03,
+    2.1806649474143606e-03, 2.1934817483432794e-03, 2.2054781426847610e-03,
+    2.2167611432850616e-03, 2.2274301514554930e-03, 2.2375794140171148e-03,
+    2.2473002403790151e-03, 2.2566830315572713e-03, 2.2658191475310183e-03,
+    2.2748026126173902e-03, 2.2837316285288004e-03, 2.2927098297363781e-03,
+    2.3018471746716089e-03, 2.3112603193811399e-03, 2.3210722699128568e-03,
+    2.3314110617907936e-03, 2.3424071801555289e-03, 2.3541894293350636e-03,
+    2.3668790088312379e-03, 2.3805816809106522e-03, 6.0115947125250683e-04,
+    8.2601894157130864e-04, 9.9812073359735226e-04, 1.1323772245363877e-03,
+    1.2394156309389181e-03, 1.3264753604052900e-03, 1.3985297845388780e-03,
+    1.4590674999896535e-03, 1.5105924109004739e-03, 1.5549416517369114e-03,
+    1.5934906258065497e-03, 1.6272879927466842e-03, 1.6571464983444976e-03,
+    1.6837054017049778e-03, 1.7074742454786958e-03, 1.7288641182090592e-03,
+    1.7482103686330889e-03, 1.7657893733075561e-03, 1.7818310992523069e-03,
+    1.7965286487647959e-03, 1.8100456092827522e-03, 1.8225217877414210e-03,
+    1.8340777435617715e-03, 1.8448184204388610e-03, 1.8548360973921544e-03,
+    1.8642128230053764e-03, 1.8730224561004558e-03, 1.8813324063327776e-03,
+    1.8892051459803169e-03, 1.8966995471429383e-03, 1.9038720849325649e-03,
+    1.9107779356992299e-03, 1.9174719888442248e-03, 1.9240097804296523e-03,
+    1.9304483458257983e-03, 1.9368469763711500e-03, 1.9432678509188443e-03,
+    1.9497764969115244e-03, 1.9564420173716962e-03, 1.9633370006931525e-03,
+    1.9705370111559243e-03, 1.9781195428613990e-03, 1.9861623132712207e-03,
+    1.9947407816344755e-03, 2.0039248107753486e-03, 2.0137744567820556e-03,
+    5.1219265785306582e-04, 7.0381269481696628e-04, 8.5049829116368310e-04,
+    9.6494944343445820e-04, 1.0562171160355604e-03, 1.1304670141859380e-03,
+    1.1919348736952541e-03, 1.2435918311689490e-03, 1.2875703392745772e-03,
+    1.3254349423018875e-03, 1.3583569080996870e-03, 1.3872291957267224e-03,
+    1.4127438115784288e-03, 1.4354449722107541e-03, 1.4557663739754412e-03,
+    1.4740578062398463e-03, 1.4906044803010660e-03, 1.5056412889928672e-03,
+    1.5193634796829649e-03, 1.5319347509458673e-03, 1.5434934728311182e-03,
+    1.5541575232111318e-03, 1.5640280918046343e-03, 1.5731927063338349e-03,
+    1.5817276673530379e-03, 1.5897000301641350e-03, 1.5971692377078385e-03,
+    1.6041884832410569e-03, 1.6108058631641709e-03, 1.6170653666037040e-03,
+    1.6230077379210464e-03, 1.6286712402271729e-03, 1.6340923415161484e-03,
+    1.6393063396366889e-03, 1.6443479375665322e-03, 1.6492517759771552e-03,
+    1.6540529255664094e-03, 1.6587873368198089e-03, 1.6634922395043945e-03,
+    1.6682064781212134e-03, 1.6729707626515608e-03, 1.6778278062781185e-03,
+    1.6828223136200568e-03, 1.6880007749925394e-03, 1.6934110153404385e-03,
+    1.6991014424238156e-03, 1.7051199398061075e-03, 1.7115123590614556e-03,
+    1.7183205855511399e-03, 1.7255801860512488e-03, 4.4160958539052201e-04,
+    6.0684928875524412e-04, 7.3335743395339570e-04, 8.3208016735120398e-04,
+    9.1081880055471191e-04, 9.7488779868463407e-04, 1.0279381044296662e-03,
+    1.0725306316386133e-03, 1.1105033787074201e-03, 1.1432048238978038e-03,
+    1.1716444502445119e-03, 1.1965918421733585e-03, 1.2186433618136597e-03,
+    1.2382679706909557e-03, 1.2558393509812334e-03, 1.2716588400442479e-03,
+    1.2859720846693575e-03, 1.2989813240524650e-03, 1.3108545792707555e-03,
+    1.3217326197816706e-03, 1.3317343099078247e-03, 1.3409607594263070e-03,
+    1.3494985808986653e-03, 1.3574224726098140e-03, 1.3647972874051802e-03,
+    1.3716797062115892e-03, 1.3781196052579923e-03, 1.3841611844112654e-03,
+    1.3898439081941594e-03, 1.3952032992985994e-03, 1.4002716155932069e-03,
+    1.4050784349347385e-03, 1.4096511669443898e-03, 1.4140155068764039e-03,
+    1.4181958434698260e-03, 1.4222156299923134e-03, 1.4260977253650572e-03,
+    1.4298647101427748e-03, 1.4335391800782676e-03, 1.4371440179101426e-03,
+    1.4407026417716914e-03, 1.4442392261417181e-03, 1.4477788884787472e-03,
+    1.4513478315686670e-03, 1.4549734281954058e-03, 1.4586842311198060e-03,
+    1.4625098877447673e-03, 1.4664809356318511e-03, 1.4706284527909201e-03,
+    1.4749835361883656e-03, 1.4795765842338445e-03, 1.4844363652995937e-03,
+    1.4895888658141231e-03, 1.4950559291373681e-03, 3.8467280466738168e-04,
+    5.2862641537840065e-04, 6.3884964710987581e-04, 7.2487475793576376e-04,
+    7.9349557664628808e-04, 8.4934028222067117e-04, 8.9558835075981063e-04,
+    9.3446997867143475e-04, 9.6758578810922900e-04, 9.9611008460310786e-04,
+    1.0209219458144809e-03, 1.0426915225947115e-03, 1.0619381056002535e-03,
+    1.0790700296172469e-03, 1.0944126459390279e-03, 1.1082282936335963e-03,
+    1.1207308007843400e-03, 1.1320961781470730e-03, 1.1424706179072360e-03,
+    1.1519765555468302e-03, 1.1607173197969720e-03, 1.1687807398827179e-03,
+    1.1762419734526487e-03, 1.1831657456154887e-03, 1.1896081384735733e-03,
+    1.1956180343819646e-03, 1.2012382902232511e-03, 1.2065067011671861e-03,
+    1.2114567985807465e-03, 1.2161185165259919e-03, 1.2205187536306233e-03,
+    1.2246818513346812e-03, 1.2286300051071236e-03, 1.2323836218263876e-03,
+    1.2359616338673844e-03, 1.2393817783377186e-03, 1.2426608482122028e-03,
+    1.2458149207126518e-03, 1.2488595670806649e-03, 1.2518100468207241e-03,
+    1.2546814884886221e-03, 1.2574890581117241e-03, 1.2602481153064842e-03,
+    1.2629743560630586e-03, 1.2656839399628416e-03, 1.2683935982565880e-03,
+    1.2711207177489587e-03, 1.2738833938202216e-03, 1.2767004442107023e-03,
+    1.2795913734856589e-03, 1.2825762765325188e-03, 1.2856756682384292e-03,
+    1.2889102259562983e-03, 1.2923004318839361e-03, 1.2958661045193772e-03,
+    1.2996258124213424e-03, 1.3035961700673035e-03, 1.3077910249880205e-03,
+    3.3807823448355460e-04, 4.6460821908785011e-04, 5.6149892993224656e-04,
+    6.3712614073433479e-04, 6.9745957304506647e-04, 7.4656602688841364e-04,
+    7.8723932301487105e-04, 8.2143913870364989e-04, 8.5057193339539065e-04,
+    8.7566955318633000e-04, 8.9750442041729259e-04, 9.1666536781295608e-04,
+    9.3360866248162072e-04, 9.4869307022362869e-04, 9.6220443480099233e-04,
+    9.7437322622730984e-04, 9.8538728215332339e-04, 9.9540120313165639e-04,
+    1.0045433794555190e-03, 1.0129213156010587e-03, 1.0206257135247070e-03,
+    1.0277336391822435e-03, 1.0343110036473717e-03, 1.0404145260796273e-03,
+    1.0460933009398910e-03, 1.0513900600688064e-03, 1.0563421974426263e-03,
+    1.0609826078763560e-03, 1.0653403788087278e-03, 1.0694413653129864e-03,
+    1.0733086717524408e-03, 1.0769630584244977e-03, 1.0804232876724291e-03,
+    1.0837064209773251e-03, 1.0868280762442830e-03, 1.0898026527006997e-03,
+    1.0926435294054888e-03, 1.0953632422337871e-03, 1.0979736432798646e-03,
+    1.1004860458576091e-03, 1.1029113576276318e-03, 1.1052602038085606e-03,
+    1.1075430419060592e-03, 1.1097702688921103e-03, 1.1119523212652970e-03,
+    1.1140997679014882e-03, 1.1162233950443455e-03, 1.1183342821740308e-03,
+    1.1204438668182060e-03, 1.1225639956301693e-03, 1.1247069582585624e-03,
+    1.1268854996915750e-03, 1.1291128059110441e-03, 1.1314024568995214e-03,
+    1.1337683403935561e-03, 1.1362245193933165e-03, 1.1387850464788891e-03,
+    1.1414637186412300e-03, 1.1442737678241293e-03, 1.1472274849116430e-03,
+    1.1503357786654428e-03, 1.1536076762201696e-03, 2.9946453133935277e-04,
+    4.1155252071559437e-04, 4.9739048068827131e-04, 5.6439618045748467e-04,
+    6.1785664214018441e-04, 6.6137360843200133e-04, 6.9742141652844557e-04,
+    7.2773564363964275e-04, 7.5356190656577409e-04, 7.7581404265236547e-04,
+    7.9517612785519884e-04, 8.1216963967242544e-04, 8.2719864684584730e-04,
+    8.4058086419109396e-04, 8.5256942117712309e-04, 8.6336840334353153e-04,
+    8.7314413630732997e-04, 8.8203350609650450e-04, 8.9015018169535671e-04,
+    8.9758932965512152e-04, 9.0443122925711397e-04, 9.1074407547907146e-04,
+    9.1658617465580007e-04, 9.2200768092577027e-04, 9.2705198182888764e-04,
+    9.3175681326758582e-04, 9.3615516384632576e-04, 9.4027601394769476e-04,
+    9.4414494415231650e-04, 9.4778463964408370e-04, 9.5121531128392891e-04,
+    9.5445504953910534e-04, 9.5752012403270404e-04, 9.6042523885292127e-04,
+    9.6318375173145275e-04, 9.6580786361905729e-04, 9.6830878394425432e-04,
+    9.7069687585846567e-04, 9.7298178498532667e-04, 9.7517255455835026e-04,
+    9.7727772931242678e-04, 9.7930545006378071e-04, 9.8126354054671482e-04,
+    9.8315958775627415e-04, 9.8500101675777865e-04, 9.8679516065495998e-04,
+    9.8854932614591260e-04, 9.9027085483080956e-04, 9.9196718015799948e-04,
+    9.9364587959831089e-04, 9.9531472131415225e-04, 9.9698170423729074e-04,
+    9.9865509008407018e-04, 1.0003434254238362e-03, 1.0020555514821967e-03,
+    1.0038005989233608e-03, 1.0055879644393089e-03, 1.0074272656179278e-03,
+    1.0093282703180931e-03, 1.0113007967160056e-03, 1.0133545803860072e-03,
+    1.0154991053356905e-03, 1.0177433969301561e-03, 1.0200957762078835e-03,
+    1.0225635772824683e-03, 1.0251528323651227e-03, 2.6710778232473336e-04,
+    3.6709203739288346e-04, 4.4366552885947037e-04, 5.0344352964594755e-04,
+    5.5114116160814386e-04, 5.8997058314367396e-04, 6.2213849638564564e-04,
+    6.4919274885461454e-04, 6.7224422063448899e-04, 6.9210789603084345e-04,
+    7.0939384745093777e-04, 7.2456713419427772e-04, 7.3798810460718898e-04,
+    7.4994009211891194e-04, 7.6064882934040305e-04, 7.7029630844090244e-04,
+    7.7903084450469512e-04, 7.8697449567280322e-04, 7.9422861229616452e-04,
+    8.0087804114889537e-04, 8.0699434899804445e-04, 8.1263832170068624e-04,
+    8.1786192154538397e-04, 8.2270983489722625e-04, 8.2722070677377333e-04,
+    8.3142813386956978e-04, 8.3536146953199278e-04, 8.3904648111803785e-04,
+    8.4250589057122225e-04, 8.4575982195220548e-04, 8.4882617434085849e-04,
+    8.5172093451652963e-04, 8.5445844076979674e-04, 8.5705160685756328e-04,
+    8.5951211330277200e-04, 8.6185057183133038e-04, 8.6407666763368268e-04,
+    8.6619928326685713e-04, 8.6822660731927586e-04, 8.7016623040604907e-04,
+    8.7202523061407939e-04, 8.7381025015194585e-04, 8.7552756465854168e-04,
+    8.7718314637405970e-04, 8.7878272216326012e-04, 8.8033182719638695e-04,
+    8.8183585492746679e-04, 8.8330010385839883e-04, 8.8472982143183803e-04,
+    8.8613024525371583e-04, 8.8750664170000925e-04, 8.8886434181032750e-04,
+    8.9020877420729156e-04, 8.9154549460466613e-04, 8.9288021127487897e-04,
+    8.9421880563963769e-04, 8.9556734692500272e-04, 8.9693209959076979e-04,
+    8.9831952200878880e-04, 8.9973625463961868e-04, 9.0118909575707517e-04,
+    9.0268496262117185e-04, 9.0423083592973343e-04, 9.0583368542752690e-04,
+    9.0750037475962003e-04, 9.0923754407316458e-04, 9.1105146954370293e-04,
+    9.1294789997201802e-04, 9.1493187189021716e-04, 9.1700750623450599e-04,
+    2.3972562723208613e-04, 3.2946563560328358e-04, 3.9819707004455472e-04,
+    4.5185627871319282e-04, 4.9467453209383120e-04, 5.2953438118385869e-04,
+    5.5841609573243722e-04, 5.8270869563114202e-04, 6.0340906892498048e-04,
+    6.2124856801606585e-04, 6.3677465792230594e-04, 6.5040466912678375e-04,
+    6.6246196455379690e-04, 6.7320079387092385e-04, 6.8282371559345086e-04,
+    6.9149403526869288e-04, 6.9934483619173995e-04, 7.0648563806820360e-04,
+    7.1300737661312023e-04, 7.1898617615562765e-04, 7.2448624216269364e-04,
+    7.2956210356287193e-04, 7.3426036883308997e-04, 7.3862111435043262e-04,
+    7.4267899171361236e-04, 7.4646411820449270e-04, 7.5000279839269619e-04,
+    7.5331811315344636e-04, 7.5643040376156064e-04, 7.5935767234685874e-04,
+    7.6211591522509152e-04, 7.6471940201790906e-04, 7.6718091073472289e-04,
+    7.6951192688716279e-04, 7.7172281308185561e-04, 7.7382295427266563e-04,
+    7.7582088286226114e-04, 7.7772438706122664e-04, 7.7954060529222271e-04,
+    7.8127610893127830e-04, 7.8293697527964743e-04, 7.8452885233766718e-04,
+    7.8605701668913656e-04, 7.8752642558932917e-04, 7.8894176417063002e-04,
+    7.9030748852996840e-04, 7.9162786533433938e-04, 7.9290700847023550e-04,
+    7.9414891316461939e-04, 7.9535748791614337e-04, 7.9653658449158938e-04,
+    7.9769002616209624e-04, 7.9882163427285908e-04, 7.9993525315793092e-04,
+    8.0103477332466597e-04, 8.0212415274039258e-04, 8.0320743595398213e-04,
+    8.0428877067779926e-04, 8.0537242133955629e-04, 8.0646277899090713e-04,
+    8.0756436683081278e-04, 8.0868184047214859e-04, 8.0981998195326949e-04,
+    8.1098368638258199e-04, 8.1217794001266967e-04, 8.1340778848690157e-04,
+    8.1467829400174786e-04, 8.1599448020459214e-04, 8.1736126382036536e-04,
+    8.1878337229707718e-04, 8.2026524720086832e-04, 8.2181093369498295e-04,
+    8.2342395721228198e-04, 8.2510718937377821e-04, 2.1634817399094816e-04,
+    2.9734118864465145e-04, 3.5937608521613201e-04, 4.0780972171457230e-04,
+    4.4646037093707834e-04, 4.7792924091441335e-04, 5.0400332538334694e-04,
+    5.2593607417711732e-04, 5.4462707622233292e-04, 5.6073629983587113e-04,
+    5.7475777226833019e-04, 5.8706808647447433e-04, 5.9795903836531062e-04,
+    6.0766005545862846e-04, 6.1635391866879689e-04, 6.2418798656472337e-04,
+    6.3128234468972993e-04, 6.3773581430504240e-04, 6.4363044591195077e-04,
+    6.4903492354854530e-04, 6.5400717486701373e-04, 6.5859639443441699e-04,
+    6.6284462821495445e-04, 6.6678802616671644e-04, 6.7045784119174414e-04,
+    6.7388123234229567e-04, 6.7708191559660456e-04, 6.8008069492874899e-04,
+    6.8289589862987493e-04, 6.8554374008193415e-04, 6.8803861787942663e-04,
+    6.9039336694456076e-04, 6.9261946980797009e-04, 6.9472723532926803e-04,
+    6.9672595066533045e-04, 6.9862401115234046e-04, 7.0042903187322533e-04,
+    7.0214794397639420e-04, 7.0378707825200003e-04, 7.0535223802503308e-04,
+    7.0684876306593048e-04, 7.0828158592974749e-04, 7.0965528189991043e-04,
+    7.1097411352050968e-04, 7.1224207054330186e-04, 7.1346290598485636e-04,
+    7.1464016888042408e-04, 7.1577723422887774e-04, 7.1687733054499533e-04,
+    7.1794356536704796e-04, 7.1897894900804045e-04, 7.1998641678462855e-04,
+    7.2096884990799294e-04, 7.2192909517315295e-04, 7.2286998353695718e-04,
+    7.2379434762806917e-04, 7.2470503818416749e-04, 7.2560493936107029e-04,
+    7.2649698280464927e-04, 7.2738416031866370e-04, 7.2826953489967374e-04,
+    7.2915624984368666e-04, 7.3004753555905354e-04, 7.3094671364669892e-04,
+    7.3185719773471525e-04, 7.3278249048164138e-04, 7.3372617609600711e-04,
+    7.3469190766389000e-04, 7.3568338853848578e-04, 7.3670434703428090e-04,
+    7.3775850369362786e-04, 7.3884953046671827e-04, 7.3998100127915139e-04,
+    7.4115633366691992e-04, 7.4237872144731413e-04, 7.4365105877363593e-04,
+    7.4497585639441159e-04, 7.4635515149860379e-04, 1.7879456209947804e-04,
+    2.4573446723091320e-04, 2.9700932395218581e-04, 3.3704536525239713e-04,
+    3.6899759453411701e-04, 3.9501538174331396e-04, 4.1657531792684531e-04,
+    4.3471312717881472e-04, 4.5017213709414223e-04, 4.6349767527716860e-04,
+    4.7509795089840760e-04, 4.8528413607301987e-04, 4.9429733423911489e-04,
+    5.0232711312345928e-04, 5.0952449577918823e-04, 5.1601123526779930e-04,
+    5.2188654847933795e-04, 5.2723208115817966e-04, 5.3211562086800501e-04,
+    5.3659390989825649e-04, 5.4071480187586614e-04, 5.4451893349221779e-04,
+    5.4804103360167849e-04, 5.5131095804885374e-04, 5.5435451487068446e-04,
+    5.5719412771581785e-04, 5.5984937326742149e-04, 5.6233741970603706e-04,
+    5.6467338683015018e-04, 5.6687064369573292e-04, 5.6894105607749475e-04,
+    5.7089519336894117e-04, 5.7274250249385631e-04, 5.7449145483362129e-04,
+    5.7614967096225513e-04, 5.7772402703765678e-04, 5.7922074595758821e-04,
+    5.8064547580610965e-04, 5.8200335765296843e-04, 5.8329908439952016e-04,
+    5.8453695206807886e-04, 5.8572090469291528e-04, 5.8685457377699102e-04,
+    5.8794131312101666e-04, 5.8898422970182546e-04, 5.8998621117116055e-04,
+    5.9094995045777055e-04, 5.9187796788314222e-04, 5.9277263113995744e-04,
+    5.9363617343161004e-04, 5.9447071002757129e-04, 5.9527825345298568e-04,
+    5.9606072749890382e-04, 5.9681998021258109e-04, 5.9755779600267130e-04,
+    5.9827590697306230e-04, 5.9897600357901705e-04, 5.9965974468155308e-04,
+    6.0032876705813415e-04, 6.0098469441144896e-04, 6.0162914590074755e-04,
+    6.0226374420362832e-04, 6.0289012309804827e-04, 6.0350993453628409e-04,
+    6.0412485516244188e-04, 6.0473659220468560e-04, 6.0534688865060112e-04,
+    6.0595752759100426e-04, 6.0657033559204706e-04, 6.0718718493033973e-04,
+    6.0780999449900654e-04, 6.0844072916735109e-04, 6.0908139735177760e-04,
+    6.0973404653470666e-04, 6.1040075645057079e-04, 6.1108362964851183e-04,
+    6.1178477914029957e-04, 6.1250631285444880e-04, 6.1325031464498387e-04,
+    6.1401882165126669e-04, 6.1481379787532698e-04, 6.1563710394036081e-04,
+    6.1649046311905854e-04, 6.1737542387616754e-04, 6.1829331935366104e-04,
+    6.1924522443802896e-04, 1.5023353048830053e-04, 2.0648390197492621e-04,
+    2.4957308449159737e-04, 2.8321975510618708e-04, 3.1007461481596466e-04,
+    3.3194348429516838e-04, 3.5006694323158507e-04, 3.6531517070757623e-04,
+    3.7831268379759413e-04, 3.8951764601876813e-04, 3.9927301796063917e-04,
+    4.0784023239616175e-04, 4.1542185230496041e-04, 4.2217714173479912e-04,
+    4.2823298050285828e-04, 4.3369165652075659e-04, 4.3863652335544926e-04,
+    4.4313617169284929e-04, 4.4724754884802709e-04, 4.5101832206353038e-04,
+    4.5448869039875825e-04, 4.5769278922348728e-04, 4.6065979003130576e-04,
+    4.6341476980727721e-04, 4.6597940426288108e-04, 4.6837252513302706e-04,
+    4.7061057160061400e-04, 4.7270795856273271e-04, 4.7467737905958592e-04,
+    4.7653005419076062e-04, 4.7827594085370832e-04, 4.7992390538262455e-04,
+    4.8148186944821272e-04, 4.8295693326096231e-04, 4.8435548010189558e-04,
+    4.8568326541171175e-04, 4.8694549304779429e-04, 4.8814688082833796e-04,
+    4.8929171709394920e-04, 4.9038390970662302e-04, 4.9142702865701254e-04,
+    4.9242434324991166e-04, 4.9337885467509832e-04, 4.9429332463799718e-04,
+    4.9517030061609557e-04, 4.9601213821786141e-04, 4.9682102104730717e-04,
+    4.9759897841630395e-04, 4.9834790119605854e-04, 4.9906955605668083e-04,
+    4.9976559830828486e-04, 5.0043758352703003e-04, 5.0108697812424315e-04,
+    5.0171516899515155e-04, 5.0232347236542449e-04, 5.0291314193784409e-04,
+    5.0348537642782231e-04, 5.0404132656442209e-04, 5.0458210162320600e-04,
+    5.0510877554767208e-04, 5.0562239270775797e-04, 5.0612397333599831e-04,
+    5.0661451867482234e-04, 5.0709501586143830e-04, 5.0756644257026460e-04,
+    5.0802977142608687e-04, 5.0848597419465835e-04, 5.0893602575047769e-04,
+    5.0938090781464695e-04, 5.0982161244805791e-04, 5.1025914527767736e-04,
+    5.1069452842511282e-04, 5.1112880309825946e-04, 5.1156303179732024e-04,
+    5.1199830007716597e-04, 5.1243571779777694e-04, 5.1287641978473659e-04,
+    5.1332156581137113e-04, 5.1377233980483175e-04, 5.1422994816926809e-04,
+    5.1469561711210417e-04, 5.1517058885352130e-04, 5.1565611659702519e-04,
+    5.1615345813946288e-04, 5.1666386800498819e-04, 5.1718858799854235e-04,
+    5.1772883609333992e-04, 5.1828579359299866e-04, 5.1886059054511748e-04,
+    5.1945428942851200e-04, 5.2006786719292059e-04, 5.2070219579631628e-04,
+    5.2135802146195773e-04, 5.2203594296172250e-04, 1.2800727045770188e-04,
+    1.7593807813064081e-04, 2.1265581508397838e-04, 2.4132866890507891e-04,
+    2.6421497492332710e-04, 2.8285325738381647e-04, 2.9830046822972191e-04,
+    3.1129798499848641e-04, 3.2237788514355323e-04, 3.3193051527905291e-04,
+    3.4024807064679969e-04, 3.4755328579846666e-04, 3.5401873891542857e-04,
+    3.5978011797977154e-04, 3.6494551996416253e-04, 3.6960208979845504e-04,
+    3.7382084054302372e-04, 3.7766020742344749e-04, 3.8116870561096650e-04,
+    3.8438694371650649e-04, 3.8734916748755778e-04, 3.9008445640514150e-04,
+    3.9261766069318077e-04, 3.9497014198681035e-04, 3.9716036393336692e-04,
+    3.9920436697127103e-04, 4.0111615290180561e-04, 4.0290799860557240e-04,
+    4.0459071366050008e-04, 4.0617385321334255e-04, 4.0766589490930219e-04,
+    4.0907438676174101e-04, 4.1040607138035138e-04, 4.1166699085344079e-04,
+    4.1286257571188849e-04, 4.1399772072678607e-04, 4.1507684976309394e-04,
+    4.1610397149408589e-04, 4.1708272744983148e-04, 4.1801643360855168e-04,
+    4.1890811652733429e-04, 4.1976054483759662e-04, 4.2057625679177749e-04,
+    4.2135758443478569e-04, 4.2210667488116251e-04, 4.2282550910293770e-04,
+    4.2351591857043246e-04, 4.2417960003625485e-04, 4.2481812870956464e-04,
+    4.2543297003153134e-04, 4.2602549023274672e-04, 4.2659696582786170e-04,
+    4.2714859218133112e-04, 4.2768149125994550e-04, 4.2819671867242484e-04,
+    4.2869527008321175e-04, 4.2917808707629003e-04, 4.2964606253527454e-04,
+    4.3010004559757307e-04, 4.3054084623330043e-04, 4.3096923949320734e-04,
+    4.3138596946447843e-04, 4.3179175296823935e-04, 4.3218728302839900e-04,
+    4.3257323213739845e-04, 4.3295025534099236e-04, 4.3331899316077424e-04,
+    4.3368007437019558e-04, 4.3403411863677968e-04, 4.3438173904046892e-04,
+    4.3472354447519754e-04, 4.3506014193801822e-04, 4.3539213870725515e-04,
+    4.3572014440827154e-04, 4.3604477296235137e-04, 4.3636664441112954e-04,
+    4.3668638660560862e-04, 4.3700463674531956e-04, 4.3732204274953853e-04,
+    4.3763926443859936e-04, 4.3795697449930024e-04, 4.3827585920435368e-04,
+    4.3859661885151856e-04, 4.3891996788398560e-04, 4.3924663464939035e-04,
+    4.3957736075113423e-04, 4.3991289994219459e-04, 4.4025401650894385e-04,
+    4.4060148309057724e-04, 4.4095607787915695e-04, 4.4131858114602177e-04,
+    4.4168977104321663e-04, 4.4207041863351644e-04, 4.4246128211042704e-04,
+    4.4286310018038904e-04, 4.4327658459379811e-04, 4.4370241182947263e-04,
+    4.4414121395949563e-04, 4.4459356874735668e-04, 4.4505998906254284e-04,
+    4.4554091172821822e-04, 4.4603668595510118e-04, 1.1037199792993025e-04,
+    1.5170111684361819e-04, 1.8336264216909309e-04, 2.0808806149855231e-04,
+    2.2782444218336358e-04, 2.4389825761980427e-04, 2.5722078430574557e-04,
+    2.6843121903471421e-04, 2.7798830530013978e-04, 2.8622858961495996e-04,
+    2.9340399460503670e-04, 2.9970655541734580e-04, 3.0528506345500707e-04,
+    3.1025650417120209e-04, 3.1471407462648209e-04, 3.1873290746247914e-04,
+    3.2237422675220111e-04, 3.2568841221254581e-04, 3.2871729068478653e-04,
+    3.3149587212391259e-04, 3.3405368053756376e-04, 3.3641578566136264e-04,
+    3.3860361082178062e-04, 3.4063557151627728e-04, 3.4252758460681350e-04,
+    3.4429347765214447e-04, 3.4594532046345412e-04, 3.4749369556789716e-04,
+    3.4894792030292605e-04, 3.5031623032866612e-04, 3.5160593214927487e-04,
+    3.5282353057656889e-04, 3.5397483580731313e-04, 3.5506505381752168e-04,
+    3.5609886302868460e-04, 3.5708047961836430e-04, 3.5801371339091678e-04,
+    3.5890201576401729e-04, 3.5974852114090534e-04, 3.6055608271017128e-04,
+    3.6132730353188798e-04, 3.6206456362129682e-04, 3.6277004362150647e-04,
+    3.6344574555924515e-04, 3.6409351109788126e-04, 3.6471503763638803e-04,
+    3.6531189254886658e-04, 3.6588552581434593e-04, 3.6643728124935866e-04,
+    3.6696840652466713e-04, 3.6748006212139613e-04, 3.6797332935997593e-04,
+    3.6844921761677738e-04, 3.6890867082769281e-04, 3.6935257336465885e-04,
+    3.6978175535979220e-04, 3.7019699754219310e-04, 3.7059903564417782e-04,
+    3.7098856442664398e-04, 3.7136624136710527e-04, 3.7173269004870437e-04,
+    3.7208850328388366e-04, 3.7243424600242925e-04, 3.7277045793010234e-04,
+    3.7309765608103495e-04, 3.7341633708433446e-04, 3.7372697936297890e-04,
+    3.7403004518093166e-04, 3.7432598257247104e-04, 3.7461522716599962e-04,
+    3.7489820391299324e-04, 3.7517532873122952e-04, 3.7544701007008533e-04,
+    3.7571365040431896e-04, 3.7597564766148718e-04, 3.7623339658685381e-04,
+    3.7648729004845715e-04, 3.7673772028362157e-04, 3.7698508008704700e-04,
+    3.7722976393915621e-04, 3.7747216907211255e-04, 3.7771269646935576e-04,
+    3.7795175179317108e-04, 3.7818974623302532e-04, 3.7842709726596110e-04,
+    3.7866422931844554e-04, 3.7890157431740777e-04, 3.7913957211629771e-04,
+    3.7937867078016474e-04, 3.7961932671188415e-04, 3.7986200459982060e-04,
+    3.8010717716549790e-04, 3.8035532468825201e-04, 3.8060693428243995e-04,
+    3.8086249890178191e-04, 3.8112251604470010e-04, 3.8138748613450988e-04,
+    3.8165791054876679e-04, 3.8193428927355873e-04, 3.8221711816077572e-04,
+    3.8250688576997317e-04, 3.8280406978103012e-04, 3.8310913297014381e-04,
+    3.8342251874926242e-04, 3.8374464627851225e-04, 3.8407590517207450e-04,
+    3.8441664983073799e-04, 3.8476719344842389e-04, 3.8512780175554810e-04,
+    3.8549868657856740e-04, 9.6145136793024697e-05, 1.3214811168020231e-04,
+    1.5973011459171222e-04, 1.8127038799730036e-04, 1.9846492410138615e-04,
+    2.1246915061763698e-04, 2.2407683818014774e-04, 2.3384476173182698e-04,
+    2.4217251161944809e-04, 2.4935323786542897e-04, 2.5560637834271124e-04,
+    2.6109920553906758e-04, 2.6596132417480489e-04, 2.7029463416391720e-04,
+    2.7418031436090130e-04, 2.7768380846828080e-04, 2.8085844502021571e-04,
+    2.8374810648737784e-04, 2.8638922528782161e-04, 2.8881229593276240e-04,
+    2.9104303434969930e-04, 2.9310327652908936e-04, 2.9501168221686994e-04,
+    2.9678429115122257e-04, 2.9843496659543340e-04, 2.9997575188501802e-04,
+    3.0141715922609304e-04, 3.0276840527805187e-04, 3.0403760460293830e-04,
+    3.0523192950662504e-04, 3.0635774288394907e-04, 3.0742070923588132e-04,
+    3.0842588792775913e-04, 3.0937781191424455e-04, 3.1028055450489151e-04,
+    3.1113778623665528e-04, 3.1195282352203388e-04, 3.1272867042775624e-04,
+    3.1346805469007350e-04, 3.1417345887397972e-04, 3.1484714742431000e-04,
+    3.1549119022801985e-04, 3.1610748320272061e-04, 3.1669776634157891e-04,
+    3.1726363957525439e-04, 3.1780657675436504e-04, 3.1832793800891287e-04,
+    3.1882898070198577e-04, 3.1931086916262458e-04, 3.1977468335559053e-04,
+    3.2022142662308282e-04, 3.2065203261432936e-04, 3.2106737150293515e-04,
+    3.2146825557813379e-04, 3.2185544428467856e-04, 3.2222964877612657e-04,
+    3.2259153603797985e-04, 3.2294173262987727e-04, 3.2328082808993653e-04,
+    3.2360937803897007e-04, 3.2392790701777415e-04, 3.2423691108667089e-04,
+    3.2453686021312387e-04, 3.2482820047016953e-04, 3.2511135606588299e-04,
+    3.2538673122174569e-04, 3.2565471191586847e-04, 3.2591566750515084e-04,
+    3.2616995223902896e-04, 3.2641790667597363e-04, 3.2665985901275972e-04,
+    3.2689612633534840e-04, 3.2712701579932357e-04, 3.2735282574680908e-04,
+    3.2757384676608043e-04, 3.2779036269925123e-04, 3.2800265160273919e-04,
+    3.2821098666450255e-04, 3.2841563708149100e-04, 3.2861686890001796e-04,
+    3.2881494582125413e-04, 3.2901012997340099e-04, 3.2920268265151134e-04,
+    3.2939286502530184e-04, 3.2958093881474122e-04, 3.2976716693245621e-04,
+    3.2995181409145829e-04, 3.3013514737589351e-04, 3.3031743677188792e-04,
+    3.3049895565474244e-04, 3.3067998122801281e-04, 3.3086079490913140e-04,
+    3.3104168265545622e-04, 3.3122293522372414e-04, 3.3140484835502082e-04,
+    3.3158772287652231e-04, 3.3177186471038659e-04, 3.3195758477931646e-04,
+    3.3214519879760425e-04, 3.3233502693568855e-04, 3.3252739334575830e-04,
+    3.3272262553544699e-04, 3.3292105357653949e-04, 3.3312300913547818e-04,
+    3.3332882431305394e-04, 3.3353883028107401e-04, 3.3375335570523577e-04,
+    3.3397272494482361e-04, 3.3419725602222387e-04, 3.3442725835795546e-04,
+    3.3466303027045483e-04, 3.3490485624400714e-04, 3.3515300397316547e-04,
+    3.3540772119760968e-04, 3.3566923234778031e-04, 3.3593773502853692e-04,
+    3.3621339637562696e-04, 3.3649634932757255e-04, 8.4501743835311646e-05,
+    1.1614550163019679e-04, 1.4038842921195539e-04, 1.5932152346650384e-04,
+    1.7443531648993118e-04, 1.8674526493500198e-04, 1.9694898116583335e-04,
+    2.0553579203317029e-04, 2.1285688125609624e-04, 2.1916988639397560e-04,
+    2.2466766228705908e-04, 2.2949721763836431e-04, 2.3377245639528922e-04,
+    2.3758293380668320e-04, 2.4099999416777787e-04, 2.4408115274305626e-04,
+    2.4687327723180288e-04, 2.4941493354302548e-04, 2.5173814001370310e-04,
+    2.5386969637630167e-04, 2.5583220264360079e-04, 2.5764484889463207e-04,
+    2.5932403372245220e-04, 2.6088385308833164e-04, 2.6233649012435799e-04,
+    2.6369252848721888e-04, 2.6496120616974141e-04, 2.6615062254277150e-04,
+    2.6726790836721821e-04, 2.6831936626867033e-04, 2.6931058748568600e-04,
+    2.7024654943378788e-04, 2.7113169766120450e-04, 2.7197001503126710e-04,
+    2.7276508039347612e-04, 2.7352011855924204e-04, 2.7423804304876767e-04,
+    2.7492149279984332e-04, 2.7557286381052308e-04, 2.7619433651308541e-04,
+    2.7678789953651214e-04, 2.7735537040174960e-04, 2.7789841360230621e-04,
+    2.7841855644819080e-04, 2.7891720299000322e-04, 2.7939564628992917e-04,
+    2.7985507926481679e-04, 2.8029660429232666e-04, 2.8072124174248790e-04,
+    2.8112993757323603e-04, 2.8152357010849161e-04, 2.8190295610058721e-04,
+    2.8226885616467530e-04, 2.8262197966078575e-04, 2.8296298908902118e-04,
+    2.8329250405476465e-04, 2.8361110485334076e-04, 2.8391933571731190e-04,
+    2.8421770776410792e-04, 2.8450670167708586e-04, 2.8478677014903968e-04,
+    2.8505834011374390e-04, 2.8532181478806482e-04, 2.8557757554459031e-04,
+    2.8582598363242098e-04, 2.8606738176179658e-04, 2.8630209556646571e-04,
+    2.8653043495623011e-04, 2.8675269537067666e-04, 2.8696915894402204e-04,
+    2.8718009558986084e-04, 2.8738576401376477e-04, 2.8758641266077729e-04,
+    2.8778228060420187e-04, 2.8797359838133777e-04, 2.8816058878131556e-04,
+    2.8834346758955761e-04, 2.8852244429300580e-04, 2.8869772274971612e-04,
+    2.8886950182610089e-04, 2.8903797600464024e-04, 2.8920333596461732e-04,
+    2.8936576913798066e-04, 2.8952546024227165e-04, 2.8968259179206726e-04,
+    2.8983734459025041e-04, 2.8998989819999771e-04, 2.9014043139816229e-04,
+    2.9028912261036468e-04, 2.9043615032785036e-04, 2.9058169350583716e-04,
+    2.9072593194274745e-04, 2.9086904663939463e-04, 2.9101122013688012e-04,
+    2.9115263683151383e-04, 2.9129348326482288e-04, 2.9143394838617305e-04,
+    2.9157422378529348e-04, 2.9171450389139735e-04, 2.9185498613538302e-04,
+    2.9199587107091134e-04, 2.9213736245000592e-04, 2.9227966724811846e-04,
+    2.9242299563342746e-04, 2.9256756087455359e-04, 2.9271357918066008e-04,
+    2.9286126946745866e-04, 2.9301085304255241e-04, 2.9316255320316884e-04,
+    2.9331659473950765e-04, 2.9347320333673557e-04, 2.9363260486910776e-04,
+    2.9379502457983135e-04, 2.9396068614110775e-04, 2.9412981058936420e-04,
+    2.9430261513200244e-04, 2.9447931182307647e-04, 2.9466010610724937e-04,
+    2.9484519523308069e-04, 2.9503476653927976e-04, 2.9522899561997251e-04,
+    2.9542804437822579e-04, 2.9563205898014991e-04, 2.9584116772568954e-04,
+    2.9605547885570664e-04, 2.9627507831918570e-04, 7.4852155428988305e-05,
+    1.0288299261527159e-04, 1.2435838164816113e-04, 1.4113045662185339e-04,
+    1.5451948736502035e-04, 1.6542493770432495e-04, 1.7446473430842433e-04,
+    1.8207231022739984e-04, 1.8855873493514249e-04, 1.9415221708861294e-04,
+    1.9902358241877531e-04, 2.0330304726677326e-04, 2.0709150457897437e-04,
+    2.1046827980582725e-04, 2.1349656756674025e-04, 2.1622731305176050e-04,
+    2.1870203008779484e-04, 2.2095487897036301e-04, 2.2301422030868528e-04,
+    2.2490379219372814e-04, 2.2664361270230047e-04, 2.2825067947061250e-04,
+    2.2973951750042672e-04, 2.3112261217406535e-04, 2.3241075453171996e-04,
+    2.3361331883197325e-04, 2.3473848737104921e-04, 2.3579343387434721e-04,
+    2.3678447408765190e-04, 2.3771719020450986e-04, 2.3859653427718338e-04,
+    2.3942691463431386e-04, 2.4021226847292248e-04, 2.4095612313576278e-04,
+    2.4166164807770373e-04, 2.4233169912964139e-04, 2.4296885635894012e-04,
+    2.4357545658106492e-04, 2.4415362138341189e-04, 2.4470528136754158e-04,
+    2.4523219719204119e-04, 2.4573597789798629e-04, 2.4621809691794170e-04,
+    2.4667990610316773e-04, 2.4712264804977184e-04, 2.4754746695988946e-04,
+    2.4795541823747168e-04, 2.4834747698767673e-04, 2.4872454556372969e-04,
+    2.4908746028385638e-04, 2.4943699742335611e-04, 2.4977387857185053e-04,
+    2.5009877543337721e-04, 2.5041231413621236e-04, 2.5071507911046659e-04,
+    2.5100761658369592e-04, 2.5129043773834052e-04, 2.5156402156911798e-04,
+    2.5182881747376945e-04, 2.5208524760635961e-04, 2.5233370901882486e-04,
+    2.5257457561333026e-04, 2.5280819992538070e-04, 2.5303491475525995e-04,
+    2.5325503466339984e-04, 2.5346885734348426e-04, 2.5367666488558570e-04,
+    2.5387872494026030e-04, 2.5407529179336230e-04, 2.5426660736027840e-04,
+    2.5445290210739471e-04, 2.5463439590777250e-04, 2.5481129883729863e-04,
+    2.5498381191696239e-04, 2.5515212780630203e-04, 2.5531643145261610e-04,
+    2.5547690070002143e-04, 2.5563370686210754e-04, 2.5578701526149589e-04,
+    2.5593698573936471e-04, 2.5608377313762434e-04, 2.5622752775624326e-04,
+    2.5636839578788406e-04, 2.5650651973187466e-04, 2.5664203878924847e-04,
+    2.5677508924045199e-04, 2.5690580480710386e-04, 2.5703431699899710e-04,
+    2.5716075544743110e-04, 2.5728524822573202e-04, 2.5740792215767219e-04,
+    2.5752890311441298e-04, 2.5764831630032862e-04, 2.5776628652801468e-04,
+    2.5788293848256073e-04, 2.5799839697505348e-04, 2.5811278718506611e-04,
+    2.5822623489177803e-04, 2.5833886669313240e-04, 2.5845081021232233e-04,
+    2.5856219429063571e-04, 2.5867314916559487e-04, 2.5878380663299283e-04,
+    2.5889430019138034e-04, 2.5900476516716782e-04, 2.5911533881847922e-04,
+    2.5922616041546589e-04, 2.5933737129478496e-04, 2.5944911488551476e-04,
+    2.5956153670374064e-04, 2.5967478431271405e-04, 2.5978900724536334e-04,
+    2.5990435688573286e-04, 2.6002098630578929e-04, 2.6013905005390958e-04,
+    2.6025870389134211e-04, 2.6038010447280199e-04, 2.6050340896759014e-04,
+    2.6062877461754616e-04, 2.6075635822850725e-04, 2.6088631559216709e-04,
+    2.6101880083569947e-04, 2.6115396569699153e-04, 2.6129195872410345e-04,
+    2.6143292439829275e-04, 2.6157700218102780e-04, 2.6172432548645031e-04,
+    2.6187502058218196e-04, 2.6202920542267350e-04, 2.6218698842109419e-04,
+    2.6234846716737534e-04, 2.6251372710197479e-04, 2.6268284015686712e-04,
+    2.6285586337733072e-04, 6.6765825699322164e-05, 9.1768924771760640e-05,
+    1.1092495368541163e-04, 1.2588589678305800e-04, 1.3782935503180103e-04,
+    1.4755759733373920e-04, 1.5562177848240044e-04, 1.6240849581826647e-04,
+    1.6819520544880036e-04, 1.7318545637024120e-04, 1.7753161526286291e-04,
+    1.8134982752015085e-04, 1.8473008371269262e-04, 1.8774313741058875e-04,
+    1.9044535438216161e-04, 1.9288217458647273e-04, 1.9509062573078910e-04,
+    1.9710117658062966e-04, 1.9893912290306964e-04, 2.0062563743519245e-04,
+    2.0217857486755174e-04, 2.0361309582487565e-04, 2.0494215547858045e-04,
+    2.0617688977192335e-04, 2.0732692338788097e-04, 2.0840061731735814e-04,
+    2.0940526938497442e-04, 2.1034727782356447e-04, 2.1123227559246102e-04,
+    2.1206524135901399e-04, 2.1285059173447115e-04, 2.1359225835269096e-04,
+    2.1429375261696723e-04, 2.1495822035470194e-04, 2.1558848816702849e-04,
+    2.1618710290812664e-04, 2.1675636545279722e-04, 2.1729835969304287e-04,
+    2.1781497753155859e-04, 2.1830794050207089e-04, 2.1877881853576509e-04,
+    2.1922904630374693e-04, 2.1965993749306550e-04, 2.2007269731486536e-04,
+    2.2046843349497207e-04, 2.2084816595755607e-04, 2.2121283537978394e-04,
+    2.2156331076825006e-04, 2.2190039618542458e-04, 2.2222483673551459e-04,
+    2.2253732390336604e-04, 2.2283850032676404e-04, 2.2312896407130679e-04,
+    2.2340927246756561e-04, 2.2367994556220889e-04, 2.2394146922792774e-04,
+    2.2419429797118707e-04, 2.2443885747179684e-04, 2.2467554688405359e-04,
+    2.2490474092548075e-04, 2.2512679177604926e-04, 2.2534203080797009e-04,
+    2.2555077016382880e-04, 2.2575330419868990e-04, 2.2594991080007618e-04,
+    2.2614085259808545e-04, 2.2632637807660423e-04, 2.2650672259530829e-04,
+    2.2668210933115345e-04, 2.2685275014707083e-04, 2.2701884639481735e-04,
+    2.2718058965816299e-04, 2.2733816244202253e-04, 2.2749173881248861e-04,
+    2.2764148499231695e-04, 2.2778755991590324e-04, 2.2793011574741322e-04,
+    2.2806929836538756e-04, 2.2820524781682041e-04, 2.2833809874339846e-04,
+    2.2846798078240448e-04, 2.2859501894444890e-04, 2.2871933397012687e-04,
+    2.2884104266735687e-04, 2.2896025823114123e-04, 2.2907709054717764e-04,
+    2.2919164648077292e-04, 2.2930403015220522e-04, 2.2941434319973442e-04,
+    2.2952268503118463e-04, 2.2962915306505707e-04, 2.2973384296192463e-04,
+    2.2983684884683343e-04, 2.2993826352330849e-04, 2.3003817867950897e-04,
+    2.3013668508691315e-04, 2.3023387279197662e-04, 2.3032983130093232e-04,
+    2.3042464975800287e-04, 2.3051841711706531e-04, 2.3061122230683354e-04,
+    2.3070315438944564e-04, 2.3079430271233489e-04, 2.3088475705309802e-04,
+    2.3097460775706213e-04, 2.3106394586704381e-04, 2.3115286324483080e-04,
+    2.3124145268366939e-04, 2.3132980801105339e-04, 2.3141802418091495e-04,
+    2.3150619735425260e-04, 2.3159442496708998e-04, 2.3168280578455088e-04,
+    2.3177143993972370e-04, 2.3186042895585352e-04, 2.3194987575027683e-04,
+    2.3203988461846235e-04, 2.3213056119631120e-04, 2.3222201239888894e-04,
+    2.3231434633355264e-04, 2.3240767218551706e-04, 2.3250210007365939e-04,
+    2.3259774087455213e-04, 2.3269470601251316e-04, 2.3279310721365266e-04,
+    2.3289305622184540e-04, 2.3299466447479142e-04, 2.3309804273838127e-04,
+    2.3320330069790798e-04, 2.3331054650487182e-04, 2.3341988627856248e-04,
+    2.3353142356193475e-04, 2.3364525873191861e-04, 2.3376148836476039e-04,
+    2.3388020455779730e-04, 2.3400149420968946e-04, 2.3412543826208690e-04,
+    2.3425211090648938e-04, 2.3438157876115893e-04, 2.3451390002383288e-04,
+    2.3464912360718733e-04, 2.3478728826493940e-04, 5.9922450095163607e-05,
+    8.2363120724070210e-05, 9.9556178417606949e-05, 1.1298423473691822e-04,
+    1.2370415894344164e-04, 1.3243596970251509e-04, 1.3967431668787181e-04,
+    1.4576616290403401e-04, 1.5096051942331610e-04, 1.5544006721800524e-04,
+    1.5934155217253425e-04, 1.6276921229228908e-04, 1.6580381214741598e-04,
+    1.6850885147806269e-04, 1.7093491725308460e-04, 1.7312279073967876e-04,
+    1.7510570337180175e-04, 1.7691100005973558e-04, 1.7856138304729209e-04,
+    1.8007585423816843e-04, 1.8147043765306942e-04, 1.8275873944032612e-04,
+    1.8395238639617884e-04, 1.8506137259432186e-04, 1.8609433578103279e-04,
+    1.8705877956269070e-04, 1.8796125337359898e-04, 1.8880749928066576e-04,
+    1.8960257253114774e-04, 1.9035094115602881e-04, 1.9105656874949243e-04,
+    1.9172298364505440e-04, 1.9235333702399924e-04, 1.9295045196622199e-04,
+    1.9351686504738127e-04, 1.9405486176998619e-04, 1.9456650686823271e-04,
+    1.9505367033086080e-04, 1.9551804983122665e-04, 1.9596119012992000e-04,
+    1.9638449991595962e-04, 1.9678926647238637e-04, 1.9717666848716438e-04,
+    1.9754778727730651e-04, 1.9790361665088791e-04, 1.9824507159595857e-04,
+    1.9857299595605387e-04, 1.9888816922758969e-04, 1.9919131259425439e-04,
+    1.9948309429654375e-04, 1.9976413442047910e-04, 2.0003500917759859e-04,
+    2.0029625473831330e-04, 2.0054837067218169e-04, 2.0079182304150474e-04,
+    2.0102704718843474e-04, 2.0125445025063335e-04, 2.0147441343596265e-04,
+    2.0168729408290311e-04, 2.0189342753003197e-04, 2.0209312881510130e-04,
+    2.0228669422171720e-04, 2.0247440268955861e-04, 2.0265651710214499e-04,
+    2.0283328546462113e-04, 2.0300494198253788e-04, 2.0317170805145933e-04,
+    2.0333379316606607e-04, 2.0349139575656004e-04, 2.0364470395926309e-04,
+    2.0379389632764930e-04, 2.0393914248932669e-04, 2.0408060375398871e-04,
+    2.0421843367677935e-04, 2.0435277858113355e-04, 2.0448377804468704e-04,
+    2.0461156535158127e-04, 2.0473626791406901e-04, 2.0485800766615147e-04,
+    2.0497690143163154e-04, 2.0509306126883123e-04, 2.0520659479390875e-04,
+    2.0531760548467428e-04, 2.0542619296646822e-04, 2.0553245328169465e-04,
+    2.0563647914429795e-04, 2.0573836018051428e-04, 2.0583818315695354e-04,
+    2.0593603219713993e-04, 2.0603198898736319e-04, 2.0612613297280497e-04,
+    2.0621854154461748e-04, 2.0630929021877924e-04, 2.0639845280726011e-04,
+    2.0648610158219643e-04, 2.0657230743347898e-04, 2.0665714002035199e-04,
+    2.0674066791730514e-04, 2.0682295875475726e-04, 2.0690407935472624e-04,
+    2.0698409586185484e-04, 2.0706307386993098e-04, 2.0714107854415939e-04,
+    2.0721817473921508e-04, 2.0729442711326995e-04, 2.0736990023791945e-04,
+    2.0744465870410909e-04, 2.0751876722386564e-04, 2.0759229072787348e-04,
+    2.0766529445858609e-04, 2.0773784405877759e-04, 2.0781000565517506e-04,
+    2.0788184593690991e-04, 2.0795343222834836e-04, 2.0802483255591417e-04,
+    2.0809611570832710e-04, 2.0816735128976498e-04, 2.0823860976524293e-04,
+    2.0830996249756944e-04, 2.0838148177506537e-04, 2.0845324082926050e-04,
+    2.0852531384162008e-04, 2.0859777593841084e-04, 2.0867070317260575e-04,
+    2.0874417249184529e-04, 2.0881826169123129e-04, 2.0889304934989121e-04,
+    2.0896861474999548e-04, 2.0904503777713379e-04, 2.0912239880065139e-04,
+    2.0920077853290610e-04, 2.0928025786603479e-04, 2.0936091768525197e-04,
+    2.0944283865743108e-04, 2.0952610099408687e-04, 2.0961078418778534e-04,
+    2.0969696672135685e-04, 2.0978472574928881e-04, 2.0987413675110705e-04,
+    2.0996527315661517e-04, 2.1005820594340155e-04, 2.1015300320713620e-04,
+    2.1024972970583102e-04, 2.1034844637942635e-04, 2.1044920984679852e-04,
+    2.1055207188255381e-04, 2.1065707887676485e-04, 2.1076427128114604e-04,
+    2.1087368304598434e-04, 2.1098534105252250e-04, 5.4079748588370025e-05,
+    7.4332620329567708e-05, 8.9849654750712605e-05, 1.0196886578815293e-04,
+    1.1164405041382983e-04, 1.1952500759265196e-04, 1.2605814667671295e-04,
+    1.3155659348565890e-04, 1.3624507459362683e-04, 1.4028845523440534e-04,
+    1.4381014529986184e-04, 1.4690421707343773e-04, 1.4964355860203670e-04,
+    1.5208547681719081e-04, 1.5427562516730778e-04, 1.5625080767666451e-04,
+    1.5804101481516574e-04, 1.5967092459747280e-04, 1.6116102513600208e-04,
+    1.6252846506923299e-04, 1.6378770556301048e-04, 1.6495102570755429e-04,
+    1.6602891827215894e-04, 1.6703040253055785e-04, 1.6796327370127652e-04,
+    1.6883430346681605e-04, 1.6964940239047198e-04, 1.7041375240414112e-04,
+    1.7113191559978844e-04, 1.7180792411907556e-04, 1.7244535485973810e-04,
+    1.7304739190523576e-04, 1.7361687896600312e-04, 1.7415636364639109e-04,
+    1.7466813498477537e-04, 1.7515425542888904e-04, 1.7561658818477562e-04,
+    1.7605682070131023e-04, 1.7647648491225251e-04, 1.7687697474604404e-04,
+    1.7725956132391197e-04, 1.7762540619448738e-04, 1.7797557289453702e-04,
+    1.7831103707759794e-04, 1.7863269541326172e-04, 1.7894137342769329e-04,
+    1.7923783242948391e-04, 1.7952277564295440e-04, 1.7979685365276075e-04,
+    1.8006066924839738e-04, 1.8031478174442293e-04, 1.8055971084146480e-04,
+    1.8079594008403444e-04, 1.8102391996348562e-04, 1.8124407070796910e-04,
+    1.8145678479566984e-04, 1.8166242922292733e-04, 1.8186134755474620e-04,
+    1.8205386178178198e-04, 1.8224027400485227e-04, 1.8242086796550042e-04,
+    1.8259591043884765e-04, 1.8276565250312276e-04, 1.8293033069848399e-04,
+    1.8309016808639331e-04, 1.8324537521943518e-04, 1.8339615103044575e-04,
+    1.8354268364876471e-04, 1.8368515115064802e-04, 1.8382372225004995e-04,
+    1.8395855693539720e-04, 1.8408980705732778e-04, 1.8421761687190553e-04,
+    1.8434212354332316e-04, 1.8446345760974079e-04, 1.8458174341550788e-04,
+    1.8469709951273431e-04, 1.8480963903486373e-04, 1.8491947004466381e-04,
+    1.8502669585881561e-04, 1.8513141535108466e-04, 1.8523372323586804e-04,
+    1.8533371033375203e-04, 1.8543146382057776e-04, 1.8552706746135532e-04,
+    1.8562060183027564e-04, 1.8571214451794564e-04, 1.8580177032687437e-04,
+    1.8588955145615625e-04, 1.8597555767622134e-04, 1.8605985649442318e-04,
+    1.8614251331221327e-04, 1.8622359157454405e-04, 1.8630315291212070e-04,
+    1.8638125727704220e-04, 1.8645796307236535e-04, 1.8653332727602013e-04,
+    1.8660740555954069e-04, 1.8668025240196106e-04, 1.8675192119924839e-04,
+    1.8682246436958262e-04, 1.8689193345476922e-04, 1.8696037921802445e-04,
+    1.8702785173838992e-04, 1.8709440050193509e-04, 1.8716007448993965e-04,
+    1.8722492226419250e-04, 1.8728899204952060e-04, 1.8735233181362568e-04,
+    1.8741498934431595e-04, 1.8747701232413631e-04, 1.8753844840243048e-04,
+    1.8759934526479328e-04, 1.8765975069988457e-04, 1.8771971266351342e-04,
+    1.8777927933989202e-04, 1.8783849919991240e-04, 1.8789742105630391e-04,
+    1.8795609411542742e-04, 1.8801456802551458e-04, 1.8807289292105121e-04,
+    1.8813111946302112e-04, 1.8818929887465534e-04, 1.8824748297233034e-04,
+    1.8830572419116477e-04, 1.8836407560491266e-04, 1.8842259093961530e-04,
+    1.8848132458052522e-04, 1.8854033157171006e-04, 1.8859966760776653e-04,
+    1.8865938901698601e-04, 1.8871955273534231e-04, 1.8878021627058628e-04,
+    1.8884143765576634e-04, 1.8890327539141709e-04, 1.8896578837570766e-04,
+    1.8902903582179744e-04, 1.8909307716165048e-04, 1.8915797193562410e-04,
+    1.8922377966709499e-04, 1.8929055972151677e-04, 1.8935837114926807e-04,
+    1.8942727251181657e-04, 1.8949732169070850e-04, 1.8956857567910328e-04,
+    1.8964109035562524e-04, 1.8971492024050056e-04, 1.8979011823408746e-04,
+    1.8986673533814488e-04, 1.8994482036035077e-04, 1.9002441960287427e-04,
+    1.9010557653603260e-04, 1.9018833145837902e-04, 1.9027272114483795e-04,
+    1.9035877848486084e-04, 1.9044653211287960e-04, 1.9053600603366876e-04,
+    1.9062721924561823e-04, 4.9051721167269174e-05, 6.7421802833672457e-05,
+    8.1496444558609604e-05, 9.2489230875371069e-05, 1.0126526227283797e-04,
+    1.0841391162317596e-04, 1.1434007603103057e-04, 1.1932776338560797e-04,
+    1.2358080270700051e-04, 1.2724872824421962e-04, 1.3044347386802208e-04,
+    1.3325036396069395e-04, 1.3573550859794260e-04, 1.3795088563172032e-04,
+    1.3993790308983558e-04, 1.4172994248441497e-04, 1.4335420536561245e-04,
+    1.4483307483329741e-04, 1.4618513370377563e-04, 1.4742593585676946e-04,
+    1.4856859760715489e-04, 1.4962425610514678e-04, 1.5060242828980998e-04,
+    1.5151129462482208e-04, 1.5235792534337830e-04, 1.5314846232109520e-04,
+    1.5388826638966011e-04, 1.5458203750455394e-04, 1.5523391341993459e-04,
+    1.5584755121933775e-04, 1.5642619507500529e-04, 1.5697273287206698e-04,
+    1.5748974377312642e-04, 1.5797953836864438e-04, 1.5844419272598878e-04,
+    1.5888557739115696e-04, 1.5930538219429262e-04, 1.5970513755010317e-04,
+    1.6008623281729350e-04, 1.6044993217978617e-04, 1.6079738843118152e-04,
+    1.6112965497828323e-04, 1.6144769632635598e-04, 1.6175239726541819e-04,
+    1.6204457094146747e-04, 1.6232496596734606e-04, 1.6259427270396090e-04,
+    1.6285312882259622e-04, 1.6310212424253522e-04, 1.6334180552432127e-04,
+    1.6357267978744577e-04, 1.6379521821145948e-04, 1.6400985917133310e-04,
+    1.6421701105088796e-04, 1.6441705477227182e-04, 1.6461034607437707e-04,
+    1.6479721756886559e-04, 1.6497798059873797e-04, 1.6515292692130583e-04,
+    1.6532233023463117e-04, 1.6548644756425907e-04, 1.6564552052494575e-04,
+    1.6579977647044182e-04, 1.6594942954275521e-04, 1.6609468163112344e-04,
+    1.6623572324963456e-04, 1.6637273434155897e-04, 1.6650588501745722e-04,
+    1.6663533623345202e-04, 1.6676124041528197e-04, 1.6688374203324216e-04,
+    1.6700297813250029e-04, 1.6711907882290081e-04, 1.6723216773185666e-04,
+    1.6734236242366981e-04, 1.6744977478817992e-04, 1.6755451140146939e-04,
+    1.6765667386097965e-04, 1.6775635909727207e-04, 1.6785365966435746e-04,
+    1.6794866401043530e-04, 1.6804145673062103e-04, 1.6813211880318540e-04,
+    1.6822072781060471e-04, 1.6830735814669598e-04, 1.6839208121090756e-04,
+    1.6847496559083057e-04, 1.6855607723382463e-04, 1.6863547960864730e-04,
+    1.6871323385783506e-04, 1.6878939894158902e-04, 1.6886403177378314e-04,
+    1.6893718735074050e-04, 1.6900891887328915e-04, 1.6907927786265033e-04,
+    1.6914831427058280e-04, 1.6921607658426202e-04, 1.6928261192623802e-04,
+    1.6934796614989124e-04, 1.6941218393066695e-04, 1.6947530885344617e-04,
+    1.6953738349628590e-04, 1.6959844951083795e-04, 1.6965854769963019e-04,
+    1.6971771809047546e-04, 1.6977600000815505e-04, 1.6983343214360417e-04,
+    1.6989005262069555e-04, 1.6994589906083751e-04, 1.7000100864543490e-04,
+    1.7005541817638098e-04, 1.7010916413462570e-04, 1.7016228273694425e-04,
+    1.7021480999090491e-04, 1.7026678174815747e-04, 1.7031823375598164e-04,
+    1.7036920170720459e-04, 1.7041972128838646e-04, 1.7046982822635658e-04,
+    1.7051955833295327e-04, 1.7056894754803069e-04, 1.7061803198054472e-04,
+    1.7066684794774648e-04, 1.7071543201225279e-04, 1.7076382101699971e-04,
+    1.7081205211778958e-04, 1.7086016281341247e-04, 1.7090819097301407e-04,
+    1.7095617486062931e-04, 1.7100415315653584e-04, 1.7105216497528117e-04,
+    1.7110024988002022e-04, 1.7114844789294266e-04, 1.7119679950140061e-04,
+    1.7124534565948039e-04, 1.7129412778456969e-04, 1.7134318774862973e-04,
+    1.7139256786368804e-04, 1.7144231086123194e-04, 1.7149245986497206e-04,
+    1.7154305835663492e-04, 1.7159415013425820e-04, 1.7164577926258344e-04,
+    1.7169799001505890e-04, 1.7175082680704191e-04, 1.7180433411970734e-04,
+    1.7185855641430777e-04, 1.7191353803631287e-04, 1.7196932310914660e-04,
+    1.7202595541710578e-04, 1.7208347827729408e-04, 1.7214193440025962e-04,
+    1.7220136573929402e-04, 1.7226181332826246e-04, 1.7232331710809491e-04,
+    1.7238591574201276e-04, 1.7244964641987019e-04, 1.7251454465193195e-04,
+    1.7258064405275173e-04, 1.7264797611580730e-04, 1.7271656997985610e-04,
+    1.7278645218804037e-04, 1.7285764644108578e-04, 1.7293017334599225e-04,
+    1.7300405016195544e-04, 1.7307929054532887e-04, 4.4693658430618872e-05,
+    6.1431790041657571e-05, 7.4256183613825860e-05, 8.4272578732642832e-05,
+    9.2269200829676708e-05, 9.8783050134000297e-05, 1.0418304412149865e-04,
+    1.0872795348264423e-04, 1.1260349483099251e-04, 1.1594591468875376e-04,
+    1.1885720039182469e-04, 1.2141509431743368e-04, 1.2367983192436728e-04,
+    1.2569877223900231e-04, 1.2750964369864101e-04, 1.2914286146089595e-04,
+    1.3062320987234277e-04, 1.3197108299618573e-04, 1.3320341230469790e-04,
+    1.3433436948436165e-04, 1.3537590525838802e-04, 1.3633816705353651e-04,
+    1.3722982605708092e-04, 1.3805833573986826e-04, 1.3883013799714260e-04,
+    1.3955082886024588e-04, 1.4022529271998964e-04, 1.4085781181626941e-04,
+    1.4145215614467984e-04, 1.4201165774236306e-04, 1.4253927242619896e-04,
+    1.4303763138529736e-04, 1.4350908451892183e-04, 1.4395573701901827e-04,
+    1.4437948039356069e-04, 1.4478201889106085e-04, 1.4516489210173085e-04,
+    1.4552949436499234e-04, 1.4587709149732197e-04, 1.4620883526208077e-04,
+    1.4652577592887890e-04, 1.4682887321024906e-04, 1.4711900581493190e-04,
+    1.4739697981761864e-04, 1.4766353601267118e-04, 1.4791935639281261e-04,
+    1.4816506987185590e-04, 1.4840125735239695e-04, 1.4862845622428360e-04,
+    1.4884716436708325e-04, 1.4905784371919118e-04, 1.4926092346736821e-04,
+    1.4945680290297109e-04, 1.4964585398485018e-04, 1.4982842364346600e-04,
+    1.5000483585624047e-04, 1.5017539352021647e-04, 1.5034038014478802e-04,
+    1.5050006138436759e-04, 1.5065468642841691e-04, 1.5080448926410001e-04,
+    1.5094968982503132e-04, 1.5109049503792953e-04, 1.5122709977767685e-04,
+    1.5135968774000440e-04, 1.5148843224004470e-04, 1.5161349694399964e-04,
+    1.5173503654044670e-04, 1.5185319735702100e-04, 1.5196811792766131e-04,
+    1.5207992951500075e-04, 1.5218875659205901e-04, 1.5229471728690346e-04,
+    1.5239792379363769e-04, 1.5249848275267496e-04, 1.5259649560301914e-04,
+    1.5269205890895471e-04, 1.5278526466336163e-04, 1.5287620056962154e-04,
+    1.5296495030392600e-04, 1.5305159375960344e-04, 1.5313620727495128e-04,
+    1.5321886384591404e-04, 1.5329963332482672e-04, 1.5337858260634635e-04,
+    1.5345577580158133e-04, 1.5353127440133858e-04, 1.5360513742935790e-04,
+    1.5367742158628469e-04, 1.5374818138511059e-04, 1.5381746927871536e-04,
+    1.5388533578013450e-04, 1.5395182957606135e-04, 1.5401699763413409e-04,
+    1.5408088530443400e-04, 1.5414353641564311e-04, 1.5420499336624849e-04,
+    1.5426529721116041e-04, 1.5432448774406278e-04, 1.5438260357583734e-04,
+    1.5443968220930747e-04, 1.5449576011059428e-04, 1.5455087277731699e-04,
+    1.5460505480385632e-04, 1.5465833994389631e-04, 1.5471076117043469e-04,
+    1.5476235073342797e-04, 1.5481314021524513e-04, 1.5486316058406152e-04,
+    1.5491244224535188e-04, 1.5496101509157329e-04, 1.5500890855019075e-04,
+    1.5505615163009196e-04, 1.5510277296655243e-04, 1.5514880086475356e-04,
+    1.5519426334199111e-04, 1.5523918816858401e-04, 1.5528360290757950e-04,
+    1.5532753495324278e-04, 1.5537101156842662e-04, 1.5541405992077327e-04,
+    1.5545670711784079e-04, 1.5549898024106590e-04, 1.5554090637865523e-04,
+    1.5558251265729270e-04, 1.5562382627272450e-04, 1.5566487451910472e-04,
+    1.5570568481712839e-04, 1.5574628474082170e-04, 1.5578670204298734e-04,
+    1.5582696467916619e-04, 1.5586710083006407e-04, 1.5590713892230681e-04,
+    1.5594710764744134e-04, 1.5598703597899841e-04, 1.5602695318754829e-04,
+    1.5606688885350269e-04, 1.5610687287759435e-04, 1.5614693548874606e-04,
+    1.5618710724923598e-04, 1.5622741905685263e-04, 1.5626790214391136e-04,
+    1.5630858807281581e-04, 1.5634950872798892e-04, 1.5639069630385912e-04,
+    1.5643218328869235e-04, 1.5647400244394937e-04, 1.5651618677892429e-04,
+    1.5655876952035242e-04, 1.5660178407674388e-04, 1.5664526399709433e-04,
+    1.5668924292376908e-04, 1.5673375453920574e-04, 1.5677883250625447e-04,
+    1.5682451040182369e-04, 1.5687082164369130e-04, 1.5691779941018520e-04,
+    1.5696547655266380e-04, 1.5701388550054987e-04, 1.5706305815894474e-04,
+    1.5711302579866489e-04, 1.5716381893882936e-04, 1.5721546722196822e-04,
+    1.5726799928191592e-04, 1.5732144260461339e-04, 1.5737582338224313e-04,
+    1.5743116636100232e-04, 1.5748749468314071e-04, 1.5754482972376693e-04,
+    1.5760319092325830e-04, 1.5766259561603700e-04, 1.5772305885673784e-04,
+    1.5778459324479872e-04, 1.5784720874873737e-04, 4.0891611197244636e-05,
+    5.6205976128475143e-05, 6.7939595350652255e-05, 7.7104126289743771e-05,
+    8.4420729536274823e-05, 9.0380715993440520e-05, 9.5321614870146597e-05,
+    9.9480180168104736e-05, 1.0302632740976918e-04, 1.0608471103189341e-04,
+    1.0874864111117708e-04, 1.1108924556131561e-04, 1.1316163488887313e-04,
+    1.1500913871024851e-04, 1.1666627543400889e-04, 1.1816087241054507e-04,
+    1.1951560525424551e-04, 1.2074913282565962e-04, 1.2187694599487577e-04,
+    1.2291201065129059e-04, 1.2386526068259256e-04, 1.2474598010609814e-04,
+    1.2556210229942315e-04, 1.2632044652816722e-04, 1.2702690654809777e-04,
+    1.2768660221794973e-04, 1.2830400230294959e-04, 1.2888302464894417e-04,
+    1.2942711843966513e-04, 1.2993933216224755e-04, 1.3042237009264923e-04,
+    1.3087863949856970e-04, 1.3131029029010030e-04, 1.3171924848972422e-04,
+    1.3210724461610768e-04, 1.3247583786031822e-04, 1.3282643676398059e-04,
+    1.3316031697549184e-04, 1.3347863655454676e-04, 1.3378244921075468e-04,
+    1.3407271579432483e-04, 1.3435031430210649e-04, 1.3461604861793476e-04,
+    1.3487065617011283e-04, 1.3511481465930655e-04, 1.3534914798584447e-04,
+    1.3557423148535867e-04, 1.3579059656510683e-04, 1.3599873481948436e-04,
+    1.3619910169172312e-04, 1.3639211973907867e-04, 1.3657818155072714e-04,
+    1.3675765236069386e-04, 1.3693087239238804e-04, 1.3709815896634903e-04,
+    1.3725980839867410e-04, 1.3741609771397500e-04, 1.3756728619369177e-04,
+    1.3771361677793504e-04, 1.3785531733680423e-04, 1.3799260182513915e-04,
+    1.3812567133302464e-04, 1.3825471504286604e-04, 1.3837991110262431e-04,
+    1.3850142742366148e-04, 1.3861942241071671e-04, 1.3873404563066963e-04,
+    1.3884543842602242e-04, 1.3895373447838391e-04, 1.3905906032667234e-04,
+    1.3916153584424881e-04, 1.3926127467876038e-04, 1.3935838465807044e-04,
+    1.3945296816532483e-04, 1.3954512248587890e-04, 1.3963494012855465e-04,
+    1.3972250912343666e-04, 1.3980791329823222e-04, 1.3989123253498072e-04,
+    1.3997254300878459e-04, 1.4005191741002005e-04, 1.4012942515140837e-04,
+    1.4020513256114077e-04, 1.4027910306321515e-04, 1.4035139734595465e-04,
+    1.4042207351968379e-04, 1.4049118726436387e-04, 1.4055879196800289e-04,
+    1.4062493885650792e-04, 1.4068967711566784e-04, 1.4075305400581859e-04,
+    1.4081511496978432e-04, 1.4087590373454190e-04, 1.4093546240712124e-04,
+    1.4099383156511547e-04, 1.4105105034224418e-04, 1.4110715650926864e-04,
+    1.4116218655065252e-04, 1.4121617573721989e-04, 1.4126915819513662e-04,
+    1.4132116697144066e-04, 1.4137223409639555e-04, 1.4142239064285911e-04,
+    1.4147166678290520e-04, 1.4152009184185962e-04, 1.4156769434995803e-04,
+    1.4161450209176102e-04, 1.4166054215350543e-04, 1.4170584096851005e-04,
+    1.4175042436078252e-04, 1.4179431758693707e-04, 1.4183754537654475e-04,
+    1.4188013197100407e-04, 1.4192210116104883e-04, 1.4196347632294720e-04,
+    1.4200428045351742e-04, 1.4204453620397225e-04, 1.4208426591272492e-04,
+    1.4212349163715321e-04, 1.4216223518443032e-04, 1.4220051814140821e-04,
+    1.4223836190366691e-04, 1.4227578770368478e-04, 1.4231281663823565e-04,
+    1.4234946969496698e-04, 1.4238576777823246e-04, 1.4242173173414509e-04,
+    1.4245738237489959e-04, 1.4249274050230832e-04, 1.4252782693061690e-04,
+    1.4256266250850072e-04, 1.4259726814031009e-04, 1.4263166480645600e-04,
+    1.4266587358298849e-04, 1.4269991566023279e-04, 1.4273381236053868e-04,
+    1.4276758515500095e-04, 1.4280125567915807e-04, 1.4283484574754090e-04,
+    1.4286837736706483e-04, 1.4290187274910190e-04, 1.4293535432022839e-04,
+    1.4296884473145280e-04, 1.4300236686592472e-04, 1.4303594384489207e-04,
+    1.4306959903189877e-04, 1.4310335603498646e-04, 1.4313723870685099e-04,
+    1.4317127114273206e-04, 1.4320547767594454e-04, 1.4323988287083403e-04,
+    1.4327451151304477e-04, 1.4330938859687719e-04, 1.4334453930960170e-04,
+    1.4337998901251827e-04, 1.4341576321859101e-04, 1.4345188756647526e-04,
+    1.4348838779076653e-04, 1.4352528968825074e-04, 1.4356261908004915e-04,
+    1.4360040176940477e-04, 1.4363866349505154e-04, 1.4367742987991269e-04,
+    1.4371672637510650e-04, 1.4375657819904825e-04, 1.4379701027164858e-04,
+    1.4383804714346917e-04, 1.4387971291987019e-04, 1.4392203118008723e-04,
+    1.4396502489134988e-04, 1.4400871631804250e-04, 1.4405312692612423e-04,
+    1.4409827728290966e-04, 1.4414418695252493e-04, 1.4419087438725269e-04,
+    1.4423835681522050e-04, 1.4428665012476699e-04, 1.4433576874606400e-04,
+    1.4438572553049557e-04, 1.4443653162849775e-04, 1.4448819636650394e-04,
+    1.4454072712386339e-04, 3.7554865160305823e-05, 5.1619686505199674e-05,
+    6.2395993969058809e-05, 7.0812879510312167e-05, 7.7532648118835607e-05,
+    8.3006514022741998e-05, 8.7544460255651693e-05, 9.1363919082940639e-05,
+    9.4620939066110827e-05, 9.7430001484313033e-05, 9.9876801295506419e-05,
+    1.0202666159578192e-04, 1.0393019526354420e-04, 1.0562719573091875e-04,
+    1.0714936430830775e-04, 1.0852225730742038e-04, 1.0976669973861971e-04,
+    1.1089982766672191e-04, 1.1193586770650045e-04, 1.1288672755623188e-04,
+    1.1376244874454174e-04, 1.1457155757591580e-04, 1.1532133994109965e-04,
+    1.1601805854171783e-04, 1.1666712610060298e-04, 1.1727324460144922e-04,
+    1.1784051807032139e-04, 1.1837254457454756e-04, 1.1887249176695180e-04,
+    1.1934315930467930e-04, 1.1978703072481960e-04, 1.2020631679506275e-04,
+    1.2060299192843281e-04, 1.2097882492176060e-04, 1.2133540502304111e-04,
+    1.2167416413457866e-04, 1.2199639580355771e-04, 1.2230327152911238e-04,
+    1.2259585481779790e-04, 1.2287511334173074e-04, 1.2314192949145712e-04,
+    1.2339710956531458e-04, 1.2364139179640385e-04, 1.2387545338504255e-04,
+    1.2409991667751113e-04, 1.2431535460950626e-04, 1.2452229551440129e-04,
+    1.2472122738106247e-04, 1.2491260163337677e-04, 1.2509683649296446e-04,
+    1.2527431997775881e-04, 1.2544541258159908e-04, 1.2561044967375972e-04,
+    1.2576974365195151e-04, 1.2592358587787492e-04, 1.2607224842049562e-04,
+    1.2621598562900083e-04, 1.2635503555450826e-04, 1.2648962123727126e-04,
+    1.2661995187396644e-04, 1.2674622387794375e-04, 1.2686862184369140e-04,
+    1.2698731942550621e-04, 1.2710248013912277e-04, 1.2721425809411290e-04,
+    1.2732279866390953e-04, 1.2742823909961664e-04, 1.2753070909300891e-04,
+    1.2763033129361014e-04, 1.2772722178414360e-04, 1.2782149051826305e-04,
+    1.2791324172398938e-04, 1.2800257427599812e-04, 1.2808958203951659e-04,
+    1.2817435418836686e-04, 1.2825697549938856e-04, 1.2833752662530631e-04,
+    1.2841608434785472e-04, 1.2849272181285251e-04, 1.2856750874870311e-04,
+    1.2864051166972012e-04, 1.2871179406547995e-04, 1.2878141657736666e-04,
+    1.2884943716329569e-04, 1.2891591125158312e-04, 1.2898089188478296e-04,
+    1.2904442985429239e-04, 1.2910657382641212e-04, 1.2916737046053491e-04,
+    1.2922686452003046e-04, 1.2928509897639461e-04, 1.2934211510714561e-04,
+    1.2939795258793725e-04, 1.2945264957930013e-04, 1.2950624280841282e-04,
+    1.2955876764624266e-04, 1.2961025818040568e-04, 1.2966074728402530e-04,
+    1.2971026668089815e-04, 1.2975884700719835e-04, 1.2980651786998433e-04,
+    1.2985330790270261e-04, 1.2989924481793239e-04, 1.2994435545751103e-04,
+    1.2998866584026890e-04, 1.3003220120749034e-04, 1.3007498606629387e-04,
+    1.3011704423103215e-04, 1.3015839886288408e-04, 1.3019907250772026e-04,
+    1.3023908713239113e-04, 1.3027846415950871e-04, 1.3031722450085472e-04,
+    1.3035538858946542e-04, 1.3039297641052360e-04, 1.3043000753108463e-04,
+    1.3046650112876133e-04, 1.3050247601937982e-04, 1.3053795068372509e-04,
+    1.3057294329337464e-04, 1.3060747173572975e-04, 1.3064155363823776e-04,
+    1.3067520639189657e-04, 1.3070844717403781e-04, 1.3074129297047010e-04,
+    1.3077376059695585e-04, 1.3080586672011607e-04, 1.3083762787772385e-04,
+    1.3086906049845733e-04, 1.3090018092108525e-04, 1.3093100541314236e-04,
+    1.3096155018905636e-04, 1.3099183142777931e-04, 1.3102186528987701e-04,
+    1.3105166793412376e-04, 1.3108125553354602e-04, 1.3111064429095564e-04,
+    1.3113985045390818e-04, 1.3116889032911802e-04, 1.3119778029625534e-04,
+    1.3122653682116073e-04, 1.3125517646837389e-04, 1.3128371591301693e-04,
+    1.3131217195191887e-04, 1.3134056151400595e-04, 1.3136890166984120e-04,
+    1.3139720964032683e-04, 1.3142550280444146e-04, 1.3145379870600977e-04,
+    1.3148211505938353e-04, 1.3151046975400793e-04, 1.3153888085773804e-04,
+    1.3156736661888791e-04, 1.3159594546684338e-04, 1.3162463601123622e-04,
+    1.3165345703947947e-04, 1.3168242751266485e-04, 1.3171156655961545e-04,
+    1.3174089346907312e-04, 1.3177042767983043e-04, 1.3180018876875210e-04,
+    1.3183019643651545e-04, 1.3186047049100637e-04, 1.3189103082818110e-04,
+    1.3192189741036004e-04, 1.3195309024174566e-04, 1.3198462934114254e-04,
+    1.3201653471167906e-04, 1.3204882630752122e-04, 1.3208152399739000e-04,
+    1.3211464752488900e-04, 1.3214821646548406e-04, 1.3218225018015771e-04,
+    1.3221676776560258e-04, 1.3225178800104200e-04, 1.3228732929155003e-04,
+    1.3232340960800889e-04, 1.3236004642364451e-04, 1.3239725664731253e-04,
+    1.3243505655354505e-04, 1.3247346170958894e-04, 1.3251248689953119e-04,
+    1.3255214604579791e-04, 1.3259245212821270e-04, 1.3263341710097846e-04,
+    1.3267505180787308e-04, 1.3271736589607933e-04, 1.3276036772905120e-04,
+    1.3280406429894948e-04, 1.3284846113908162e-04, 3.4610479033551747e-05,
+    4.7572672103574826e-05, 5.7504213826157996e-05, 6.5261341502452643e-05,
+    7.1454426550207845e-05, 7.6499302255453699e-05, 8.0681645138914806e-05,
+    8.4201838122216786e-05, 8.7203693670845887e-05, 8.9792716350707374e-05,
+    9.2047881600638406e-05, 9.4029390394108822e-05, 9.5783886941586528e-05,
+    9.7348044378672656e-05, 9.8751078235921665e-05, 1.0001654088440958e-04,
+    1.0116362438260907e-04, 1.0220812109931670e-04, 1.0316314208765085e-04,
+    1.0403966131392745e-04, 1.0484693290393025e-04, 1.0559281457025492e-04,
+    1.0628402087442089e-04, 1.0692632341858719e-04, 1.0752471047421507e-04,
+    1.0808351530373436e-04, 1.0860652009869642e-04, 1.0909704076489613e-04,
+    1.0955799654307256e-04, 1.0999196753337461e-04, 1.1040124250333820e-04,
+    1.1078785883933939e-04, 1.1115363610598779e-04, 1.1150020437432972e-04,
+    1.1182902824521035e-04, 1.1214142731141274e-04, 1.1243859365912756e-04,
+    1.1272160689632808e-04, 1.1299144710610191e-04, 1.1324900605141497e-04,
+    1.1349509690047492e-04, 1.1373046269549571e-04, 1.1395578375021466e-04,
+    1.1417168413086760e-04, 1.1437873735039254e-04, 1.1457747138499237e-04,
+    1.1476837310530365e-04, 1.1495189220028002e-04, 1.1512844466028200e-04,
+    1.1529841587603171e-04, 1.1546216340198015e-04, 1.1562001942569146e-04,
+    1.1577229297912143e-04, 1.1591927192268822e-04, 1.1606122472893967e-04,
+    1.1619840208901340e-04, 1.1633103836212230e-04, 1.1645935288564680e-04,
+    1.1658355116125943e-04, 1.1670382593052857e-04, 1.1682035815186450e-04,
+    1.1693331788918450e-04, 1.1704286512149984e-04, 1.1714915048149249e-04,
+    1.1725231593027635e-04, 1.1735249537466865e-04, 1.1744981523263726e-04,
+    1.1754439495191270e-04, 1.1763634748626684e-04, 1.1772577973341358e-04,
+    1.1781279293813311e-04, 1.1789748306377774e-04, 1.1797994113505777e-04,
+    1.1806025355464073e-04, 1.1813850239591780e-04, 1.1821476567397430e-04,
+    1.1828911759668814e-04, 1.1836162879760519e-04, 1.1843236655217224e-04,
+    1.1850139497866338e-04, 1.1856877522511423e-04, 1.1863456564334643e-04,
+    1.1869882195117698e-04, 1.1876159738370184e-04, 1.1882294283456408e-04,
+    1.1888290698793902e-04, 1.1894153644200282e-04, 1.1899887582448553e-04,
+    1.1905496790095741e-04, 1.1910985367634077e-04, 1.1916357249021201e-04,
+    1.1921616210627863e-04, 1.1926765879653516e-04, 1.1931809742040228e-04,
+    1.1936751149928906e-04, 1.1941593328682327e-04, 1.1946339383513660e-04,
+    1.1950992305740109e-04, 1.1955554978695480e-04, 1.1960030183317615e-04,
+    1.1964420603440604e-04, 1.1968728830804239e-04, 1.1972957369807282e-04,
+    1.1977108642014649e-04, 1.1981184990441942e-04, 1.1985188683625028e-04,
+    1.1989121919496147e-04, 1.1992986829072199e-04, 1.1996785479974084e-04,
+    1.2000519879782000e-04, 1.2004191979243342e-04, 1.2007803675336551e-04,
+    1.2011356814206640e-04, 1.2014853193973900e-04, 1.2018294567430687e-04,
+    1.2021682644626584e-04, 1.2025019095355957e-04, 1.2028305551546688e-04,
+    1.2031543609563794e-04, 1.2034734832425734e-04, 1.2037880751946138e-04,
+    1.2040982870798028e-04, 1.2044042664512658e-04, 1.2047061583409440e-04,
+    1.2050041054468329e-04, 1.2052982483140355e-04, 1.2055887255107581e-04,
+    1.2058756737986830e-04, 1.2061592282988932e-04, 1.2064395226526926e-04,
+    1.2067166891783186e-04, 1.2069908590230601e-04, 1.2072621623116318e-04,
+    1.2075307282901658e-04, 1.2077966854668100e-04, 1.2080601617481093e-04,
+    1.2083212845721543e-04, 1.2085801810376732e-04, 1.2088369780299220e-04,
+    1.2090918023425248e-04, 1.2093447807961565e-04, 1.2095960403530233e-04,
+    1.2098457082281143e-04, 1.2100939119960324e-04, 1.2103407796943732e-04,
+    1.2105864399224608e-04, 1.2108310219361873e-04, 1.2110746557379133e-04,
+    1.2113174721619925e-04, 1.2115596029547832e-04, 1.2118011808498207e-04,
+    1.2120423396367947e-04, 1.2122832142249596e-04, 1.2125239406996988e-04,
+    1.2127646563725809e-04, 1.2130054998237780e-04, 1.2132466109370120e-04,
+    1.2134881309257830e-04, 1.2137302023511570e-04, 1.2139729691296293e-04,
+    1.2142165765313666e-04, 1.2144611711672305e-04, 1.2147069009648976e-04,
+    1.2149539151324144e-04, 1.2152023641092992e-04, 1.2154523995037965e-04,
+    1.2157041740159608e-04, 1.2159578413455297e-04, 1.2162135560839582e-04,
+    1.2164714735896503e-04, 1.2167317498458666e-04, 1.2169945413000967e-04,
+    1.2172600046847203e-04, 1.2175282968174152e-04, 1.2177995743816009e-04,
+    1.2180739936850691e-04, 1.2183517103973625e-04, 1.2186328792642548e-04,
+    1.2189176537998323e-04, 1.2192061859547688e-04, 1.2194986257616063e-04,
+    1.2197951209556126e-04, 1.2200958165724886e-04, 1.2204008545217246e-04,
+    1.2207103731370051e-04, 1.2210245067031109e-04, 1.2213433849608721e-04,
+    1.2216671325900467e-04, 1.2219958686721628e-04, 1.2223297061337375e-04,
+    1.2226687511721843e-04, 1.2230131026655269e-04, 1.2233628515687892e-04,
+    1.2237180802985879e-04, 1.2240788621094471e-04, 1.2244452604639815e-04,
+    1.2248173284010492e-04, 1.2251951079045309e-04
+};
+
+
+
+const realtype rock2Kappa[3191] =
+{
+    1.0000000000000000e+00, 1.0000000000000000e+00, 1.0211881446682864e+00,
+    1.0000000000000000e+00, 1.0215432000591382e+00, 1.0882204999985150e+00,
+    1.0000000000000000e+00, 1.0224455875623806e+00, 1.0861725832460476e+00,
+    1.1628768977691912e+00, 1.0000000000000000e+00, 1.0231293639510011e+00,
+    1.0881288485892480e+00, 1.1560941821574628e+00, 1.2338443117163316e+00,
+    1.0000000000000000e+00, 1.0236193831004252e+00, 1.0900888609901240e+00,
+    1.1575013413417876e+00, 1.2222856630966965e+00, 1.2978263945011996e+00,
+    1.0000000000000000e+00, 1.0239749970753922e+00, 1.0916597314451015e+00,
+    1.1599006141922807e+00, 1.2221669076302171e+00, 1.2824108702120585e+00,
+    1.3543575728856887e+00, 1.0000000000000000e+00, 1.0242389708729041e+00,
+    1.0928800876555449e+00, 1.1621018156199130e+00, 1.2242796333738462e+00,
+    1.2804143519640399e+00, 1.3361884847339587e+00, 1.4039675359646202e+00,
+    1.0000000000000000e+00, 1.0244394156269336e+00, 1.0938312248997197e+00,
+    1.1639362107249454e+00, 1.2266257735693813e+00, 1.2817987539064717e+00,
+    1.3323399739611934e+00, 1.3840268894543628e+00, 1.4474777113036958e+00,
+    1.0000000000000000e+00, 1.0245947991693267e+00, 1.0945812009785185e+00,
+    1.1654336919160586e+00, 1.2287463099694476e+00, 1.2839363761732592e+00,
+    1.3327853187345216e+00, 1.3785370266786561e+00, 1.4265442824465395e+00,
+    1.4857302282040936e+00, 1.0000000000000000e+00, 1.0247174820402183e+00,
+    1.0951805251823923e+00, 1.1666557513979843e+00, 1.2305632571259997e+00,
+    1.2860778406250586e+00, 1.3344931790604688e+00, 1.3779867280578475e+00,
+    1.4196920634622074e+00, 1.4643855082802506e+00, 1.5194906613512482e+00,
+    1.0000000000000000e+00, 1.0248159268609640e+00, 1.0956657901393545e+00,
+    1.1676592790266029e+00, 1.2320970319216491e+00, 1.2880155243419036e+00,
+    1.3364688458920693e+00, 1.3791452970614451e+00, 1.4181819972140737e+00,
+    1.4564559431149067e+00, 1.4981522513658461e+00, 1.5494213961866545e+00,
+    1.0000000000000000e+00, 1.0248960593642935e+00, 1.0960635496107840e+00,
+    1.1684902414500258e+00, 1.2333894938638974e+00, 1.2897103326899055e+00,
+    1.3383770332939200e+00, 1.3808347904604916e+00, 1.4187428912264004e+00,
+    1.4540718083570308e+00, 1.4894067010485605e+00, 1.5283798627893930e+00,
+    1.5760828594510281e+00, 9.9999999999999989e-01, 1.0249621171341963e+00,
+    1.0963932667894463e+00, 1.1691843745034314e+00, 1.2344822393182679e+00,
+    1.2911759518772890e+00, 1.3401128484577327e+00, 1.3826078311822039e+00,
+    1.4200761726183622e+00, 1.4540335061461342e+00, 1.4862566509243351e+00,
+    1.5190445254605101e+00, 1.5555338556990976e+00, 1.5999446233650993e+00,
+    1.0000000000000000e+00, 1.0250171894966134e+00, 1.0966693905539189e+00,
+    1.1697692003812714e+00, 1.2354110749152412e+00, 1.2924404488674022e+00,
+    1.3416552900816447e+00, 1.3842955111797175e+00, 1.4216441293805997e+00,
+    1.4549768382854862e+00, 1.4856467439715200e+00, 1.5152425528933346e+00,
+    1.5457976747154216e+00, 1.5800144310069237e+00, 1.6213988869644556e+00,
+    9.9999999999999989e-01, 1.0250635684506135e+00, 1.0969027908958167e+00,
+    1.1702659493637588e+00, 1.2362053784378544e+00, 1.2935332471942258e+00,
+    1.3430136344707151e+00, 1.3858403117933740e+00, 1.4232204428244726e+00,
+    1.4562969017323057e+00, 1.4861916481580226e+00, 1.5141053429335913e+00,
+    1.5414541147534722e+00, 1.5700314908280859e+00, 1.6021638408956216e+00,
+    1.6407733638326252e+00, 1.0000000000000000e+00, 1.0251029816749126e+00,
+    1.0971017523005098e+00, 1.1706910988642631e+00, 1.2368888452398838e+00,
+    1.2944809490815397e+00, 1.3442069037201871e+00, 1.3872302926679838e+00,
+    1.4247123652564297e+00, 1.4577190174988386e+00, 1.4872410325060639e+00,
+    1.5142602991111820e+00, 1.5398422302252508e+00, 1.5652480447642141e+00,
+    1.5920575832365527e+00, 1.6222742725765955e+00, 1.6583425584032097e+00,
+    1.0000000000000000e+00, 1.0251367503811344e+00, 1.0972726670885506e+00,
+    1.1710575399143615e+00, 1.2374805026469735e+00, 1.2953063318737195e+00,
+    1.3452558810972548e+00, 1.3884718680246220e+00, 1.4260862899103623e+00,
+    1.4591184264654700e+00, 1.4884817293109300e+00, 1.5150306756499929e+00,
+    1.5396266000978931e+00, 1.5632169497138100e+00, 1.5869251186639772e+00,
+    1.6121421579751611e+00, 1.6405952629615037e+00, 1.6743372361200355e+00,
+    1.0000000000000000e+00, 1.0251912280977902e+00, 1.0975492627482191e+00,
+    1.1716529116705949e+00, 1.2384466372059959e+00, 1.2966631586031396e+00,
+    1.3469969025325519e+00, 1.3905640387786493e+00, 1.4284633428979177e+00,
+    1.4616652913178512e+00, 1.4910061130403065e+00, 1.5172161654971352e+00,
+    1.5409599863448546e+00, 1.5628815870950239e+00, 1.5836539318283394e+00,
+    1.6040324252129279e+00, 1.6249101135538206e+00, 1.6473666415263937e+00,
+    1.6726923687671169e+00, 1.7023527219987327e+00, 1.0000000000000000e+00,
+    1.0252328522426821e+00, 1.0977613147569567e+00, 1.1721112908704010e+00,
+    1.2391943955407172e+00, 1.2977203750144568e+00, 1.3483657968464502e+00,
+    1.3922307610967004e+00, 1.4303966034835391e+00, 1.4638112005159052e+00,
+    1.4932779083913033e+00, 1.5194767889720588e+00, 1.5429947120247605e+00,
+    1.5643571698547400e+00, 1.5840603260381523e+00, 1.6026036621125896e+00,
+    1.6205237676994042e+00, 1.6384288891377357e+00, 1.6570316347496556e+00,
+    1.6771731854050316e+00, 1.6998259435706005e+00, 1.7260531566711588e+00,
+    1.0000000000000000e+00, 1.0252653591523684e+00, 1.0979273496249564e+00,
+    1.1724713564975413e+00, 1.2397840929323611e+00, 1.2985581771269847e+00,
+    1.3494573224707378e+00, 1.3935708526061861e+00, 1.4319696188554207e+00,
+    1.4655894457346010e+00, 1.4952177771941861e+00, 1.5215118453688226e+00,
+    1.5450246066126889e+00, 1.5662309184280967e+00, 1.5855521361541933e+00,
+    1.6033792825106215e+00, 1.6200955061940838e+00, 1.6360984856231386e+00,
+    1.6518229509447628e+00, 1.6677625211944811e+00, 1.6844883633817376e+00,
+    1.7026595097596966e+00, 1.7230159342513176e+00, 1.7463412927958806e+00,
+    1.0000000000000000e+00, 1.0252912232601057e+00, 1.0980597239839247e+00,
+    1.1727591485610156e+00, 1.2402568612830933e+00, 1.2992323276978921e+00,
+    1.3503396098314742e+00, 1.3946602970077915e+00, 1.4332582772886451e+00,
+    1.4670621421163030e+00, 1.4968506803074826e+00, 1.5232696077868504e+00,
+    1.5468556098561612e+00, 1.5680599946085962e+00, 1.5872699543524695e+00,
+    1.6048274175795731e+00, 1.6210460978087091e+00, 1.6362274494453846e+00,
+    1.6506761157785155e+00, 1.6647151701673844e+00, 1.6787009729485960e+00,
+    1.6930366969021586e+00, 1.7081823869254706e+00, 1.7246577217850747e+00,
+    1.7430315208572196e+00, 1.7638900169534109e+00, 9.9999999999999989e-01,
+    1.0253121348874488e+00, 1.0981669250492940e+00, 1.1729926794837404e+00,
+    1.2406414180147802e+00, 1.2997822682953417e+00, 1.3510618217621477e+00,
+    1.3955558550012206e+00, 1.4343232939103723e+00, 1.4682879653821181e+00,
+    1.4982234459719603e+00, 1.5247690485225827e+00, 1.5484529326686509e+00,
+    1.5697145485509454e+00, 1.5889243175534842e+00, 1.6064004368120046e+00,
+    1.6224233246926147e+00, 1.6372483578302941e+00, 1.6511175005790606e+00,
+    1.6642703017293876e+00, 1.6769545519519033e+00, 1.6894366376951675e+00,
+    1.7020112470460989e+00, 1.7150095192829662e+00, 1.7288039251832312e+00,
+    1.7438071092448291e+00, 1.7604607408501860e+00, 1.7792095039702596e+00,
+    1.0000000000000000e+00, 1.0253292799929090e+00, 1.0982549333061475e+00,
+    1.1731847116093381e+00, 1.2409582538333190e+00, 1.3002364054223559e+00,
+    1.3516598389336569e+00, 1.3962998170379344e+00, 1.4352115499083626e+00,
+    1.4693154979776066e+00, 1.4993818216413484e+00, 1.5260459483093300e+00,
+    1.5498311880113740e+00, 1.5711705574437624e+00, 1.5904256668121513e+00,
+    1.6079025047326421e+00, 1.6238645858577503e+00, 1.6385440632050314e+00,
+    1.6521513725876307e+00, 1.6648838871470886e+00, 1.6769339527557430e+00,
+    1.6884965531036735e+00, 1.6997767030734516e+00, 1.7109964666500408e+00,
+    1.7224012103120543e+00, 1.7342643026930848e+00, 1.7468889370911027e+00,
+    1.7606051074294828e+00, 1.7757591242019826e+00, 1.7926926880943874e+00,
+    1.0000000000000000e+00, 1.0253435102480339e+00, 1.0983280584189012e+00,
+    1.1733444821286658e+00, 1.2412222813379288e+00, 1.3006155586175350e+00,
+    1.3521602086150355e+00, 1.3969239019248116e+00, 1.4359589657131702e+00,
+    1.4701833557042092e+00, 1.5003648372851268e+00, 1.5271362948559164e+00,
+    1.5510180643342149e+00, 1.5724394187601434e+00, 1.5917570333075362e+00,
+    1.6092702365555598e+00, 1.6252334831789392e+00, 1.6398666201600716e+00,
+    1.6533634863976103e+00, 1.6658993043007924e+00, 1.6776372334109257e+00,
+    1.6887343708035345e+00, 1.6993473983171052e+00, 1.7096379833760322e+00,
+    1.7197779250480807e+00, 1.7299538836762205e+00, 1.7403713234019473e+00,
+    1.7512570179934914e+00, 1.7628591208619644e+00, 1.7754434109526347e+00,
+    1.7892839878080828e+00, 1.8046465837134418e+00, 1.0000000000000000e+00,
+    1.0253554498819428e+00, 1.0983894680894091e+00, 1.1734788047786420e+00,
+    1.2414445492314978e+00, 1.3009352381163015e+00, 1.3525828489504907e+00,
+    1.3974521386203282e+00, 1.4365931376907903e+00, 1.4709218660951193e+00,
+    1.5012043204235557e+00, 1.5280716124404727e+00, 1.5520421276829892e+00,
+    1.5735428143401609e+00, 1.5929274115857013e+00, 1.6104914077207531e+00,
+    1.6264841464380890e+00, 1.6411186358615326e+00, 1.6545795826898047e+00,
+    1.6670300939245164e+00, 1.6786174046245250e+00, 1.6894779147976056e+00,
+    1.6997417528043153e+00, 1.7095370225060667e+00, 1.7189938305233490e+00,
+    1.7282481205414324e+00, 1.7374452545158801e+00, 1.7467431660687152e+00,
+    1.7563147603575957e+00, 1.7663490427579829e+00, 1.7770502327325992e+00,
+    1.7886338887884818e+00, 1.8013189025591754e+00, 1.8153142338237671e+00,
+    1.0000000000000000e+00, 1.0253655647621889e+00, 1.0984415319467109e+00,
+    1.1735927916058877e+00, 1.2416333767369194e+00, 1.3012071741715008e+00,
+    1.3529429073949097e+00, 1.3979029328119916e+00, 1.4371354140660018e+00,
+    1.4715548318324676e+00, 1.5019258235127995e+00, 1.5288782007801935e+00,
+    1.5529289939675597e+00, 1.5745036194731992e+00, 1.5939539680854620e+00,
+    1.6115731943951372e+00, 1.6276076155940562e+00, 1.6422662640349777e+00,
+    1.6557286052705527e+00, 1.6681508534459211e+00, 1.6796712327762737e+00,
+    1.6904144611022944e+00, 1.7004956712889283e+00, 1.7100239363083403e+00,
+    1.7191055204583332e+00, 1.7278469379010837e+00, 1.7363578557066004e+00,
+    1.7447538265412574e+00, 1.7531587704001903e+00, 1.7617070398744410e+00,
+    1.7705447954448208e+00, 1.7798302865220881e+00, 1.7897324895501081e+00,
+    1.8004274210777969e+00, 1.8120913692152802e+00, 1.8248903482526426e+00,
+    9.9999999999999989e-01, 1.0253742082106727e+00, 1.0984860506893530e+00,
+    1.1736903368158262e+00, 1.2417951201260773e+00, 1.3014403617087791e+00,
+    1.3532520508466050e+00, 1.3982905403828207e+00, 1.4376024516094084e+00,
+    1.4721010142777748e+00, 1.5025497892350519e+00, 1.5295775955083859e+00,
+    1.5537004750106997e+00, 1.5753427804717208e+00, 1.5948551765597079e+00,
+    1.6125293276559791e+00, 1.6286096743195304e+00, 1.6433028365693143e+00,
+    1.6567851492692955e+00, 1.6692087548731533e+00, 1.6807065956819167e+00,
+    1.6913965755968934e+00, 1.7013851026582298e+00, 1.7107701768860724e+00,
+    1.7196441502542545e+00, 1.7280962539255802e+00, 1.7362149590571838e+00,
+    1.7440902084167362e+00, 1.7518155235020527e+00, 1.7594899524655530e+00,
+    1.7672197745829370e+00, 1.7751198144920857e+00, 1.7833141428186203e+00,
+    1.7919358515030701e+00, 1.8011255010439959e+00, 1.8110277622019146e+00,
+    1.8217857499459043e+00, 1.8335326220436903e+00, 1.0000000000000000e+00,
+    1.0253881083047389e+00, 1.0985576996716335e+00, 1.1738474768718521e+00,
+    1.2420559752297560e+00, 1.3018169351827331e+00, 1.3537520384786297e+00,
+    1.3989185058078162e+00, 1.4383605739917134e+00, 1.4729895715058887e+00,
+    1.5035674654016391e+00, 1.5307216606738649e+00, 1.5549668613373422e+00,
+    1.5767260636626212e+00, 1.5963484609936178e+00, 1.6141240254488987e+00,
+    1.6302951615250170e+00, 1.6450659631397908e+00, 1.6586095728379842e+00,
+    1.6710740616866508e+00, 1.6825871650988833e+00, 1.6932601376416105e+00,
+    1.7031909315991733e+00, 1.7124668584657388e+00, 1.7211668572914289e+00,
+    1.7293634665152071e+00, 1.7371245744555619e+00, 1.7445150061803874e+00,
+    1.7515979894696638e+00, 1.7584365286076360e+00, 1.7650947004624906e+00,
+    1.7716388714226601e+00, 1.7781388149676511e+00, 1.7846686867499264e+00,
+    1.7913077861154949e+00, 1.7981409996874245e+00, 1.8052587848967834e+00,
+    1.8127565121872480e+00, 1.8207329502805352e+00, 1.8292876600079273e+00,
+    1.8385170745817772e+00, 1.8485091082029810e+00, 1.0000000000000000e+00,
+    1.0253986924666936e+00, 1.0986123023273489e+00, 1.1739673548721101e+00,
+    1.2422552191187961e+00, 1.3021049759327106e+00, 1.3541351012903620e+00,
+    1.3994005041509510e+00, 1.4389436811379899e+00, 1.4736745954874355e+00,
+    1.5043540972047806e+00, 1.5316086351033977e+00, 1.5559520525897643e+00,
+    1.5778065270845325e+00, 1.5975204256386946e+00, 1.6153828372118519e+00,
+    1.6316351728963279e+00, 1.6464803624576829e+00, 1.6600901429987744e+00,
+    1.6726108554239720e+00, 1.6841680810510358e+00, 1.6948703784522714e+00,
+    1.7048123222558773e+00, 1.7140770000567407e+00, 1.7227380885260855e+00,
+    1.7308616029968376e+00, 1.7385073942772680e+00, 1.7457304506214042e+00,
+    1.7525820504018226e+00, 1.7591108010869438e+00, 1.7653635918053820e+00,
+    1.7713864793950749e+00, 1.7772255207725287e+00, 1.7829275571472576e+00,
+    1.7885409475013134e+00, 1.7941162393308225e+00, 1.7997067534383280e+00,
+    1.8053690462318848e+00, 1.8111631974469280e+00, 1.8171528538393238e+00,
+    1.8234049413310323e+00, 1.8299889415642323e+00, 1.8369756175789964e+00,
+    1.8444350729148351e+00, 1.8524340461751787e+00, 1.8610323874468324e+00,
+    9.9999999999999989e-01, 1.0254069366136218e+00, 1.0986548605435051e+00,
+    1.1740608639866827e+00, 1.2424107830166022e+00, 1.3023301156900189e+00,
+    1.3544348856953463e+00, 1.3997782449966598e+00, 1.4394013785243926e+00,
+    1.4742132318466530e+00, 1.5049738352609210e+00, 1.5323089515644979e+00,
+    1.5567318261102494e+00, 1.5786640911552758e+00, 1.5984535921258665e+00,
+    1.6163888929819847e+00, 1.6327108496192788e+00, 1.6476217778630862e+00,
+    1.6612927103339590e+00, 1.6738691564755956e+00, 1.6854756967589442e+00,
+    1.6962196698076488e+00, 1.7061941528079931e+00, 1.7154803899461919e+00,
+    1.7241497885319843e+00, 1.7322655756718763e+00, 1.7398841879223528e+00,
+    1.7470564507406805e+00, 1.7538285925605732e+00, 1.7602431290331786e+00,
+    1.7663396456840885e+00, 1.7721555013970658e+00, 1.7777264703097939e+00,
+    1.7830873355403258e+00, 1.7882724443501272e+00, 1.7933162306191095e+00,
+    1.7982537066066615e+00, 1.8031209216616721e+00, 1.8079553806010196e+00,
+    1.8127964087086199e+00, 1.8176854435846304e+00, 1.8226662263774398e+00,
+    1.8277848564268666e+00, 1.8330896644926347e+00, 1.8386308514150711e+00,
+    1.8444598326898027e+00, 1.8506282271464902e+00, 1.8571864325255099e+00,
+    1.8641817456412066e+00, 1.8716560135454967e+00, 1.0000000000000000e+00,
+    1.0254134825663652e+00, 1.0986886694135560e+00, 1.1741351953061252e+00,
+    1.2425345338040370e+00, 1.3025093674666934e+00, 1.3546738009700718e+00,
+    1.4000796185091056e+00, 1.4397669904977619e+00, 1.4746440818833726e+00,
+    1.5054703010615305e+00, 1.5328708981584784e+00, 1.5573586808747375e+00,
+    1.5793548937743944e+00, 1.5992070248820700e+00, 1.6172032943480321e+00,
+    1.6335842124714905e+00, 1.6485517324424770e+00, 1.6622764911526946e+00,
+    1.6749035515879191e+00, 1.6865569771169653e+00, 1.6973434957584526e+00,
+    1.7073554541309262e+00, 1.7166732151611488e+00, 1.7253671185232065e+00,
+    1.7334990959676639e+00, 1.7411240132587003e+00, 1.7482907948364390e+00,
+    1.7550433753779999e+00, 1.7614215132430115e+00, 1.7674614936763040e+00,
+    1.7731967440865577e+00, 1.7786583793316331e+00, 1.7838756914167715e+00,
+    1.7888765951120797e+00, 1.7936880385290905e+00, 1.7983363855018846e+00,
+    1.8028477745567932e+00, 1.8072484572007104e+00, 1.8115651160943296e+00,
+    1.8158251612943388e+00, 1.8200570000482843e+00, 1.8242902725244972e+00,
+    1.8285560423043590e+00, 1.8328869264524086e+00, 1.8373171455894912e+00,
+    1.8418824698240885e+00, 1.8466200320157451e+00, 1.8515679762442778e+00,
+    1.8567649074034853e+00, 1.8622491086875674e+00, 1.8680574988211771e+00,
+    1.8742243117807376e+00, 1.8807794999547154e+00, 1.0000000000000000e+00,
+    1.0254187663939143e+00, 1.0987159706531808e+00, 1.1741952490271976e+00,
+    1.2426345736118245e+00, 1.3026543733736633e+00, 1.3548672222999625e+00,
+    1.4003238182820230e+00, 1.4400635302248626e+00, 1.4749939103523406e+00,
+    1.5058738829240119e+00, 1.5333283032483840e+00, 1.5578696468305988e+00,
+    1.5799188696532245e+00, 1.5998232004819239e+00, 1.6178706180770981e+00,
+    1.6343013993596385e+00, 1.6493172630288451e+00, 1.6630886013491595e+00,
+    1.6757602131219604e+00, 1.6874558677421141e+00, 1.6982819580503163e+00,
+    1.7083304413385776e+00, 1.7176812222423268e+00, 1.7264040961478009e+00,
+    1.7345603449219362e+00, 1.7422040563207750e+00, 1.7493832228235144e+00,
+    1.7561406636930641e+00, 1.7625148048841355e+00, 1.7685403443315293e+00,
+    1.7742488246465060e+00, 1.7796691309455692e+00, 1.7848279281442170e+00,
+    1.7897500493471445e+00, 1.7944588447857392e+00, 1.7989764989591859e+00,
+    1.8033243221202699e+00, 1.8075230209218409e+00, 1.8115929518298799e+00,
+    1.8155543597473662e+00, 1.8194276031191812e+00, 1.8232333655458957e+00,
+    1.8269928525717172e+00, 1.8307279707825481e+00, 1.8344614846165355e+00,
+    1.8382171443296069e+00, 1.8420197763731980e+00, 1.8458953250693795e+00,
+    1.8498708320012611e+00, 1.8539743371387070e+00, 1.8582346836516919e+00,
+    1.8626812070020371e+00, 1.8673432887539587e+00, 1.8722497572359935e+00,
+    1.8774281214442976e+00, 1.8829036321413470e+00, 1.8886981755998760e+00,
+    1.0000000000000000e+00, 1.0254230927387904e+00, 1.0987383319884276e+00,
+    1.1742444564921479e+00, 1.2427165846752333e+00, 1.3027733130333496e+00,
+    1.3550259745234430e+00, 1.4005243894782262e+00, 1.4403072821522220e+00,
+    1.4752817145717532e+00, 1.5062062261873614e+00, 1.5337053610487370e+00,
+    1.5582913355214498e+00, 1.5803848835695182e+00, 1.6003330380929477e+00,
+    1.6184235996963792e+00, 1.6348966779588625e+00, 1.6499538290411944e+00,
+    1.6637652818792212e+00, 1.6764756656304205e+00, 1.6882085679982251e+00,
+    1.6990701819145244e+00, 1.7091522397331700e+00, 1.7185343884770463e+00,
+    1.7272861245818507e+00, 1.7354683797583721e+00, 1.7431348291403606e+00,
+    1.7503329772712861e+00, 1.7571050655316534e+00, 1.7634888354250136e+00,
+    1.7695181750519140e+00, 1.7752236706013678e+00, 1.7806330803993404e+00,
+    1.7857717456876665e+00, 1.7906629496481847e+00, 1.7953282340713532e+00,
+    1.7997876813697602e+00, 1.8040601682566590e+00, 1.8081635962708189e+00,
+    1.8121151033697533e+00, 1.8159312599829589e+00, 1.8196282521726070e+00,
+    1.8232220538540467e+00, 1.8267285893491556e+00, 1.8301638868521937e+00,
+    1.8335442226518388e+00, 1.8368862551489991e+00, 1.8402071468155632e+00,
+    1.8435246712363265e+00, 1.8468573012555851e+00, 1.8502242730128970e+00,
+    1.8536456193190867e+00, 1.8571421644380994e+00, 1.8607354709803088e+00,
+    1.8644477283999217e+00, 1.8683015716956051e+00, 1.8723198185716461e+00,
+    1.8765251138185499e+00, 1.8809394713589442e+00, 1.8855837076454998e+00,
+    1.8904767652402956e+00, 1.8956349327077029e+00, 1.0000000000000000e+00,
+    1.0254266796171851e+00, 1.0987568763054762e+00, 1.1742852779712862e+00,
+    1.2427846462260812e+00, 1.3028720670528060e+00, 1.3551578529425474e+00,
+    1.4006911048486719e+00, 1.4405100205397121e+00, 1.4755212634806290e+00,
+    1.5064830619168812e+00, 1.5340197098065549e+00, 1.5586432169778728e+00,
+    1.5807741422532047e+00, 1.6007593660507320e+00, 1.6188865526080221e+00,
+    1.6353956861047059e+00, 1.6504882039927422e+00, 1.6643342194178306e+00,
+    1.6770782451364818e+00, 1.6888437483547305e+00, 1.6997367938112100e+00,
+    1.7098489741249145e+00, 1.7192597808330068e+00, 1.7280385344531082e+00,
+    1.7362459650869153e+00, 1.7439355146281470e+00, 1.7511544160226669e+00,
+    1.7579445930745017e+00, 1.7643434151049442e+00, 1.7703843336802871e+00,
+    1.7760974231223337e+00, 1.7815098422259308e+00, 1.7866462312449227e+00,
+    1.7915290555569650e+00, 1.7961789053160653e+00, 1.8006147587251045e+00,
+    1.8048542152140230e+00, 1.8089137037185619e+00, 1.8128086703626560e+00,
+    1.8165537491082937e+00, 1.8201629183141232e+00, 1.8236496456078615e+00,
+    1.8270270230028292e+00, 1.8303078937539943e+00, 1.8335049720351642e+00,
+    1.8366309561087752e+00, 1.8396986352378069e+00, 1.8427209901410855e+00,
+    1.8457112863052958e+00, 1.8486831589283326e+00, 1.8516506876705257e+00,
+    1.8546284587281978e+00, 1.8576316110197477e+00, 1.8606758624982020e+00,
+    1.8637775117988480e+00, 1.8669534096339742e+00, 1.8702208936187068e+00,
+    1.8735976796353626e+00, 1.8771017025301355e+00, 1.8807508990269639e+00,
+    1.8845629264053774e+00, 1.8885548119093964e+00, 1.8927425302202887e+00,
+    1.8971405098013716e+00, 1.9017610736089663e+00, 1.0000000000000000e+00,
+    1.0254296863705636e+00, 1.0987724248575825e+00, 1.1743195143903262e+00,
+    1.2428417473206543e+00, 1.3029549495610022e+00, 1.3552685841187788e+00,
+    1.4008311546775261e+00, 1.4406804232843444e+00, 1.4757227248096425e+00,
+    1.5067160320801287e+00, 1.5342844348907363e+00, 1.5589397755492047e+00,
+    1.5811024719487730e+00, 1.6011192830291276e+00, 1.6192777657450286e+00,
+    1.6358178071641094e+00, 1.6509407545698265e+00, 1.6648166351586204e+00,
+    1.6775898775283049e+00, 1.6893838642317094e+00, 1.7003045726020669e+00,
+    1.7104435027774130e+00, 1.7198800462708992e+00, 1.7286834133521334e+00,
+    1.7369142106923832e+00, 1.7446257402752314e+00, 1.7518650749599649e+00,
+    1.7586739541304044e+00, 1.7650895336742043e+00, 1.7711450174442014e+00,
+    1.7768701918504564e+00, 1.7822918809400881e+00, 1.7874343359585076e+00,
+    1.7923195707349731e+00, 1.7969676521358915e+00, 1.8013969531572720e+00,
+    1.8056243748887766e+00, 1.8096655425034960e+00, 1.8135349795535858e+00,
+    1.8172462641381497e+00, 1.8208121699222530e+00, 1.8242447944964675e+00,
+    1.8275556771534720e+00, 1.8307559078032567e+00, 1.8338562284365727e+00,
+    1.8368671282643991e+00, 1.8397989333982294e+00, 1.8426618916815074e+00,
+    1.8454662530280734e+00, 1.8482223453596811e+00, 1.8509406459547006e+00,
+    1.8536318477164508e+00, 1.8563069195365718e+00, 1.8589771595621885e+00,
+    1.8616542397730722e+00, 1.8643502398380483e+00, 1.8670776677537633e+00,
+    1.8698494642862551e+00, 1.8726789877554317e+00, 1.8755799752555595e+00,
+    1.8785664760325809e+00, 1.8816527524975846e+00, 1.8848531443162335e+00,
+    1.8881818912607284e+00, 1.8916529111406037e+00, 1.8952795302430510e+00,
+    1.8990741654081567e+00, 1.9030479592165086e+00, 1.9072103728102345e+00,
+    1.0000000000000000e+00, 1.0254322316373963e+00, 1.0987855894653622e+00,
+    1.1743485083638630e+00, 1.2428901182270422e+00, 1.3030251826896611e+00,
+    1.3553624499127548e+00, 1.4009499221156336e+00, 1.4408249965299373e+00,
+    1.4758937338118341e+00, 1.5069138944644265e+00, 1.5345093993351455e+00,
+    1.5591919528464357e+00, 1.5813818576343937e+00, 1.6014257740615196e+00,
+    1.6196111728595783e+00, 1.6361778639735727e+00, 1.6513271241217811e+00,
+    1.6652289144174555e+00, 1.6780276000799526e+00, 1.6898465013879800e+00,
+    1.7007915329911736e+00, 1.7109541304374298e+00, 1.7204136172065203e+00,
+    1.7292391304673673e+00, 1.7374911969696927e+00, 1.7452230300327898e+00,
+    1.7524816029816617e+00, 1.7593085424268748e+00, 1.7657408755967539e+00,
+    1.7718116588365029e+00, 1.7775505088849464e+00, 1.7829840542471300e+00,
+    1.7881363206163836e+00, 1.7930290616480948e+00, 1.7976820442875618e+00,
+    1.8021132961826190e+00, 1.8063393213741208e+00, 1.8103752893817540e+00,
+    1.8142352019331629e+00, 1.8179320408776172e+00, 1.8214779002478736e+00,
+    1.8248841049584250e+00, 1.8281613182343714e+00, 1.8313196395351850e+00,
+    1.8343686944584672e+00, 1.8373177178688869e+00, 1.8401756312874011e+00,
+    1.8429511153879923e+00, 1.8456526782760219e+00, 1.8482887200583344e+00,
+    1.8508675940546708e+00, 1.8533976648375214e+00, 1.8558873631192789e+00,
+    1.8583452373261773e+00, 1.8607800015054776e+00, 1.8632005790012995e+00,
+    1.8656161411042045e+00, 1.8680361396284664e+00, 1.8704703321001288e+00,
+    1.8729287979512075e+00, 1.8754219438181605e+00, 1.8779604957452918e+00,
+    1.8805554758132588e+00, 1.8832181604706579e+00, 1.8859600176717040e+00,
+    1.8887926198528298e+00, 1.8917275298596530e+00, 1.8947761572141764e+00,
+    1.8979495826462358e+00, 1.9012583496583961e+00, 1.9047122230988367e+00,
+    1.9083199163170366e+00, 1.9120887904803701e+00, 9.9999999999999989e-01,
+    1.0254344052177362e+00, 1.0987968334533995e+00, 1.1743732772448960e+00,
+    1.2429314501092354e+00, 1.3030852117278238e+00, 1.3554427029089964e+00,
+    1.4010515006569080e+00, 1.4409486936074403e+00, 1.4760401111290222e+00,
+    1.5070833352432558e+00, 1.5347021453339309e+00, 1.5594081308927144e+00,
+    1.5816214989961432e+00, 1.6016888287916966e+00, 1.6198975205138197e+00,
+    1.6364873216332194e+00, 1.6516594523488788e+00, 1.6655838215634327e+00,
+    1.6784047452286441e+00, 1.6902454961137878e+00, 1.7012119420403433e+00,
+    1.7113954713854611e+00, 1.7208753591017540e+00, 1.7297206914358567e+00,
+    1.7379919407266642e+00, 1.7457422612198115e+00, 1.7530185612244162e+00,
+    1.7598623949855197e+00, 1.7663107084583720e+00, 1.7723964660768590e+00,
+    1.7781491801040439e+00, 1.7835953598600287e+00, 1.7887588947569237e+00,
+    1.7936613824189069e+00, 1.7983224110646723e+00, 1.8027598036576959e+00,
+    1.8069898299919087e+00, 1.8110273918049780e+00, 1.8148861851429310e+00,
+    1.8185788434946357e+00, 1.8221170646398592e+00, 1.8255117236831768e+00,
+    1.8287729743578607e+00, 1.8319103403617045e+00, 1.8349327982183306e+00,
+    1.8378488529313908e+00, 1.8406666075069735e+00, 1.8433938272544617e+00,
+    1.8460379996316729e+00, 1.8486063902716594e+00, 1.8511060957116079e+00,
+    1.8535440932349880e+00, 1.8559272881328728e+00, 1.8582625585866031e+00,
+    1.8605567982681153e+00, 1.8628169566441379e+00, 1.8650500768537717e+00,
+    1.8672633309030169e+00, 1.8694640517836818e+00, 1.8716597619758339e+00,
+    1.8738581976326938e+00, 1.8760673275748629e+00, 1.8782953660387216e+00,
+    1.8805507779361814e+00, 1.8828422751943892e+00, 1.8851788025643217e+00,
+    1.8875695111276769e+00, 1.8900237176079486e+00, 1.8925508475239667e+00,
+    1.8951603602364633e+00, 1.8978616540583759e+00, 1.9006639498581264e+00,
+    1.9035761520144061e+00, 1.9066066862114182e+00, 1.9097633144198851e+00,
+    1.9130529285064570e+00, 1.9164813252502091e+00, 1.0000000000000000e+00,
+    1.0254378979526664e+00, 1.0988149049628053e+00, 1.1744130956566317e+00,
+    1.2429979139709795e+00, 1.3031817732173863e+00, 1.3555718442698015e+00,
+    1.4012150267216861e+00, 1.4411479190561272e+00, 1.4762759845940734e+00,
+    1.5073565240652538e+00, 1.5350130949775920e+00, 1.5597571075565819e+00,
+    1.5820086207703516e+00, 1.6021140888113665e+00, 1.6203608043774549e+00,
+    1.6369884206073031e+00, 1.6521980733925308e+00, 1.6661595948818568e+00,
+    1.6790172298419137e+00, 1.6908941837720943e+00, 1.7018962597053628e+00,
+    1.7121147824154226e+00, 1.7216289632155262e+00, 1.7305078234826410e+00,
+    1.7388117682483704e+00, 1.7465938807599839e+00, 1.7539009933084941e+00,
+    1.7607745776709967e+00, 1.7672514893288058e+00, 1.7733645925300725e+00,
+    1.7791432877615818e+00, 1.7846139589016852e+00, 1.7898003539605725e+00,
+    1.7947239106617217e+00, 1.7994040360173076e+00, 1.8038583473774470e+00,
+    1.8081028810951290e+00, 1.8121522738725766e+00, 1.8160199209861623e+00,
+    1.8197181148819082e+00, 1.8232581670593520e+00, 1.8266505156913784e+00,
+    1.8299048210414381e+00, 1.8330300504206121e+00, 1.8360345541629575e+00,
+    1.8389261338775127e+00, 1.8417121040516184e+00, 1.8443993479256211e+00,
+    1.8469943684286241e+00, 1.8495033348539938e+00, 1.8519321258582970e+00,
+    1.8542863692851974e+00, 1.8565714792442638e+00, 1.8587926908108683e+00,
+    1.8609550926564340e+00, 1.8630636578656785e+00, 1.8651232731486205e+00,
+    1.8671387666078210e+00, 1.8691149341754769e+00, 1.8710565647882187e+00,
+    1.8729684643202604e+00, 1.8748554782455500e+00, 1.8767225129471969e+00,
+    1.8785745555361246e+00, 1.8804166919805003e+00, 1.8822541232826073e+00,
+    1.8840921793703402e+00, 1.8859363302964265e+00, 1.8877921942609546e+00,
+    1.8896655418928605e+00, 1.8915622961452816e+00, 1.8934885270816897e+00,
+    1.8954504407579169e+00, 1.8974543613441310e+00, 1.8995067055877524e+00,
+    1.9016139487000736e+00, 1.9037825807650068e+00, 1.9060190528284049e+00,
+    1.9083297119412619e+00, 1.9107207246114999e+00, 1.9131979883771795e+00,
+    1.9157670315587580e+00, 1.9184329016844883e+00, 1.9212000436132892e+00,
+    1.9240721689978200e+00, 1.0000000000000000e+00, 1.0254405552168451e+00,
+    1.0988286566129919e+00, 1.1744434036111000e+00, 1.2430485187542966e+00,
+    1.3032553200957959e+00, 1.3556702455882659e+00, 1.4013396843366897e+00,
+    1.4412998666933843e+00, 1.4764559821701759e+00, 1.5075651220847011e+00,
+    1.5352506796684569e+00, 1.5600239332431578e+00, 1.5823048335642549e+00,
+    1.6024397442535905e+00, 1.6207158807691777e+00, 1.6373728291999177e+00,
+    1.6526116662386343e+00, 1.6666021709037495e+00, 1.6794885395076082e+00,
+    1.6913939326532479e+00, 1.7024241111097209e+00, 1.7126703592271788e+00,
+    1.7222118490332505e+00, 1.7311175631112674e+00, 1.7394478675760570e+00,
+    1.7472558060299899e+00, 1.7545881697793866e+00, 1.7614863876439815e+00,
+    1.7679872695083849e+00, 1.7741236306726886e+00, 1.7799248185562500e+00,
+    1.7854171590162968e+00, 1.7906243361775847e+00, 1.7955677170169408e+00,
+    1.8002666298454089e+00, 1.8047386041577609e+00, 1.8089995779806656e+00,
+    1.8130640777747045e+00, 1.8169453750762283e+00, 1.8206556233600608e+00,
+    1.8242059780291522e+00, 1.8276067019673690e+00, 1.8308672587050736e+00,
+    1.8339963949284690e+00, 1.8370022137998081e+00, 1.8398922403362039e+00,
+    1.8426734799116997e+00, 1.8453524707941136e+00, 1.8479353314993729e+00,
+    1.8504278036373973e+00, 1.8528352908317027e+00, 1.8551628942165754e+00,
+    1.8574154449490390e+00, 1.8595975341153046e+00, 1.8617135403620906e+00,
+    1.8637676555400036e+00, 1.8657639086084832e+00, 1.8677061880185091e+00,
+    1.8695982627592305e+00, 1.8714438022275910e+00, 1.8732463950550000e+00,
+    1.8750095670015576e+00, 1.8767367980057159e+00, 1.8784315384555641e+00,
+    1.8800972247256287e+00, 1.8817372940012720e+00, 1.8833551983895600e+00,
+    1.8849544182918103e+00, 1.8865384749875576e+00, 1.8881109423530800e+00,
+    1.8896754576088741e+00, 1.8912357309600822e+00, 1.8927955539615231e+00,
+    1.8943588064047370e+00, 1.8959294614888440e+00, 1.8975115890003862e+00,
+    1.8991093561901620e+00, 1.9007270259988771e+00, 1.9023689522492220e+00,
+    1.9040395713915559e+00, 1.9057433903659800e+00, 1.9074849701280341e+00,
+    1.9092689043812678e+00, 1.9110997930715652e+00, 1.9129822102290375e+00,
+    1.9149206657979152e+00, 1.9169195611774019e+00, 1.9189831383111502e+00,
+    1.9211154223134275e+00, 1.9233201578087715e+00, 1.9256007393897421e+00,
+    1.9279601368639867e+00, 1.9304008162621238e+00, 1.0000000000000000e+00,
+    1.0254426236433769e+00, 1.0988393626886996e+00, 1.1744670039589082e+00,
+    1.2430879332315354e+00, 1.3033126190898570e+00, 1.3557469319870876e+00,
+    1.4014368666062971e+00, 1.4414183696303089e+00, 1.4765964202669288e+00,
+    1.5077279496066227e+00, 1.5354362257436776e+00, 1.5602324270262351e+00,
+    1.5825364226535372e+00, 1.6026945084150619e+00, 1.6209938423238754e+00,
+    1.6376739609910496e+00, 1.6529358978082775e+00, 1.6669493933189856e+00,
+    1.6798586091471579e+00, 1.6917866741766998e+00, 1.7028393197688128e+00,
+    1.7131078026336848e+00, 1.7226712684652175e+00, 1.7315986744149885e+00,
+    1.7399503617026022e+00, 1.7477793492308076e+00, 1.7551324034740245e+00,
+    1.7620509279638144e+00, 1.7685717065123288e+00, 1.7747275272243550e+00,
+    1.7805477088460444e+00, 1.7860585467065648e+00, 1.7912836921439717e+00,
+    1.7962444766543493e+00, 1.8009601899022420e+00, 1.8054483190576041e+00,
+    1.8097247555859193e+00, 1.8138039745420251e+00, 1.8176991905489452e+00,
+    1.8214224939377504e+00, 1.8249849699497749e+00, 1.8283968034320999e+00,
+    1.8316673710708264e+00, 1.8348053228877823e+00, 1.8378186544623283e+00,
+    1.8407147711205356e+00, 1.8435005451509532e+00, 1.8461823669530868e+00,
+    1.8487661908959978e+00, 1.8512575765561647e+00, 1.8536617259120698e+00,
+    1.8559835169953411e+00, 1.8582275344322561e+00, 1.8603980972529255e+00,
+    1.8624992842973838e+00, 1.8645349575060712e+00, 1.8665087833467231e+00,
+    1.8684242525984294e+00, 1.8702846986868120e+00, 1.8720933147406376e+00,
+    1.8738531695193872e+00, 1.8755672223429019e+00, 1.8772383371377215e+00,
+    1.8788692956998523e+00, 1.8804628102599878e+00, 1.8820215354246388e+00,
+    1.8835480795546820e+00, 1.8850450156314063e+00, 1.8865148916491266e+00,
+    1.8879602405623119e+00, 1.8893835898043232e+00, 1.8907874703833987e+00,
+    1.8921744255500437e+00, 1.8935470190176560e+00, 1.8949078427055985e+00,
+    1.8962595239603199e+00, 1.8976047321957650e+00, 1.8989461848792788e+00,
+    1.9002866527732030e+00, 1.9016289643253839e+00, 1.9029760090846930e+00,
+    1.9043307399995602e+00, 1.9056961744393901e+00, 1.9070753937610083e+00,
+    1.9084715412251394e+00, 1.9098878180521237e+00, 1.9113274773927331e+00,
+    1.9127938159798432e+00, 1.9142901632208844e+00, 1.9158198674912454e+00,
+    1.9173862793963306e+00, 1.9189927317865012e+00, 1.9206425163366132e+00,
+    1.9223388565419204e+00, 1.9240848770365850e+00, 1.9258835692111638e+00,
+    1.9277377531932101e+00, 1.9296500363594664e+00, 1.9316227686714300e+00,
+    1.9336579952641957e+00, 1.9357574068721342e+00, 1.0000000000000000e+00,
+    1.0254442651569156e+00, 1.0988478601603444e+00, 1.1744857386073324e+00,
+    1.2431192273930223e+00, 1.3033581228845135e+00, 1.3558078470486772e+00,
+    1.4015140833998689e+00, 1.4415125553116854e+00, 1.4767080768740217e+00,
+    1.5078574537708813e+00, 1.5355838565103590e+00, 1.5603983858004091e+00,
+    1.5827208477967096e+00, 1.6028974861230179e+00, 1.6212154148645170e+00,
+    1.6379141330313791e+00, 1.6531946413328211e+00, 1.6672266514914693e+00,
+    1.6801542993653911e+00, 1.6921006905004292e+00, 1.7031715348509844e+00,
+    1.7134580692503736e+00, 1.7230394207139819e+00, 1.7319845286325506e+00,
+    1.7403537171386656e+00, 1.7481999885040691e+00, 1.7555700928280591e+00,
+    1.7625054173338806e+00, 1.7690427294088733e+00, 1.7752148004344790e+00,
+    1.7810509319504562e+00, 1.7865774014063664e+00, 1.7918178413886574e+00,
+    1.7967935635597272e+00, 1.8015238364446053e+00, 1.8060261245280829e+00,
+    1.8103162947865923e+00, 1.8144087957032542e+00, 1.8183168129450327e+00,
+    1.8220524051758176e+00, 1.8256266229044189e+00, 1.8290496127961298e+00,
+    1.8323307094898538e+00, 1.8354785166441387e+00, 1.8385009786711004e+00,
+    1.8414054443981167e+00, 1.8441987237137156e+00, 1.8468871381011933e+00,
+    1.8494765658346770e+00, 1.8519724825039703e+00, 1.8543799974430093e+00,
+    1.8567038865590715e+00, 1.8589486219938802e+00, 1.8611183989915914e+00,
+    1.8632171603003898e+00, 1.8652486183933714e+00, 1.8672162757587920e+00,
+    1.8691234434792920e+00, 1.8709732582932403e+00, 1.8727686983084209e+00,
+    1.8745125975183794e+00, 1.8762076592542549e+00, 1.8778564686897590e+00,
+    1.8794615045034282e+00, 1.8810251497904642e+00, 1.8825497023058104e+00,
+    1.8840373841107114e+00, 1.8854903506863570e+00, 1.8869106995704674e+00,
+    1.8883004785654371e+00, 1.8896616935599695e+00, 1.8909963159998640e+00,
+    1.8923062900373757e+00, 1.8935935393830068e+00, 1.8948599738773984e+00,
+    1.8961074957956092e+00, 1.8973380058897880e+00, 1.8985534091706548e+00,
+    1.8997556204216286e+00, 1.9009465694332766e+00, 1.9021282059385776e+00,
+    1.9033025042229437e+00, 1.9044714673746752e+00, 1.9056371311342306e+00,
+    1.9068015672920802e+00, 1.9079668865762174e+00, 1.9091352409615363e+00,
+    1.9103088253240361e+00, 1.9114898783534247e+00, 1.9126806826284817e+00,
+    1.9138835637506768e+00, 1.9151008884230314e+00, 1.9163350613537322e+00,
+    1.9175885208579315e+00, 1.9188637330267517e+00, 1.9201631843306046e+00,
+    1.9214893725248576e+00, 1.9228447957307377e+00, 1.9242319395735343e+00,
+    1.9256532622746263e+00, 1.9271111776143686e+00, 1.9286080357102242e+00,
+    1.9301461015894255e+00, 1.9317275315782583e+00, 1.9333543475812884e+00,
+    1.9350284093837282e+00, 1.9367513851777323e+00, 1.9385247205885929e+00,
+    1.9403496065579284e+00, 1.0000000000000000e+00, 1.0254455896271213e+00,
+    1.0988547171177114e+00, 1.1745008582461411e+00, 1.2431444868184094e+00,
+    1.3033948580641692e+00, 1.3558570333049207e+00, 1.4015764461830733e+00,
+    1.4415886410701009e+00, 1.4767982999868845e+00, 1.5079621285719029e+00,
+    1.5357032197177589e+00, 1.5605326125949222e+00, 1.5828700635852397e+00,
+    1.6030617753042866e+00, 1.6213948274678953e+00, 1.6381086898181807e+00,
+    1.6534043377664103e+00, 1.6674514608612419e+00, 1.6803941752677349e+00,
+    1.6923555688231979e+00, 1.7034413353684734e+00, 1.7137426969075769e+00,
+    1.7233387666585125e+00, 1.7322984710376736e+00, 1.7406821218497108e+00,
+    1.7485427095320911e+00, 1.7559269727081668e+00, 1.7628762873606070e+00,
+    1.7694274097569718e+00, 1.7756131001703213e+00, 1.7814626489365715e+00,
+    1.7870023220994447e+00, 1.7922557405293833e+00, 1.7972442037512610e+00,
+    1.8019869676149003e+00, 1.8065014832699482e+00, 1.8108036035681245e+00,
+    1.8149077619399712e+00, 1.8188271279239419e+00, 1.8225737428204467e+00,
+    1.8261586383687110e+00, 1.8295919408738910e+00, 1.8328829628253414e+00,
+    1.8360402837280974e+00, 1.8390718216054913e+00, 1.8419848964112824e+00,
+    1.8447862864067641e+00, 1.8474822784048088e+00, 1.8500787126543796e+00,
+    1.8525810230304269e+00, 1.8549942731026356e+00, 1.8573231885787289e+00,
+    1.8595721865520485e+00, 1.8617454019270092e+00, 1.8638467113477126e+00,
+    1.8658797549139778e+00, 1.8678479559335908e+00, 1.8697545389289991e+00,
+    1.8716025460905197e+00, 1.8733948523450803e+00, 1.8751341791899649e+00,
+    1.8768231074236654e+00, 1.8784640888910524e+00, 1.8800594573467455e+00,
+    1.8816114385293279e+00, 1.8831221595286887e+00, 1.8845936575199462e+00,
+    1.8860278879294359e+00, 1.8874267320913021e+00, 1.8887920044467867e+00,
+    1.8901254593328050e+00, 1.8914287974012001e+00, 1.8927036717054146e+00,
+    1.8939516934871259e+00, 1.8951744376913595e+00, 1.8963734482348837e+00,
+    1.8975502430493070e+00, 1.8987063189167306e+00, 1.8998431561128675e+00,
+    1.9009622228688938e+00, 1.9020649796607152e+00, 1.9031528833304818e+00,
+    1.9042273910424545e+00, 1.9052899640717471e+00, 1.9063420714209895e+00,
+    1.9073851932564747e+00, 1.9084208241515601e+00, 1.9094504761210953e+00,
+    1.9104756814265902e+00, 1.9114979951275088e+00, 1.9125189973494598e+00,
+    1.9135402952355225e+00, 1.9145635245419683e+00, 1.9155903508346774e+00,
+    1.9166224702376216e+00, 1.9176616096797250e+00, 1.9187095265814640e+00,
+    1.9197680079180932e+00, 1.9208388685919384e+00, 1.9219239490426610e+00,
+    1.9230251120213659e+00, 1.9241442384527270e+00, 1.9252832223083871e+00,
+    1.9264439644164468e+00, 1.9276283651342292e+00, 1.9288383158173159e+00,
+    1.9300756890254418e+00, 1.9313423274170629e+00, 1.9326400312987659e+00,
+    1.9339705448137579e+00, 1.9353355407760204e+00, 1.9367366041827554e+00,
+    1.9381752144686686e+00, 1.9396527266000019e+00, 1.9411703511451575e+00,
+    1.9427291335004424e+00, 1.9443299324943544e+00, 1.0000000000000000e+00,
+    1.0254466737291241e+00, 1.0988603301188555e+00, 1.1745132362058128e+00,
+    1.2431651683791918e+00, 1.3034249397682605e+00, 1.3558973173133830e+00,
+    1.4016275309317574e+00, 1.4416509792652275e+00, 1.4768722370088478e+00,
+    1.5080479286758319e+00, 1.5358010843821850e+00, 1.5606426936717814e+00,
+    1.5829924729193237e+00, 1.6031965918998434e+00, 1.6215421029158863e+00,
+    1.6382684524669153e+00, 1.6535765959686957e+00, 1.6676362055319762e+00,
+    1.6805913819187777e+00, 1.6925651991962374e+00, 1.7036633387542497e+00,
+    1.7139770112168329e+00, 1.7235853192934616e+00, 1.7325571796006085e+00,
+    1.7409528947163906e+00, 1.7488254463107435e+00, 1.7562215645998025e+00,
+    1.7631826174323515e+00, 1.7697453531369873e+00, 1.7759425241704465e+00,
+    1.7818034131067864e+00, 1.7873542782166294e+00, 1.7926187325215008e+00,
+    1.7976180675568885e+00, 1.8023715309770940e+00, 1.8068965654624363e+00,
+    1.8112090150511351e+00, 1.8153233039421874e+00, 1.8192525919463964e+00,
+    1.8230089100575302e+00, 1.8266032790408124e+00, 1.8300458134655488e+00,
+    1.8333458132222245e+00, 1.8365118442454227e+00, 1.8395518098998984e+00,
+    1.8424730142676304e+00, 1.8452822183904725e+00, 1.8479856903699514e+00,
+    1.8505892500968200e+00, 1.8530983092748079e+00, 1.8555179073111487e+00,
+    1.8578527435689751e+00, 1.8601072064105562e+00, 1.8622853994041269e+00,
+    1.8643911650189282e+00, 1.8664281060919339e+00, 1.8683996053142033e+00,
+    1.8703088429544183e+00, 1.8721588130107882e+00, 1.8739523379597061e+00,
+    1.8756920822497849e+00, 1.8773805646727693e+00, 1.8790201697277469e+00,
+    1.8806131580821686e+00, 1.8821616762215780e+00, 1.8836677653700538e+00,
+    1.8851333697545432e+00, 1.8865603442783412e+00, 1.8879504616623761e+00,
+    1.8893054191066496e+00, 1.8906268445189174e+00, 1.8919163023528243e+00,
+    1.8931752990934909e+00, 1.8944052884245961e+00, 1.8956076761076179e+00,
+    1.8967838246006732e+00, 1.8979350574416349e+00, 1.8990626634174459e+00,
+    1.9001679005392285e+00, 1.9012519998405351e+00, 1.9023161690138444e+00,
+    1.9033615958985763e+00, 1.9043894518317848e+00, 1.9054008948710273e+00,
+    1.9063970728968007e+00, 1.9073791266004929e+00, 1.9083481923615169e+00,
+    1.9093054050159752e+00, 1.9102519005168230e+00, 1.9111888184840340e+00,
+    1.9121173046408988e+00, 1.9130385131307481e+00, 1.9139536087061997e+00,
+    1.9148637687807075e+00, 1.9157701853298925e+00, 1.9166740666277005e+00,
+    1.9175766387998230e+00, 1.9184791471741844e+00, 1.9193828574056946e+00,
+    1.9202890563494674e+00, 1.9211990526540799e+00, 1.9221141770435382e+00,
+    1.9230357822538870e+00, 1.9239652425877662e+00, 1.9249039530476395e+00,
+    1.9258533280063395e+00, 1.9268147993715856e+00, 1.9277898141997838e+00,
+    1.9287798317136609e+00, 1.9297863196780447e+00, 1.9308107500891760e+00,
+    1.9318545941345910e+00, 1.9329193163838656e+00, 1.9340063681750217e+00,
+    1.9351171801675309e+00, 1.9362531540408641e+00, 1.9374156533272504e+00,
+    1.9386059933794186e+00, 1.9398254304881901e+00, 1.9410751501810735e+00,
+    1.9423562547516406e+00, 1.9436697500901685e+00, 1.9450165319085184e+00,
+    1.9463973714764851e+00, 1.9478129010122773e+00, 9.9999999999999989e-01,
+    1.0254475722883345e+00, 1.0988649827764434e+00, 1.1745234972418674e+00,
+    1.2431823146005843e+00, 1.3034498821137150e+00, 1.3559307232798714e+00,
+    1.4016698997057235e+00, 1.4417026897842578e+00, 1.4769335797852383e+00,
+    1.5081191275058199e+00, 1.5358823115473899e+00, 1.5607340808319952e+00,
+    1.5830941190793455e+00, 1.6033085693437870e+00, 1.6216644617004528e+00,
+    1.6384012238740471e+00, 1.6537197951939018e+00, 1.6677898338025428e+00,
+    1.6807554281804740e+00, 1.6927396414689191e+00, 1.7038481452299927e+00,
+    1.7141721411552371e+00, 1.7237907237550421e+00, 1.7327728020491551e+00,
+    1.7411786715138062e+00, 1.7490613071222527e+00, 1.7564674327232426e+00,
+    1.7634384100620180e+00, 1.7700109815699676e+00, 1.7762178939614097e+00,
+    1.7820884241756274e+00, 1.7876488249120617e+00, 1.7929227036426887e+00,
+    1.7979313463343032e+00, 1.8026939950130785e+00, 1.8072280866313035e+00,
+    1.8115494593580843e+00, 1.8156725313398270e+00, 1.8196104561072237e+00,
+    1.8233752581003062e+00, 1.8269779512083424e+00, 1.8304286427510910e+00,
+    1.8337366249412721e+00, 1.8369104555493903e+00, 1.8399580292277908e+00,
+    1.8428866407314437e+00, 1.8457030410898083e+00, 1.8484134876308185e+00,
+    1.8510237886294278e+00, 1.8535393432446075e+00, 1.8559651773171608e+00,
+    1.8583059755229114e+00, 1.8605661103100164e+00, 1.8627496679925866e+00,
+    1.8648604723249624e+00, 1.8669021058395954e+00, 1.8688779291961413e+00,
+    1.8707910987588063e+00, 1.8726445825927795e+00, 1.8744411750475904e+00,
+    1.8761835100756925e+00, 1.8778740734172119e+00, 1.8795152137669688e+00,
+    1.8811091530267234e+00, 1.8826579957342608e+00, 1.8841637377508089e+00,
+    1.8856282742796724e+00, 1.8870534072810057e+00, 1.8884408523410210e+00,
+    1.8897922450477911e+00, 1.8911091469205812e+00, 1.8923930509347331e+00,
+    1.8936453866801861e+00, 1.8948675251877092e+00, 1.8960607834537853e+00,
+    1.8972264286919223e+00, 1.8983656823356743e+00, 1.8994797238159997e+00,
+    1.9005696941336185e+00, 1.9016366992448632e+00, 1.9026818132778522e+00,
+    1.9037060815940099e+00, 1.9047105237085720e+00, 1.9056961360821356e+00,
+    1.9066638947941466e+00, 1.9076147581078375e+00, 1.9085496689349397e+00,
+    1.9094695572074780e+00, 1.9103753421627583e+00, 1.9112679345463850e+00,
+    1.9121482387375885e+00, 1.9130171547994503e+00, 1.9138755804560119e+00,
+    1.9147244129969083e+00, 1.9155645511091937e+00, 1.9163968966347389e+00,
+    1.9172223562505479e+00, 1.9180418430680284e+00, 1.9188562781459357e+00,
+    1.9196665919105000e+00, 1.9204737254747568e+00, 1.9212786318477171e+00,
+    1.9220822770224939e+00, 1.9228856409309989e+00, 1.9236897182512169e+00,
+    1.9244955190514017e+00, 1.9253040692540413e+00, 1.9261164109006095e+00,
+    1.9269336021967083e+00, 1.9277567173155168e+00, 1.9285868459359436e+00,
+    1.9294250924907219e+00, 1.9302725750981808e+00, 1.9311304241508542e+00,
+    1.9319997805329598e+00, 1.9328817934388365e+00, 1.9337776177643751e+00,
+    1.9346884110439593e+00, 1.9356153299068586e+00, 1.9365595260287967e+00,
+    1.9375221415571111e+00, 1.9385043039914678e+00, 1.9395071205066923e+00,
+    1.9405316717097332e+00, 1.9415790048296206e+00, 1.9426501263471039e+00,
+    1.9437459940796886e+00, 1.9448675087482519e+00, 1.9460155050626446e+00,
+    1.9471907423767583e+00, 1.9483938949763049e+00, 1.9496255420778361e+00,
+    1.9508861576316467e+00, 9.9999999999999989e-01, 1.0254483253469320e+00,
+    1.0988688822650758e+00, 1.1745320978255489e+00, 1.2431966873856404e+00,
+    1.3034707919786812e+00, 1.3559587314704933e+00, 1.4017054267944495e+00,
+    1.4417460559441895e+00, 1.4769850314557458e+00, 1.5081788555818294e+00,
+    1.5359504641148065e+00, 1.5608107722922921e+00, 1.5831794368221563e+00,
+    1.6034025787162909e+00, 1.6217672097694249e+00, 1.6385127423161621e+00,
+    1.6538401025460654e+00, 1.6679189372351053e+00, 1.6808933249096867e+00,
+    1.6928863198929394e+00, 1.7040035858503964e+00, 1.7143363173300128e+00,
+    1.7239636023176301e+00, 1.7329543438196984e+00, 1.7413688317225773e+00,
+    1.7492600357606269e+00, 1.7566746748340327e+00, 1.7636541059783395e+00,
+    1.7702350671097056e+00, 1.7764503005827526e+00, 1.7823290790978272e+00,
+    1.7878976512045646e+00, 1.7931796202849632e+00, 1.7981962682479702e+00,
+    1.8029668330674187e+00, 1.8075087476227234e+00, 1.8118378459637192e+00,
+    1.8159685420450900e+00, 1.8199139851068278e+00, 1.8236861951719445e+00,
+    1.8272961815580506e+00, 1.8307540468289500e+00, 1.8340690782260249e+00,
+    1.8372498283001999e+00, 1.8403041862012532e+00, 1.8432394408617421e+00,
+    1.8460623371296292e+00, 1.8487791257505715e+00, 1.8513956079719920e+00,
+    1.8539171754327086e+00, 1.8563488459101980e+00, 1.8586952954199611e+00,
+    1.8609608870953485e+00, 1.8631496972200472e+00, 1.8652655387370725e+00,
+    1.8673119825172824e+00, 1.8692923766345251e+00, 1.8712098638644059e+00,
+    1.8730673975971570e+00, 1.8748677563322778e+00, 1.8766135569029003e+00,
+    1.8783072665606844e+00, 1.8799512140369621e+00, 1.8815475996829367e+00,
+    1.8830985047801865e+00, 1.8846059001028501e+00, 1.8860716538039271e+00,
+    1.8874975386905499e+00, 1.8888852389461828e+00, 1.8902363563517102e+00,
+    1.8915524160520698e+00, 1.8928348719103889e+00, 1.8940851114874042e+00,
+    1.8953044606800817e+00, 1.8964941880505088e+00, 1.8976555088723439e+00,
+    1.8987895889204862e+00, 1.8998975480263987e+00, 1.9009804634198986e+00,
+    1.9020393728761427e+00, 1.9030752776848132e+00, 1.9040891454569930e+00,
+    1.9050819127838059e+00, 1.9060544877595411e+00, 1.9070077523809001e+00,
+    1.9079425648328856e+00, 1.9088597616707952e+00, 1.9097601599069984e+00,
+    1.9106445590101571e+00, 1.9115137428238591e+00, 1.9123684814108728e+00,
+    1.9132095328283154e+00, 1.9140376448386744e+00, 1.9148535565606206e+00,
+    1.9156580000629382e+00, 1.9164517019045897e+00, 1.9172353846227026e+00,
+    1.9180097681701354e+00, 1.9187755713033392e+00, 1.9195335129206690e+00,
+    1.9202843133505676e+00, 1.9210286955883331e+00, 1.9217673864795857e+00,
+    1.9225011178476143e+00, 1.9232306275610964e+00, 1.9239566605379370e+00,
+    1.9246799696799815e+00, 1.9254013167326645e+00, 1.9261214730626519e+00,
+    1.9268412203455147e+00, 1.9275613511548666e+00, 1.9282826694429736e+00,
+    1.9290059909022450e+00, 1.9297321431958132e+00, 1.9304619660445188e+00,
+    1.9311963111566766e+00, 1.9319360419860769e+00, 1.9326820333027923e+00,
+    1.9334351705606700e+00, 1.9341963490446987e+00, 1.9349664727808755e+00,
+    1.9357464531910535e+00, 1.9365372074748088e+00, 1.9373396567008785e+00,
+    1.9381547235908536e+00, 1.9389833299787538e+00, 1.9398263939312497e+00,
+    1.9406848265149270e+00, 1.9415595281990776e+00, 1.9424513848852960e+00,
+    1.9433612635582320e+00, 1.9442900075559235e+00, 1.9452384314625839e+00,
+    1.9462073156319506e+00, 1.9471974003553376e+00, 1.9482093796949218e+00,
+    1.9492438950102902e+00, 1.9503015282138316e+00, 1.9513827947991367e+00,
+    1.9524881366951035e+00, 1.9536179150075383e+00, 1.0000000000000000e+00,
+    1.0254489627011731e+00, 1.0988721827700230e+00, 1.1745393777359165e+00,
+    1.2432088539839032e+00, 1.3034884936530500e+00, 1.3559824445415958e+00,
+    1.4017355087972803e+00, 1.4417827797105998e+00, 1.4770286076797450e+00,
+    1.5082294482110825e+00, 1.5360082011262970e+00, 1.5608757534120294e+00,
+    1.5832517391696883e+00, 1.6034822610078170e+00, 1.6218543154992011e+00,
+    1.6386073022003296e+00, 1.6539421364250908e+00, 1.6680284555727727e+00,
+    1.6810103299871986e+00, 1.6930108067696015e+00, 1.7041355431434013e+00,
+    1.7144757278523792e+00, 1.7241104436036949e+00, 1.7331085885604234e+00,
+    1.7415304481277609e+00, 1.7494289878611791e+00, 1.7568509227345188e+00,
+    1.7638376060677383e+00, 1.7704257722366221e+00, 1.7766481601999020e+00,
+    1.7825340393796327e+00, 1.7881096551407534e+00, 1.7933986077524535e+00,
+    1.7984221760627490e+00, 1.8031995950176385e+00, 1.8077482944839063e+00,
+    1.8120841054966164e+00, 1.8162214389764599e+00, 1.8201734410931969e+00,
+    1.8239521287461871e+00, 1.8275685080584148e+00, 1.8310326783100495e+00,
+    1.8343539233511179e+00, 1.8375407922139555e+00, 1.8406011703820553e+00,
+    1.8435423429524540e+00, 1.8463710507456654e+00, 1.8490935402639084e+00,
+    1.8517156082697126e+00, 1.8542426416485311e+00, 1.8566796531272884e+00,
+    1.8590313133432654e+00, 1.8613019796915069e+00, 1.8634957223228221e+00,
+    1.8656163476162222e+00, 1.8676674194084371e+00, 1.8696522782277774e+00,
+    1.8715740587489578e+00, 1.8734357056593589e+00, 1.8752399881042288e+00,
+    1.8769895128586116e+00, 1.8786867363566693e+00, 1.8803339756939792e+00,
+    1.8819334187054648e+00, 1.8834871332100362e+00, 1.8849970755031620e+00,
+    1.8864650981696773e+00, 1.8878929572814991e+00, 1.8892823190380472e+00,
+    1.8906347659011933e+00, 1.8919518022712545e+00, 1.8932348597457664e+00,
+    1.8944853019987602e+00, 1.8957044293143275e+00, 1.8968934828051847e+00,
+    1.8980536483438666e+00, 1.8991860602315815e+00, 1.9002918046274275e+00,
+    1.9013719227586032e+00, 1.9024274139302371e+00, 1.9034592383518887e+00,
+    1.9044683197962486e+00, 1.9054555481040107e+00, 1.9064217815478965e+00,
+    1.9073678490675305e+00, 1.9082945523858135e+00, 1.9092026680166481e+00,
+    1.9100929491728871e+00, 1.9109661275826764e+00, 1.9118229152216037e+00,
+    1.9126640059674209e+00, 1.9134900771835093e+00, 1.9143017912366473e+00,
+    1.9150997969541657e+00, 1.9158847310249740e+00, 1.9166572193486364e+00,
+    1.9174178783359648e+00, 1.9181673161644595e+00, 1.9189061339912212e+00,
+    1.9196349271257220e+00, 1.9203542861644354e+00, 1.9210647980887241e+00,
+    1.9217670473271622e+00, 1.9224616167830499e+00, 1.9231490888273539e+00,
+    1.9238300462570370e+00, 1.9245050732180835e+00, 1.9251747560924590e+00,
+    1.9258396843473431e+00, 1.9265004513448434e+00, 1.9271576551098200e+00,
+    1.9278118990527737e+00, 1.9284637926445658e+00, 1.9291139520388687e+00,
+    1.9297630006378828e+00, 1.9304115695962161e+00, 1.9310602982573255e+00,
+    1.9317098345161294e+00, 1.9323608351010406e+00, 1.9330139657678422e+00,
+    1.9336699013974492e+00, 1.9343293259887557e+00, 1.9349929325374859e+00,
+    1.9356614227911584e+00, 1.9363355068699681e+00, 1.9370159027428626e+00,
+    1.9377033355478166e+00, 1.9383985367448571e+00, 1.9391022430904195e+00,
+    1.9398151954216083e+00, 1.9405381372387385e+00, 1.9412718130753419e+00,
+    1.9420169666448428e+00, 1.9427743387542662e+00, 1.9435446649761003e+00,
+    1.9443286730708007e+00, 1.9451270801541658e+00, 1.9459405896055715e+00,
+    1.9467698877155168e+00, 1.9476156400737350e+00, 1.9484784877019121e+00,
+    1.9493590429389382e+00, 1.9502578850902359e+00, 1.9511755558571933e+00,
+    1.9521125545671725e+00, 1.9530693332297826e+00, 1.9540462914500714e+00,
+    1.9550437712349302e+00, 1.9560620517344409e+00, 9.9999999999999989e-01,
+    1.0254495068934752e+00, 1.0988750009545385e+00, 1.1745455941027216e+00,
+    1.2432192437404885e+00, 1.3035036111606209e+00, 1.3560026974467743e+00,
+    1.4017612035230178e+00, 1.4418141505544029e+00, 1.4770658360784024e+00,
+    1.5082726758802787e+00, 1.5360575392591713e+00, 1.5609312892684846e+00,
+    1.5833135408938837e+00, 1.6035503812149912e+00, 1.6219287939902014e+00,
+    1.6386881680464764e+00, 1.6540294095909331e+00, 1.6681221481945336e+00,
+    1.6811104473911411e+00, 1.6931173482913795e+00, 1.7042485027932945e+00,
+    1.7145950948598607e+00, 1.7242362028664471e+00, 1.7332407210169620e+00,
+    1.7416689310682851e+00, 1.7495737951880137e+00, 1.7570020251809710e+00,
+    1.7639949713822400e+00, 1.7705893653376426e+00, 1.7768179433058413e+00,
+    1.7827099721171258e+00, 1.7882916946340364e+00, 1.7935867086958632e+00,
+    1.7986162907780043e+00, 1.8033996734971645e+00, 1.8079542844211216e+00,
+    1.8122959523038948e+00, 1.8164390857912285e+00, 1.8203968287724492e+00,
+    1.8241811958495482e+00, 1.8278031908197390e+00, 1.8312729105974364e+00,
+    1.8345996366150659e+00, 1.8377919154233338e+00, 1.8408576299474433e+00,
+    1.8438040626363381e+00, 1.8466379515588627e+00, 1.8493655403475453e+00,
+    1.8519926227620080e+00, 1.8545245825355101e+00, 1.8569664290765637e+00,
+    1.8593228295198421e+00, 1.8615981375546287e+00, 1.8637964194026659e+00,
+    1.8659214772692549e+00, 1.8679768705501665e+00, 1.8699659350415143e+00,
+    1.8718918003691865e+00, 1.8737574058281734e+00, 1.8755655147992454e+00,
+    1.8773187278906687e+00, 1.8790194949355705e+00, 1.8806701259604377e+00,
+    1.8822728012272216e+00, 1.8838295804402514e+00, 1.8853424111988557e+00,
+    1.8868131367680367e+00, 1.8882435032317446e+00, 1.8896351660864450e+00,
+    1.8909896963266910e+00, 1.8923085860691700e+00, 1.8935932537568072e+00,
+    1.8948450489805500e+00, 1.8960652569526080e+00, 1.8972551026616522e+00,
+    1.8984157547375502e+00, 1.8995483290506494e+00, 1.9006538920681035e+00,
+    1.9017334639878571e+00, 1.9027880216688817e+00, 1.9038185013745643e+00,
+    1.9048258013447055e+00, 1.9058107842102476e+00, 1.9067742792633720e+00,
+    1.9077170845948979e+00, 1.9086399691095433e+00, 1.9095436744288701e+00,
+    1.9104289166909025e+00, 1.9112963882546565e+00, 1.9121467593170063e+00,
+    1.9129806794488968e+00, 1.9137987790572095e+00, 1.9146016707780118e+00,
+    1.9153899508065930e+00, 1.9161642001691352e+00, 1.9169249859404203e+00,
+    1.9176728624117239e+00, 1.9184083722125633e+00, 1.9191320473896096e+00,
+    1.9198444104459615e+00, 1.9205459753433587e+00, 1.9212372484698439e+00,
+    1.9219187295751217e+00, 1.9225909126754059e+00, 1.9232542869293723e+00,
+    1.9239093374867364e+00, 1.9245565463104022e+00, 1.9251963929730902e+00,
+    1.9258293554291124e+00, 1.9264559107615140e+00, 1.9270765359047271e+00,
+    1.9276917083425176e+00, 1.9283019067807425e+00, 1.9289076117941690e+00,
+    1.9295093064462998e+00, 1.9301074768808391e+00, 1.9307026128831977e+00,
+    1.9312952084099271e+00, 1.9318857620839316e+00, 1.9324747776526572e+00,
+    1.9330627644063221e+00, 1.9336502375527953e+00, 1.9342377185454249e+00,
+    1.9348257353595932e+00, 1.9354148227136243e+00, 1.9360055222290802e+00,
+    1.9365983825252711e+00, 1.9371939592421956e+00, 1.9377928149861521e+00,
+    1.9383955191913846e+00, 1.9390026478914233e+00, 1.9396147833928339e+00,
+    1.9402325138444632e+00, 1.9408564326945004e+00, 1.9414871380280561e+00,
+    1.9421252317773290e+00, 1.9427713187970144e+00, 1.9434260057972594e+00,
+    1.9440899001269156e+00, 1.9447636084001505e+00, 1.9454477349599026e+00,
+    1.9461428801724843e+00, 1.9468496385481631e+00, 1.9475685966838689e+00,
+    1.9483003310252622e+00, 1.9490454054466895e+00, 1.9498043686495565e+00,
+    1.9505777513811695e+00, 1.9513660634784999e+00, 1.9521697907434847e+00,
+    1.9529893916593797e+00, 1.9538252939600993e+00, 1.9546778910679226e+00,
+    1.9555475384178722e+00, 1.9564345496905584e+00, 1.9573391929786530e+00,
+    1.9582616869157912e+00, 1.0000000000000000e+00, 1.0254499752326536e+00,
+    1.0988774264057042e+00, 1.1745509444038069e+00, 1.2432281864454819e+00,
+    1.3035166239118938e+00, 1.3560201317712754e+00, 1.4017833239803590e+00,
+    1.4418411597774710e+00, 1.4770978913513024e+00, 1.5083099004450067e+00,
+    1.5361000302306014e+00, 1.5609791233038395e+00, 1.5833667783373488e+00,
+    1.6036090691832428e+00, 1.6219929687072479e+00, 1.6387578566366461e+00,
+    1.6541046314742418e+00, 1.6682029161858298e+00, 1.6811967685755416e+00,
+    1.6932092247285897e+00, 1.7043459320894876e+00, 1.7146980706359256e+00,
+    1.7243447151443085e+00, 1.7333547565404304e+00, 1.7417884735711660e+00,
+    1.7496988256192352e+00, 1.7571325218944043e+00, 1.7641309102972251e+00,
+    1.7707307200749314e+00, 1.7769646853027614e+00, 1.7828620707249054e+00,
+    1.7884491171996868e+00, 1.7937494206305276e+00, 1.7987842556132585e+00,
+    1.8035728529304460e+00, 1.8081326383512455e+00, 1.8124794388573240e+00,
+    1.8166276613396939e+00, 1.8205904479422319e+00, 1.8243798115227565e+00,
+    1.8280067541276603e+00, 1.8314813709060636e+00, 1.8348129415027374e+00,
+    1.8380100106503918e+00, 1.8410804594177310e+00, 1.8440315683503010e+00,
+    1.8468700735579351e+00, 1.8496022166495278e+00, 1.8522337892869545e+00,
+    1.8547701730217452e+00, 1.8572163749862798e+00, 1.8595770599337824e+00,
+    1.8618565790551953e+00, 1.8640589959448723e+00, 1.8661881100388189e+00,
+    1.8682474778080165e+00, 1.8702404319538999e+00, 1.8721700988226380e+00,
+    1.8740394142283641e+00, 1.8758511378528762e+00, 1.8776078663694185e+00,
+    1.8793120454210452e+00, 1.8809659805690642e+00, 1.8825718473139992e+00,
+    1.8841317002801263e+00, 1.8856474816445050e+00, 1.8871210288827804e+00,
+    1.8885540818962288e+00, 1.8899482895776862e+00, 1.8913052158680459e+00,
+    1.8926263453496319e+00, 1.8939130884181423e+00, 1.8951667860705366e+00,
+    1.8963887143427260e+00, 1.8975800884274117e+00, 1.8987420664996750e+00,
+    1.8998757532751360e+00, 1.9009822033233013e+00, 1.9020624241564681e+00,
+    1.9031173791128220e+00, 1.9041479900505851e+00, 1.9051551398685773e+00,
+    1.9061396748671895e+00, 1.9071024069625779e+00, 1.9080441157657078e+00,
+    1.9089655505369356e+00, 1.9098674320259126e+00, 1.9107504542056761e+00,
+    1.9116152859092306e+00, 1.9124625723760724e+00, 1.9132929367155773e+00,
+    1.9141069812936293e+00, 1.9149052890483040e+00, 1.9156884247399713e+00,
+    1.9164569361407857e+00, 1.9172113551681191e+00, 1.9179521989660608e+00,
+    1.9186799709389561e+00, 1.9193951617403946e+00, 1.9200982502210442e+00,
+    1.9207897043381807e+00, 1.9214699820298133e+00, 1.9221395320557808e+00,
+    1.9227987948081937e+00, 1.9234482030932549e+00, 1.9240881828863960e+00,
+    1.9247191540622990e+00, 1.9253415311015039e+00, 1.9259557237747504e+00,
+    1.9265621378062774e+00, 1.9271611755170983e+00, 1.9277532364490035e+00,
+    1.9283387179699745e+00, 1.9289180158614889e+00, 1.9294915248879985e+00,
+    1.9300596393487368e+00, 1.9306227536118308e+00, 1.9311812626305069e+00,
+    1.9317355624409500e+00, 1.9322860506413031e+00, 1.9328331268509749e+00,
+    1.9333771931493715e+00, 1.9339186544927591e+00, 1.9344579191080198e+00,
+    1.9349953988615727e+00, 1.9355315096017303e+00, 1.9360666714724240e+00,
+    1.9366013091959862e+00, 1.9371358523225086e+00, 1.9376707354429978e+00,
+    1.9382063983633335e+00, 1.9387432862357625e+00, 1.9392818496444073e+00,
+    1.9398225446411419e+00, 1.9403658327277264e+00, 1.9409121807801073e+00,
+    1.9414620609103652e+00, 1.9420159502618100e+00, 1.9425743307322723e+00,
+    1.9431376886208156e+00, 1.9437065141926850e+00, 1.9442813011573441e+00,
+    1.9448625460546107e+00, 1.9454507475434462e+00, 1.9460464055886315e+00,
+    1.9466500205402166e+00, 1.9472620921011701e+00, 1.9478831181788863e+00,
+    1.9485135936165223e+00, 1.9491540088009225e+00, 1.9498048481442882e+00,
+    1.9504665884375720e+00, 1.9511396970746502e+00, 1.9518246301471358e+00,
+    1.9525218304109830e+00, 1.9532317251274252e+00, 1.9539547237821828e+00,
+    1.9546912156884493e+00, 1.9554415674810985e+00, 1.9562061205113517e+00,
+    1.9569851881529796e+00, 1.9577790530337136e+00, 1.9585879642071151e+00,
+    1.9594121342828137e+00, 1.9602517365353347e+00, 1.0000000000000000e+00,
+    1.0254503811869933e+00, 1.0988795288388666e+00, 1.1745555823300908e+00,
+    1.2432359387972227e+00, 1.3035279051204585e+00, 1.3560352470634716e+00,
+    1.4018025033103665e+00, 1.4418645795307219e+00, 1.4771256887130702e+00,
+    1.5083421831999602e+00, 1.5361368836224887e+00, 1.5610206149487729e+00,
+    1.5834129618153896e+00, 1.6036599867119428e+00, 1.6220486531645444e+00,
+    1.6388183331140993e+00, 1.6541699184856311e+00, 1.6682730266190626e+00,
+    1.6812717104507038e+00, 1.6932890018077458e+00, 1.7044305443718255e+00,
+    1.7147875147631744e+00, 1.7244389847352926e+00, 1.7334538424690924e+00,
+    1.7418923641990485e+00, 1.7498075069909722e+00, 1.7572459779028911e+00,
+    1.7642491228237107e+00, 1.7708536691081582e+00, 1.7770923490405033e+00,
+    1.7829944256604844e+00, 1.7885861381956325e+00, 1.7938910809810276e+00,
+    1.7989305270967917e+00, 1.8037237058536670e+00, 1.8082880415850162e+00,
+    1.8126393598655484e+00, 1.8167920662015138e+00, 1.8207593013680068e+00,
+    1.8245530768640952e+00, 1.8281843933817827e+00, 1.8316633447145663e+00,
+    1.8349992091448895e+00, 1.8382005300309505e+00, 1.8412751870492454e+00,
+    1.8442304593298038e+00, 1.8470730815379366e+00, 1.8498092938030792e+00,
+    1.8524448862666474e+00, 1.8549852389123460e+00, 1.8574353572507838e+00,
+    1.8597999043525273e+00, 1.8620832296577476e+00, 1.8642893949342951e+00,
+    1.8664221977079336e+00, 1.8684851924472501e+00, 1.8704817097502324e+00,
+    1.8724148737491912e+00, 1.8742876179241332e+00, 1.8761026994920074e+00,
+    1.8778627125195297e+00, 1.8795700998899245e+00, 1.8812271642391514e+00,
+    1.8828360779639695e+00, 1.8843988923928612e+00, 1.8859175462007383e+00,
+    1.8873938731396416e+00, 1.8888296091498735e+00, 1.8902263989091999e+00,
+    1.8915858018716791e+00, 1.8929092978425754e+00, 1.8941982921307454e+00,
+    1.8954541203161186e+00, 1.8966780526658282e+00, 1.8978712982295223e+00,
+    1.8990350086412759e+00, 1.9001702816529140e+00, 1.9012781644213648e+00,
+    1.9023596565703040e+00, 1.9034157130448082e+00, 1.9044472467756155e+00,
+    1.9054551311685748e+00, 1.9064402024330487e+00, 1.9074032617621464e+00,
+    1.9083450773763242e+00, 1.9092663864410444e+00, 1.9101678968681726e+00,
+    1.9110502890101011e+00, 1.9119142172546864e+00, 1.9127603115285055e+00,
+    1.9135891787154600e+00, 1.9144014039968000e+00, 1.9151975521186619e+00,
+    1.9159781685923385e+00, 1.9167437808322232e+00, 1.9174948992360807e+00,
+    1.9182320182117738e+00, 1.9189556171543489e+00, 1.9196661613770762e+00,
+    1.9203641029997947e+00, 1.9210498817975095e+00, 1.9217239260122720e+00,
+    1.9223866531306770e+00, 1.9230384706296770e+00, 1.9236797766927258e+00,
+    1.9243109608984363e+00, 1.9249324048835292e+00, 1.9255444829818820e+00,
+    1.9261475628412554e+00, 1.9267420060190754e+00, 1.9273281685587185e+00,
+    1.9279064015472598e+00, 1.9284770516560605e+00, 1.9290404616648271e+00,
+    1.9295969709701728e+00, 1.9301469160793165e+00, 1.9306906310895533e+00,
+    1.9312284481539341e+00, 1.9317606979335935e+00, 1.9322877100369247e+00,
+    1.9328098134458771e+00, 1.9333273369292239e+00, 1.9338406094429161e+00,
+    1.9343499605172054e+00, 1.9348557206302357e+00, 1.9353582215677689e+00,
+    1.9358577967682564e+00, 1.9363547816528288e+00, 1.9368495139390909e+00,
+    1.9373423339380198e+00, 1.9378335848325945e+00, 1.9383236129371184e+00,
+    1.9388127679355953e+00, 1.9393014030978040e+00, 1.9397898754712022e+00,
+    1.9402785460467942e+00, 1.9407677798969678e+00, 1.9412579462830468e+00,
+    1.9417494187302005e+00, 1.9422425750671264e+00, 1.9427377974279167e+00,
+    1.9432354722131990e+00, 1.9437359900075095e+00, 1.9442397454499396e+00,
+    1.9447471370545726e+00, 1.9452585669776856e+00, 1.9457744407278088e+00,
+    1.9462951668156820e+00, 1.9468211563400362e+00, 1.9473528225060301e+00,
+    1.9478905800725774e+00, 1.9484348447251760e+00, 1.9489860323708796e+00,
+    1.9495445583521906e+00, 1.9501108365769453e+00, 1.9506852785613997e+00,
+    1.9512682923843010e+00, 1.9518602815498665e+00, 1.9524616437583626e+00,
+    1.9530727695833690e+00, 1.9536940410556087e+00, 1.9543258301537931e+00,
+    1.9549684972040999e+00, 1.9556223891904647e+00, 1.9562878379792310e+00,
+    1.9569651584625651e+00, 1.9576546466265099e+00, 1.9583565775505243e+00,
+    1.9590712033469961e+00, 1.9597987510505361e+00, 1.9605394204681799e+00,
+    1.9612933820033254e+00, 1.9620607744676082e+00, 9.9999999999999989e-01,
+    1.0254507353631757e+00, 1.0988813631611145e+00, 1.1745596289382136e+00,
+    1.2432427030098170e+00, 1.3035377488229287e+00, 1.3560484369501826e+00,
+    1.4018192404876106e+00, 1.4418850184514405e+00, 1.4771499497119982e+00,
+    1.5083703610425407e+00, 1.5361690534889167e+00, 1.5610568367199109e+00,
+    1.5834532832055583e+00, 1.6037044456007841e+00, 1.6220972793612074e+00,
+    1.6388711497116923e+00, 1.6542269429150211e+00, 1.6683342714787275e+00,
+    1.6813371841674996e+00, 1.6933587091684008e+00, 1.7045044869544077e+00,
+    1.7148656912904139e+00, 1.7245213913661306e+00, 1.7335404730410258e+00,
+    1.7419832104308679e+00, 1.7499025586533721e+00, 1.7573452229627915e+00,
+    1.7643525475668793e+00, 1.7709612582437935e+00, 1.7772040857906659e+00,
+    1.7831102918367154e+00, 1.7887061142646394e+00, 1.7940151461209326e+00,
+    1.7990586592451647e+00, 1.8038558817483530e+00, 1.8084242367985113e+00,
+    1.8127795488336245e+00, 1.8169362222465519e+00, 1.8209073967174769e+00,
+    1.8247050826644957e+00, 1.8283402797082775e+00, 1.8318230805765092e+00,
+    1.8351627624873441e+00, 1.8383678677322950e+00, 1.8414462749148921e+00,
+    1.8444052620820282e+00, 1.8472515628017880e+00, 1.8499914160882847e+00,
+    1.8526306109454542e+00, 1.8551745261931418e+00, 1.8576281661473708e+00,
+    1.8599961926488890e+00, 1.8622829538681127e+00, 1.8644925102582983e+00,
+    1.8666286579806304e+00, 1.8686949500837342e+00, 1.8706947156846399e+00,
+    1.8726310773677242e+00, 1.8745069669918586e+00, 1.8763251400730905e+00,
+    1.8780881888905343e+00, 1.8797985544458498e+00, 1.8814585373917900e+00,
+    1.8830703080322215e+00, 1.8846359154845065e+00, 1.8861572960853257e+00,
+    1.8876362811119338e+00, 1.8890746038834116e+00, 1.8904739062994373e+00,
+    1.8918357448682266e+00, 1.8931615962698725e+00, 1.8944528624967276e+00,
+    1.8957108756081336e+00, 1.8969369021332905e+00, 1.8981321471525880e+00,
+    1.8992977580848422e+00, 1.9004348282053170e+00, 1.9015443999169508e+00,
+    1.9026274677952029e+00, 1.9036849814250278e+00, 1.9047178480467715e+00,
+    1.9057269350262824e+00, 1.9067130721632470e+00, 1.9076770538503289e+00,
+    1.9086196410948728e+00, 1.9095415634136461e+00, 1.9104435206104049e+00,
+    1.9113261844451463e+00, 1.9121902002031692e+00, 1.9130361881714402e+00,
+    1.9138647450291761e+00, 1.9146764451588569e+00, 1.9154718418835637e+00,
+    1.9162514686359251e+00, 1.9170158400637280e+00, 1.9177654530765347e+00,
+    1.9185007878377098e+00, 1.9192223087056381e+00, 1.9199304651277240e+00,
+    1.9206256924905081e+00, 1.9213084129289841e+00, 1.9219790360979334e+00,
+    1.9226379599079475e+00, 1.9232855712285362e+00, 1.9239222465606458e+00,
+    1.9245483526805989e+00, 1.9251642472575501e+00, 1.9257702794460461e+00,
+    1.9263667904555712e+00, 1.9269541140984916e+00, 1.9275325773178535e+00,
+    1.9281025006963910e+00, 1.9286641989479214e+00, 1.9292179813922117e+00,
+    1.9297641524144451e+00, 1.9303030119100797e+00, 1.9308348557160366e+00,
+    1.9313599760289752e+00, 1.9318786618112889e+00, 1.9323911991854366e+00,
+    1.9328978718171790e+00, 1.9333989612880975e+00, 1.9338947474578181e+00,
+    1.9343855088162369e+00, 1.9348715228258895e+00, 1.9353530662547467e+00,
+    1.9358304154993888e+00, 1.9363038468985716e+00, 1.9367736370371516e+00,
+    1.9372400630401359e+00, 1.9377034028566289e+00, 1.9381639355333320e+00,
+    1.9386219414772274e+00, 1.9390777027068211e+00, 1.9395315030914406e+00,
+    1.9399836285778782e+00, 1.9404343674035118e+00, 1.9408840102950777e+00,
+    1.9413328506521033e+00, 1.9417811847138373e+00, 1.9422293117085629e+00,
+    1.9426775339838542e+00, 1.9431261571165412e+00, 1.9435754900006261e+00,
+    1.9440258449117271e+00, 1.9444775375461523e+00, 1.9449308870328119e+00,
+    1.9453862159160311e+00, 1.9458438501071840e+00, 1.9463041188029471e+00,
+    1.9467673543680364e+00, 1.9472338921800709e+00, 1.9477040704341488e+00,
+    1.9481782299047905e+00, 1.9486567136625828e+00, 1.9491398667433584e+00,
+    1.9496280357670781e+00, 1.9501215685041566e+00, 1.9506208133867440e+00,
+    1.9511261189626035e+00, 1.9516378332894486e+00, 1.9521563032675366e+00,
+    1.9526818739087548e+00, 1.9532148875404585e+00, 1.9537556829427316e+00,
+    1.9543045944180575e+00, 1.9548619507925886e+00, 1.9554280743490831e+00,
+    1.9560032796914308e+00, 1.9565878725418469e+00, 1.9571821484720884e+00,
+    1.9577863915707683e+00, 1.9584008730496720e+00, 1.9590258497926141e+00,
+    1.9596615628513789e+00, 1.9603082358940631e+00, 1.9609660736120216e+00,
+    1.9616352600928071e+00, 1.9623159571671218e+00, 1.9630083027391594e+00,
+    1.9637124091104319e+00, 1.0000000000000000e+00, 1.0254510462060111e+00,
+    1.0988829730911540e+00, 1.1745631806249683e+00, 1.2432486401207850e+00,
+    1.3035463892076566e+00, 1.3560600149789703e+00, 1.4018339330317622e+00,
+    1.4419029615006842e+00, 1.4771712493753761e+00, 1.5083951010508310e+00,
+    1.5361973004460210e+00, 1.5610886438638862e+00, 1.5834886931576038e+00,
+    1.6037434924113021e+00, 1.6221399900576476e+00, 1.6389175454867881e+00,
+    1.6542770400511593e+00, 1.6683880820758030e+00, 1.6813947167223804e+00,
+    1.6934199690409555e+00, 1.7045694767458108e+00, 1.7149344111528544e+00,
+    1.7245938392584168e+00, 1.7336166449410215e+00, 1.7420631005132743e+00,
+    1.7499861594393900e+00, 1.7574325254468028e+00, 1.7644435413242050e+00,
+    1.7710559315227514e+00, 1.7773024255914680e+00, 1.7832122839792985e+00,
+    1.7888117434470590e+00, 1.7941243959696904e+00, 1.7991715123585517e+00,
+    1.8039723197336994e+00, 1.8085442403040510e+00, 1.8129030975756162e+00,
+    1.8170632950320478e+00, 1.8210379714632241e+00, 1.8248391364121899e+00,
+    1.8284777886364822e+00, 1.8319640200093985e+00, 1.8353071069004181e+00,
+    1.8385155907551867e+00, 1.8415973493313138e+00, 1.8445596598269161e+00,
+    1.8474092549556518e+00, 1.8501523728687528e+00, 1.8527948016959868e+00,
+    1.8553419193688356e+00, 1.8577987292978337e+00, 1.8601698923980523e+00,
+    1.8624597558908982e+00, 1.8646723792540278e+00, 1.8668115576430266e+00,
+    1.8688808430674078e+00, 1.8708835635678422e+00, 1.8728228406112624e+00,
+    1.8747016048939298e+00, 1.8765226107198685e+00, 1.8782884491023062e+00,
+    1.8800015597184374e+00, 1.8816642418330798e+00, 1.8832786642934929e+00,
+    1.8848468746863474e+00, 1.8863708077378099e+00, 1.8878522930288226e+00,
+    1.8892930620900321e+00, 1.8906947549339450e+00, 1.8920589260758995e+00,
+    1.8933870500901386e+00, 1.8946805267424764e+00, 1.8959406857370351e+00,
+    1.8971687911106532e+00, 1.8983660453053899e+00, 1.8995335929464809e+00,
+    1.9006725243506726e+00, 1.9017838787872676e+00, 1.9028686475123466e+00,
+    1.9039277765946028e+00, 1.9049621695495920e+00, 1.9059726897977016e+00,
+    1.9069601629597412e+00, 1.9079253790028341e+00, 1.9088690942482556e+00,
+    1.9097920332517087e+00, 1.9106948905658425e+00, 1.9115783323937661e+00,
+    1.9124429981417717e+00, 1.9132895018786651e+00, 1.9141184337086157e+00,
+    1.9149303610637480e+00, 1.9157258299223345e+00, 1.9165053659578817e+00,
+    1.9172694756240398e+00, 1.9180186471798941e+00, 1.9187533516597606e+00,
+    1.9194740437914268e+00, 1.9201811628664274e+00, 1.9208751335655367e+00,
+    1.9215563667426943e+00, 1.9222252601701564e+00, 1.9228821992474650e+00,
+    1.9235275576767223e+00, 1.9241616981064416e+00, 1.9247849727460575e+00,
+    1.9253977239530882e+00, 1.9260002847947177e+00, 1.9265929795855787e+00,
+    1.9271761244032033e+00, 1.9277500275826864e+00, 1.9283149901918777e+00,
+    1.9288713064883940e+00, 1.9294192643595975e+00, 1.9299591457466672e+00,
+    1.9304912270537251e+00, 1.9310157795429781e+00, 1.9315330697167636e+00,
+    1.9320433596872331e+00, 1.9325469075344621e+00, 1.9330439676536408e+00,
+    1.9335347910918914e+00, 1.9340196258754092e+00, 1.9344987173272430e+00,
+    1.9349723083763204e+00, 1.9354406398579511e+00, 1.9359039508063425e+00,
+    1.9363624787391718e+00, 1.9368164599346394e+00, 1.9372661297010909e+00,
+    1.9377117226393543e+00, 1.9381534728978809e+00, 1.9385916144206767e+00,
+    1.9390263811880362e+00, 1.9394580074499739e+00, 1.9398867279521661e+00,
+    1.9403127781543441e+00, 1.9407363944406550e+00, 1.9411578143218984e+00,
+    1.9415772766291286e+00, 1.9419950216982163e+00, 1.9424112915448570e+00,
+    1.9428263300294730e+00, 1.9432403830113107e+00, 1.9436536984911192e+00,
+    1.9440665267415225e+00, 1.9444791204243415e+00, 1.9448917346937817e+00,
+    1.9453046272846968e+00, 1.9457180585846494e+00, 1.9461322916887569e+00,
+    1.9465475924360500e+00, 1.9469642294259970e+00, 1.9473824740139709e+00,
+    1.9478026002840261e+00, 1.9482248849976627e+00, 1.9486496075169186e+00,
+    1.9490770497001302e+00, 1.9495074957689160e+00, 1.9499412321442411e+00,
+    1.9503785472504376e+00, 1.9508197312847069e+00, 1.9512650759509689e+00,
+    1.9517148741558537e+00, 1.9521694196653128e+00, 1.9526290067200138e+00,
+    1.9530939296079710e+00, 1.9535644821927391e+00, 1.9540409573957986e+00,
+    1.9545236466316880e+00, 1.9550128391947956e+00, 1.9555088215968102e+00,
+    1.9560118768539563e+00, 1.9565222837236431e+00, 1.9570403158903082e+00,
+    1.9575662411003207e+00, 1.9581003202468199e+00, 1.9586428064049908e+00,
+    1.9591939438193577e+00, 1.9597539668447372e+00, 1.9603230988433433e+00,
+    1.9609015510407093e+00, 1.9614895213441761e+00, 1.9620871931277111e+00,
+    1.9626947339881387e+00, 1.9633122944777828e+00, 1.9639400068199901e+00,
+    1.9645779836139736e+00, 1.9652263165364783e+00, 1.0000000000000000e+00,
+    1.0254513205064040e+00, 1.0988843937874488e+00, 1.1745663149178618e+00,
+    1.2432538796560579e+00, 1.3035540146556515e+00, 1.3560702333951975e+00,
+    1.4018469007823355e+00, 1.4419187989257136e+00, 1.4771900504961770e+00,
+    1.5084169401899701e+00, 1.5362222368609852e+00, 1.5611167250655869e+00,
+    1.5835199573358396e+00, 1.6037779702399124e+00, 1.6221777060600207e+00,
+    1.6389585190840459e+00, 1.6543212863774965e+00, 1.6684356126204141e+00,
+    1.6814455398404524e+00, 1.6934740903645793e+00, 1.7046268995174871e+00,
+    1.7149951364985252e+00, 1.7246578664127357e+00, 1.7336839714346228e+00,
+    1.7421337223294591e+00, 1.7500600711460765e+00, 1.7575097203082564e+00,
+    1.7645240113961373e+00, 1.7711396677336346e+00, 1.7773894178123497e+00,
+    1.7833025210839164e+00, 1.7889052133637853e+00, 1.7942210857264429e+00,
+    1.7992714081216983e+00, 1.8040754068417333e+00, 1.8086505032967068e+00,
+    1.8130125202189185e+00, 1.8171758603397969e+00, 1.8211536617152195e+00,
+    1.8249579331695267e+00, 1.8285996727541312e+00, 1.8320889716462578e+00,
+    1.8354351055270171e+00, 1.8386466151591110e+00, 1.8417313776205013e+00,
+    1.8446966694308189e+00, 1.8475492226243533e+00, 1.8502952746700390e+00,
+    1.8529406130103616e+00, 1.8554906148825197e+00, 1.8579502829936441e+00,
+    1.8603242775441871e+00, 1.8626169450275416e+00, 1.8648323441777155e+00,
+    1.8669742693887195e+00, 1.8690462718881431e+00, 1.8710516789119254e+00,
+    1.8729936110968450e+00, 1.8748749982809123e+00, 1.8766985938789624e+00,
+    1.8784669879811291e+00, 1.8801826193045528e+00, 1.8818477861137688e+00,
+    1.8834646562121340e+00, 1.8850352760952529e+00, 1.8865615793473105e+00,
+    1.8880453943524391e+00, 1.8894884513855417e+00, 1.8908923891401448e+00,
+    1.8922587607448444e+00, 1.8935890393146280e+00, 1.8948846230786041e+00,
+    1.8961468401214969e+00, 1.8973769527726323e+00, 1.8985761616726851e+00,
+    1.8997456095456917e+00, 1.9008863847010760e+00, 1.9019995242881886e+00,
+    1.9030860173236075e+00, 1.9041468075098482e+00, 1.9051827958620919e+00,
+    1.9061948431583196e+00, 1.9071837722267138e+00, 1.9081503700830258e+00,
+    1.9090953899294574e+00, 1.9100195530256852e+00, 1.9109235504416364e+00,
+    1.9118080447009176e+00, 1.9126736713229726e+00, 1.9135210402715175e+00,
+    1.9143507373158908e+00, 1.9151633253118359e+00, 1.9159593454073240e+00,
+    1.9167393181788235e+00, 1.9175037447028818e+00, 1.9182531075675726e+00,
+    1.9189878718279776e+00, 1.9197084859095341e+00, 1.9204153824628665e+00,
+    1.9211089791733533e+00, 1.9217896795285365e+00, 1.9224578735461311e+00,
+    1.9231139384653964e+00, 1.9237582394041297e+00, 1.9243911299837202e+00,
+    1.9250129529242392e+00, 1.9256240406116298e+00, 1.9262247156386954e+00,
+    1.9268152913217294e+00, 1.9273960721942232e+00, 1.9279673544792297e+00,
+    1.9285294265416975e+00, 1.9290825693220561e+00, 1.9296270567522846e+00,
+    1.9301631561554944e+00, 1.9306911286302104e+00, 1.9312112294200849e+00,
+    1.9317237082701926e+00, 1.9322288097705689e+00, 1.9327267736878591e+00,
+    1.9332178352857488e+00, 1.9337022256348939e+00, 1.9341801719129421e+00,
+    1.9346518976952520e+00, 1.9351176232367793e+00, 1.9355775657457173e+00,
+    1.9360319396491912e+00, 1.9364809568516110e+00, 1.9369248269858537e+00,
+    1.9373637576577023e+00, 1.9377979546838122e+00, 1.9382276223235220e+00,
+    1.9386529635045568e+00, 1.9390741800430162e+00, 1.9394914728576373e+00,
+    1.9399050421784809e+00, 1.9403150877501818e+00, 1.9407218090296929e+00,
+    1.9411254053785620e+00, 1.9415260762497639e+00, 1.9419240213689153e+00,
+    1.9423194409097995e+00, 1.9427125356640595e+00, 1.9431035072048028e+00,
+    1.9434925580439733e+00, 1.9438798917830760e+00, 1.9442657132570982e+00,
+    1.9446502286710730e+00, 1.9450336457289723e+00, 1.9454161737544862e+00,
+    1.9457980238030763e+00, 1.9461794087648019e+00, 1.9465605434573614e+00,
+    1.9469416447085299e+00, 1.9473229314274216e+00, 1.9477046246637586e+00,
+    1.9480869476542975e+00, 1.9484701258555872e+00, 1.9488543869621484e+00,
+    1.9492399609090258e+00, 1.9496270798578028e+00, 1.9500159781648876e+00,
+    1.9504068923311453e+00, 1.9508000609314342e+00, 1.9511957245232781e+00,
+    1.9515941255329687e+00, 1.9519955081183178e+00, 1.9524001180063946e+00,
+    1.9528082023053508e+00, 1.9532200092886822e+00, 1.9536357881509336e+00,
+    1.9540557887335082e+00, 1.9544802612191940e+00, 1.9549094557945936e+00,
+    1.9553436222788476e+00, 1.9557830097180102e+00, 1.9562278659439047e+00,
+    1.9566784370966730e+00, 1.9571349671101930e+00, 1.9575976971600388e+00,
+    1.9580668650731914e+00, 1.9585427046998021e+00, 1.9590254452465417e+00,
+    1.9595153105721013e+00, 1.9600125184454085e+00, 1.9605172797671555e+00,
+    1.9610297977560587e+00, 1.9615502671012575e+00, 1.9620788730827736e+00,
+    1.9626157906621939e+00, 1.9631611835465888e+00, 1.9637152032284224e+00,
+    1.9642779880053529e+00, 1.9648496619837750e+00, 1.9654303340707731e+00,
+    1.9660200969593917e+00, 1.9666190261126908e+00
+};
+
+
+
+const realtype rock2Finishing[53][2] =
+{
+    4.0884830922379511e-01, 3.5093114137307713e-01,
+    3.8785763882384167e-01, 3.1396227995031717e-01,
+    3.7941431094239975e-01, 2.9875423119112160e-01,
+    3.7511907565874492e-01, 2.9093654257966772e-01,
+    3.7262146536741025e-01, 2.8636432268107237e-01,
+    3.7103610147895050e-01, 2.8345175748396856e-01,
+    3.6996500555019485e-01, 2.8147935877904756e-01,
+    3.6920662145648586e-01, 2.8008052900303071e-01,
+    3.6864962184211891e-01, 2.7905193449518884e-01,
+    3.6822830304960602e-01, 2.7827320936512134e-01,
+    3.6790179891198926e-01, 2.7766932081597689e-01,
+    3.6764358357140975e-01, 2.7719148211134753e-01,
+    3.6743581821861754e-01, 2.7680683976246206e-01,
+    3.6726614155982606e-01, 2.7649260373944606e-01,
+    3.6712576538845765e-01, 2.7623255749218184e-01,
+    3.6700830131276363e-01, 2.7601490433870168e-01,
+    3.6690901415265320e-01, 2.7583089518890780e-01,
+    3.6682433325355290e-01, 2.7567392932331647e-01,
+    3.6668846581190262e-01, 2.7542203216032918e-01,
+    3.6658526846317829e-01, 2.7523066296402876e-01,
+    3.6650504080912044e-01, 2.7508186361808662e-01,
+    3.6644143496348369e-01, 2.7496387731580008e-01,
+    3.6639015473312675e-01, 2.7486874444827186e-01,
+    3.6634820801240253e-01, 2.7479092000359173e-01,
+    3.6631345886014777e-01, 2.7472644475770591e-01,
+    3.6628434938122900e-01, 2.7467243044442929e-01,
+    3.6625972161308440e-01, 2.7462672993287573e-01,
+    3.6623870032310402e-01, 2.7458772013477017e-01,
+    3.6620494054885305e-01, 2.7452506799891296e-01,
+    3.6617927221722668e-01, 2.7447742952185511e-01,
+    3.6615930144581521e-01, 2.7444036371888703e-01,
+    3.6614345850399854e-01, 2.7441095820335559e-01,
+    3.6613067932467724e-01, 2.7438723859891395e-01,
+    3.6612022189661919e-01, 2.7436782801017839e-01,
+    3.6611155598673212e-01, 2.7435174246879912e-01,
+    3.6610429453343829e-01, 2.7433826366138270e-01,
+    3.6609814963842924e-01, 2.7432685728285522e-01,
+    3.6609290356952806e-01, 2.7431711923544344e-01,
+    3.6608447650264492e-01, 2.7430147624298928e-01,
+    3.6607806757273731e-01, 2.7428957931355236e-01,
+    3.6607308024437252e-01, 2.7428032121260726e-01,
+    3.6606912315488160e-01, 2.7427297550878282e-01,
+    3.6606593090840478e-01, 2.7426704957423298e-01,
+    3.6606331837536199e-01, 2.7426219976616817e-01,
+    3.6606115323117761e-01, 2.7425818045619738e-01,
+    3.6605933886086633e-01, 2.7425481230003712e-01,
+    3.6605780338886462e-01, 2.7425196187556478e-01,
+    3.6605649244905769e-01, 2.7424952826253646e-01,
+    3.6605536430512892e-01, 2.7424743398483331e-01,
+    3.6605438648617894e-01, 2.7424561876567582e-01,
+    3.6605353342354352e-01, 2.7424403514100748e-01,
+    3.6605278476273850e-01, 2.7424264532568976e-01,
+    3.6605212413628707e-01, 2.7424141893628118e-01
+};
+
+
+
+// ROCK4, degrees 5 to 152.
+
+const int rock4NumberOfDegrees = 45;
+
+
+
+const int rock4Stages[45] =
+{
+    5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 22, 24, 26, 28,
+    30, 32, 34, 36, 38, 40, 44, 48, 52, 56,
+    60, 64, 68, 72, 76, 80, 88, 96, 104, 112,
+    120, 128, 136, 144, 152
+};
+
+
+
+const realtype rock4StabilityBound[45] =
+{
+    5.9934090483727518e+00, 9.8528443323646329e+00, 1.4409976036258985e+01,
+    1.9671264273648227e+01, 2.5637156317512371e+01, 3.2307296822053956e+01,
+    3.9681240825210132e+01, 4.7758274911885735e+01, 5.6539181204261297e+01,
+    6.6022129394276192e+01, 7.6208334697068580e+01, 8.7098264254517716e+01,
+    9.8690755781845169e+01, 1.1098443540175529e+02, 1.2398197041192780e+02,
+    1.3768399844355349e+02, 1.6719075964140538e+02, 1.9951131308468786e+02,
+    2.3464619173508848e+02, 2.7259650811264515e+02, 3.1333417555063841e+02,
+    3.5690075450671782e+02, 4.0327942192643559e+02, 4.5247479175012319e+02,
+    5.0446446443037269e+02, 5.5930682777882521e+02, 6.7730975315562341e+02,
+    8.0666230469355219e+02, 9.4716490967224354e+02, 1.0989985148803837e+03,
+    1.2619923013199348e+03, 1.4361789039162891e+03, 1.6216060088096344e+03,
+    1.8185075920643685e+03, 2.0266019710255578e+03, 2.2457316792708552e+03,
+    2.7178269775676940e+03, 3.2350930191942525e+03, 3.7982164346749423e+03,
+    4.4054780059750146e+03, 5.0564176924574485e+03, 5.7533106690359027e+03,
+    6.5029953808968967e+03, 7.2824813926828965e+03, 8.1214156800252085e+03
+};
+
+
+
+const int rock4Offset[45] =
+{
+    0, 1, 3, 6, 10, 15, 21, 28, 36, 45,
+    55, 66, 78, 91, 105, 120, 136, 154, 174, 196,
+    220, 246, 274, 304, 336, 370, 406, 446, 490, 538,
+    590, 646, 706, 770, 838, 910, 986, 1070, 1162, 1262,
+    1370, 1486, 1610, 1742, 1882
+};
+
+
+
+const realtype rock4Mu[2030] =
+{
+    1.7629571522668985e-01, 1.0695640740936632e-01, 1.2946003711269152e-01,
+    7.3194510678333505e-02, 8.7771780586278866e-02, 1.0233826282969172e-01,
+    5.3656247656614170e-02, 6.4454458795535713e-02, 7.3862255829588122e-02,
+    8.4060603349472754e-02, 4.1192867874752397e-02, 4.9571891232073652e-02,
+    5.6795089765097818e-02, 6.3224256234156742e-02, 7.0736555355552289e-02,
+    3.2702172951502045e-02, 3.9411945051814411e-02, 4.5194317680017214e-02,
+    5.0220876017368965e-02, 5.4821780211437396e-02, 6.0552164897031011e-02,
+    2.6634057985280259e-02, 3.2136820580707076e-02, 3.6883473254436631e-02,
+    4.0996550262014514e-02, 4.4614172160763584e-02, 4.8033620747341098e-02,
+    5.2516737834900323e-02, 2.2135505779820402e-02, 2.6734492733305474e-02,
+    3.0706077862665895e-02, 3.4146908236337946e-02, 3.7151880300644743e-02,
+    3.9832651869986094e-02, 4.2454559387050325e-02, 4.6030081827851968e-02,
+    1.8701719756379465e-02, 2.2605021227326036e-02, 2.5979634835166278e-02,
+    2.8904536464372212e-02, 3.1455388289946651e-02, 3.3703292371168737e-02,
+    3.5741363587131730e-02, 3.7804085270668794e-02, 4.0699225440848384e-02,
+    1.6018331647799880e-02, 1.9374111284842843e-02, 2.2278423666011089e-02,
+    2.4797202125955247e-02, 2.6993550110092305e-02, 2.8923348875591143e-02,
+    3.0640755637525080e-02, 3.2225689704839681e-02, 3.3883449354348331e-02,
+    3.6257392433611431e-02, 1.3879274403309685e-02, 1.6795976409703227e-02,
+    1.9322706567468487e-02, 2.1515421930852732e-02, 2.3427846761972061e-02,
+    2.5106914714099492e-02, 2.6593702669581821e-02, 2.7930849845866173e-02,
+    2.9188275564498347e-02, 3.0544256731778317e-02, 3.2511389378668994e-02,
+    1.2145397054779669e-02, 1.4704377309597307e-02, 1.6923127251810565e-02,
+    1.8849786869201260e-02, 2.0530728937931217e-02, 2.2006379029504173e-02,
+    2.3311072979909052e-02, 2.4475524474879294e-02, 2.5534521460510377e-02,
+    2.6549875601548405e-02, 2.7675391442938773e-02, 2.9320238819696556e-02,
+    1.0719843339648500e-02, 1.2983434013299055e-02, 1.4947579423942868e-02,
+    1.6654174815587612e-02, 1.8143689519952926e-02, 1.9451423471435230e-02,
+    2.0607112235579240e-02, 2.1636010177981863e-02, 2.2561711054582476e-02,
+    2.3413499164252727e-02, 2.4246273609261126e-02, 2.5192108362749932e-02,
+    2.6578614989150880e-02, 9.5332258664328900e-03, 1.1550019756747557e-02,
+    1.3301215395124343e-02, 1.4823636239941256e-02, 1.6152931016902673e-02,
+    1.7320227748028744e-02, 1.8351698081057206e-02, 1.9269192894254369e-02,
+    2.0091587500477320e-02, 2.0837571241703583e-02, 2.1532404047239450e-02,
+    2.2224910758992550e-02, 2.3028159272529311e-02, 2.4205470237078103e-02,
+    8.5344412883193808e-03, 1.0342836299367806e-02, 1.1914034226278103e-02,
+    1.3280678498904023e-02, 1.4474426432798679e-02, 1.5522947907743744e-02,
+    1.6449505462054006e-02, 1.7273415652993999e-02, 1.8010883785298339e-02,
+    1.8676327538951671e-02, 1.9285004670711009e-02, 1.9859082136954722e-02,
+    2.0441952041330452e-02, 2.1130202824956749e-02, 2.2136313800683531e-02,
+    7.6855938789234766e-03, 9.3163805426050746e-03, 1.0734033852509216e-02,
+    1.1967708269462847e-02, 1.3045717041281189e-02, 1.3992826944023705e-02,
+    1.4829867983736245e-02, 1.5574109921562471e-02, 1.6239887154023899e-02,
+    1.6839396491319165e-02, 1.7383925032549527e-02, 1.7886270609673009e-02,
+    1.8366108802309704e-02, 1.8861946595901534e-02, 1.9456196564318112e-02,
+    2.0321027259400749e-02, 6.3298421097753108e-03, 7.6759867651752375e-03,
+    8.8472682207857735e-03, 9.8673880136059631e-03, 1.0759411218702568e-02,
+    1.1543536331265015e-02, 1.2236765268840181e-02, 1.2853192074857279e-02,
+    1.3404455919884451e-02, 1.3900215498019128e-02, 1.4348643256760225e-02,
+    1.4757047139113889e-02, 1.5132888084993799e-02, 1.5485761611792036e-02,
+    1.5831468367099803e-02, 1.6200215232899409e-02, 1.6652020846606653e-02,
+    1.7301501369790535e-02, 5.3048321936741884e-03, 6.4349565350978345e-03,
+    7.4189980120028661e-03, 8.2766308721212937e-03, 9.0270283203826122e-03,
+    9.6869922422674268e-03, 1.0270673151487886e-02, 1.0789806517308452e-02,
+    1.1254080716895079e-02, 1.1671504752003285e-02, 1.2048742781474763e-02,
+    1.2391429207121491e-02, 1.2704515818101073e-02, 1.2992758132035180e-02,
+    1.3261549065231318e-02, 1.3518490651355929e-02, 1.3776399506643737e-02,
+    1.4058863346676824e-02, 1.4409723956130337e-02, 1.4906641872128795e-02,
+    4.5107875878810213e-03, 5.4730682068008562e-03, 6.3114578426937216e-03,
+    7.0425655484651914e-03, 7.6825941382884294e-03, 8.2457488243582698e-03,
+    8.7439970145577074e-03, 9.1872668252740309e-03, 9.5837565648731887e-03,
+    9.9402408879262182e-03, 1.0262339976875440e-02, 1.0554750031424065e-02,
+    1.0821448772629361e-02, 1.1065903050594893e-02, 1.1291326167291761e-02,
+    1.1501069501228115e-02, 1.1699298590758524e-02, 1.1892212954703283e-02,
+    1.2090230419128746e-02, 1.2311732134800487e-02, 1.2588927156869144e-02,
+    1.2975350645312293e-02, 3.8829959161751043e-03, 4.7122591681098454e-03,
+    5.4351067214824236e-03, 6.0657568272939081e-03, 6.6180908147660976e-03,
+    7.1042823609321530e-03, 7.5345892973991769e-03, 7.9175230550487270e-03,
+    8.2601135746808024e-03, 8.5681708256895635e-03, 8.8465127862207248e-03,
+    9.0991556612227235e-03, 9.3294720790877486e-03, 9.5403278096902865e-03,
+    9.7342122392471871e-03, 9.9133857324207510e-03, 1.0080081475908186e-02,
+    1.0236824795615001e-02, 1.0386974871937793e-02, 1.0535657346594269e-02,
+    1.0691337680546769e-02, 1.0868342490794049e-02, 1.1090507231501758e-02,
+    1.1395348490629453e-02, 3.3782885844095474e-03, 4.1004075163807606e-03,
+    4.7301115527655022e-03, 5.2797170907057907e-03, 5.7612559949999772e-03,
+    6.1852823533014136e-03, 6.5606903114486092e-03, 6.8948605179037902e-03,
+    7.1938897232155744e-03, 7.4628174046606132e-03, 7.7058228876232893e-03,
+    7.9263886362990997e-03, 8.1274333132684666e-03, 8.3114208860993431e-03,
+    8.4804532520938117e-03, 8.6363553827837648e-03, 8.7807650959079026e-03,
+    8.9152455260711715e-03, 9.0414488538795197e-03, 9.1613770558916785e-03,
+    9.2778117058822749e-03, 9.3950207640388500e-03, 9.5198879590760819e-03,
+    9.6636143144086598e-03, 9.8440020260005950e-03, 1.0087780929999157e-02,
+    2.9660008160686106e-03, 3.6004569104244872e-03, 4.1539014411708913e-03,
+    4.6371101420825392e-03, 5.0606149356789473e-03, 5.4336557706281541e-03,
+    5.7640199175234786e-03, 6.0581698364046881e-03, 6.3214441622941138e-03,
+    6.5582561492547710e-03, 6.7722661860376929e-03, 6.9665243996777050e-03,
+    7.1435861398413758e-03, 7.3056051175177097e-03, 7.4544093041330663e-03,
+    7.5915647219185010e-03, 7.7184326399488195e-03, 7.8362269046891621e-03,
+    7.9460806854861517e-03, 8.0491364732672085e-03, 8.1466806285388771e-03,
+    8.2403551763242360e-03, 8.3324955947373866e-03, 8.4266627141886888e-03,
+    8.5284513432056994e-03, 8.6466407234344223e-03, 8.7946310292323603e-03,
+    8.9917343913713792e-03, 2.6249709251393093e-03, 3.1868202341547350e-03,
+    3.6770664503995723e-03, 4.1052194636670555e-03, 4.4805776879210373e-03,
+    4.8112999866057734e-03, 5.1042628607970517e-03, 5.3651730893209638e-03,
+    5.5987451761747992e-03, 5.8088766263949144e-03, 5.9988003119678572e-03,
+    6.1712103379386951e-03, 6.3283637681417725e-03, 6.4721622238789337e-03,
+    6.6042174704446545e-03, 6.7259047722796140e-03, 6.8384075049115547e-03,
+    6.9427565015156628e-03, 7.0398680638830364e-03, 7.1305856868559081e-03,
+    7.2157326111749265e-03, 7.2961857126052979e-03, 7.3729864221400562e-03,
+    7.4475117728437113e-03, 7.5217381883021612e-03, 7.5986403276279832e-03,
+    7.6827700684344085e-03, 7.7810368840867785e-03, 7.9036149817048856e-03,
+    8.0646496795574833e-03, 2.3396242375869902e-03, 2.8406550814437451e-03,
+    3.2779378135705146e-03, 3.6599289473335885e-03, 3.9948996705695163e-03,
+    4.2901083163856624e-03, 4.5516726253433774e-03, 4.7846697414825421e-03,
+    4.9932940490883988e-03, 5.1810131412553043e-03, 5.3507034140810525e-03,
+    5.5047620582118692e-03, 5.6451975094455719e-03, 5.7737018665083694e-03,
+    5.8917088191274974e-03, 6.0004402280614093e-03, 6.1009440534996635e-03,
+    6.1941260025342214e-03, 6.2807771422708327e-03, 6.3615998691571559e-03,
+    6.4372351210575844e-03, 6.5082946867102004e-03, 6.5754040753746822e-03,
+    6.6392638713031376e-03, 6.7007410333564154e-03, 6.7610062965692396e-03,
+    6.8217392492691681e-03, 6.8854268446634226e-03, 6.9557783805017639e-03,
+    7.0382565728278543e-03, 7.1406517186043223e-03, 7.2734569609602812e-03,
+    2.0985453164768866e-03, 2.5481449537788268e-03, 2.9406202179822448e-03,
+    3.2835416705776885e-03, 3.5843160143751197e-03, 3.8494435635395099e-03,
+    4.0844033179481135e-03, 4.2937423469331937e-03, 4.4812171162382985e-03,
+    4.6499331941508397e-03, 4.8024667231090414e-03, 4.9409647450766973e-03,
+    5.0672262111691310e-03, 5.1827667958355339e-03, 5.2888706507152189e-03,
+    5.3866318412075474e-03, 5.4769877519225390e-03, 5.5607463561193129e-03,
+    5.6386089682384432e-03, 5.7111899610551853e-03, 5.7790349522243555e-03,
+    5.8426391829571158e-03, 5.9024682771304116e-03, 5.9589843587657971e-03,
+    6.0126817198107117e-03, 6.0641379804675733e-03, 6.1140890497223526e-03,
+    6.1635390941235432e-03, 6.2139196084048968e-03, 6.2673128307899626e-03,
+    6.3267498318293047e-03, 6.3965731792347234e-03, 6.4828004120868980e-03,
+    6.5933118061546423e-03, 1.8928056763269799e-03, 2.2984784070385071e-03,
+    2.6526701708809355e-03, 2.9621982809693707e-03, 3.2337340676182342e-03,
+    3.4731329287353554e-03, 3.6853303959090943e-03, 3.8744225134784566e-03,
+    4.0437931181577852e-03, 4.1962397008451268e-03, 4.3340828552744827e-03,
+    4.4592566766549881e-03, 4.5733817507842972e-03, 4.6778235358966753e-03,
+    4.7737389480276568e-03, 4.8621135968309635e-03, 4.9437916877901021e-03,
+    5.0195002212019991e-03, 5.0898688145589567e-03, 5.1554462620747987e-03,
+    5.2167148257248044e-03, 5.2741032318309412e-03, 5.3279994390083331e-03,
+    5.3787644706452409e-03, 5.4267490037026465e-03, 5.4723150237327902e-03,
+    5.5158657504578565e-03, 5.5578882591786330e-03, 5.5990147715526814e-03,
+    5.6401103120725122e-03, 5.6823957829320549e-03, 5.7276150854814797e-03,
+    5.7782495191709389e-03, 5.8377659451235558e-03, 5.9108462153957767e-03,
+    6.0034702238441519e-03, 1.5630772174406685e-03, 1.8982828241995927e-03,
+    2.1910333435596748e-03, 2.4469442127261205e-03, 2.6715126951799852e-03,
+    2.8695643376896590e-03, 3.0451667680673014e-03, 3.2016957459245336e-03,
+    3.3419400120253892e-03, 3.4682050273670386e-03, 3.5824032054353654e-03,
+    3.6861284472519285e-03, 3.7807163226644251e-03, 3.8672922015083083e-03,
+    3.9468096442995659e-03, 4.0200810578901623e-03, 4.0878022576303743e-03,
+    4.1505722447119468e-03, 4.2089092320141850e-03, 4.2632637360892700e-03,
+    4.3140293912483476e-03, 4.3615520273829183e-03, 4.4061374812028676e-03,
+    4.4480585787737403e-03, 4.4875617365759896e-03, 4.5248736832641957e-03,
+    4.5602089130591427e-03, 4.5937786562212039e-03, 4.6258024075313230e-03,
+    4.6565234065012069e-03, 4.6862299248134776e-03, 4.7152847802480564e-03,
+    4.7441661055148392e-03, 4.7735228851514900e-03, 4.8042487278042332e-03,
+    4.8375759043274699e-03, 4.8751872032409575e-03, 4.9193328117021068e-03,
+    4.9729192040940066e-03, 5.0395032306870006e-03, 1.3124563419099956e-03,
+    1.5940450314909556e-03, 1.8400234245265306e-03, 2.0550976842045850e-03,
+    2.2438762574723994e-03, 2.4104048867172297e-03, 2.5580939842014686e-03,
+    2.6897738794823545e-03, 2.8077826893768342e-03, 2.9140532955287748e-03,
+    3.0101890121313458e-03, 3.0975260966733544e-03, 3.1771842252503479e-03,
+    3.2501068614748945e-03, 3.3170934538576252e-03, 3.3788251412008529e-03,
+    3.4358853392988738e-03, 3.4887763009126141e-03, 3.5379325063503984e-03,
+    3.5837315550851729e-03, 3.6265030837986183e-03, 3.6665361258340842e-03,
+    3.7040852447788458e-03, 3.7393757157065705e-03, 3.7726079879484126e-03,
+    3.8039616410398139e-03, 3.8335990400037326e-03, 3.8616689079803185e-03,
+    3.8883100652905280e-03, 3.9136556374775189e-03, 3.9378381150186091e-03,
+    3.9609957593539713e-03, 3.9832809985904469e-03, 4.0048716442290973e-03,
+    4.0259859827231955e-03, 4.0469030304940085e-03, 4.0679894296306082e-03,
+    4.0897344738458708e-03, 4.1127943295788715e-03, 4.1380451737973037e-03,
+    4.1666418953333331e-03, 4.2000729938532766e-03, 4.2401919523433196e-03,
+    4.2891899669587914e-03, 1.1177841212431350e-03, 1.3576916105188120e-03,
+    1.5672959944258663e-03, 1.7505996125382788e-03, 1.9115225777857358e-03,
+    2.0535066223821403e-03, 2.1794530795982334e-03, 2.2917697934127096e-03,
+    2.3924458421495159e-03, 2.4831255289291076e-03, 2.5651727609888341e-03,
+    2.6397242394784731e-03, 2.7077324107064823e-03, 2.7699998185018323e-03,
+    2.8272065030596023e-03, 2.8799318746509785e-03, 2.9286722299553306e-03,
+    2.9738548390854224e-03, 3.0158493311022551e-03, 3.0549769457338199e-03,
+    3.0915180939339220e-03, 3.1257185734178622e-03, 3.1577947114733800e-03,
+    3.1879376513014516e-03, 3.2163169561177794e-03, 3.2430836744541391e-03,
+    3.2683729885825924e-03, 3.2923065544960255e-03, 3.3149946357672860e-03,
+    3.3365381347684724e-03, 3.3570306335459175e-03, 3.3765605739706980e-03,
+    3.3952137339064051e-03, 3.4130761947022657e-03, 3.4302380471401893e-03,
+    3.4467981495826402e-03, 3.4628703338333991e-03, 3.4785915484666944e-03,
+    3.4941325269157407e-03, 3.5097116464096276e-03, 3.5256126580149641e-03,
+    3.5422068298820242e-03, 3.5599795990189287e-03, 3.5795608126854041e-03,
+    3.6017556694134009e-03, 3.6275700410493897e-03, 3.6582185224039157e-03,
+    3.6950964009454441e-03, 9.6336735283881754e-04, 1.1701916551656311e-03,
+    1.3509165352432614e-03, 1.5089875427188972e-03, 1.6477800398865211e-03,
+    1.7702576794993113e-03, 1.8789188397125875e-03, 1.9758369543268939e-03,
+    2.0627248355893201e-03, 2.1409983836733109e-03, 2.2118320274252504e-03,
+    2.2762045324366022e-03, 2.3349359931734664e-03, 2.3887174201334309e-03,
+    2.4381343384592960e-03, 2.4836856278196693e-03, 2.5257986090061650e-03,
+    2.5648411762604737e-03, 2.6011316017606058e-03, 2.6349465006249985e-03,
+    2.6665273367377706e-03, 2.6960857660719485e-03, 2.7238080498165583e-03,
+    2.7498587201989621e-03, 2.7743836440351534e-03, 2.7975126001366212e-03,
+    2.8193614647986495e-03, 2.8400340832640336e-03, 2.8596238932799859e-03,
+    2.8782153589647893e-03, 2.8958852687632152e-03, 2.9127039501248377e-03,
+    2.9287364557157576e-03, 2.9440437816971605e-03, 2.9586841882664710e-03,
+    2.9727147068086290e-03, 2.9861929372990335e-03, 2.9991792647028172e-03,
+    3.0117396545011376e-03, 3.0239492250470216e-03, 3.0358968368084500e-03,
+    3.0476909816936921e-03, 3.0594672907037351e-03, 3.0713979876353806e-03,
+    3.0837035684253685e-03, 3.0966668247165122e-03, 3.1106489666480695e-03,
+    3.1261068987712996e-03, 3.1436094827785128e-03, 3.1638486831748651e-03,
+    3.1876387256910368e-03, 3.2158930183564189e-03, 8.3895131568417324e-04,
+    1.0191063296591284e-03, 1.1765449322758241e-03, 1.3142650014811546e-03,
+    1.4352037693295813e-03, 1.5419403386286359e-03, 1.6366489545840965e-03,
+    1.7211340563759105e-03, 1.7968862375595306e-03, 1.8651376854972620e-03,
+    1.9269104303175830e-03, 1.9830562130784017e-03, 2.0342886823705936e-03,
+    2.0812091465823236e-03, 2.1243271141906700e-03, 2.1640766922200920e-03,
+    2.2008297178290610e-03, 2.2349063183491370e-03, 2.2665834448882764e-03,
+    2.2961018044029679e-03, 2.3236715210258594e-03, 2.3494767845335007e-03,
+    2.3736796876366378e-03, 2.3964234105050700e-03, 2.4178348776105773e-03,
+    2.4380269862737188e-03, 2.4571004864753876e-03, 2.4751455762187912e-03,
+    2.4922432650157488e-03, 2.5084665491975446e-03, 2.5238814361906552e-03,
+    2.5385478502886099e-03, 2.5525204495562182e-03, 2.5658493821948086e-03,
+    2.5785810109390794e-03, 2.5907586358960653e-03, 2.6024232497933349e-03,
+    2.6136143650663623e-03, 2.6243709598230847e-03, 2.6347325997482826e-03,
+    2.6447408056995345e-03, 2.6544407522385675e-03, 2.6638834004885990e-03,
+    2.6731281887802565e-03, 2.6822464247097419e-03, 2.6913255386844612e-03,
+    2.7004743646236312e-03, 2.7098295956017736e-03, 2.7195634997458414e-03,
+    2.7298928410425102e-03, 2.7410886806810354e-03, 2.7534862682019718e-03,
+    2.7674934856811865e-03, 2.7835952102493234e-03, 2.8023495078872427e-03,
+    2.8243699483961439e-03, 7.3720547926336174e-04, 8.9554161590998276e-04,
+    1.0339252645811894e-03, 1.1549888174743554e-03, 1.2613117187052440e-03,
+    1.3551590096638809e-03, 1.4384402090352058e-03, 1.5127400626520689e-03,
+    1.5793676771413238e-03, 1.6394052052837273e-03, 1.6937502204484496e-03,
+    1.7431507323118012e-03, 1.7882334656295247e-03, 1.8295264793510835e-03,
+    1.8674772081708497e-03, 1.9024668662714814e-03, 1.9348219816623490e-03,
+    1.9648236717737565e-03, 1.9927151390476705e-03, 2.0187077596837493e-03,
+    2.0429860560198733e-03, 2.0657117789673121e-03, 2.0870272775130897e-03,
+    2.1070582942307689e-03, 2.1259162963722460e-03, 2.1437004294059662e-03,
+    2.1604991622631150e-03, 2.1763916798707120e-03, 2.1914490678988058e-03,
+    2.2057353263569197e-03, 2.2193082422428166e-03, 2.2322201465002638e-03,
+    2.2445185768108938e-03, 2.2562468650317367e-03, 2.2674446662639485e-03,
+    2.2781484455166438e-03, 2.2883919376767421e-03, 2.2982065970096502e-03,
+    2.3076220537325510e-03, 2.3166665973847157e-03, 2.3253677098599456e-03,
+    2.3337526751717533e-03, 2.3418492984087417e-03, 2.3496867729967921e-03,
+    2.3572967433491718e-03, 2.3647146191399242e-03, 2.3719812073965179e-03,
+    2.3791447384940443e-03, 2.3862633702299279e-03, 2.3934082573596914e-03,
+    2.4006672669917295e-03, 2.4081493944388371e-03, 2.4159898760659068e-03,
+    2.4243558854514773e-03, 2.4334525092489928e-03, 2.4435283950136081e-03,
+    2.4548800091701681e-03, 2.4678528177253189e-03, 2.4828369307803586e-03,
+    2.5002539631604746e-03, 6.5291217370590932e-04, 7.9316583838972155e-04,
+    9.1575501130165848e-04, 1.0230097034518110e-03, 1.1172132836453433e-03,
+    1.2003708824648099e-03, 1.2741729306613998e-03, 1.3400223555632201e-03,
+    1.3990780671639246e-03, 1.4522980541875014e-03, 1.5004768963618699e-03,
+    1.5442767635731429e-03, 1.5842524515074182e-03, 1.6208714070827385e-03,
+    1.6545297014405600e-03, 1.6855647823595572e-03, 1.7142656863100225e-03,
+    1.7408812507445400e-03, 1.7656267504431780e-03, 1.7886892882627884e-03,
+    1.8102321974407412e-03, 1.8303986558843349e-03, 1.8493146691236958e-03,
+    1.8670915448825943e-03, 1.8838279561941439e-03, 1.8996116698476505e-03,
+    1.9145210013146083e-03, 1.9286260451153647e-03, 1.9419897200571063e-03,
+    1.9546686612970090e-03, 1.9667139853062447e-03, 1.9781719491876134e-03,
+    1.9890845221720633e-03, 1.9994898842930005e-03, 2.0094228650664571e-03,
+    2.0189153333853831e-03, 2.0279965486916657e-03, 2.0366934827722428e-03,
+    2.0450311212071872e-03, 2.0530327535697489e-03, 2.0607202619467397e-03,
+    2.0681144182359292e-03, 2.0752352020169422e-03, 2.0821021526308942e-03,
+    2.0887347714889717e-03, 2.0951529936130810e-03, 2.1013777510247569e-03,
+    2.1074316548424497e-03, 2.1133398277451841e-03, 2.1191309236075853e-03,
+    2.1248383761678447e-03, 2.1305019227463714e-03, 2.1361694508676842e-03,
+    2.1418992128102669e-03, 2.1477624418812149e-03, 2.1538463788840726e-03,
+    2.1602576694650087e-03, 2.1671260112170179e-03, 2.1746077987478208e-03,
+    2.1828893186112666e-03, 2.1921887696607131e-03, 2.2027560255512388e-03,
+    2.2148686418680848e-03, 2.2288222244059228e-03, 5.8222054161817484e-04,
+    7.0730520758019444e-04, 8.1664289721233255e-04, 9.1231031727277798e-04,
+    9.9634277077094218e-04, 1.0705276085946804e-03, 1.1363716830462916e-03,
+    1.1951255715131599e-03, 1.2478223320660929e-03, 1.2953159165216234e-03,
+    1.3383146084310158e-03, 1.3774086562794053e-03, 1.4130925911942838e-03,
+    1.4457830786461664e-03, 1.4758331577647704e-03, 1.5035436097380489e-03,
+    1.5291720616224852e-03, 1.5529403074503051e-03, 1.5750402244306780e-03,
+    1.5956385787254392e-03, 1.6148809500285575e-03, 1.6328949536159097e-03,
+    1.6497928995249447e-03, 1.6656739984561252e-03, 1.6806262007779159e-03,
+    1.6947277370514169e-03, 1.7080484145340527e-03, 1.7206507132363183e-03,
+    1.7325907165792627e-03, 1.7439189049948294e-03, 1.7546808355166745e-03,
+    1.7649177262160215e-03, 1.7746669610077242e-03, 1.7839625277074073e-03,
+    1.7928354001226401e-03, 1.8013138733069230e-03, 1.8094238598149251e-03,
+    1.8171891538137704e-03, 1.8246316691847152e-03, 1.8317716572643754e-03,
+    1.8386279096051681e-03, 1.8452179510729195e-03, 1.8515582287441639e-03,
+    1.8576643024235541e-03, 1.8635510431849942e-03, 1.8692328471680950e-03,
+    1.8747238729546131e-03, 1.8800383122336119e-03, 1.8851907051578378e-03,
+    1.8901963138114528e-03, 1.8950715695402777e-03, 1.8998346124953871e-03,
+    1.9045059444940820e-03, 1.9091092189872153e-03, 1.9136721941370742e-03,
+    1.9182278760824555e-03, 1.9228158783081643e-03, 1.9274840179551625e-03,
+    1.9322901583606526e-03, 1.9373042854326716e-03, 1.9426107685581932e-03,
+    1.9483106980163214e-03, 1.9545241024929026e-03, 1.9613917244447375e-03,
+    1.9690758628185191e-03, 1.9777595856102287e-03, 1.9876433904329259e-03,
+    1.9989382020109176e-03, 5.2243988366698136e-04, 6.3469372358732892e-04,
+    7.3282121684808347e-04, 8.1868506328464216e-04, 8.9411095327701976e-04,
+    9.6070220610635162e-04, 1.0198105404300240e-03, 1.0725577893053344e-03,
+    1.1198706595776362e-03, 1.1625151879048404e-03, 1.2011267356943152e-03,
+    1.2362347776620295e-03, 1.2682829224644739e-03, 1.2976449272046437e-03,
+    1.3246374714481620e-03, 1.3495303558360100e-03, 1.3725546691826446e-03,
+    1.3939093563314561e-03, 1.4137665256723892e-03, 1.4322757604903489e-03,
+    1.4495676397788251e-03, 1.4657566287953581e-03, 1.4809434646420553e-03,
+    1.4952171351799110e-03, 1.5086565287614853e-03, 1.5213318161463516e-03,
+    1.5333056134380569e-03, 1.5446339651093047e-03, 1.5553671785234167e-03,
+    1.5655505353320339e-03, 1.5752249003617577e-03, 1.5844272448183865e-03,
+    1.5931910976201163e-03, 1.6015469362598437e-03, 1.6095225266631338e-03,
+    1.6171432199587890e-03, 1.6244322128363149e-03, 1.6314107771745637e-03,
+    1.6380984638424783e-03, 1.6445132849656199e-03, 1.6506718784943424e-03,
+    1.6565896585860041e-03, 1.6622809551105101e-03, 1.6677591455012181e-03,
+    1.6730367821972691e-03, 1.6781257190618382e-03, 1.6830372404165565e-03,
+    1.6877821967142934e-03, 1.6923711513891807e-03, 1.6968145440864936e-03,
+    1.7011228762955745e-03, 1.7053069263977289e-03, 1.7093780022979710e-03,
+    1.7133482411304083e-03, 1.7172309669787411e-03, 1.7210411190770332e-03,
+    1.7247957644288760e-03, 1.7285147100054592e-03, 1.7322212303156701e-03,
+    1.7359429256615659e-03, 1.7397127239940629e-03, 1.7435700337816047e-03,
+    1.7475620450027407e-03, 1.7517451579411958e-03, 1.7561864918481758e-03,
+    1.7609653840291724e-03, 1.7661747304836253e-03, 1.7719219384621982e-03,
+    1.7783291582689016e-03, 1.7855323411240054e-03, 1.7936785473777509e-03,
+    1.8029208372314311e-03, 4.7146422848527031e-04, 5.7277482403672001e-04,
+    6.6134032869458507e-04, 7.3884110028178782e-04, 8.0692420840783752e-04,
+    8.6703614271638988e-04, 9.2039641618537748e-04, 9.6801714483034937e-04,
+    1.0107344024997136e-03, 1.0492393049916450e-03, 1.0841050707981964e-03,
+    1.1158093853152790e-03, 1.1447524637195005e-03, 1.1712714996285705e-03,
+    1.1956521902150557e-03, 1.2181379377738128e-03, 1.2389372184224278e-03,
+    1.2582295079245382e-03, 1.2761700703960435e-03, 1.2928938482290298e-03,
+    1.3085186387599339e-03, 1.3231477022860941e-03, 1.3368719144634304e-03,
+    1.3497715517803805e-03, 1.3619177800146089e-03, 1.3733739010335056e-03,
+    1.3841964019969709e-03, 1.3944358422017858e-03, 1.4041376058939248e-03,
+    1.4133425439318030e-03, 1.4220875228767305e-03, 1.4304058966646575e-03,
+    1.4383279132812240e-03, 1.4458810666729740e-03, 1.4530904023662399e-03,
+    1.4599787838446242e-03, 1.4665671255867320e-03, 1.4728745977363735e-03,
+    1.4789188066251942e-03, 1.4847159547621608e-03, 1.4902809834197071e-03,
+    1.4956277005646287e-03, 1.5007688965879959e-03, 1.5057164500728052e-03,
+    1.5104814256923953e-03, 1.5150741662534014e-03, 1.5195043808805540e-03,
+    1.5237812313877827e-03, 1.5279134189911303e-03, 1.5319092736981639e-03,
+    1.5357768489587145e-03, 1.5395240244897063e-03, 1.5431586205969961e-03,
+    1.5466885278156372e-03, 1.5501218562804311e-03, 1.5534671099211221e-03,
+    1.5567333913446741e-03, 1.5599306441030152e-03, 1.5630699399122789e-03,
+    1.5661638192240512e-03, 1.5692266942426353e-03, 1.5722753238614510e-03,
+    1.5753293697914963e-03, 1.5784120419765233e-03, 1.5815508386543436e-03,
+    1.5847783813155722e-03, 1.5881333362116150e-03, 1.5916614005123887e-03,
+    1.5954163108995105e-03, 1.5994608032488550e-03, 1.6038674121104928e-03,
+    1.6087189466421259e-03, 1.6141084160763636e-03, 1.6201381070251727e-03,
+    1.6269174476267977e-03, 1.6345592497866374e-03, 3.8957201031856640e-04,
+    4.7329798364728940e-04, 5.4649654531671642e-04, 6.1055539581284521e-04,
+    6.6683487587504409e-04, 7.1652971119300405e-04, 7.6064717520770656e-04,
+    8.0002324583939070e-04, 8.3534849665870686e-04, 8.6719376850291554e-04,
+    8.9603251981201142e-04, 9.2225929866378373e-04, 9.4620466243954069e-04,
+    9.6814711241614642e-04, 9.8832261363887173e-04, 1.0069321956013815e-03,
+    1.0241480389950037e-03, 1.0401183706384308e-03, 1.0549714191355616e-03,
+    1.0688186281212961e-03, 1.0817572803384855e-03, 1.0938726519885756e-03,
+    1.1052397907213016e-03, 1.1159249905256612e-03, 1.1259870212649483e-03,
+    1.1354781585831324e-03, 1.1444450505734101e-03, 1.1529294503134638e-03,
+    1.1609688376607193e-03, 1.1685969492019660e-03, 1.1758442316922033e-03,
+    1.1827382314864938e-03, 1.1893039302078503e-03, 1.1955640350790778e-03,
+    1.2015392308844426e-03, 1.2072483993426680e-03, 1.2127088107112387e-03,
+    1.2179362916571639e-03, 1.2229453727877423e-03, 1.2277494187081753e-03,
+    1.2323607430402882e-03, 1.2367907104805212e-03, 1.2410498276826821e-03,
+    1.2451478245108349e-03, 1.2490937270117665e-03, 1.2528959232981870e-03,
+    1.2565622234079895e-03, 1.2600999141075624e-03, 1.2635158095355052e-03,
+    1.2668162985349663e-03, 1.2700073894969133e-03, 1.2730947535322644e-03,
+    1.2760837668077925e-03, 1.2789795529194203e-03, 1.2817870262377849e-03,
+    1.2845109372459139e-03, 1.2871559209986813e-03, 1.2897265499708466e-03,
+    1.2922273927248741e-03, 1.2946630800246411e-03, 1.2970383802449819e-03,
+    1.2993582861806048e-03, 1.3016281156366198e-03, 1.3038536284809572e-03,
+    1.3060411631429614e-03, 1.3081977958320403e-03, 1.3103315259924064e-03,
+    1.3124514916536749e-03, 1.3145682183084431e-03, 1.3166939046379332e-03,
+    1.3188427476626765e-03, 1.3210313085053856e-03, 1.3232789176333521e-03,
+    1.3256081148262345e-03, 1.3280451137260975e-03, 1.3306202731156605e-03,
+    1.3333685464293626e-03, 1.3363298668529178e-03, 1.3395494073292868e-03,
+    1.3430776329594384e-03, 1.3469700386785147e-03, 1.3512864402369482e-03,
+    1.3560896662130498e-03, 1.3614434907710594e-03, 3.2728418318638734e-04,
+    3.9763157565775320e-04, 4.5913725704046593e-04, 5.1296655479074319e-04,
+    5.6026190478210183e-04, 6.0202668736694589e-04, 6.3910686529089879e-04,
+    6.7220454303006431e-04, 7.0189970713898785e-04, 7.2867178477998998e-04,
+    7.5291841408206908e-04, 7.7497095786566335e-04, 7.9510703415285934e-04,
+    8.1356053975395633e-04, 8.3052964586945925e-04, 8.4618318184198941e-04,
+    8.6066574740364054e-04, 8.7410182394001546e-04, 8.8659909687353856e-04,
+    8.9825115450155866e-04, 9.0913969199360434e-04, 9.1933632086515235e-04,
+    9.2890406234355928e-04, 9.3789858615835650e-04, 9.4636924325304929e-04,
+    9.5435993082455611e-04, 9.6190982025401884e-04, 9.6905397237364460e-04,
+    9.7582385971639574e-04, 9.8224781161717375e-04, 9.8835139504333696e-04,
+    9.9415774165481359e-04, 9.9968782969367485e-04, 1.0049607277785896e-03,
+    1.0099938064492163e-03, 1.0148029223105916e-03, 1.0194025788166975e-03,
+    1.0238060670719690e-03, 1.0280255894863730e-03, 1.0320723686743211e-03,
+    1.0359567436187031e-03, 1.0396882548167892e-03, 1.0432757198709044e-03,
+    1.0467273007763640e-03, 1.0500505639829030e-03, 1.0532525341594779e-03,
+    1.0563397424695601e-03, 1.0593182700624874e-03, 1.0621937874013949e-03,
+    1.0649715899790706e-03, 1.0676566309157924e-03, 1.0702535508882909e-03,
+    1.0727667058032105e-03, 1.0752001926030927e-03, 1.0775578735747696e-03,
+    1.0798433995217432e-03, 1.0820602321600439e-03, 1.0842116661045839e-03,
+    1.0863008508270077e-03, 1.0883308129896008e-03, 1.0903044795908966e-03,
+    1.0922247023994669e-03, 1.0940942842023198e-03, 1.0959160074543973e-03,
+    1.0976926659860659e-03, 1.0994271005066890e-03, 1.1011222387336667e-03,
+    1.1027811410782835e-03, 1.1044070529289168e-03, 1.1060034646883413e-03,
+    1.1075741808376650e-03, 1.1091233994099266e-03, 1.1106558033487177e-03,
+    1.1121766652858790e-03, 1.1136919672735258e-03, 1.1152085369166122e-03,
+    1.1167342011264405e-03, 1.1182779582924818e-03, 1.1198501689662205e-03,
+    1.1214627640616973e-03, 1.1231294679685500e-03, 1.1248660316841429e-03,
+    1.1266904679142228e-03, 1.1286232758690763e-03, 1.1306876380076148e-03,
+    1.1329095641316709e-03, 1.1353179500191992e-03, 1.1379445084751900e-03,
+    1.1408235209523173e-03, 1.1439913490375892e-03, 1.1474856392181530e-03,
+    1.1513441544932735e-03, 2.7876216401917910e-04, 3.3868553442961821e-04,
+    3.9107969746520702e-04, 4.3693688553718201e-04, 4.7722989555204839e-04,
+    5.1281313771421588e-04, 5.4440698482855984e-04, 5.7260931197638057e-04,
+    5.9791400630155266e-04, 6.2072932368465881e-04, 6.4139387199268799e-04,
+    6.6018982155837725e-04, 6.7735357550691903e-04, 6.9308430540749027e-04,
+    7.0755076003492512e-04, 7.2089670157280718e-04, 7.3324525906533970e-04,
+    7.4470242947394499e-04, 7.5535990695198567e-04, 7.6529738112852096e-04,
+    7.7458441399970348e-04, 7.8328198085389055e-04, 7.9144374200628613e-04,
+    7.9911709774183601e-04, 8.0634406776499161e-04, 8.1316202786182719e-04,
+    8.1960432980173077e-04, 8.2570082529502054e-04, 8.3147831073705422e-04,
+    8.3696090625208291e-04, 8.4217038000299039e-04, 8.4712642670838956e-04,
+    8.5184690769000125e-04, 8.5634805847492135e-04, 8.6064466892944182e-04,
+    8.6475024005339151e-04, 8.6867712087324901e-04, 8.7243662830920412e-04,
+    8.7603915242854213e-04, 8.7949424911743673e-04, 8.8281072188850919e-04,
+    8.8599669428073425e-04, 8.8905967409109608e-04, 8.9200661049636959e-04,
+    8.9484394497139235e-04, 8.9757765678319672e-04, 9.0021330373280298e-04,
+    9.0275605872650662e-04, 9.0521074268181670e-04, 9.0758185420914371e-04,
+    9.0987359645545258e-04, 9.1208990145057991e-04, 9.1423445225777777e-04,
+    9.1631070319816380e-04, 9.1832189839137599e-04, 9.2027108883316637e-04,
+    9.2216114821250760e-04, 9.2399478765739030e-04, 9.2577456958800326e-04,
+    9.2750292084948810e-04, 9.2918214529270297e-04, 9.3081443597130991e-04,
+    9.3240188712613136e-04, 9.3394650613389386e-04, 9.3545022560645040e-04,
+    9.3691491583960311e-04, 9.3834239782619538e-04, 9.3973445706856790e-04,
+    9.4109285844849841e-04, 9.4241936244079201e-04, 9.4371574298808731e-04,
+    9.4498380739037996e-04, 9.4622541860238884e-04, 9.4744252037535072e-04,
+    9.4863716572598763e-04, 9.4981154926356655e-04, 9.5096804395380268e-04,
+    9.5210924294364364e-04, 9.5323800710913177e-04, 9.5435751901415823e-04,
+    9.5547134397273078e-04, 9.5658349888042189e-04, 9.5769852940674435e-04,
+    9.5882159599944424e-04, 9.5995856891841641e-04, 9.6111613215701204e-04,
+    9.6230189558089508e-04, 9.6352451386762976e-04, 9.6479380980416841e-04,
+    9.6612089812618649e-04, 9.6751830429306427e-04, 9.6900007031904890e-04,
+    9.7058183698091923e-04, 9.7228088839359020e-04, 9.7411614116294973e-04,
+    9.7610805629076952e-04, 9.7827844809795800e-04, 9.8065016127586247e-04,
+    9.8324658569350965e-04, 9.8609098003028068e-04, 2.4033768910649675e-04,
+    2.9200495794542714e-04, 3.3718197983930782e-04, 3.7672399578803409e-04,
+    4.1146953278411351e-04, 4.4215508562898802e-04, 4.6940161606119505e-04,
+    4.9372449538126646e-04, 5.1554945778844031e-04, 5.3522842290665545e-04,
+    5.5305327298199266e-04, 5.6926724022232904e-04, 5.8407410465159118e-04,
+    5.9764555192837209e-04, 6.1012704260430465e-04, 6.2164249823839569e-04,
+    6.3229805417333151e-04, 6.4218507753737982e-04, 6.5138260615987809e-04,
+    6.5995932976238569e-04, 6.6797520790040199e-04, 6.7548279829390660e-04,
+    6.8252835310855645e-04, 6.8915272835610747e-04, 6.9539214201439197e-04,
+    7.0127880905962545e-04, 7.0684147584719676e-04, 7.1210587178504973e-04,
+    7.1709509272194054e-04, 7.2182992769921053e-04, 7.2632913851924605e-04,
+    7.3060969983825431e-04, 7.3468700609595266e-04, 7.3857505047528595e-04,
+    7.4228658018216163e-04, 7.4583323160412151e-04, 7.4922564831163816e-04,
+    7.5247358438001446e-04, 7.5558599511095980e-04, 7.5857111690491206e-04,
+    7.6143653776357487e-04, 7.6418925967737604e-04, 7.6683575396475651e-04,
+    7.6938201047409727e-04, 7.7183358142746301e-04, 7.7419562057546524e-04,
+    7.7647291823922310e-04, 7.7866993273709173e-04, 7.8079081862695437e-04,
+    7.8283945213850580e-04, 7.8481945412158059e-04, 7.8673421079572699e-04,
+    7.8858689255089927e-04, 7.9038047101950067e-04, 7.9211773461411699e-04,
+    7.9380130270369730e-04, 7.9543363858217337e-04, 7.9701706136781482e-04,
+    7.9855375695830834e-04, 8.0004578815539120e-04, 8.0149510406378390e-04,
+    8.0290354886169231e-04, 8.0427287003453842e-04, 8.0560472615916689e-04,
+    8.0690069432312671e-04, 8.0816227726212631e-04, 8.0939091029874676e-04,
+    8.1058796816669372e-04, 8.1175477180762978e-04, 8.1289259523141717e-04,
+    8.1400267253634278e-04, 8.1508620519232745e-04, 8.1614436969907667e-04,
+    8.1717832574056029e-04, 8.1818922496932798e-04, 8.1917822056716029e-04,
+    8.2014647774373379e-04, 8.2109518535156698e-04, 8.2202556881398896e-04,
+    8.2293890458223838e-04, 8.2383653635888774e-04, 8.2471989334588697e-04,
+    8.2559051079673647e-04, 8.2645005317200960e-04, 8.2730034021446098e-04,
+    8.2814337627137532e-04, 8.2898138319564168e-04, 8.2981683714808169e-04,
+    8.3065250959723461e-04, 8.3149151276165059e-04, 8.3233734965476645e-04,
+    8.3319396876206805e-04, 8.3406582319013915e-04, 8.3495793385963122e-04,
+    8.3587595594867170e-04, 8.3682624730519795e-04, 8.3781593691039985e-04,
+    8.3885299066308809e-04, 8.3994627074291935e-04, 8.4110558358002185e-04,
+    8.4234171000999083e-04, 8.4366640954804811e-04, 8.4509238894168873e-04,
+    8.4663322337938710e-04, 8.4830321715003050e-04, 8.5011718946600230e-04,
+    8.5209017100343007e-04, 8.5423699800464840e-04, 2.0939826996645418e-04,
+    2.5441685596112857e-04, 2.9378150373905710e-04, 3.2823720110919494e-04,
+    3.5851440334996914e-04, 3.8525469381339884e-04, 4.0899901582297369e-04,
+    4.3019633084157651e-04, 4.4921751452788110e-04, 4.6636913966154606e-04,
+    4.8190547770380157e-04, 4.9603841865585366e-04, 5.0894548366552550e-04,
+    5.2077623475023263e-04, 5.3165738779425010e-04, 5.4169689486730085e-04,
+    5.5098721347398162e-04, 5.5960793570779114e-04, 5.6762791293467145e-04,
+    5.7510698172923830e-04, 5.8209737336484485e-04, 5.8864487100712031e-04,
+    5.9478976475597824e-04, 6.0056764388466985e-04, 6.0601005728929715e-04,
+    6.1114506670897645e-04, 6.1599771226211416e-04, 6.2059040593084847e-04,
+    6.2494326555784718e-04, 6.2907439950314094e-04, 6.3300015019634309e-04,
+    6.3673530329869739e-04, 6.4029326797432362e-04, 6.4368623279455878e-04,
+    6.4692530101276573e-04, 6.5002060830978412e-04, 6.5298142559198392e-04,
+    6.5581624900036193e-04, 6.5853287894194893e-04, 6.6113848966867532e-04,
+    6.6363969069252265e-04, 6.6604258112956444e-04, 6.6835279790229902e-04,
+    6.7057555859303302e-04, 6.7271569962697956e-04, 6.7477771036719399e-04,
+    6.7676576362274139e-04, 6.7868374300244160e-04, 6.8053526748866329e-04,
+    6.8232371355584308e-04, 6.8405223511635053e-04, 6.8572378154004617e-04,
+    6.8734111396313586e-04, 6.8890682007514872e-04, 6.9042332755025093e-04,
+    6.9189291626928456e-04, 6.9331772946207965e-04, 6.9469978388487673e-04,
+    6.9604097913521343e-04, 6.9734310619558684e-04, 6.9860785528807665e-04,
+    6.9983682311382332e-04, 7.0103151954470702e-04, 7.0219337382844806e-04,
+    7.0332374036377729e-04, 7.0442390409801512e-04, 7.0549508559641623e-04,
+    7.0653844582982373e-04, 7.0755509072559372e-04, 7.0854607552528058e-04,
+    7.0951240899221350e-04, 7.1045505751184330e-04, 7.1137494912870670e-04,
+    7.1227297756466226e-04, 7.1315000626532904e-04, 7.1400687252376797e-04,
+    7.1484439173386612e-04, 7.1566336182945763e-04, 7.1646456796994494e-04,
+    7.1724878753816270e-04, 7.1801679552251118e-04, 7.1876937036166751e-04,
+    7.1950730033820090e-04, 7.2023139061502079e-04, 7.2094247101793800e-04,
+    7.2164140467666346e-04, 7.2232909764673029e-04, 7.2300650964447820e-04,
+    7.2367466603746498e-04, 7.2433467124146029e-04, 7.2498772368340906e-04,
+    7.2563513249489936e-04, 7.2627833610324182e-04, 7.2691892288384824e-04,
+    7.2755865402777649e-04, 7.2819948875774089e-04, 7.2884361199285566e-04,
+    7.2949346451063244e-04, 7.3015177558079204e-04, 7.3082159794112520e-04,
+    7.3150634484461091e-04, 7.3220982871873843e-04, 7.3293630073393787e-04,
+    7.3369049026546197e-04, 7.3447764284288058e-04, 7.3530355470136761e-04,
+    7.3617460147471067e-04, 7.3709775789782147e-04, 7.3808060462702272e-04,
+    7.3913131746125484e-04, 7.4025863340190518e-04, 7.4147178719543010e-04,
+    7.4278041137094465e-04, 7.4419439246466807e-04, 7.4572367631157326e-04,
+    7.4737801621649986e-04, 1.8403444642348173e-04, 2.2360193728338895e-04,
+    2.5820091264963939e-04, 2.8848601040477943e-04, 3.1509911770728955e-04,
+    3.3860403287501797e-04, 3.5947611893757763e-04, 3.7810990980809850e-04,
+    3.9483132058169064e-04, 4.0990975901204139e-04, 4.2356867187310797e-04,
+    4.3599426213138012e-04, 4.4734253015655889e-04, 4.5774490640225604e-04,
+    4.6731274457948141e-04, 4.7614090910691459e-04, 4.8431064806147585e-04,
+    4.9189190363086203e-04, 4.9894517925000242e-04, 5.0552305632746138e-04,
+    5.1167143288551075e-04, 5.1743054048691253e-04, 5.2283578351449865e-04,
+    5.2791843538225688e-04, 5.3270621893178045e-04, 5.3722379259714035e-04,
+    5.4149315951430160e-04, 5.4553401331232626e-04, 5.4936403162746887e-04,
+    5.5299912625787480e-04, 5.5645365719588283e-04, 5.5974061643855567e-04,
+    5.6287178640913274e-04, 5.6585787696500204e-04, 5.6870864427645534e-04,
+    5.7143299430069047e-04, 5.7403907311992812e-04, 5.7653434604055869e-04,
+    5.7892566704486963e-04, 5.8121933993571467e-04, 5.8342117230657036e-04,
+    5.8553652329720559e-04, 5.8757034595146782e-04, 5.8952722487396413e-04,
+    5.9141140978167021e-04, 5.9322684546213702e-04, 5.9497719857845902e-04,
+    5.9666588170098232e-04, 5.9829607489432360e-04, 5.9987074514486450e-04,
+    6.0139266387653270e-04, 6.0286442277100824e-04, 6.0428844808108149e-04,
+    6.0566701360254720e-04, 6.0700225244974767e-04, 6.0829616776246487e-04,
+    6.0955064245678649e-04, 6.1076744811949281e-04, 6.1194825313418686e-04,
+    6.1309463011753075e-04, 6.1420806273541114e-04, 6.1528995196137787e-04,
+    6.1634162183324685e-04, 6.1736432475812590e-04, 6.1835924641118970e-04,
+    6.1932751026932216e-04, 6.2027018181713852e-04, 6.2118827245961070e-04,
+    6.2208274317301199e-04, 6.2295450792353168e-04, 6.2380443688109016e-04,
+    6.2463335945435038e-04, 6.2544206717179388e-04, 6.2623131643278459e-04,
+    6.2700183115208267e-04, 6.2775430532093759e-04, 6.2848940550795575e-04,
+    6.2920777332319845e-04, 6.2991002786967750e-04, 6.3059676820710544e-04,
+    6.3126857585422708e-04, 6.3192601735722058e-04, 6.3256964695381044e-04,
+    6.3320000936453757e-04, 6.3381764274537933e-04, 6.3442308183849177e-04,
+    6.3501686136122136e-04, 6.3559951967676574e-04, 6.3617160279402752e-04,
+    6.3673366874807547e-04, 6.3728629241732195e-04, 6.3783007083804467e-04,
+    6.3836562908194323e-04, 6.3889362676709826e-04, 6.3941476527777977e-04,
+    6.3992979577274340e-04, 6.4043952806576042e-04, 6.4094484046465291e-04,
+    6.4144669065665692e-04, 6.4194612772663830e-04, 6.4244430539087908e-04,
+    6.4294249652055663e-04, 6.4344210901537858e-04, 6.4394470306623818e-04,
+    6.4445200981530330e-04, 6.4496595137883070e-04, 6.4548866214026075e-04,
+    6.4602251114426309e-04, 6.4657012532320002e-04, 6.4713441316025639e-04,
+    6.4771858823496490e-04, 6.4832619190065082e-04, 6.4896111410656619e-04,
+    6.4962761109613903e-04, 6.5033031838701127e-04, 6.5107425707048227e-04,
+    6.5186483106762525e-04, 6.5270781256194317e-04, 6.5360931242323202e-04,
+    6.5457573208380364e-04, 6.5561369308559411e-04, 6.5672994045926764e-04,
+    6.5793121631847371e-04, 6.5922410066159628e-04, 1.6281869383933347e-04,
+    1.9782618447198994e-04, 2.2843836629128579e-04, 2.5523432690749046e-04,
+    2.7878188911945739e-04, 2.9957980265679402e-04, 3.1804858767357010e-04,
+    3.3453726164930144e-04, 3.4933414015849660e-04, 3.6267755066107457e-04,
+    3.7476516196175617e-04, 3.8576169562057794e-04, 3.9580515480977936e-04,
+    4.0501180716731133e-04, 4.1348015961843878e-04, 4.2129413197057196e-04,
+    4.2852559843990659e-04, 4.3523643157342373e-04, 4.4148015399762385e-04,
+    4.4730328018126433e-04, 4.5274641219202115e-04, 4.5784513931653240e-04,
+    4.6263078052632072e-04, 4.6713100037918634e-04, 4.7137032246591414e-04,
+    4.7537055949552453e-04, 4.7915117521377749e-04, 4.8272959030746919e-04,
+    4.8612144206194201e-04, 4.8934080566082646e-04, 4.9240038353014833e-04,
+    4.9531166794679229e-04, 4.9808508118649795e-04, 5.0073009672841945e-04,
+    5.0325534442161902e-04, 5.0566870202370016e-04, 5.0797737511871696e-04,
+    5.1018796709243754e-04, 5.1230654057292586e-04, 5.1433867152217427e-04,
+    5.1628949698059314e-04, 5.1816375731377287e-04, 5.1996583368385920e-04,
+    5.2169978136185925e-04, 5.2336935940819069e-04, 5.2497805717399357e-04,
+    5.2652911801264878e-04, 5.2802556053745825e-04, 5.2947019771620765e-04,
+    5.3086565405467245e-04, 5.3221438108827892e-04, 5.3351867137288922e-04,
+    5.3478067114161082e-04, 5.3600239177362531e-04, 5.3718572020328593e-04,
+    5.3833242838206233e-04, 5.3944418189276326e-04, 5.4052254780356584e-04,
+    5.4156900183956929e-04, 5.4258493494054559e-04, 5.4357165926610640e-04,
+    5.4453041370260298e-04, 5.4546236892043395e-04, 5.4636863202507451e-04,
+    5.4725025084088517e-04, 5.4810821786257960e-04, 5.4894347390600220e-04,
+    5.4975691148663474e-04, 5.5054937795177394e-04, 5.5132167838985429e-04,
+    5.5207457833851385e-04, 5.5280880631109342e-04, 5.5352505615992049e-04,
+    5.5422398929325404e-04, 5.5490623676185109e-04, 5.5557240123002951e-04,
+    5.5622305884555408e-04, 5.5685876102186968e-04, 5.5748003614606830e-04,
+    5.5808739122537173e-04, 5.5868131348511059e-04, 5.5926227193091446e-04,
+    5.5983071888819765e-04, 5.6038709153211758e-04, 5.6093181342183474e-04,
+    5.6146529605324293e-04, 5.6198794044532807e-04, 5.6250013877587129e-04,
+    5.6300227608364537e-04, 5.6349473205500895e-04, 5.6397788291455333e-04,
+    5.6445210344069591e-04, 5.6491776912899624e-04, 5.6537525852766468e-04,
+    5.6582495577196703e-04, 5.6626725334611217e-04, 5.6670255510385295e-04,
+    5.6713127958110633e-04, 5.6755386363670766e-04, 5.6797076645957159e-04,
+    5.6838247398333357e-04, 5.6878950375146284e-04, 5.6919241027814115e-04,
+    5.6959179095140327e-04, 5.6998829252613364e-04, 5.7038261825404434e-04,
+    5.7077553569645555e-04, 5.7116788526208166e-04, 5.7156058950649574e-04,
+    5.7195466322070433e-04, 5.7235122432373203e-04, 5.7275150555579561e-04,
+    5.7315686694473650e-04, 5.7356880898611832e-04, 5.7398898643620680e-04,
+    5.7441922256411151e-04, 5.7486152364340736e-04, 5.7531809338167155e-04,
+    5.7579134688719624e-04, 5.7628392365279967e-04, 5.7679869889688503e-04,
+    5.7733879243987364e-04, 5.7790757411222467e-04, 5.7850866449023761e-04,
+    5.7914592954535734e-04, 5.7982346758080983e-04, 5.8054558663316123e-04,
+    5.8131677035663039e-04, 5.8214163031556460e-04, 5.8302484262139455e-04,
+    5.8397106701052329e-04, 5.8498484681756419e-04, 1.4539147881269477e-04,
+    1.7665297783471678e-04, 2.0398993051277235e-04, 2.2791938204098062e-04,
+    2.4894833017477763e-04, 2.6752210269119839e-04, 2.8401617889531322e-04,
+    2.9874219474712414e-04, 3.1195758618581237e-04, 3.2387515511280747e-04,
+    3.3467139947375392e-04, 3.4449339867461288e-04, 3.5346437527470172e-04,
+    3.6168814415044742e-04, 3.6925266160245428e-04, 3.7623285905548468e-04,
+    3.8269291238916548e-04, 3.8868806695981295e-04, 3.9426611245173764e-04,
+    3.9946858094242344e-04, 4.0433172530878831e-04, 4.0888732250283724e-04,
+    4.1316333650401571e-04, 4.1718446826174467e-04, 4.2097261415574208e-04,
+    4.2454725002256960e-04, 4.2792575431570761e-04, 4.3112368125027510e-04,
+    4.3415499265366339e-04, 4.3703225556630609e-04, 4.3976681130899380e-04,
+    4.4236892067776119e-04, 4.4484788908359944e-04, 4.4721217477744415e-04,
+    4.4946948275457750e-04, 4.5162684649061876e-04, 4.5369069930119012e-04,
+    4.5566693682371780e-04, 4.5756097187846082e-04, 4.5937778276759333e-04,
+    4.6112195590675544e-04, 4.6279772354764783e-04, 4.6440899723649724e-04,
+    4.6595939755885221e-04, 4.6745228064136701e-04, 4.6889076181483676e-04,
+    4.7027773678594368e-04, 4.7161590061794881e-04, 4.7290776477962836e-04,
+    4.7415567248774223e-04, 4.7536181253849129e-04, 4.7652823179869747e-04,
+    4.7765684650541228e-04, 4.7874945250453806e-04, 4.7980773454262644e-04,
+    4.8083327471258288e-04, 4.8182756014164476e-04, 4.8279199000003621e-04,
+    4.8372788189917141e-04, 4.8463647774096082e-04, 4.8551894907230230e-04,
+    4.8637640199344705e-04, 4.8720988166304737e-04, 4.8802037643864673e-04,
+    4.8880882168679486e-04, 4.8957610329387728e-04, 4.9032306090511610e-04,
+    4.9105049091695090e-04, 4.9175914924497514e-04, 4.9244975388807095e-04,
+    4.9312298730684015e-04, 4.9377949863336525e-04, 4.9441990572724457e-04,
+    4.9504479709215014e-04, 4.9565473366537617e-04, 4.9625025049249909e-04,
+    4.9683185829772184e-04, 4.9740004496037890e-04, 4.9795527690681357e-04,
+    4.9849800042685625e-04, 4.9902864292311752e-04, 4.9954761410153496e-04,
+    5.0005530711068715e-04, 5.0055209963781907e-04, 5.0103835496882222e-04,
+    5.0151442301979616e-04, 5.0198064134752550e-04, 5.0243733614651275e-04,
+    5.0288482324018749e-04, 5.0332340907433383e-04, 5.0375339172085639e-04,
+    5.0417506190069804e-04, 5.0458870403479773e-04, 5.0499459733295722e-04,
+    5.0539301693066729e-04, 5.0578423508508205e-04, 5.0616852244171075e-04,
+    5.0654614938467095e-04, 5.0691738748393856e-04, 5.0728251105443018e-04,
+    5.0764179884256065e-04, 5.0799553585741217e-04, 5.0834401536463695e-04,
+    5.0868754106281875e-04, 5.0902642946307501e-04, 5.0936101249426100e-04,
+    5.0969164035723235e-04, 5.1001868465303673e-04, 5.1034254181069451e-04,
+    5.1066363684128984e-04, 5.1098242744528446e-04, 5.1129940850012966e-04,
+    5.1161511695426028e-04, 5.1193013715223788e-04, 5.1224510661262079e-04,
+    5.1256072227632849e-04, 5.1287774723659922e-04, 5.1319701795356687e-04,
+    5.1351945194472105e-04, 5.1384605592764716e-04, 5.1417793437199980e-04,
+    5.1451629839328308e-04, 5.1486247489002449e-04, 5.1521791578849104e-04,
+    5.1558420721266134e-04, 5.1596307834227660e-04, 5.1635640965609771e-04,
+    5.1676624018159411e-04, 5.1719477328492406e-04, 5.1764438043764498e-04,
+    5.1811760228962032e-04, 5.1861714626490662e-04, 5.1914587978267232e-04,
+    5.1970681809623679e-04, 5.2030310564921860e-04, 5.2093798978220505e-04,
+    5.2161478560210724e-04, 5.2233683087045402e-04, 5.2310742989819319e-04,
+    5.2392978567888720e-04, 1.3037284439148676e-04, 1.5840588779175973e-04,
+    1.8292002589073310e-04, 2.0437884755023679e-04, 2.2323694113999778e-04,
+    2.3989360312770132e-04, 2.5468550281120672e-04, 2.6789206575544893e-04,
+    2.7974411989913398e-04, 2.9043247256488482e-04, 3.0011537943571190e-04,
+    3.0892471824908372e-04, 3.1697097561956519e-04, 3.2434723633873266e-04,
+    3.3113236565547881e-04, 3.3739355009655876e-04, 3.4318833225172583e-04,
+    3.4856624717329222e-04, 3.5357014479785778e-04, 3.5823726418939515e-04,
+    3.6260011082623976e-04, 3.6668717685789040e-04, 3.7052353554136932e-04,
+    3.7413133434758498e-04, 3.7753020604035302e-04, 3.8073761301443476e-04,
+    3.8376913705773274e-04, 3.8663872426718959e-04, 3.8935889293838482e-04,
+    3.9194091074491668e-04, 3.9439494633328778e-04, 3.9673019951248821e-04,
+    3.9895501346112126e-04, 4.0107697176785758e-04, 4.0310298263133325e-04,
+    4.0503935214916930e-04, 4.0689184830304846e-04, 4.0866575698339264e-04,
+    4.1036593118085431e-04, 4.1199683429396760e-04, 4.1356257835502096e-04,
+    4.1506695785420157e-04, 4.1651347974033820e-04, 4.1790539009166594e-04,
+    4.1924569787877582e-04, 4.2053719618205575e-04, 4.2178248117536159e-04,
+    4.2298396914491735e-04, 4.2414391177613217e-04, 4.2526440991014458e-04,
+    4.2634742594551962e-04, 4.2739479503799057e-04, 4.2840823523174876e-04,
+    4.2938935663918885e-04, 4.3033966977158256e-04, 4.3126059311085827e-04,
+    4.3215346000182261e-04, 4.3301952493491204e-04, 4.3385996928139411e-04,
+    4.3467590653593435e-04, 4.3546838711518761e-04, 4.3623840275577516e-04,
+    4.3698689055016187e-04, 4.3771473665490181e-04, 4.3842277970195941e-04,
+    4.3911181394068011e-04, 4.3978259213508261e-04, 4.4043582823866042e-04,
+    4.4107219986664606e-04, 4.4169235058375114e-04, 4.4229689202358836e-04,
+    4.4288640585453377e-04, 4.4346144560528084e-04, 4.4402253836227221e-04,
+    4.4457018634994831e-04, 4.4510486840393946e-04, 4.4562704134634094e-04,
+    4.4613714127157526e-04, 4.4663558475054998e-04, 4.4712276996036700e-04,
+    4.4759907774616906e-04, 4.4806487262139108e-04, 4.4852050371219624e-04,
+    4.4896630565157954e-04, 4.4940259942832610e-04, 4.4982969319576777e-04,
+    4.5024788304507752e-04, 4.5065745374772779e-04, 4.5105867947156604e-04,
+    4.5145182447496357e-04, 4.5183714378340100e-04, 4.5221488385289516e-04,
+    4.5258528322472262e-04, 4.5294857317596334e-04, 4.5330497837050096e-04,
+    4.5365471751533762e-04, 4.5399800402720993e-04, 4.5433504671477576e-04,
+    4.5466605048194583e-04, 4.5499121705821198e-04, 4.5531074576222737e-04,
+    4.5562483430534596e-04, 4.5593367964216628e-04, 4.5623747887581516e-04,
+    4.5653643022605390e-04, 4.5683073406907395e-04, 4.5712059405831820e-04,
+    4.5740621833645443e-04, 4.5768782084925231e-04, 4.5796562277289679e-04,
+    4.5823985406693972e-04, 4.5851075516589626e-04, 4.5877857882313690e-04,
+    4.5904359212143675e-04, 4.5930607866507541e-04, 4.5956634096885868e-04,
+    4.5982470305971267e-04, 4.6008151330651030e-04, 4.6033714749348629e-04,
+    4.6059201215192959e-04, 4.6084654816345083e-04, 4.6110123464630060e-04,
+    4.6135659313316797e-04, 4.6161319204514036e-04, 4.6187165146098974e-04,
+    4.6213264817415701e-04, 4.6239692102084489e-04, 4.6266527645122548e-04,
+    4.6293859430179206e-04, 4.6321783370942878e-04, 4.6350403908659225e-04,
+    4.6379834605154291e-04, 4.6410198717730243e-04, 4.6441629738747656e-04,
+    4.6474271878595613e-04, 4.6508280466073113e-04, 4.6543822234967289e-04,
+    4.6581075459879018e-04, 4.6620229898236630e-04, 4.6661486489145854e-04,
+    4.6705056753549705e-04, 4.6751161834518429e-04, 4.6800031111952434e-04,
+    4.6851900323226908e-04, 4.6907009121282059e-04, 4.6965598005359142e-04,
+    4.7027904568210484e-04, 4.7094159018342611e-04
+};
+
+
+
+const realtype rock4Kappa[2030] =
+{
+    9.9999999999999989e-01, 1.0000000000000000e+00, 1.0060646893385121e+00,
+    1.0000000000000000e+00, 1.0061329219734592e+00, 1.0299177089443989e+00,
+    1.0000000000000000e+00, 1.0063027307109185e+00, 1.0295473753865436e+00,
+    1.0626423095833635e+00, 1.0000000000000000e+00, 1.0064416791811481e+00,
+    1.0301077687770521e+00, 1.0608715301008211e+00, 1.0993575072386386e+00,
+    1.0000000000000000e+00, 1.0065519399925729e+00, 1.0306281725128561e+00,
+    1.0616025599004302e+00, 1.0955054231354251e+00, 1.1372969823779917e+00,
+    1.0000000000000000e+00, 1.0066398707899447e+00, 1.0310606406046903e+00,
+    1.0624398439159759e+00, 1.0960994561877464e+00, 1.1310501853202473e+00,
+    1.1748863696302210e+00, 9.9999999999999989e-01, 1.0067106502649865e+00,
+    1.0314170096869266e+00, 1.0631727010823793e+00, 1.0971138033549657e+00,
+    1.1312272063354385e+00, 1.1662156261990946e+00, 1.2112504070482784e+00,
+    1.0000000000000000e+00, 1.0067682179378041e+00, 1.0317119204933052e+00,
+    1.0637944502376826e+00, 1.0980646023856584e+00, 1.1322715579878833e+00,
+    1.1657615219464148e+00, 1.2003051769716264e+00, 1.2459241548000337e+00,
+    9.9999999999999989e-01, 1.0068155066299873e+00, 1.0319575208509126e+00,
+    1.0643206241417560e+00, 1.0988954741417585e+00, 1.1333493204429534e+00,
+    1.1667032898967162e+00, 1.1990780610656793e+00, 1.2329568007638949e+00,
+    1.2787029684561881e+00, 9.9999999999999989e-01, 1.0068547406852735e+00,
+    1.0321635729779917e+00, 1.0647675561452759e+00, 1.0996131558750306e+00,
+    1.1343246051192013e+00, 1.1678247375141781e+00, 1.1998074997508597e+00,
+    1.2308781694776216e+00, 1.2639994953920501e+00, 1.3095189464767789e+00,
+    1.0000000000000000e+00, 1.0068875942102948e+00, 1.0323377081444840e+00,
+    1.0651490846785130e+00, 1.1002330360341830e+00, 1.1351840853388682e+00,
+    1.1688846456609105e+00, 1.2009004377073509e+00, 1.2313096837045816e+00,
+    1.2610430566139337e+00, 1.2933758139781086e+00, 1.3383951338507485e+00,
+    1.0000000000000000e+00, 1.0069153379321727e+00, 1.0324858896167284e+00,
+    1.0654764920392099e+00, 1.1007699496960908e+00, 1.1359376118042426e+00,
+    1.1698389984549806e+00, 1.2019932414005638e+00, 1.2323134360043551e+00,
+    1.2611142286960522e+00, 1.2895545367079828e+00, 1.3210970191799354e+00,
+    1.3654108687657158e+00, 9.9999999999999989e-01, 1.0069389512791820e+00,
+    1.0326128249895232e+00, 1.0657589578422095e+00, 1.1012367640139702e+00,
+    1.1365986426732633e+00, 1.1706879008204996e+00, 1.2030020341440004e+00,
+    1.2333956121710348e+00, 1.2619793198413547e+00, 1.2892236491286835e+00,
+    1.3164503013473847e+00, 1.3472141105599991e+00, 1.3906718474176494e+00,
+    9.9999999999999989e-01, 1.0069592042357025e+00, 1.0327222924931065e+00,
+    1.0660040347760285e+00, 1.1016444666098713e+00, 1.1371801745560914e+00,
+    1.1714416050740357e+00, 1.2039133075732198e+00, 1.2344255271116529e+00,
+    1.2630150834412648e+00, 1.2899112555432113e+00, 1.3156931201963524e+00,
+    1.3417968679556604e+00, 1.3717956559742965e+00, 1.4142810734695948e+00,
+    1.0000000000000000e+00, 1.0069766944545242e+00, 1.0328172698956304e+00,
+    1.0662177822534395e+00, 1.1020020755098991e+00, 1.1376934015630045e+00,
+    1.1721114904316940e+00, 1.2047315475198033e+00, 1.2353714720002629e+00,
+    1.2640383861185267e+00, 1.2908708710522523e+00, 1.3161735698093888e+00,
+    1.3406040819114211e+00, 1.3656755908106211e+00, 1.3949235037129741e+00,
+    1.4363531818642556e+00, 1.0000000000000000e+00, 1.0070051678729763e+00,
+    1.0329727657540984e+00, 1.0665699537148197e+00, 1.1025953818360839e+00,
+    1.1385513023023695e+00, 1.1732404777082046e+00, 1.2061243055333815e+00,
+    1.2370073577830885e+00, 1.2658756957208039e+00, 1.2928148440025777e+00,
+    1.3179771635291990e+00, 1.3415945932056568e+00, 1.3640585309569666e+00,
+    1.3861269998475394e+00, 1.4093842786558286e+00, 1.4371798853786031e+00,
+    1.4763708648620268e+00, 1.0000000000000000e+00, 1.0070271480585780e+00,
+    1.0330935427155850e+00, 1.0668453978483015e+00, 1.1030629832374614e+00,
+    1.1392330440672493e+00, 1.1741456322103510e+00, 1.2072519192615709e+00,
+    1.2383480589005915e+00, 1.2674118104199301e+00, 1.2945159457098041e+00,
+    1.3197834475220072e+00, 1.3433693174428789e+00, 1.3654660755279635e+00,
+    1.3863415468339748e+00, 1.4064333423627824e+00, 1.4265498333483835e+00,
+    1.4482674028093951e+00, 1.4746648604221031e+00, 1.5115479513904244e+00,
+    1.0000000000000000e+00, 1.0070444500310312e+00, 1.0331890672133899e+00,
+    1.0670644288602587e+00, 1.1034370421922088e+00, 1.1397819539981910e+00,
+    1.1748795107128618e+00, 1.2081729878142391e+00, 1.2394521770914673e+00,
+    1.2686895224704755e+00, 1.2959524408300327e+00, 1.3213558575223587e+00,
+    1.3450374919277983e+00, 1.3671479570992813e+00, 1.3878538059660708e+00,
+    1.4073571702261471e+00, 1.4259427292103275e+00, 1.4440735628003865e+00,
+    1.4625742217230291e+00, 1.4829627550055891e+00, 1.5080148425135729e+00,
+    1.5426174828439898e+00, 1.0000000000000000e+00, 1.0070583022879476e+00,
+    1.0332658332171507e+00, 1.0672412006148331e+00, 1.1037403671176160e+00,
+    1.1402293783417929e+00, 1.1754810507923752e+00, 1.2089324617946187e+00,
+    1.2403683713423865e+00, 1.2697571485481738e+00, 1.2971627484128871e+00,
+    1.3226965358013414e+00, 1.3464909553395648e+00, 1.3686859441961789e+00,
+    1.3894238033479445e+00, 1.4088513875416724e+00, 1.4271312678384629e+00,
+    1.4444669272375554e+00, 1.4611520076116917e+00, 1.4776611398671708e+00,
+    1.4948106652145672e+00, 1.5140302041544342e+00, 1.5377908653350851e+00,
+    1.5701970036062318e+00, 9.9999999999999989e-01, 1.0070695484560961e+00,
+    1.0333283446461836e+00, 1.0673856426724275e+00, 1.1039891680355800e+00,
+    1.1405979202633572e+00, 1.1759787902861163e+00, 1.2095639345719387e+00,
+    1.2411340745276220e+00, 1.2706542972802783e+00, 1.2981858800778867e+00,
+    1.3238378718692214e+00, 1.3477402878794407e+00, 1.3700295085819330e+00,
+    1.3908409725760775e+00, 1.4103067918293497e+00, 1.4285576111675622e+00,
+    1.4457295166867543e+00, 1.4619785309993243e+00, 1.4775076526888231e+00,
+    1.4926149707021299e+00, 1.5077765295657326e+00, 1.5237842381415843e+00,
+    1.5419649890588112e+00, 1.5645033695503390e+00, 1.5948500916331931e+00,
+    1.0000000000000000e+00, 1.0070788119018614e+00, 1.0333799613903605e+00,
+    1.0675052452193885e+00, 1.1041958292375775e+00, 1.1409050981327447e+00,
+    1.1763952061963876e+00, 1.2100943522510403e+00, 1.2417799799129550e+00,
+    1.2714144866051809e+00, 1.2990569570769941e+00, 1.3248146349946537e+00,
+    1.3488159451397899e+00, 1.3711955680501913e+00, 1.3920864764088117e+00,
+    1.4116162107589616e+00, 1.4299060562090684e+00, 1.4470727231869898e+00,
+    1.4632329522492493e+00, 1.4785123865062206e+00, 1.4930612984989182e+00,
+    1.5070815479683295e+00, 1.5208717070267479e+00, 1.5349007089919420e+00,
+    1.5499241575036322e+00, 1.5671591991233287e+00, 1.5885261609981189e+00,
+    1.6169288237173103e+00, 9.9999999999999989e-01, 1.0070865257648691e+00,
+    1.0334230306394554e+00, 1.0676052733284827e+00, 1.1043691168571186e+00,
+    1.1411634080919471e+00, 1.1767464671037602e+00, 1.2105432761938806e+00,
+    1.2423285969033293e+00, 1.2720626056305557e+00, 1.2998025618016056e+00,
+    1.3256542145589318e+00, 1.3497447453194946e+00, 1.3722077186026453e+00,
+    1.3931748932646451e+00, 1.4127720623841618e+00, 1.4311173797561054e+00,
+    1.4483214074548849e+00, 1.4644886566263837e+00, 1.4797208581445860e+00,
+    1.4941227114973683e+00, 1.5078115282126601e+00, 1.5209331246031625e+00,
+    1.5336876461078239e+00, 1.5463708049814635e+00, 1.5594381918255398e+00,
+    1.5736022182272091e+00, 1.5899706552313335e+00, 1.6102267577868856e+00,
+    1.6368203040223401e+00, 9.9999999999999989e-01, 1.0070930163913372e+00,
+    1.0334593312587863e+00, 1.0676897445096574e+00, 1.1045157720498642e+00,
+    1.1413825439472201e+00, 1.1770452379955445e+00, 1.2109261939386136e+00,
+    1.2427979592955380e+00, 1.2726188637303131e+00, 1.3004446354425814e+00,
+    1.3263797619078672e+00, 1.3505503858914829e+00, 1.3730891980503335e+00,
+    1.3941271581450432e+00, 1.4137891759241019e+00, 1.4321921415262548e+00,
+    1.4494444177524317e+00, 1.4656463529181596e+00, 1.4808916872537832e+00,
+    1.4952699969451997e+00, 1.5088706128796283e+00, 1.5217888238659700e+00,
+    1.5341356863742299e+00, 1.5460534780790132e+00, 1.5577398052717297e+00,
+    1.5694846038807690e+00, 1.5817255752511239e+00, 1.5951282822896522e+00,
+    1.6106952964664736e+00, 1.6298999429637782e+00, 1.6548153050454117e+00,
+    1.0000000000000000e+00, 1.0070985251967508e+00, 1.0334901845782689e+00,
+    1.0677616571387427e+00, 1.1046408530666414e+00, 1.1415698233026357e+00,
+    1.1773011428431868e+00, 1.2112549596081290e+00, 1.2432019788021547e+00,
+    1.2730989850879144e+00, 1.3010004159677495e+00, 1.3270096865076817e+00,
+    1.3512520529512637e+00, 1.3738594715906056e+00, 1.3949622769287053e+00,
+    1.4146847963361451e+00, 1.4331432664425678e+00, 1.4504451201872266e+00,
+    1.4666891279793248e+00, 1.4819661383646743e+00, 1.4963603509133674e+00,
+    1.5099512159040109e+00, 1.5228162278775101e+00, 1.5350350950612637e+00,
+    1.5466960564332377e+00, 1.5579055174343421e+00, 1.5688027170239955e+00,
+    1.5795818379355648e+00, 1.5905247802036526e+00, 1.6020485122808423e+00,
+    1.6147708488809200e+00, 1.6295961137924260e+00, 1.6478140963805175e+00,
+    1.6711859729669694e+00, 1.0000000000000000e+00, 1.0071032465130727e+00,
+    1.0335166593639573e+00, 1.0678234501326778e+00, 1.1047485008957090e+00,
+    1.1417312804326034e+00, 1.1775221823899937e+00, 1.2115395167617673e+00,
+    1.2435524407171332e+00, 1.2735164356569559e+00, 1.3014848439140203e+00,
+    1.3275601636527086e+00, 1.3518668873454842e+00, 1.3745363375099635e+00,
+    1.3956983200494284e+00, 1.4154767066408742e+00, 1.4339873017486415e+00,
+    1.4513370466060593e+00, 1.4676240152872595e+00, 1.4829379006275241e+00,
+    1.4973608441509356e+00, 1.5109685776468349e+00, 1.5238319424459461e+00,
+    1.5360189563422595e+00, 1.5475977254485420e+00, 1.5586406671418469e+00,
+    1.5692307400004002e+00, 1.5794706867294104e+00, 1.5894967001388780e+00,
+    1.5994984111072938e+00, 1.6097475981950102e+00, 1.6206383035010246e+00,
+    1.6327405405629494e+00, 1.6468672514121272e+00, 1.6641471898804470e+00,
+    1.6860810248376272e+00, 9.9999999999999989e-01, 1.0071108466299754e+00,
+    1.0335593390079205e+00, 1.0679232325875598e+00, 1.1049226574692166e+00,
+    1.1419930395283933e+00, 1.1778813620642863e+00, 1.2120030622702924e+00,
+    1.2441248741271762e+00, 1.2742002318034464e+00, 1.3022807470296580e+00,
+    1.3284674566899419e+00, 1.3528836231085433e+00, 1.3756595376882188e+00,
+    1.3969241449178478e+00, 1.4168005939726309e+00, 1.4354040673131436e+00,
+    1.4528409287988417e+00, 1.4692086302738929e+00, 1.4845960477258966e+00,
+    1.4990840576878566e+00, 1.5127462517063186e+00, 1.5256497447823407e+00,
+    1.5378560770159297e+00, 1.5494222457577329e+00, 1.5604019455136799e+00,
+    1.5708471408264786e+00, 1.5808101594638502e+00, 1.5903465759622122e+00,
+    1.5995192657701915e+00, 1.6084041542604122e+00, 1.6170983658531835e+00,
+    1.6257316897716321e+00, 1.6344824898196522e+00, 1.6435993121717625e+00,
+    1.6534292950854230e+00, 1.6644536608430980e+00, 1.6773283305536817e+00,
+    1.6929228215185106e+00, 1.7123414487214235e+00, 9.9999999999999989e-01,
+    1.0071166552307167e+00, 1.0335920096096876e+00, 1.0679997534640115e+00,
+    1.1050564885656597e+00, 1.1421946484600520e+00, 1.1781586985897301e+00,
+    1.2123619580336444e+00, 1.2445693737065304e+00, 1.2747328664704096e+00,
+    1.3029027626227159e+00, 1.3291790052847527e+00, 1.3536839261272866e+00,
+    1.3765470261774939e+00, 1.3978965809993238e+00, 1.4178551758150064e+00,
+    1.4365375181582234e+00, 1.4540495682501506e+00, 1.4704884227070298e+00,
+    1.4859426175374966e+00, 1.5004926530213407e+00, 1.5142116255874534e+00,
+    1.5271659027952498e+00, 1.5394158101859625e+00, 1.5510163211097299e+00,
+    1.5620177577339793e+00, 1.5724665267723374e+00, 1.5824059296818809e+00,
+    1.5918771064446824e+00, 1.6009201968086726e+00, 1.6095758353703584e+00,
+    1.6178871396789993e+00, 1.6259024062169332e+00, 1.6336787997958866e+00,
+    1.6412874080468889e+00, 1.6488201303622003e+00, 1.6563989662538861e+00,
+    1.6641883281032341e+00, 1.6724109559568709e+00, 1.6813677170511783e+00,
+    1.6914607768050542e+00, 1.7032179158645111e+00, 1.7173125533285085e+00,
+    1.7345687217121935e+00, 9.9999999999999989e-01, 1.0071211839163596e+00,
+    1.0336175122399065e+00, 1.0680595692626875e+00, 1.1051612690966823e+00,
+    1.1423527727922331e+00, 1.1783766387722745e+00, 1.2126445850978327e+00,
+    1.2449202092322222e+00, 1.2751542888520251e+00, 1.3033961771277311e+00,
+    1.3297449856490775e+00, 1.3543223338642221e+00, 1.3772571123551978e+00,
+    1.3986770740440766e+00, 1.4187043578918448e+00, 1.4374532917889988e+00,
+    1.4550295139472951e+00, 1.4715298473940497e+00, 1.4870425922132819e+00,
+    1.5016480362518076e+00, 1.5154190666151688e+00, 1.5284218138308636e+00,
+    1.5407162910511325e+00, 1.5523570098036561e+00, 1.5633935662462271e+00,
+    1.5738712005616948e+00, 1.5838313389526295e+00, 1.5933121339995875e+00,
+    1.6023490259662601e+00, 1.6109753558681530e+00, 1.6192230716429625e+00,
+    1.6271235824902512e+00, 1.6347088343837819e+00, 1.6420127029625347e+00,
+    1.6490728294950718e+00, 1.6559330620968431e+00, 1.6626467076867419e+00,
+    1.6692808480943431e+00, 1.6759220198854914e+00, 1.6826835874117265e+00,
+    1.6897151231677214e+00, 1.6972139943199114e+00, 1.7054390442179794e+00,
+    1.7147255992435180e+00, 1.7254998019417249e+00, 1.7382882059982139e+00,
+    1.7537154885009381e+00, 1.0000000000000000e+00, 1.0071247881733798e+00,
+    1.0336378284426579e+00, 1.0681072728915719e+00, 1.1052449366420438e+00,
+    1.1424792108801445e+00, 1.1785511727275526e+00, 1.2128712994578874e+00,
+    1.2452021444093260e+00, 1.2754936013449916e+00, 1.3037942706231063e+00,
+    1.3302026192668304e+00, 1.3548397125549358e+00, 1.3778339633361558e+00,
+    1.3993127122384477e+00, 1.4193977425943767e+00, 1.4382030761822713e+00,
+    1.4558340885853958e+00, 1.4723873783024113e+00, 1.4879510537644358e+00,
+    1.5026052383944135e+00, 1.5164226752634706e+00, 1.5294693621361024e+00,
+    1.5418051776991017e+00, 1.5534844781691102e+00, 1.5645566548469851e+00,
+    1.5750666503285549e+00, 1.5850554357332225e+00, 1.5945604545925116e+00,
+    1.6036160416986860e+00, 1.6122538277854621e+00, 1.6205031438191364e+00,
+    1.6283914422891581e+00, 1.6359447575624211e+00, 1.6431882334845973e+00,
+    1.6501467543882158e+00, 1.6568457259502816e+00, 1.6633120653941267e+00,
+    1.6695754767623254e+00, 1.6756701066195454e+00, 1.6816366983284672e+00,
+    1.6875253877483556e+00, 1.6933993067045199e+00, 1.6993391762637746e+00,
+    1.7054490670640106e+00, 1.7118634559636206e+00, 1.7187555786283313e+00,
+    1.7263468052376456e+00, 1.7349162619628318e+00, 1.7448090700951184e+00,
+    1.7564402678691238e+00, 1.7702896976977964e+00, 1.0000000000000000e+00,
+    1.0071276988582634e+00, 1.0336542476899071e+00, 1.0681458602299985e+00,
+    1.1053126826786368e+00, 1.1425817024708604e+00, 1.1786928247678468e+00,
+    1.2130555474326881e+00, 1.2454316012045026e+00, 1.2757701843724907e+00,
+    1.3041193052442464e+00, 1.3305769236128406e+00, 1.3552636678325958e+00,
+    1.3783075728033463e+00, 1.3998356512950476e+00, 1.4199694018495936e+00,
+    1.4388225989014973e+00, 1.4565004035563129e+00, 1.4730992288608529e+00,
+    1.4887070234565303e+00, 1.5034037734936250e+00, 1.5172621040768659e+00,
+    1.5303479106844919e+00, 1.5427209808905025e+00, 1.5544355849376894e+00,
+    1.5655410248105615e+00, 1.5760821382054615e+00, 1.5860997578901392e+00,
+    1.5956311294489416e+00, 1.6047102919989189e+00, 1.6133684275789697e+00,
+    1.6216341858606718e+00, 1.6295339918263467e+00, 1.6370923452831088e+00,
+    1.6443321226884733e+00, 1.6512748939077402e+00, 1.6579412693695854e+00,
+    1.6643512968134604e+00, 1.6705249316285691e+00, 1.6764826108806330e+00,
+    1.6822459687175360e+00, 1.6878387401051593e+00, 1.6932879108216237e+00,
+    1.6986251841307245e+00, 1.7038888478675251e+00, 1.7091261381979272e+00,
+    1.7143962048705756e+00, 1.7197737815120469e+00, 1.7253536432926919e+00,
+    1.7312558764266750e+00, 1.7376318634332681e+00, 1.7446706668846761e+00,
+    1.7526051222494605e+00, 1.7617163717125242e+00, 1.7723347474065978e+00,
+    1.7848338770915757e+00, 1.0000000000000000e+00, 1.0071300838463479e+00,
+    1.0336677098027620e+00, 1.0681775205787292e+00, 1.1053683124269071e+00,
+    1.1426659398167349e+00, 1.1788093641792221e+00, 1.2132072964535801e+00,
+    1.2456208077720134e+00, 1.2759985396492914e+00, 1.3043880269033710e+00,
+    1.3308868237797535e+00, 1.3556152090578573e+00, 1.3787009146983378e+00,
+    1.4002706898584911e+00, 1.4204458030370397e+00, 1.4393398276215019e+00,
+    1.4570577489914243e+00, 1.4736958267870928e+00, 1.4893418760531503e+00,
+    1.5040757669790104e+00, 1.5179700243612630e+00, 1.5310904570799622e+00,
+    1.5434967777453343e+00, 1.5552431908449706e+00, 1.5663789387512086e+00,
+    1.5769488015888216e+00, 1.5869935509029147e+00, 1.5965503593527284e+00,
+    1.6056531699450467e+00, 1.6143330290274764e+00, 1.6226183876556597e+00,
+    1.6305353762080137e+00, 1.6381080573700086e+00, 1.6453586629394119e+00,
+    1.6523078203885779e+00, 1.6589747758282498e+00, 1.6653776210171074e+00,
+    1.6715335334255235e+00, 1.6774590401717397e+00, 1.6831703189941036e+00,
+    1.6886835524033572e+00, 1.6940153548768486e+00, 1.6991832975073868e+00,
+    1.7042065599700451e+00, 1.7091067460168123e+00, 1.7139089058097166e+00,
+    1.7186428158567322e+00, 1.7233445742687030e+00, 1.7280585738957692e+00,
+    1.7328399157795205e+00, 1.7377573154925354e+00, 1.7428965276575707e+00,
+    1.7483642574858047e+00, 1.7542924254892696e+00, 1.7608424796758246e+00,
+    1.7682091812541156e+00, 1.7766229000328948e+00, 1.7863489374200470e+00,
+    1.7976817912819405e+00, 1.0000000000000000e+00, 1.0071320631239935e+00,
+    1.0336788875730762e+00, 1.0682038240899290e+00, 1.1054145606962595e+00,
+    1.1427360235646251e+00, 1.1789064024784981e+00, 1.2133337662872379e+00,
+    1.2457786489848037e+00, 1.2761892394756722e+00, 1.3046126881891855e+00,
+    1.3311462204031612e+00, 1.3559098313626097e+00, 1.3790310071366585e+00,
+    1.4006362825387790e+00, 1.4208467384777772e+00, 1.4397757837087553e+00,
+    1.4575282589037906e+00, 1.4742002964717424e+00, 1.4898795996954914e+00,
+    1.5046459407951280e+00, 1.5185717589469192e+00, 1.5317227884639941e+00,
+    1.5441586772107110e+00, 1.5559335734885429e+00, 1.5670966706435507e+00,
+    1.5776927052560989e+00, 1.5877624086679818e+00, 1.5973429138226798e+00,
+    1.6064681205912501e+00, 1.6151690233378375e+00, 1.6234740047037766e+00,
+    1.6314090996232464e+00, 1.6389982335339215e+00, 1.6462634386844710e+00,
+    1.6532250524176695e+00, 1.6599019013604557e+00, 1.6663114756126092e+00,
+    1.6724700973229480e+00, 1.6783930885067682e+00, 1.6840949436235613e+00,
+    1.6895895133378798e+00, 1.6948902070707743e+00, 1.7000102234622196e+00,
+    1.7049628197575026e+00, 1.7097616334537438e+00, 1.7144210723407678e+00,
+    1.7189567923680178e+00, 1.7233862865488663e+00, 1.7277296122792012e+00,
+    1.7320102887638236e+00, 1.7362564002425267e+00, 1.7405019435379101e+00,
+    1.7447884586582707e+00, 1.7491669764159334e+00, 1.7537003035533876e+00,
+    1.7584656381176060e+00, 1.7635574577471169e+00, 1.7690905402584436e+00,
+    1.7752028459935572e+00, 1.7820578006938845e+00, 1.7898452564909715e+00,
+    1.7987800822490552e+00, 1.8090969816913609e+00, 1.0000000000000000e+00,
+    1.0071337260453741e+00, 1.0336882827467999e+00, 1.0682259436732779e+00,
+    1.1054534742574953e+00, 1.1427950291999145e+00, 1.1789881581919541e+00,
+    1.2134403984899806e+00, 1.2459118402322731e+00, 1.2763502989762272e+00,
+    1.3048026085563078e+00, 1.3313657236063505e+00, 1.3561594062486313e+00,
+    1.3793109403745525e+00, 1.4009466844199510e+00, 1.4211875646716190e+00,
+    1.4401468538193987e+00, 1.4579292724784139e+00, 1.4746308469612850e+00,
+    1.4903391867532507e+00, 1.5051339812083697e+00, 1.5190875964244122e+00,
+    1.5322657024422182e+00, 1.5447278907886637e+00, 1.5565282605508532e+00,
+    1.5677159621795236e+00, 1.5783356948232736e+00, 1.5884281568769991e+00,
+    1.5980304516285242e+00, 1.6071764510552606e+00, 1.6158971213638318e+00,
+    1.6242208140355114e+00, 1.6321735261004733e+00, 1.6397791332163791e+00,
+    1.6470595989371200e+00, 1.6540351633672759e+00, 1.6607245142353122e+00,
+    1.6671449433027266e+00, 1.6733124909725834e+00, 1.6792420819816118e+00,
+    1.6849476551682470e+00, 1.6904422905176690e+00, 1.6957383370099952e+00,
+    1.7008475452564498e+00, 1.7057812095216025e+00, 1.7105503245205920e+00,
+    1.7151657633747159e+00, 1.7196384843337320e+00, 1.7239797753543451e+00,
+    1.7282015473825403e+00, 1.7323166892293103e+00, 1.7363394992378129e+00,
+    1.7402862114509603e+00, 1.7441756365628451e+00, 1.7480299403093997e+00,
+    1.7518755836618614e+00, 1.7557444494644596e+00, 1.7596751777890505e+00,
+    1.7637147253930456e+00, 1.7679201504930795e+00, 1.7723605986562685e+00,
+    1.7771194236145138e+00, 1.7822963114675880e+00, 1.7880091804382929e+00,
+    1.7943954942633800e+00, 1.8016124530923272e+00, 1.8098353202287782e+00,
+    1.8192529366848182e+00, 9.9999999999999989e-01, 1.0071351337318775e+00,
+    1.0336962387449886e+00, 1.0682446826938594e+00, 1.1054864561272231e+00,
+    1.1428450667663768e+00, 1.1790575284011220e+00, 1.2135309340131544e+00,
+    1.2460250034578122e+00, 1.2764872413698285e+00, 1.3049642183378012e+00,
+    1.3315526642508997e+00, 1.3563721478251054e+00, 1.3795497852945073e+00,
+    1.4012117888130100e+00, 1.4214789563229331e+00, 1.4404644473891657e+00,
+    1.4582728825586013e+00, 1.4750001993986699e+00, 1.4907339285712318e+00,
+    1.5055536893853252e+00, 1.5195317857276645e+00, 1.5327338324699844e+00,
+    1.5452193723335594e+00, 1.5570424613651213e+00, 1.5682522121912068e+00,
+    1.5788932908217397e+00, 1.5890063666527039e+00, 1.5986285175129040e+00,
+    1.6077935927585141e+00, 1.6165325379468964e+00, 1.6248736847723824e+00,
+    1.6328430098813944e+00, 1.6404643660029858e+00, 1.6477596885963461e+00,
+    1.6547491809685908e+00, 1.6614514805783633e+00, 1.6678838090288366e+00,
+    1.6740621080774247e+00, 1.6800011638554408e+00, 1.6857147214044179e+00,
+    1.6912155916014866e+00, 1.6965157525691639e+00, 1.7016264477510246e+00,
+    1.7065582829909924e+00, 1.7113213251888875e+00, 1.7159252054285565e+00,
+    1.7203792298989136e+00, 1.7246925024660971e+00, 1.7288740634205146e+00,
+    1.7329330497309465e+00, 1.7368788831016964e+00, 1.7407214932575321e+00,
+    1.7444715851754380e+00, 1.7481409604268316e+00, 1.7517429043477275e+00,
+    1.7552926523318220e+00, 1.7588079499890383e+00, 1.7623097229695837e+00,
+    1.7658228725017522e+00, 1.7693772114803614e+00, 1.7730085522889756e+00,
+    1.7767599500128863e+00, 1.7806830912802079e+00, 1.7848397969256566e+00,
+    1.7893035725156490e+00, 1.7941610904057721e+00, 1.7995134162777562e+00,
+    1.8054766991417888e+00, 1.8121819274803210e+00, 1.8197732243739004e+00,
+    1.8284040338275909e+00, 1.0000000000000000e+00, 1.0071363348484332e+00,
+    1.0337030293122400e+00, 1.0682606823720269e+00, 1.1055146278412686e+00,
+    1.1428878258428876e+00, 1.1791168372632903e+00, 1.2136083802227475e+00,
+    1.2461218626683137e+00, 1.2766045277627369e+00, 1.3051027250633522e+00,
+    1.3317129960172731e+00, 1.3565547473568427e+00, 1.3797549550055064e+00,
+    1.4014397087340844e+00, 1.4217296990847559e+00, 1.4407379908774296e+00,
+    1.4585691207175919e+00, 1.4753189515522083e+00, 1.4910749475477834e+00,
+    1.5059166686708925e+00, 1.5199163658210939e+00, 1.5331396065766876e+00,
+    1.5456458915028615e+00, 1.5574892391510435e+00, 1.5687187288947639e+00,
+    1.5793789973531804e+00, 1.5895106880331125e+00, 1.5991508560146772e+00,
+    1.6083333306619600e+00, 1.6170890398635946e+00, 1.6254462994530710e+00,
+    1.6334310713841398e+00, 1.6410671940432195e+00, 1.6483765878298029e+00,
+    1.6553794388663485e+00, 1.6620943634335841e+00, 1.6685385554798893e+00,
+    1.6747279193318805e+00, 1.6806771895421180e+00, 1.6864000396517012e+00,
+    1.6919091815212843e+00, 1.6972164567957433e+00, 1.7023329220158536e+00,
+    1.7072689288773029e+00, 1.7120342011650480e+00, 1.7166379099628000e+00,
+    1.7210887488574442e+00, 1.7253950110309861e+00, 1.7295646703649579e+00,
+    1.7336054689799854e+00, 1.7375250140051193e+00, 1.7413308868249369e+00,
+    1.7450307685954352e+00, 1.7486325864594947e+00, 1.7521446856322347e+00,
+    1.7555760333649679e+00, 1.7589364617214753e+00, 1.7622369570851544e+00,
+    1.7654900053066664e+00, 1.7687100023075824e+00, 1.7719137406247918e+00,
+    1.7751209825764331e+00, 1.7783551300909677e+00, 1.7816439992324371e+00,
+    1.7850207033081003e+00, 1.7885246410856466e+00, 1.7922025746317722e+00,
+    1.7961097627548424e+00, 1.8003110887575471e+00, 1.8048820827637937e+00,
+    1.8099096871636560e+00, 1.8154925478818476e+00, 1.8217405363301464e+00,
+    1.8287731246804837e+00, 1.8367161670239260e+00, 9.9999999999999989e-01,
+    1.0071382669983460e+00, 1.0337139567999289e+00, 1.0682864401944512e+00,
+    1.1055600031578048e+00, 1.1429567335681217e+00, 1.1792124722719706e+00,
+    1.2137333426620762e+00, 1.2462782589223638e+00, 1.2767940512231184e+00,
+    1.3053267207725112e+00, 1.3319725126408002e+00, 1.3568505792584422e+00,
+    1.3800876765935046e+00, 1.4018097027566092e+00, 1.4221371801657152e+00,
+    1.4411830252893527e+00, 1.4590516431612337e+00, 1.4758387795403609e+00,
+    1.4916317938589772e+00, 1.5065101522375264e+00, 1.5205460213384139e+00,
+    1.5338048930583157e+00, 1.5463461999607087e+00, 1.5582238995393471e+00,
+    1.5694870164269461e+00, 1.5801801382742628e+00, 1.5903438649077859e+00,
+    1.6000152125704055e+00, 1.6092279762061421e+00, 1.6180130532726913e+00,
+    1.6263987327078453e+00, 1.6344109525975039e+00, 1.6420735298931883e+00,
+    1.6494083652678784e+00, 1.6564356259177675e+00, 1.6631739088374498e+00,
+    1.6696403868291929e+00, 1.6758509392609509e+00, 1.6818202693654292e+00,
+    1.6875620096748780e+00, 1.6930888170133076e+00, 1.6984124583182783e+00,
+    1.7035438884374103e+00, 1.7084933209388236e+00, 1.7132702928889454e+00,
+    1.7178837244847078e+00, 1.7223419743791797e+00, 1.7266528915104049e+00,
+    1.7308238642322831e+00, 1.7348618675545096e+00, 1.7387735093264995e+00,
+    1.7425650762491880e+00, 1.7462425806702060e+00, 1.7498118092141124e+00,
+    1.7532783744221943e+00, 1.7566477707288175e+00, 1.7599254362858172e+00,
+    1.7631168223654079e+00, 1.7662274723287974e+00, 1.7692631124427896e+00,
+    1.7722297571610157e+00, 1.7751338318576471e+00, 1.7779823164031678e+00,
+    1.7807829133921382e+00, 1.7835442452497861e+00, 1.7862760848233887e+00,
+    1.7889896243502241e+00, 1.7916977878046094e+00, 1.7944155914406061e+00,
+    1.7971605566910465e+00, 1.7999531782136942e+00, 1.8028174474594714e+00,
+    1.8057814282323958e+00, 1.8088778747457861e+00, 1.8121448739534476e+00,
+    1.8156264816337835e+00, 1.8193733049794718e+00, 1.8234429625635309e+00,
+    1.8279003251958941e+00, 1.8328174089264662e+00, 1.8382727564743744e+00,
+    1.8443501104098226e+00, 1.8511361588528010e+00, 1.0000000000000000e+00,
+    1.0071397387363887e+00, 1.0337222836784923e+00, 1.0683060769833079e+00,
+    1.1055946136265209e+00, 1.1430093242883228e+00, 1.1792855084807405e+00,
+    1.2138288435593527e+00, 1.2463978743638791e+00, 1.2769391229864488e+00,
+    1.3054983315018565e+00, 1.3321715251088202e+00, 1.3570776680619239e+00,
+    1.3803433539382333e+00, 1.4020943396117402e+00, 1.4224510237745180e+00,
+    1.4415262137974765e+00, 1.4594242179514121e+00, 1.4762406957310878e+00,
+    1.4920629293244276e+00, 1.5069703154290714e+00, 1.5210349581289238e+00,
+    1.5343222927844622e+00, 1.5468917008027219e+00, 1.5587970933494641e+00,
+    1.5700874530954383e+00, 1.5808073297039087e+00, 1.5909972886529791e+00,
+    1.6006943151848210e+00, 1.6099321763323311e+00, 1.6187417444975234e+00,
+    1.6271512861988822e+00, 1.6351867195265375e+00, 1.6428718436439851e+00,
+    1.6502285434147366e+00, 1.6572769719497509e+00, 1.6640357135886690e+00,
+    1.6705219295582014e+00, 1.6767514883005454e+00, 1.6827390822370603e+00,
+    1.6884983325280176e+00, 1.6940418832074726e+00, 1.6993814859121696e+00,
+    1.7045280762830191e+00, 1.7094918429954429e+00, 1.7142822902690424e+00,
+    1.7189082946162288e+00, 1.7233781565118722e+00, 1.7276996476009563e+00,
+    1.7318800540071497e+00, 1.7359262162618165e+00, 1.7398445663390809e+00,
+    1.7436411622582459e+00, 1.7473217206995395e+00, 1.7508916480726637e+00,
+    1.7543560704805352e+00, 1.7577198630323381e+00, 1.7609876789819039e+00,
+    1.7641639791992456e+00, 1.7672530625259200e+00, 1.7702590976196053e+00,
+    1.7731861569604574e+00, 1.7760382537729449e+00, 1.7788193827122962e+00,
+    1.7815335652762287e+00, 1.7841849010299415e+00, 1.7867776258766133e+00,
+    1.7893161787661001e+00, 1.7918052784092950e+00, 1.7942500117524576e+00,
+    1.7966559361579713e+00, 1.7990291974267900e+00, 1.8013766659691672e+00,
+    1.8037060935612188e+00, 1.8060262931859952e+00, 1.8083473444023803e+00,
+    1.8106808264521117e+00, 1.8130400808182465e+00, 1.8154405040731814e+00,
+    1.8178998704494151e+00, 1.8204386814391527e+00, 1.8230805366394343e+00,
+    1.8258525157228156e+00, 1.8287855555096306e+00, 1.8319147983202009e+00,
+    1.8352798778166086e+00, 1.8389250962739156e+00, 1.8428994328188211e+00,
+    1.8472563063340066e+00, 1.8520530009597542e+00, 1.8573496491070560e+00,
+    1.8632076607919492e+00, 1.0000000000000000e+00, 1.0071408868974434e+00,
+    1.0337287817874041e+00, 1.0683214065068283e+00, 1.1056216432487254e+00,
+    1.1430504143407787e+00, 1.1793426013064601e+00, 1.2139035377862648e+00,
+    1.2464914846317197e+00, 1.2770527276137236e+00, 1.3056328105203721e+00,
+    1.3323275907270342e+00, 1.3572558892106823e+00, 1.3805441761919315e+00,
+    1.4023181014851374e+00, 1.4226979701662952e+00, 1.4417965071755203e+00,
+    1.4597179477403430e+00, 1.4765578862600712e+00, 1.4924035466150696e+00,
+    1.5073342730432762e+00, 1.5214221222503888e+00, 1.5347324866717835e+00,
+    1.5473247087242497e+00, 1.5592526640882287e+00, 1.5705653030952220e+00,
+    1.5813071459138830e+00, 1.5915187311173304e+00, 1.6012370194148255e+00,
+    1.6104957554911026e+00, 1.6193257914214649e+00, 1.6277553752746845e+00,
+    1.6358104084379153e+00, 1.6435146749981286e+00, 1.6508900462543923e+00,
+    1.6579566631527443e+00, 1.6647330991524001e+00, 1.6712365057617409e+00,
+    1.6774827427316041e+00, 1.6834864946644665e+00, 1.6892613755926220e+00,
+    1.6948200228948187e+00, 1.7001741817586884e+00, 1.7053347812530728e+00,
+    1.7103120029488947e+00, 1.7151153429173074e+00, 1.7197536678379290e+00,
+    1.7242352658664741e+00, 1.7285678928385844e+00, 1.7327588143238619e+00,
+    1.7368148439900513e+00, 1.7407423786908698e+00, 1.7445474306516116e+00,
+    1.7482356570933906e+00, 1.7518123876095275e+00, 1.7552826495852734e+00,
+    1.7586511919350081e+00, 1.7619225074183458e+00, 1.7651008537887871e+00,
+    1.7681902740249262e+00, 1.7711946158952492e+00, 1.7741175511130847e+00,
+    1.7769625943484670e+00, 1.7797331223787822e+00, 1.7824323936802975e+00,
+    1.7850635687885212e+00, 1.7876297317867327e+00, 1.7901339133200991e+00,
+    1.7925791155770066e+00, 1.7949683397308078e+00, 1.7973046163939985e+00,
+    1.7995910397029966e+00, 1.8018308057255039e+00, 1.8040272559632877e+00,
+    1.8061839268100877e+00, 1.8083046059160370e+00, 1.8103933965031733e+00,
+    1.8124547907677393e+00, 1.8144937535871044e+00, 1.8165158178136227e+00,
+    1.8185271924716633e+00, 1.8205348851592349e+00, 1.8225468398682521e+00,
+    1.8245720912440420e+00, 1.8266209359632271e+00, 1.8287051213622907e+00,
+    1.8308380506270137e+00, 1.8330350026665809e+00, 1.8353133631398615e+00,
+    1.8376928608515444e+00, 1.8401958007585415e+00, 1.8428472809871195e+00,
+    1.8456753764451168e+00, 1.8487112657636500e+00, 1.8519892714699464e+00,
+    1.8555467757153641e+00, 1.8594239660812077e+00, 1.8636633588877065e+00,
+    1.8683090424924824e+00, 1.8734055823568230e+00, 9.9999999999999989e-01,
+    1.0071417962451905e+00, 1.0337339295464092e+00, 1.0683335538251415e+00,
+    1.1056430686370580e+00, 1.1430829964172524e+00, 1.1793878903579793e+00,
+    1.2139628145588719e+00, 1.2465658075810848e+00, 1.2771429705898878e+00,
+    1.3057396928120950e+00, 1.3324517011000392e+00, 1.3573977052506139e+00,
+    1.3807040799770343e+00, 1.4024963923815303e+00, 1.4228948753572113e+00,
+    1.4420121903962733e+00, 1.4599525165842975e+00, 1.4768113983397178e+00,
+    1.4926760148003280e+00, 1.5076256699516584e+00, 1.5217323841271420e+00,
+    1.5350615167698223e+00, 1.5476723802716690e+00, 1.5596188229139547e+00,
+    1.5709497699697876e+00, 1.5817097186515092e+00, 1.5919391864769039e+00,
+    1.6016751148304926e+00, 1.6109512306575196e+00, 1.6197983697542415e+00,
+    1.6282447652627010e+00, 1.6363163049010605e+00, 1.6440367602612613e+00,
+    1.6514279912459606e+00, 1.6585101284343395e+00, 1.6653017358834998e+00,
+    1.6718199566019876e+00, 1.6780806426808548e+00, 1.6840984718388701e+00,
+    1.6898870519324301e+00, 1.6954590147971769e+00, 1.7008261006253109e+00,
+    1.7059992339391481e+00, 1.7109885920950376e+00, 1.7158036671410335e+00,
+    1.7204533217545919e+00, 1.7249458399017583e+00, 1.7292889727850118e+00,
+    1.7334899805821977e+00, 1.7375556704224284e+00, 1.7414924309955151e+00,
+    1.7453062641485695e+00, 1.7490028137861915e+00, 1.7525873923582322e+00,
+    1.7560650051912587e+00, 1.7594403728959369e+00, 1.7627179520619527e+00,
+    1.7659019544351429e+00, 1.7689963647569620e+00, 1.7720049574351218e+00,
+    1.7749313122050787e+00, 1.7777788289356762e+00, 1.7805507417278910e+00,
+    1.7832501324539214e+00, 1.7858799438841813e+00, 1.7884429925525462e+00,
+    1.7909419815153476e+00, 1.7933795131671715e+00, 1.7957581022866604e+00,
+    1.7980801894985152e+00, 1.8003481553533496e+00, 1.8025643352461020e+00,
+    1.8047310354154085e+00, 1.8068505502916641e+00, 1.8089251814904346e+00,
+    1.8109572587799712e+00, 1.8129491633877952e+00, 1.8149033540507131e+00,
+    1.8168223962553467e+00, 1.8187089951616939e+00, 1.8205660327497306e+00,
+    1.8223966097764983e+00, 1.8242040931776786e+00, 1.8259921695893535e+00,
+    1.8277649056985823e+00, 1.8295268161507932e+00, 1.8312829397385781e+00,
+    1.8330389245614340e+00, 1.8348011227649186e+00, 1.8365766953231837e+00,
+    1.8383737270984848e+00, 1.8402013520664739e+00, 1.8420698881017468e+00,
+    1.8439909800321439e+00, 1.8459777487424081e+00, 1.8480449428822383e+00,
+    1.8502090881497719e+00, 1.8524886271206316e+00, 1.8549040401237282e+00,
+    1.8574779347035544e+00, 1.8602350877700309e+00, 1.8632024207111968e+00,
+    1.8664088837283936e+00, 1.8698852217986281e+00, 1.8736635915264046e+00,
+    1.8777769965123654e+00, 1.8822585097958062e+00, 1.0000000000000000e+00,
+    1.0071425284376181e+00, 1.0337380752325063e+00, 1.0683433386884391e+00,
+    1.1056603314802282e+00, 1.1431092558134537e+00, 1.1794244022707725e+00,
+    1.2140106196623384e+00, 1.2466257692767624e+00, 1.2772158053130127e+00,
+    1.3058259941791370e+00, 1.3325519592145136e+00, 1.3575123222233245e+00,
+    1.3808333824865795e+00, 1.4026406419139050e+00, 1.4230542766170653e+00,
+    1.4421868982700121e+00, 1.4601426419494101e+00, 1.4770170129493421e+00,
+    1.4928971554221611e+00, 1.5078623419021127e+00, 1.5219845643121781e+00,
+    1.5353291563211631e+00, 1.5479554068493564e+00, 1.5599171427323397e+00,
+    1.5712632695931172e+00, 1.5820382665966259e+00, 1.5922826346536711e+00,
+    1.6020332998450291e+00, 1.6113239749988510e+00, 1.6201854828813740e+00,
+    1.6286460446061397e+00, 1.6367315367903748e+00, 1.6444657207881925e+00,
+    1.6518704470709564e+00, 1.6589658375428236e+00, 1.6657704482969897e+00,
+    1.6723014150479327e+00, 1.6785745832241004e+00, 1.6846046244765651e+00,
+    1.6904051411532643e+00, 1.6959887601047059e+00, 1.7013672170241450e+00,
+    1.7065514323814279e+00, 1.7115515798833811e+00, 1.7163771482823891e+00,
+    1.7210369972577231e+00, 1.7255394080087438e+00, 1.7298921291245650e+00,
+    1.7341024182294731e+00, 1.7381770798461602e+00, 1.7421224998688454e+00,
+    1.7459446769945350e+00, 1.7496492514222999e+00, 1.7532415310968832e+00,
+    1.7567265157435898e+00, 1.7601089189156527e+00, 1.7633931882528489e+00,
+    1.7665835241305634e+00, 1.7696838968614101e+00, 1.7726980625968747e+00,
+    1.7756295780635540e+00, 1.7784818142579750e+00, 1.7812579692145121e+00,
+    1.7839610799535714e+00, 1.7865940337108681e+00, 1.7891595785439482e+00,
+    1.7916603334085290e+00, 1.7940987977950626e+00, 1.7964773610149285e+00,
+    1.7987983112258294e+00, 1.8010638442875249e+00, 1.8032760725417243e+00,
+    1.8054370336139902e+00, 1.8075486993408243e+00, 1.8096129849320421e+00,
+    1.8116317584864996e+00, 1.8136068509893233e+00, 1.8155400669299420e+00,
+    1.8174331956934950e+00, 1.8192880238929063e+00, 1.8211063488256596e+00,
+    1.8228899932577702e+00, 1.8246408217577981e+00, 1.8263607588256814e+00,
+    1.8280518090848290e+00, 1.8297160798307408e+00, 1.8313558062548649e+00,
+    1.8329733796881649e+00, 1.8345713792333844e+00, 1.8361526071773624e+00,
+    1.8377201285922420e+00, 1.8392773155455640e+00, 1.8408278963390459e+00,
+    1.8423760101808901e+00, 1.8439262676599364e+00, 1.8454838173246364e+00,
+    1.8470544185654232e+00, 1.8486445208439377e+00, 1.8502613490911897e+00,
+    1.8519129947914756e+00, 1.8536085118581529e+00, 1.8553580158667660e+00,
+    1.8571727845132575e+00, 1.8590653562821986e+00, 1.8610496232133629e+00,
+    1.8631409123232709e+00, 1.8653560486576422e+00, 1.8677133911281696e+00,
+    1.8702328302590405e+00, 1.8729357348159394e+00, 1.8758448321568826e+00,
+    1.8789840052560447e+00, 1.8823779880348099e+00, 1.8860519403294560e+00,
+    1.8900308850858114e+00, 1.0000000000000000e+00, 1.0071431293891466e+00,
+    1.0337414783578092e+00, 1.0683513723641616e+00, 1.1056745077032186e+00,
+    1.1431308249249239e+00, 1.1794544002504856e+00, 1.2140499069584052e+00,
+    1.2466750619925442e+00, 1.2772757000601189e+00, 1.3058969878714470e+00,
+    1.3326344648848198e+00, 1.3576066817299022e+00, 1.3809398767877996e+00,
+    1.4027594994354391e+00, 1.4231856801161640e+00, 1.4423309905090533e+00,
+    1.4602995304204882e+00, 1.4771867738380029e+00, 1.4930798369574354e+00,
+    1.5080579672086003e+00, 1.5221931338558234e+00, 1.5355506500216329e+00,
+    1.5481897859173981e+00, 1.5601643512791505e+00, 1.5715232360497284e+00,
+    1.5823109049742730e+00, 1.5925678456704166e+00, 1.6023309719393914e+00,
+    1.6116339852475738e+00, 1.6205076978354520e+00, 1.6289803210568579e+00,
+    1.6370777224751167e+00, 1.6448236550441595e+00, 1.6522399614435537e+00,
+    1.6593467563543769e+00, 1.6661625891804170e+00, 1.6727045894492725e+00,
+    1.6789885968769707e+00, 1.6850292778510507e+00, 1.6908402298811065e+00,
+    1.6964340753821507e+00, 1.7018225459932117e+00, 1.7070165584899093e+00,
+    1.7120262832232269e+00, 1.7168612059056125e+00, 1.7215301834682228e+00,
+    1.7260414946277685e+00, 1.7304028857266545e+00, 1.7346216123446756e+00,
+    1.7387044771232607e+00, 1.7426578641928814e+00, 1.7464877705502757e+00,
+    1.7501998346934788e+00, 1.7537993627886992e+00, 1.7572913526132359e+00,
+    1.7606805154925624e+00, 1.7639712964264893e+00, 1.7671678925792138e+00,
+    1.7702742702901819e+00, 1.7732941807469911e+00, 1.7762311744478552e+00,
+    1.7790886145690561e+00, 1.7818696893421635e+00, 1.7845774235366882e+00,
+    1.7872146891356486e+00, 1.7897842152848031e+00, 1.7922885975900602e+00,
+    1.7947303068328715e+00, 1.7971116971690044e+00, 1.7994350138727553e+00,
+    1.8017024006860973e+00, 1.8039159068302473e+00, 1.8060774937359179e+00,
+    1.8081890415480770e+00, 1.8102523554610250e+00, 1.8122691719405373e+00,
+    1.8142411648912671e+00, 1.8161699518298413e+00, 1.8180571001269710e+00,
+    1.8199041333857215e+00, 1.8217125380273684e+00, 1.8234837701617568e+00,
+    1.8252192628251886e+00, 1.8269204336757936e+00, 1.8285886932445068e+00,
+    1.8302254538486407e+00, 1.8318321392847938e+00, 1.8334101954289395e+00,
+    1.8349611018831946e+00, 1.8364863848214221e+00, 1.8379876311993684e+00,
+    1.8394665045089464e+00, 1.8409247622706573e+00, 1.8423642754723990e+00,
+    1.8437870501765397e+00, 1.8451952515295102e+00, 1.8465912304179295e+00,
+    1.8479775530219706e+00, 1.8493570335172709e+00, 1.8507327701703287e+00,
+    1.8521081850554026e+00, 1.8534870675898192e+00, 1.8548736220354256e+00,
+    1.8562725190406226e+00, 1.8576889511933183e+00, 1.8591286924125037e+00,
+    1.8605981608149782e+00, 1.8621044844430981e+00, 1.8636555689168552e+00,
+    1.8652601656655114e+00, 1.8669279388862712e+00, 1.8686695287566126e+00,
+    1.8704966076820242e+00, 1.8724219254856724e+00, 1.8744593384428228e+00,
+    1.8766238159469499e+00, 1.8789314174004403e+00, 1.8813992307129810e+00,
+    1.8840452626619000e+00, 1.8868882704616972e+00, 1.8899475233963861e+00,
+    1.8932424835323365e+00, 1.8967923956471746e+00, 1.0000000000000000e+00,
+    1.0071436340005462e+00, 1.0337443362858190e+00, 1.0683581200092958e+00,
+    1.1056864166102256e+00, 1.1431489477487349e+00, 1.1794796104714824e+00,
+    1.2140829314830033e+00, 1.2467165073313244e+00, 1.2773260731839815e+00,
+    1.3059567128170968e+00, 1.3327038960182567e+00, 1.3576861143964667e+00,
+    1.3810295559183894e+00, 1.4028596265494964e+00, 1.4232964190611936e+00,
+    1.4424524721989160e+00, 1.4604318567755648e+00, 1.4773300210852660e+00,
+    1.4932340584140709e+00, 1.5082231956464509e+00, 1.5223693835236745e+00,
+    1.5357379183866438e+00, 1.5483880551747937e+00, 1.5603735896697011e+00,
+    1.5717433990170613e+00, 1.5825419361880539e+00, 1.5928096779367429e+00,
+    1.6025835280158927e+00, 1.6118971785776883e+00, 1.6207814332138524e+00,
+    1.6292644952360016e+00, 1.6373722247212030e+00, 1.6451283676494799e+00,
+    1.6525547602010628e+00, 1.6596715109993414e+00, 1.6664971638033217e+00,
+    1.6730488428833821e+00, 1.6793423830634520e+00, 1.6853924461840537e+00,
+    1.6912126255347999e+00, 1.6968155396212885e+00, 1.7022129164684978e+00,
+    1.7074156695191052e+00, 1.7124339660586292e+00, 1.7172772889882422e+00,
+    1.7219544926687789e+00, 1.7264738534740234e+00, 1.7308431156166912e+00,
+    1.7350695327449741e+00, 1.7391599057501768e+00, 1.7431206171756406e+00,
+    1.7469576625730179e+00, 1.7506766791132671e+00, 1.7542829717256068e+00,
+    1.7577815370078453e+00, 1.7611770851250848e+00, 1.7644740598905755e+00,
+    1.7676766572020999e+00, 1.7707888419891380e+00, 1.7738143638101449e+00,
+    1.7767567712251817e+00, 1.7796194250566422e+00, 1.7824055106398806e+00,
+    1.7851180491557153e+00, 1.7877599081282216e+00, 1.7903338111636329e+00,
+    1.7928423469994570e+00, 1.7952879779269861e+00, 1.7976730476452940e+00,
+    1.7999997886002153e+00, 1.8022703288579347e+00, 1.8044866985594517e+00,
+    1.8066508359993396e+00, 1.8087645933697873e+00, 1.8108297422090747e+00,
+    1.8128479785919871e+00, 1.8148209280986907e+00, 1.8167501505978385e+00,
+    1.8186371448792769e+00, 1.8204833531719227e+00, 1.8222901655826684e+00,
+    1.8240589244931364e+00, 1.8257909289522067e+00, 1.8274874391039311e+00,
+    1.8291496806925400e+00, 1.8307788496885917e+00, 1.8323761170833117e+00,
+    1.8339426339016724e+00, 1.8354795364883740e+00, 1.8369879521255135e+00,
+    1.8384690050455537e+00, 1.8399238229084842e+00, 1.8413535438182316e+00,
+    1.8427593239596614e+00, 1.8441423459445820e+00, 1.8455038279625005e+00,
+    1.8468450338397904e+00, 1.8481672841189494e+00, 1.8494719682778449e+00,
+    1.8507605582171138e+00, 1.8520346231516260e+00, 1.8532958460490556e+00,
+    1.8545460417644224e+00, 1.8557871770235648e+00, 1.8570213924097549e+00,
+    1.8582510265050916e+00, 1.8594786423309451e+00, 1.8607070562170787e+00,
+    1.8619393692059427e+00, 1.8631790010638694e+00, 1.8644297269215382e+00,
+    1.8656957164986987e+00, 1.8669815757776362e+00, 1.8682923908721272e+00,
+    1.8696337736867625e+00, 1.8710119087698389e+00, 1.8724336005241831e+00,
+    1.8739063196470935e+00, 1.8754382473164488e+00, 1.8770383152189629e+00,
+    1.8787162390251577e+00, 1.8804825423541758e+00, 1.8823485676458420e+00,
+    1.8843264696825797e+00, 1.8864291868053269e+00, 1.8886703841878953e+00,
+    1.8910643629334030e+00, 1.8936259283184951e+00, 1.8963702103449711e+00,
+    1.8993124299980426e+00, 1.9024676054130469e+00, 1.0000000000000000e+00,
+    1.0071440456069800e+00, 1.0337466677184510e+00, 1.0683636252677395e+00,
+    1.1056961342021800e+00, 1.1431637381947057e+00, 1.1795001887029590e+00,
+    1.2141098934324450e+00, 1.2467503512802591e+00, 1.2773672167677714e+00,
+    1.3060055065607379e+00, 1.3327606341447231e+00, 1.3577510435020632e+00,
+    1.3811028819798707e+00, 1.4029415206224440e+00, 1.4233870219468563e+00,
+    1.4425518982934853e+00, 1.4605401972675993e+00, 1.4774473466302280e+00,
+    1.4933604213868485e+00, 1.5083586320513009e+00, 1.5225139146243987e+00,
+    1.5358915521070851e+00, 1.5485507873097402e+00, 1.5605454049384975e+00,
+    1.5719242719860798e+00, 1.5827318320833552e+00, 1.5930085533643388e+00,
+    1.6027913316039482e+00, 1.6121138515525131e+00, 1.6210069099194964e+00,
+    1.6294987036056323e+00, 1.6376150867071080e+00, 1.6453797996174171e+00,
+    1.6528146732937854e+00, 1.6599398114733677e+00, 1.6667737533423785e+00,
+    1.6733336188914136e+00, 1.6796352389396860e+00, 1.6856932715821809e+00,
+    1.6915213066080199e+00, 1.6971319592547025e+00, 1.7025369545000855e+00,
+    1.7077472029502667e+00, 1.7127728692551158e+00, 1.7176234338721317e+00,
+    1.7223077489018934e+00, 1.7268340886331346e+00, 1.7312101953605998e+00,
+    1.7354433209734479e+00, 1.7395402647544771e+00, 1.7435074077802621e+00,
+    1.7473507442679832e+00, 1.7510759101761049e+00, 1.7546882093319034e+00,
+    1.7581926373288930e+00, 1.7615939034108299e+00, 1.7648964505357110e+00,
+    1.7681044737925442e+00, 1.7712219373257534e+00, 1.7742525899057575e+00,
+    1.7771999792703523e+00, 1.7800674653486783e+00, 1.7828582324686431e+00,
+    1.7855753006385546e+00, 1.7882215359850846e+00, 1.7907996604218004e+00,
+    1.7933122606155691e+00, 1.7957617963119474e+00, 1.7981506080752654e+00,
+    1.8004809244941538e+00, 1.8027548688989841e+00, 1.8049744656339279e+00,
+    1.8071416459228340e+00, 1.8092582533653212e+00, 1.8113260490967673e+00,
+    1.8133467166436423e+00, 1.8153218665037427e+00, 1.8172530404792149e+00,
+    1.8191417157888032e+00, 1.8209893089847684e+00, 1.8227971796989941e+00,
+    1.8245666342420777e+00, 1.8262989290790399e+00, 1.8279952742048544e+00,
+    1.8296568364431725e+00, 1.8312847426920065e+00, 1.8328800831403862e+00,
+    1.8344439144810267e+00, 1.8359772631447657e+00, 1.8374811285839912e+00,
+    1.8389564866335717e+00, 1.8404042929795428e+00, 1.8418254867680124e+00,
+    1.8432209943886866e+00, 1.8445917334703230e+00, 1.8459386171280130e+00,
+    1.8472625585055225e+00, 1.8485644756592952e+00, 1.8498452968345320e+00,
+    1.8511059661877753e+00, 1.8523474500147674e+00, 1.8535707435469735e+00,
+    1.8547768783848415e+00, 1.8559669306408579e+00, 1.8571420298703563e+00,
+    1.8583033688730122e+00, 1.8594522144524641e+00, 1.8605899192258373e+00,
+    1.8617179345782289e+00, 1.8628378248598447e+00, 1.8639512829240357e+00,
+    1.8650601471033741e+00, 1.8661664197168915e+00, 1.8672722871934584e+00,
+    1.8683801418843449e+00, 1.8694926056186132e+00, 1.8706125550293649e+00,
+    1.8717431486426392e+00, 1.8728878556731101e+00, 1.8740504864092764e+00,
+    1.8752352239909822e+00, 1.8764466572829459e+00, 1.8776898144237006e+00,
+    1.8789701964775392e+00, 1.8802938104333773e+00, 1.8816672005753028e+00,
+    1.8830974769918254e+00, 1.8845923396933166e+00, 1.8861600964694378e+00,
+    1.8878096722436202e+00, 1.8895506072782848e+00, 1.8913930411643249e+00,
+    1.8933476791131214e+00, 1.8954257366888123e+00, 1.8976388588138127e+00,
+    1.8999990087056586e+00, 1.9025183224251858e+00, 1.9052089250140278e+00,
+    1.9080827048619293e+00, 9.9999999999999989e-01, 1.0071444028341250e+00,
+    1.0337486913143799e+00, 1.0683684041178869e+00, 1.1057045705653792e+00,
+    1.1431765802610390e+00, 1.1795180587141114e+00, 1.2141333107578478e+00,
+    1.2467797509416889e+00, 1.2774029641928948e+00, 1.3060479093248210e+00,
+    1.3328099513442677e+00, 1.3578074932764330e+00, 1.3811666475843485e+00,
+    1.4030127553647895e+00, 1.4234658532279840e+00, 1.4426384309380038e+00,
+    1.4606345162880727e+00, 1.4775495195370982e+00, 1.4934705001316226e+00,
+    1.5084766546719186e+00, 1.5226399066473819e+00, 1.5360255277499131e+00,
+    1.5486927505182915e+00, 1.5606953502876104e+00, 1.5720821854659794e+00,
+    1.5828976917904245e+00, 1.5931823301114398e+00, 1.6029729894627218e+00,
+    1.6123033483379883e+00, 1.6212041976255496e+00, 1.6297037287984166e+00,
+    1.6378277908824324e+00, 1.6456001195270817e+00, 1.6530425412450696e+00,
+    1.6601751556052666e+00, 1.6670164978815767e+00, 1.6735836843905909e+00,
+    1.6798925425003168e+00, 1.6859577270636774e+00, 1.6917928248248379e+00,
+    1.6974104481627130e+00, 1.7028223193733913e+00, 1.7080393465494137e+00,
+    1.7130716919875337e+00, 1.7179288339454439e+00, 1.7226196224707055e+00,
+    1.7271523299396887e+00, 1.7315346968696583e+00, 1.7357739735016262e+00,
+    1.7398769575941790e+00, 1.7438500288181999e+00, 1.7476991800982598e+00,
+    1.7514300462076404e+00, 1.7550479298899162e+00, 1.7585578257499741e+00,
+    1.7619644421310934e+00, 1.7652722211711802e+00, 1.7684853572109165e+00,
+    1.7716078137083748e+00, 1.7746433387984073e+00, 1.7775954796211697e+00,
+    1.7804675955312488e+00, 1.7832628702878497e+00, 1.7859843233164159e+00,
+    1.7886348201232611e+00, 1.7912170819369240e+00, 1.7937336946427958e+00,
+    1.7961871170715389e+00, 1.7985796886959347e+00, 1.8009136367860590e+00,
+    1.8031910830680571e+00, 1.8054140499278601e+00, 1.8075844661976517e+00,
+    1.8097041725596696e+00, 1.8117749265991128e+00, 1.8137984075354292e+00,
+    1.8157762206589341e+00, 1.8177099014978482e+00, 1.8196009197389911e+00,
+    1.8214506829238486e+00, 1.8232605399404003e+00, 1.8250317843299815e+00,
+    1.8267656574273505e+00, 1.8284633513514796e+00, 1.8301260118636959e+00,
+    1.8317547411095523e+00, 1.8333506002601245e+00, 1.8349146120684621e+00,
+    1.8364477633566425e+00, 1.8379510074489660e+00, 1.8394252665669839e+00,
+    1.8408714342023778e+00, 1.8422903774841350e+00, 1.8436829395569370e+00,
+    1.8450499419886872e+00, 1.8463921872255855e+00, 1.8477104611144424e+00,
+    1.8490055355131354e+00, 1.8502781710111746e+00, 1.8515291197841370e+00,
+    1.8527591286072869e+00, 1.8539689420555032e+00, 1.8551593059187459e+00,
+    1.8563309708644389e+00, 1.8574846963805567e+00, 1.8586212550357653e+00,
+    1.8597414370954761e+00, 1.8608460555358590e+00, 1.8619359515004066e+00,
+    1.8630120002469526e+00, 1.8640751176358317e+00, 1.8651262672130990e+00,
+    1.8661664679452736e+00, 1.8671968026649131e+00, 1.8682184272881617e+00,
+    1.8692325808673822e+00, 1.8702405965422304e+00, 1.8712439134524126e+00,
+    1.8722440896733132e+00, 1.8732428162316275e+00, 1.8742419322519632e+00,
+    1.8752434412753756e+00, 1.8762495287776557e+00, 1.8772625808960524e+00,
+    1.8782852043492240e+00, 1.8793202475026445e+00, 1.8803708224914650e+00,
+    1.8814403282613932e+00, 1.8825324743247136e+00, 1.8836513049507519e+00,
+    1.8848012234157057e+00, 1.8859870158240595e+00, 1.8872138738805053e+00,
+    1.8884874158356231e+00, 1.8898137046500301e+00, 1.8911992622197962e+00,
+    1.8926510782818786e+00, 1.8941766123761710e+00, 1.8957837869860648e+00,
+    1.8974809697225163e+00, 1.8992769421709530e+00, 1.9011808528071812e+00,
+    1.9032021512314286e+00, 1.9053505009039700e+00, 1.9076356676285948e+00,
+    1.9100673812691029e+00, 1.9126551686461217e+00
+};
+
+
+
+const realtype rock4Finishing[45][15] =
+{
+    { 3.0573519256161907e-01, -3.6457234778406783e-01, 7.6461013123604038e-01,
+      -4.5717231951154007e-02, 1.6486804491102003e-01, 7.4787719440339240e-01,
+      -1.6061859385756667e-02, 4.6042745170535304e-01, 2.4600446942748605e-01, 1.3333422302622780e-01,
+      -1.1479175068006886e-02, 4.6507506665020210e-01, 2.2263275792893847e-01, 4.7475635262176588e-02, 1.0000000000000001e-01 },
+    { 3.0343066408638825e-01, -3.8430776927459231e-01, 6.8544307868935184e-01,
+      -3.1788651979599852e-01, 4.5693141592685160e-01, 6.7106422812704314e-01,
+      -3.4221118506589432e-02, 4.7501773455269747e-01, 1.9610817911267744e-01, 1.2603010293545547e-01,
+      -2.5370151648964639e-02, 4.5843256051393916e-01, 1.8926240221613755e-01, 4.0610087013129043e-02, 1.0000000000000001e-01 },
+    { 2.9362640727836758e-01, -3.7443214752126935e-01, 6.5868799482325402e-01,
+      -3.1293360930093361e-01, 4.5829436625015585e-01, 6.3274291679552364e-01,
+      -2.9292590653231643e-02, 4.5636250519776123e-01, 1.8443152879559685e-01, 1.2210574581103961e-01,
+      -2.0597172543388304e-02, 4.3957806004028654e-01, 1.7818688629400034e-01, 3.6439415360267458e-02, 1.0000000000000001e-01 },
+    { 2.9261924825917568e-01, -3.6407263906226645e-01, 6.3848705349258350e-01,
+      -3.0634464775571557e-01, 4.6212309215543457e-01, 6.0287932828052782e-01,
+      -1.8923792266030422e-02, 4.4151420638479438e-01, 1.7479351407840904e-01, 1.1958304482584574e-01,
+      -1.0764248410302490e-02, 4.2426686709051009e-01, 1.6999952622302941e-01, 3.3464828119781742e-02, 1.0000000000000001e-01 },
+    { 3.0127581901240913e-01, -3.6565490691110275e-01, 6.1048311425983171e-01,
+      -3.8025630944027938e-01, 5.4348792170098348e-01, 5.8294965228670026e-01,
+      -1.1311940286839194e-02, 4.4137514213092632e-01, 1.5937731159942742e-01, 1.1709006696820383e-01,
+      -4.4810189218863483e-03, 4.1817016608736274e-01, 1.6189419312927811e-01, 3.0947240116963724e-02, 1.0000000000000001e-01 },
+    { 3.0321370564961203e-01, -3.5996560143582190e-01, 5.9949588956012079e-01,
+      -3.7743331050223677e-01, 5.4703254441638527e-01, 5.6745892890255378e-01,
+      -3.6138513198522692e-03, 4.3352900474366635e-01, 1.5382874622348283e-01, 1.1577377080179817e-01,
+      2.4645614367382607e-03, 4.0986936042092853e-01, 1.5790974886729481e-01, 2.9273999724133776e-02, 1.0000000000000001e-01 },
+    { 3.0514865107983086e-01, -3.5563571529315008e-01, 5.9125291166850291e-01,
+      -3.7535482948249682e-01, 5.4990899869224608e-01, 5.5580390789266754e-01,
+      2.5687539908041844e-03, 4.2764079384542486e-01, 1.4956494895068681e-01, 1.1478555597464588e-01,
+      7.9873717889840726e-03, 4.0361062306902945e-01, 1.5498297991954391e-01, 2.7979077984004279e-02, 1.0000000000000001e-01 },
+    { 3.0688770813792987e-01, -3.5230043702312175e-01, 5.8494422083063036e-01,
+      -3.7380829089648232e-01, 5.5222293165786307e-01, 5.4686101122857889e-01,
+      7.5107988620993389e-03, 4.2313597723263124e-01, 1.4624203120779389e-01, 1.1402489114370196e-01,
+      1.2364512255257289e-02, 3.9880672930503264e-01, 1.5278360661909443e-01, 2.6958850266841968e-02, 1.0000000000000001e-01 },
+    { 3.0840136166989646e-01, -3.4968696601285543e-01, 5.8002098450115780e-01,
+      -3.7263369551617975e-01, 5.5409389211672599e-01, 5.3986545999721425e-01,
+      1.1492697311465263e-02, 4.1962151272199238e-01, 1.4361148395802664e-01, 1.1342831330153551e-01,
+      1.5865918597403050e-02, 3.9505040302796374e-01, 1.5109496476464310e-01, 2.6142720903009849e-02, 1.0000000000000001e-01 },
+    { 3.0968919062686845e-01, -3.4761055971816401e-01, 5.7611304158109833e-01,
+      -3.7172805474166304e-01, 5.5561362038574336e-01, 5.3430069678398795e-01,
+      1.4720142160697898e-02, 4.1683293225240031e-01, 1.4150001085121325e-01, 1.1295076869539639e-01,
+      1.8686602738541912e-02, 3.9206477706720949e-01, 1.4977233001622017e-01, 2.5480144137736287e-02, 1.0000000000000001e-01 },
+    { 3.1078878837373797e-01, -3.4593320121602822e-01, 5.7296101175497749e-01,
+      -3.7101445678987544e-01, 5.5686283350071530e-01, 5.2980344159594073e-01,
+      1.7370727000196939e-02, 4.1458401013289753e-01, 1.3978106574109095e-01, 1.1256366380833938e-01,
+      2.0991226985022718e-02, 3.8965395389686475e-01, 1.4871841936054447e-01, 2.4935866440092908e-02, 1.0000000000000001e-01 },
+    { 3.0312634967883689e-01, -2.9449328766362909e-01, 5.5779165446260193e-01,
+      -2.5429268581849235e-01, 4.2066475008302745e-01, 5.4689159287402955e-01,
+      2.4103037048546029e-02, 3.8778295677692554e-01, 1.5748641418927120e-01, 1.1355445845423813e-01,
+      2.9398448235330183e-02, 3.7073154277990467e-01, 1.5789248464169434e-01, 2.4904390812051754e-02, 1.0000000000000001e-01 },
+    { 3.0403831407192694e-01, -2.9291577977115868e-01, 5.5553643429515231e-01,
+      -2.5346496404591606e-01, 4.2149776016539831e-01, 5.4352310351174105e-01,
+      2.6048754897019882e-02, 3.8617967408105153e-01, 1.5625915564111115e-01, 1.1331336198007282e-01,
+      3.1170844219263593e-02, 3.6899158496159778e-01, 1.5711518199156743e-01, 2.4523335426826540e-02, 1.0000000000000001e-01 },
+    { 3.0481615297631842e-01, -2.9159423252375355e-01, 5.5364837084911067e-01,
+      -2.5278146977219507e-01, 4.2220214921111238e-01, 5.4069842209477770e-01,
+      2.7685169067075549e-02, 3.8483982097006875e-01, 1.5522586729582002e-01, 1.1311022435539987e-01,
+      3.2658174438736025e-02, 3.6753490572925035e-01, 1.5646788603496817e-01, 2.4200115485409689e-02, 1.0000000000000001e-01 },
+    { 3.0549202355851163e-01, -2.9047250108352868e-01, 5.5205140676381359e-01,
+      -2.5220722452343336e-01, 4.2280585162338341e-01, 5.3830507146469597e-01,
+      2.9081565309489438e-02, 3.8370776580362226e-01, 1.5434720471129776e-01, 1.1293875304835395e-01,
+      3.3924901974630356e-02, 3.6630235358682972e-01, 1.5592379126153261e-01, 2.3924242049770651e-02, 1.0000000000000001e-01 },
+    { 3.0608402880007157e-01, -2.8951153601128737e-01, 5.5068877070985500e-01,
+      -2.5171929862917464e-01, 4.2332754976195247e-01, 5.3625954576781365e-01,
+      3.0283983040873728e-02, 3.8274258106731152e-01, 1.5359387214903375e-01, 1.1279305334883849e-01,
+      3.5013836546500116e-02, 3.6525019861755609e-01, 1.5546231015555895e-01, 2.3687144286442263e-02, 1.0000000000000001e-01 },
+    { 3.0704015200784651e-01, -2.8797172717507430e-01, 5.4850305067213900e-01,
+      -2.5094713763635407e-01, 4.2416542761789444e-01, 5.3297401289241253e-01,
+      3.2213325738105834e-02, 3.8119664341616322e-01, 1.5238016323916606e-01, 1.1255675606541597e-01,
+      3.6757511737992458e-02, 3.6356251438578591e-01, 1.5472519671086260e-01, 2.3301665624210086e-02, 1.0000000000000001e-01 },
+    { 3.0778919895372964e-01, -2.8679675060798743e-01, 5.4684274178333836e-01,
+      -2.5036524811741978e-01, 4.2481196547073319e-01, 5.3047266747467969e-01,
+      3.3694684071553141e-02, 3.8002367752925015e-01, 1.5145235065692791e-01, 1.1237791952993433e-01,
+      3.8093258346169390e-02, 3.6227988420002627e-01, 1.5416970886351389e-01, 2.3005780377955982e-02, 1.0000000000000001e-01 },
+    { 3.0838708244276392e-01, -2.8587939945447272e-01, 5.4555222499143030e-01,
+      -2.4991508206977464e-01, 4.2532124947101252e-01, 5.2852474950989703e-01,
+      3.4857356856972138e-02, 3.7911266179342068e-01, 1.5072747926567101e-01, 1.1223962588708139e-01,
+      3.9139775393876086e-02, 3.6128243578922009e-01, 1.5374088492119733e-01, 2.2774027698851802e-02, 1.0000000000000001e-01 },
+    { 3.0887327792716973e-01, -2.8514871315198137e-01, 5.4452944055957186e-01,
+      -2.4955871970293569e-01, 4.2573004941313247e-01, 5.2697832798510380e-01,
+      3.5788119543832174e-02, 3.7839095386667859e-01, 1.5015047372529153e-01, 1.1213087720382345e-01,
+      3.9976372245865102e-02, 3.6049148349511212e-01, 1.5340317234839879e-01, 2.2589396250249649e-02, 1.0000000000000001e-01 },
+    { 3.0923974015534789e-01, -2.8457164915570099e-01, 5.4370511113465447e-01,
+      -2.4928425489346326e-01, 4.2604980756432181e-01, 5.2573357209762994e-01,
+      3.6514485340903451e-02, 3.7781117798963471e-01, 1.4968601595679598e-01, 1.1203835118435769e-01,
+      4.0628345627057860e-02, 3.5985535794141227e-01, 1.5312877706883532e-01, 2.2437549834386426e-02, 1.0000000000000001e-01 },
+    { 3.0956283535603063e-01, -2.8409043969660919e-01, 5.4303098421086848e-01,
+      -2.4905320248214941e-01, 4.2632056343075658e-01, 5.2471265075683826e-01,
+      3.7128669588827060e-02, 3.7733623226902485e-01, 1.4930388906025843e-01, 1.1196599647987676e-01,
+      4.1179211465704683e-02, 3.5933404622333898e-01, 1.5290728169115955e-01, 2.2314248017783821e-02, 1.0000000000000001e-01 },
+    { 3.0983336656724519e-01, -2.8369113210571872e-01, 5.4247271898459670e-01,
+      -2.4886224314309219e-01, 4.2654601751198806e-01, 5.2386645269854393e-01,
+      3.7639432031771503e-02, 3.7694303346691688e-01, 1.4898672738348750e-01, 1.1190621794692246e-01,
+      4.1636960058303980e-02, 3.5890223028693896e-01, 1.5272443216606058e-01, 2.2211788317794655e-02, 1.0000000000000001e-01 },
+    { 3.1006602812779699e-01, -2.8335449795899637e-01, 5.4200528718474050e-01,
+      -2.4870111725138105e-01, 4.2673723861279811e-01, 5.2315700013959132e-01,
+      3.8072212114799033e-02, 3.7661369377166881e-01, 1.4872039137001591e-01, 1.1185692278799543e-01,
+      4.2024592261463517e-02, 3.5854040785446428e-01, 1.5257218078343576e-01, 2.2126039145115597e-02, 1.0000000000000001e-01 },
+    { 3.1025098523799394e-01, -2.8307489408376468e-01, 5.4160967038114172e-01,
+      -2.4856990688444616e-01, 4.2689443578485520e-01, 5.2255752847839609e-01,
+      3.8427598290121809e-02, 3.7633566721885320e-01, 1.4849553885414968e-01, 1.1181309684665229e-01,
+      4.2342641157035052e-02, 3.5823476267587578e-01, 1.5244215931914398e-01, 2.2052338057722106e-02, 1.0000000000000001e-01 },
+    { 3.1043812560816836e-01, -2.8282434013515578e-01, 5.4127274739740416e-01,
+      -2.4844777186151187e-01, 4.2703991352653975e-01, 5.2204382056640963e-01,
+      3.8756445571752153e-02, 3.7609754840248766e-01, 1.4830181585827812e-01, 1.1178043684096808e-01,
+      4.2636999086886576e-02, 3.5797307481026547e-01, 1.5233472782904381e-01, 2.1991444947290318e-02, 1.0000000000000001e-01 },
+    { 3.1067334301982868e-01, -2.8244917504296480e-01, 5.4073006414033120e-01,
+      -2.4827631776873862e-01, 4.2724822481183300e-01, 5.2122280272306365e-01,
+      3.9226872539897817e-02, 3.7571734424642461e-01, 1.4799402778181708e-01, 1.1171690593527653e-01,
+      4.3057397033639380e-02, 3.5755469507493176e-01, 1.5215472819577933e-01, 2.1888330199065633e-02, 1.0000000000000001e-01 },
+    { 3.1090506434649789e-01, -2.8214257488878530e-01, 5.4031914405763515e-01,
+      -2.4812765185922567e-01, 4.2742696455799573e-01, 5.2059538216307000e-01,
+      3.9630472657982245e-02, 3.7542704387792564e-01, 1.4775693757512270e-01, 1.1167725146695467e-01,
+      4.3418257840119878e-02, 3.5723540738456305e-01, 1.5202438363571927e-01, 2.1813656717583087e-02, 1.0000000000000001e-01 },
+    { 3.1104698959763100e-01, -2.8191987066790514e-01, 5.3999821529770764e-01,
+      -2.4802640485173177e-01, 4.2755132612548080e-01, 5.2010919399943978e-01,
+      3.9910795811596789e-02, 3.7520225904582816e-01, 1.4757431921105627e-01, 1.1163987161751014e-01,
+      4.3668486427327007e-02, 3.5698787327548615e-01, 1.5191845970665291e-01, 2.1752426276525232e-02, 1.0000000000000001e-01 },
+    { 3.1119090079674733e-01, -2.8173059534575623e-01, 5.3974482122466461e-01,
+      -2.4793512294800815e-01, 4.2766198602084787e-01, 5.1972194647353565e-01,
+      4.0160322281782020e-02, 3.7502333613279920e-01, 1.4742777881908264e-01, 1.1161541140709634e-01,
+      4.3891401416504050e-02, 3.5679096207420241e-01, 1.5183832694082275e-01, 2.1706158209230868e-02, 1.0000000000000001e-01 },
+    { 3.1128144943431524e-01, -2.8158833895014779e-01, 5.3953945687394955e-01,
+      -2.4787089614344812e-01, 4.2774148137448459e-01, 5.1941071048912113e-01,
+      4.0339311701402501e-02, 3.7487958152541578e-01, 1.4731077996613209e-01, 1.1159134436360352e-01,
+      4.4051052074077453e-02, 3.5663258108375256e-01, 1.5177060399817158e-01, 2.1666780400552307e-02, 1.0000000000000001e-01 },
+    { 3.1134319209327604e-01, -2.8147694037417365e-01, 5.3937085989489642e-01,
+      -2.4782289754979647e-01, 4.2780182384987087e-01, 5.1915644839964425e-01,
+      4.0475031747481002e-02, 3.7476216653475586e-01, 1.4721557421535422e-01, 1.1156953232793726e-01,
+      4.4171965017372784e-02, 3.5650313212030382e-01, 1.5171367150486559e-01, 2.1633536182986090e-02, 1.0000000000000001e-01 },
+    { 3.1139510172613266e-01, -2.8138433387866302e-01, 5.3923114110894399e-01,
+      -2.4778293327752726e-01, 4.2785212332298567e-01, 5.1894563207162336e-01,
+      4.0588138799270486e-02, 3.7466483853198501e-01, 1.4713659430182432e-01, 1.1155155634650613e-01,
+      4.4272716019067085e-02, 3.5639581909478324e-01, 1.5166658885039788e-01, 2.1606004015337937e-02, 1.0000000000000001e-01 },
+    { 3.1148721632698395e-01, -2.8128720180585054e-01, 5.3911622863906150e-01,
+      -2.4773210582830568e-01, 4.2791282159276828e-01, 5.1876713060362323e-01,
+      4.0725011041023933e-02, 3.7458252091573951e-01, 1.4706810568581366e-01, 1.1154469461207608e-01,
+      4.4395091907702224e-02, 3.5630530235617774e-01, 1.5163321603749924e-01, 2.1586721953273959e-02, 1.0000000000000001e-01 },
+    { 3.1155435842461354e-01, -2.8120939102099801e-01, 5.3901855375462193e-01,
+      -2.4769302670296808e-01, 4.2796005475465126e-01, 5.1861653745230163e-01,
+      4.0831429390414474e-02, 3.7451307884381385e-01, 1.4701066255013581e-01, 1.1153705811720613e-01,
+      4.4490151837133764e-02, 3.5622887749546533e-01, 1.5160365309462687e-01, 2.1569546474344330e-02, 1.0000000000000001e-01 },
+    { 3.1157635425894931e-01, -2.8115714982329820e-01, 5.3893353803215549e-01,
+      -2.4767232386338223e-01, 4.2798691424994134e-01, 5.1848921192743025e-01,
+      4.0891702640618074e-02, 3.7445431658349249e-01, 1.4696324636894703e-01, 1.1152455390630844e-01,
+      4.4543717458886099e-02, 3.5616401803215025e-01, 1.5157399265044935e-01, 2.1552091357880353e-02, 1.0000000000000001e-01 },
+    { 3.1162873421843290e-01, -2.8106639465252753e-01, 5.3879773754847726e-01,
+      -2.4763302116289562e-01, 4.2803655443860550e-01, 5.1828402736492585e-01,
+      4.1003266858912778e-02, 3.7435966538067128e-01, 1.4688625897763438e-01, 1.1150733474005305e-01,
+      4.4643045064847876e-02, 3.5605962597370844e-01, 1.5152848981518607e-01, 2.1525365103529138e-02, 1.0000000000000001e-01 },
+    { 3.1169272260615938e-01, -2.8098772233980041e-01, 5.3869562298570939e-01,
+      -2.4759456746318906e-01, 4.2808350443568516e-01, 5.1812717890381810e-01,
+      4.1108966166082735e-02, 3.7428737596500916e-01, 1.4682659431434358e-01, 1.1149832142502093e-01,
+      4.4737378326831570e-02, 3.5598001229317050e-01, 1.5149694109283574e-01, 2.1506926157618591e-02, 1.0000000000000001e-01 },
+    { 3.1182844280901889e-01, -2.8089221066788694e-01, 5.3862048819653330e-01,
+      -2.4753408030641549e-01, 4.2815271438171104e-01, 5.1800258420855072e-01,
+      4.1265345230710265e-02, 3.7423015803315851e-01, 1.4677633845849075e-01, 1.1150589164717900e-01,
+      4.4877628917776385e-02, 3.5591742295783962e-01, 1.5148330224222797e-01, 2.1499379251694515e-02, 1.0000000000000001e-01 },
+    { 3.1185916057142499e-01, -2.8084719835600280e-01, 5.3855707377834183e-01,
+      -2.4751354227382821e-01, 4.2817834732054544e-01, 5.1790609534421783e-01,
+      4.1322961248551657e-02, 3.7418569230829141e-01, 1.4673990922738467e-01, 1.1149883473205595e-01,
+      4.4928963971180944e-02, 3.5586839714370233e-01, 1.5146274501403553e-01, 2.1487291387364920e-02, 1.0000000000000001e-01 },
+    { 3.1178814850744885e-01, -2.8084908787639024e-01, 5.3850101604644296e-01,
+      -2.4753106618925622e-01, 4.2816261225952412e-01, 5.1783096562272590e-01,
+      4.1286831819074193e-02, 3.7415084369460877e-01, 1.4671473679000063e-01, 1.1147686118169227e-01,
+      4.4895874061608831e-02, 3.5582949375279932e-01, 1.5143397872501604e-01, 2.1469926945951685e-02, 1.0000000000000001e-01 },
+    { 3.1179855856244598e-01, -2.8082329249487259e-01, 5.3845860828192105e-01,
+      -2.4752102345142699e-01, 4.2817579098184488e-01, 5.1776748342535284e-01,
+      4.1316374880449709e-02, 3.7412156609582647e-01, 1.4669109740399475e-01, 1.1147051523290399e-01,
+      4.4922100425439912e-02, 3.5579716255690086e-01, 1.5141914105757195e-01, 2.1461149573262169e-02, 1.0000000000000001e-01 },
+    { 3.1225371343643427e-01, -2.8062420450912023e-01, 5.3844710117918893e-01,
+      -2.4735403501136558e-01, 4.2835623170363585e-01, 5.1770329747239796e-01,
+      4.1725447095192256e-02, 3.7409315754912931e-01, 1.4665218200889205e-01, 1.1154123027226535e-01,
+      4.5290672028331397e-02, 3.5576798443794355e-01, 1.5146390699053158e-01, 2.1489453468672551e-02, 1.0000000000000001e-01 },
+    { 3.1184005890955180e-01, -2.8077375635350987e-01, 5.3839532801223333e-01,
+      -2.4749653962023949e-01, 4.2820553493771613e-01, 5.1767006069130495e-01,
+      4.1383491876403500e-02, 3.7407668568296892e-01, 1.4665396540971257e-01, 1.1146520571111583e-01,
+      4.4981991222540992e-02, 3.5574773533305110e-01, 1.5139981057661134e-01, 2.1449811547997598e-02, 1.0000000000000001e-01 },
+    { 3.1217047024926553e-01, -2.8062957655917076e-01, 5.3838762391781303e-01,
+      -2.4737544346001789e-01, 4.2833639420917635e-01, 5.1762442316026758e-01,
+      4.1680131083991226e-02, 3.7405651271238899e-01, 1.4662606065213346e-01, 1.1151666268480220e-01,
+      4.5249258823467850e-02, 3.5572705171051638e-01, 1.5143255894645641e-01, 2.1470497652875096e-02, 1.0000000000000001e-01 }
+};
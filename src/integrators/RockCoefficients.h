@@ -0,0 +1,22 @@
+#ifndef ROCK_COEFFICIENTS_H
+#define ROCK_COEFFICIENTS_H
+
+#include <sundials/sundials_types.h>
+
+extern const int rock2NumberOfDegrees;
+extern const int rock2Stages[];
+extern const realtype rock2StabilityBound[];
+extern const int rock2Offset[];
+extern const realtype rock2Mu[];
+extern const realtype rock2Kappa[];
+extern const realtype rock2Finishing[][2];
+
+extern const int rock4NumberOfDegrees;
+extern const int rock4Stages[];
+extern const realtype rock4StabilityBound[];
+extern const int rock4Offset[];
+extern const realtype rock4Mu[];
+extern const realtype rock4Kappa[];
+extern const realtype rock4Finishing[][15];
+
+#endif // ROCK_COEFFICIENTS_H
@@ -1,6 +1,7 @@
 #include "RungeKuttaBase.h"
 #include "../odesystem/ExplicitOde.h"
 #include "../utils/LogStream.h"
+#include "../utils/Profiler.h"
 
 #include <limits>
 
@@ -50,7 +51,6 @@ void RungeKuttaBase::assignExplicitOde (
     int neq = odeProblem.numberOfEquations();
 
     newState_.reinit( neq );
-    localError_.reinit( neq );
     newLocalError_.reinit( neq );
     weights_.reinit( neq );
     calculateWeights( currentState_ );
@@ -79,8 +79,8 @@ void RungeKuttaBase::integrateTo( realtype tOut )
     while ( currentTime_ != endTime_ )
     {
         performIntegrationStep();
-        if ( saveHistory() )
-            updateHistory();
+        if ( recordSteps() )
+            stepTaken();
     }
 }    
 
@@ -98,6 +98,7 @@ void RungeKuttaBase::setStabilizationFactor( realtype stabilizationBeta )
 
 void RungeKuttaBase::calculateWeights( const Vector<realtype>& y )
 {
+    ODEITY_PROBE( "vector kernels" );
     weights_.invabsequ( relTol_, y, absTol_ );
 }
 
@@ -128,7 +129,6 @@ void RungeKuttaBase::completeStep()
 void RungeKuttaBase::prepareNextStep()
 {
     swap( currentState_, newState_ );
-    swap( localError_, newLocalError_ );
     oldLocalErrorNorm_ = newLocalErrorNorm_;
 }
 
@@ -136,11 +136,19 @@ void RungeKuttaBase::prepareNextStep()
 
 void RungeKuttaBase::performIntegrationStep()
 {
+    ODEITY_PROBE( "step" );
+
     while ( true )
     {
         startStep();
-        calculateSolutionPoint();
-        estimateError();
+        {
+            ODEITY_PROBE( "stages" );
+            calculateSolutionPoint();
+        }
+        {
+            ODEITY_PROBE( "error estimate" );
+            estimateError();
+        }
 
         if ( not testAccuracy() ) // failed step
         {
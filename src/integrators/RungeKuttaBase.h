@@ -41,7 +41,6 @@ class RungeKuttaBase : public OdeIntegratorBase
         int orderError_;
 
         Vector<realtype> newState_;
-        Vector<realtype> localError_;
         Vector<realtype> newLocalError_;
         Vector<realtype> weights_;
         realtype newLocalErrorNorm_;
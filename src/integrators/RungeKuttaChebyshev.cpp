@@ -1,18 +1,15 @@
 #include "RungeKuttaChebyshev.h"
 #include "../odesystem/ExplicitOde.h"
 #include "../utils/LogStream.h"
+#include "../utils/MpiUtilities.h"
+#include "../utils/Profiler.h"
 
 #include <cmath>
 
 
 RungeKuttaChebyshev::RungeKuttaChebyshev()
   :
-    RungeKuttaBase( 2 ),
-    spectralRadius_( 0.0 ),
-    computeSpectralRadius_( true ),
-    jacobianAtT_( false ),
-    computeSRFlag_( 0 ),
-    maxIterations_( 50 )
+    StabilizedRungeKuttaBase( 2 )
 {
   solverName_ = "Stabilized recursive Runge-Kutta-Chebyshev";
   maxStage_ = (int)( std::sqrt( relTol_ / ( 10.0 * epsilon_) ) );
@@ -21,193 +18,21 @@ RungeKuttaChebyshev::RungeKuttaChebyshev()
 
 
 
-IntegratorStatsBase&
-RungeKuttaChebyshev::stats()
-{
-  return (IntegratorStatsBase&) stats_;
-}
-
-
-
 void RungeKuttaChebyshev::assignExplicitOde( ExplicitOde& odeProblem,
     const realtype initialTime,
     const Vector<realtype>& initialState )
 {
-  RungeKuttaBase::assignExplicitOde( odeProblem, initialTime, initialState );
-
-  stats_.reset();
+  StabilizedRungeKuttaBase::assignExplicitOde( odeProblem, initialTime, initialState );
 
-  fn_.reinit( odeProblem.numberOfEquations() );
-  fev_.reinit( odeProblem.numberOfEquations() );
-  temp1_.reinit( odeProblem.numberOfEquations() );
-  temp2_.reinit( odeProblem.numberOfEquations() );
   yjm1_.reinit( odeProblem.numberOfEquations() );
   yjm2_.reinit( odeProblem.numberOfEquations() );
-  eigenVector_.reinit( odeProblem.numberOfEquations() );
-
-  odeProblem.rhs( currentTime_, currentState_, fn_ );
-  stats_.incRhsEvaluations();
-
-  computeSpectralRadius_ = true;
-  jacobianAtT_ = false;
-}
-
-
-void RungeKuttaChebyshev::printInfo() const
-{
-  using namespace std;
-
-  RungeKuttaBase::printInfo();
-
-  logger << endl;
-  logger << "Concrete solver information" << endl;
-  logger << "~~~~~~~~~~~~~~~~~~~~~~~~~~~" << endl;
-  logger << "*Maximum number of stages*:: " << maxStage_ << endl;
-  logger << "*Maximum number of iterations for spectral radius computation*:: " << maxIterations_ << endl;
-  logger << "*Small number*:: " << small_ 
-    << " (if spectral radius is less than this quantity, it does not restrict the time step size)" << endl << endl;
-}
-
-
-
-void RungeKuttaChebyshev::initializeIntegration()
-{
-  if ( computeSpectralRadius_ )
-  {
-    estimateSpectralRadius();
-    jacobianAtT_ = true;
-  }
-
-  small_ = 1.0 / ( endTime_ - currentTime_ );
-}
-
-
-
-void RungeKuttaChebyshev::estimateInitialStepsize()
-{
-  realtype dt = endTime_ - currentTime_;
-
-  minStepsize_ = 10.0 * epsilon_ * dt;
-  stepsize_ = dt;
-  if ( spectralRadius_ * stepsize_ > 1.0 )
-    stepsize_ = 1.0 / spectralRadius_;
-
-  stepsize_ = std::max( stepsize_, minStepsize_ );
-  temp1_.equ( 1.0, currentState_, stepsize_, fn_ );
-  odeProblem_->rhs( currentTime_ + stepsize_, temp1_, temp2_ );
-  stats_.incRhsEvaluations();
-  temp2_.add( -1.0, fn_ );
-
-  realtype estimate = stepsize_ * temp2_.rms_norm( weights_ );
-
-  if ( 0.1 * stepsize_ < dt * std::sqrt( estimate ) )
-    stepsize_ = std::max( 0.1 * stepsize_ / std::sqrt( estimate ) , minStepsize_ );
-  else
-    stepsize_ = dt;
-}
-
-
-
-void RungeKuttaChebyshev::estimateSpectralRadius()
-{
-  if ( stats_.getAcceptedSteps() == 0 )
-    eigenVector_ = fn_;
-
-  realtype yNorm = currentState_.l2_norm();
-  realtype evNorm = eigenVector_.l2_norm();
-  realtype dyNorm;
-
-  if ( yNorm != 0.0 && evNorm != 0.0 )
-  {
-    dyNorm = yNorm * sqrtEpsilon_;
-    eigenVector_.sadd( dyNorm / evNorm, 1.0, currentState_ );
-  }
-  else if ( yNorm != 0.0)
-  {
-    dyNorm = yNorm * sqrtEpsilon_;
-    eigenVector_.equ( 1.0, currentState_, sqrtEpsilon_, currentState_ );
-  }
-  else if ( evNorm != 0.0 )
-  {
-    dyNorm = epsilon_;
-    eigenVector_.scale( dyNorm / evNorm );
-  }
-  else
-  {
-    dyNorm = epsilon_;
-    eigenVector_ = dyNorm;
-  }
-
-  //--------------------------------------------
-  //  Now iterate with a nonlinear power method.
-  //--------------------------------------------
-  realtype sigma = 0.0;
-  realtype sigmal;
-  realtype dfNorm = 0.0;
-
-  int iter;
-  for ( iter = 1; iter <= maxIterations_; iter++ )
-  {
-    odeProblem_->rhs( currentTime_, eigenVector_, fev_ );
-    stats_.incRhsEvaluations();
-
-    dfNorm = 0.0;
-    fev_.add( -1.0, fn_ );
-    dfNorm = fev_.l2_norm();
-
-    sigmal = sigma;
-    sigma = dfNorm/dyNorm;
-
-    //----------------------------------------------------------
-    //  sprad is a little bigger than the estimate sigma of the 
-    //  spectral radius, so is more likely to be an upper bound.
-    //----------------------------------------------------------
-    spectralRadius_ = 1.2 * sigma;
-    if ( iter >= 2 && std::fabs( sigma - sigmal) <= std::max( sigma, small_) * 0.01 )
-    {
-      eigenVector_.add( -1.0, currentState_ );
-      ++stats_.nspraditers_;
-      break;
-      // return;
-    }
-    //--------------------------------------
-    //  The next v(*) is the change in f
-    //  scaled so that norm(v - yn) = dynrm.
-    //--------------------------------------
-    if ( dfNorm != 0.0 )
-      eigenVector_.equ( 1.0, currentState_, dyNorm/dfNorm, fev_);
-    else
-    {
-      //-------------------------------------------------------
-      //  The new v(*) degenerated to yn(*)--"randomly" perturb 
-      //  current approximation to the eigenvector by changing 
-      //  the sign of one component.
-      //-------------------------------------------------------
-      int index = 1 + ( iter % odeProblem_->numberOfEquations() );
-      eigenVector_(index) = currentState_(index)
-        - (eigenVector_(index) - currentState_(index));
-    }
-  }
-
-  AssertThrow( iter <= maxIterations_, ExcMaxIterExceededSR( maxIterations_ ) );
 }
 
 
 
 void RungeKuttaChebyshev::startStep()
 {
-  if ( computeSpectralRadius_ )
-  {
-    estimateSpectralRadius();
-    jacobianAtT_ = true;
-  }
-
-  last_ = false;
-  if ( 1.2 * stepsize_ > endTime_ - currentTime_ )
-  {
-    stepsize_ = endTime_ - currentTime_;
-    last_ = true;
-  }
+  updateSpectralRadius();
 
   stages_ = 1 + (int)( std::sqrt( 1.54 * stepsize_ * spectralRadius_ + 1.0 ) );
   if ( stages_ > maxStage_ )
@@ -241,10 +66,14 @@ void RungeKuttaChebyshev::calculateSolutionPoint()
   bjm1 = 1.0 / (4.0 * w0*w0 );
   bjm2 = bjm1;
 
+  // The three-term recurrence only ever needs the stages j-1 and j-2, so the
+  // stages are kept in a rotating set of three buffers: stage j lives in
+  // stage[j%3]. Stage 0 is the current state itself and is never copied.
+  Vector<realtype>* stage[3] = { &yjm2_, &yjm1_, &newState_ };
+
   // compute first stage
-  yjm2_ = currentState_;
   mus = w1 * bjm1;
-  yjm1_.equ( 1.0, currentState_, stepsize_ * mus, fn_ );
+  stage[1]->equ( 1.0, currentState_, stepsize_ * mus, fn_ );
   thjm2  = 0.0;
   thjm1  = mus;
   zjm1   = w0;
@@ -266,32 +95,34 @@ void RungeKuttaChebyshev::calculateSolutionPoint()
     nu   = - bj/bjm2;
     mus  =   mu*w1/w0;
 
-    odeProblem_->rhs( currentTime_ + stepsize_ * thjm1, yjm1_, newState_ );
+    Vector<realtype>& yj = *stage[s%3];
+    const Vector<realtype>& yjm1 = *stage[(s-1)%3];
+    const Vector<realtype>& yjm2 = ( s == 2 ) ? currentState_ : *stage[(s-2)%3];
+
+    odeProblem_->rhs( currentTime_ + stepsize_ * thjm1, yjm1, yj );
     stats_.incRhsEvaluations();
 
-    newState_.sadd( stepsize_ * mus, mu, yjm1_, nu, yjm2_, 1.0 - mu - nu, currentState_ );
-    newState_.add( - stepsize_ * mus * ajm1, fn_ );
+    stageUpdate( yj, stepsize_ * mus, mu, yjm1, nu, yjm2,
+        1.0 - mu - nu, currentState_, - stepsize_ * mus * ajm1, fn_ );
 
     thj = mu*thjm1 + nu*thjm2 + mus*(1.0 - ajm1);
 
-    if ( s < stages_ )
-    {
-      swap( yjm2_, yjm1_ );
-      yjm1_ = newState_;
-
-      thjm2  = thjm1;
-      thjm1  = thj;
-      bjm2   = bjm1;
-      bjm1   = bj;
-      zjm2   = zjm1;
-      zjm1   = zj;
-      dzjm2  = dzjm1;
-      dzjm1  = dzj;
-      d2zjm2 = d2zjm1;
-      d2zjm1 = d2zj;
-    }
+    thjm2  = thjm1;
+    thjm1  = thj;
+    bjm2   = bjm1;
+    bjm1   = bj;
+    zjm2   = zjm1;
+    zjm1   = zj;
+    dzjm2  = dzjm1;
+    dzjm1  = dzj;
+    d2zjm2 = d2zjm1;
+    d2zjm1 = d2zj;
   }
 
+  // the last stage is the new solution point
+  if ( stage[stages_%3] != &newState_ )
+    swap( newState_, *stage[stages_%3] );
+
   newTime_ = currentTime_ + stepsize_;
 
   odeProblem_->rhs( newTime_, newState_, temp1_ );
@@ -300,89 +131,45 @@ void RungeKuttaChebyshev::calculateSolutionPoint()
 
 
 
-void RungeKuttaChebyshev::estimateError()
-{
-  temp2_.maxabs( currentState_, newState_ );
-  calculateWeights( temp2_ );
-
-  newLocalError_.equ( 0.8, currentState_, -0.8, newState_);
-  newLocalError_.add( 0.4*stepsize_, fn_, -0.4*stepsize_, temp1_ );
-
-  newLocalErrorNorm_ = newLocalError_.rms_norm( weights_ );       
-}
-
-
-
-void RungeKuttaChebyshev::newStepsizeAfterRejectedStep()
-{
-  stepsize_ = safety_ * stepsize_ / std::pow( newLocalErrorNorm_, 1.0/3.0 );
-}
-
-
-
-void RungeKuttaChebyshev::handleRejectedStep()
+void RungeKuttaChebyshev::stageUpdate( Vector<realtype>& yj,
+    const realtype s, const realtype a, const Vector<realtype>& yjm1,
+    const realtype b, const Vector<realtype>& yjm2,
+    const realtype c, const Vector<realtype>& y0,
+    const realtype d, const Vector<realtype>& f0 )
 {
-  RungeKuttaBase::handleRejectedStep();
-
-  stats_.incRejectedSteps();
-  computeSpectralRadius_ = not jacobianAtT_; // if we have jacobian, do not compute it
-}
+  ODEITY_PROBE( "vector kernels" );
 
+  // Fused form of
+  //   yj.sadd( s, a, yjm1, b, yjm2, c, y0 );
+  //   yj.add( d, f0 );
+  // The operations are evaluated in the same order as in the two separate
+  // vector kernels, so the result is bitwise identical, but yj is streamed
+  // through memory only once.
+  const unsigned int n = yj.size();
+  realtype * const dst = yj.data();
+  const realtype * const v1 = yjm1.data();
+  const realtype * const v2 = yjm2.data();
+  const realtype * const v3 = y0.data();
+  const realtype * const v4 = f0.data();
 
-
-void RungeKuttaChebyshev::newStepsizeAfterAcceptedStep()
-{
-  realtype temp1, temp2, factor = 10.0;
-
-  if ( stats_.getAcceptedSteps() == 0 )
+  for ( unsigned int i = 0; i < n; i++ )
   {
-    temp1 = std::pow( newLocalErrorNorm_, 1.0/3.0 );
-    if ( 0.8 < factor * temp1 )
-      factor = 0.8 / temp1;
+    realtype val = s*dst[i] + a*v1[i] + b*v2[i] + c*v3[i];
+    dst[i] = val + d*v4[i];
   }
-  else
-  {
-    temp1 = 0.8 * stepsize_ * std::pow( oldLocalErrorNorm_, 1.0/3.0 );
-    temp2 = oldStepsize_ * std::pow( newLocalErrorNorm_, 2.0/3.0 );
-    if ( temp1 < factor * temp2 )
-      factor = temp1 / temp2;
-  }
-  stepsize_ *= std::max( 0.1, factor);
-  stepsize_ = std::max( minStepsize_, stepsize_ );
-}
-
-
-
-void RungeKuttaChebyshev::completeStep()
-{
-  stats_.incAcceptedSteps();
-  // stats_.updateTimeStepsize( currentTime_ , stepsize_ );
-
-  RungeKuttaBase::completeStep();
 }
 
 
 
-void RungeKuttaChebyshev::prepareNextStep()
+void RungeKuttaChebyshev::estimateError()
 {
-  RungeKuttaBase::prepareNextStep();
-
-  jacobianAtT_ = false; // we assume that jacobian is not constant
-  computeSpectralRadius_ = false;
-
-  computeSRFlag_ = ( computeSRFlag_ + 1 ) % 25;
-  if ( computeSRFlag_ == 0 )
-    computeSpectralRadius_ = not jacobianAtT_;
-
-  swap( fn_, temp1_ );
-}
-
+  temp2_.maxabs( currentState_, newState_ );
+  calculateWeights( temp2_ );
 
+  newLocalError_.equ( 0.8, currentState_, -0.8, newState_);
+  newLocalError_.add( 0.4*stepsize_, fn_, -0.4*stepsize_, temp1_ );
 
-void
-RungeKuttaChebyshev::updateHistory()
-{
-  stats_.updateHistory( oldTime_, oldStepsize_, stages_ );
+  newLocalErrorNorm_ = globalRmsNorm( newLocalError_, weights_ );       
 }
 
 
@@ -0,0 +1,328 @@
+#include "SparsePreconditioner.h"
+#include "../odesystem/ExplicitOde.h"
+#include "../utils/Exceptions.h"
+#include "../utils/Profiler.h"
+#include "../utils/Vector.h"
+#include "../utils/Workspace.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <map>
+
+
+SparsePreconditioner::SparsePreconditioner( const Type type, const int fillLevel, const Ordering ordering )
+    :
+        type_( type ),
+        fillLevel_( fillLevel ),
+        ordering_( ordering ),
+        analyzed_( false ),
+        workspace_( 0 ),
+        workBuffer_( -1 ),
+        jacobianEvaluations_( 0 ),
+        factorizations_( 0 )
+{
+    Assert( fillLevel >= 0, ExcMessage( "The level of fill must not be negative" ) );
+}
+
+
+
+int
+SparsePreconditioner::setup( ExplicitOde & ode, const realtype t, const Vector<realtype> & y,
+        const Vector<realtype> & fy, const bool jok, bool & jacobianCurrent,
+        const realtype gamma )
+{
+    ODEITY_PROBE( "preconditioner setup" );
+
+    jacobianCurrent = not jok || not analyzed_;
+    if ( jacobianCurrent )
+    {
+        const SparseMatrix & J = ode.sparseJacobian( t, y, fy );
+        jacobianEvaluations_++;
+
+        if ( analyzed_ && samePattern( J ) )
+            std::copy( J.values(), J.values() + J.nonzeros(), jacobian_.values() );
+        else
+        {
+            jacobian_ = J;
+            analyze( ode.lineBlockSize() );
+            analyzed_ = true;
+            workspace_ = 0;
+        }
+
+        // the size may have changed, or a new problem come with its own
+        // workspace
+        if ( workspace_ != &ode.workspace() )
+        {
+            workspace_ = &ode.workspace();
+            workBuffer_ = workspace_->request( "preconditioner solve", J.size(),
+                    Workspace::preconditionerSolve );
+        }
+    }
+
+    return factorize( gamma );
+}
+
+
+
+void
+SparsePreconditioner::resetCounters()
+{
+    jacobianEvaluations_ = 0;
+    factorizations_ = 0;
+}
+
+
+
+// After CVODE has been reinitialized with another problem of the same size
+// the factors are analyzed again if the pattern of the Jacobian differs.
+bool
+SparsePreconditioner::samePattern( const SparseMatrix & J ) const
+{
+    const int n = J.size();
+
+    return n == jacobian_.size()
+        && J.nonzeros() == jacobian_.nonzeros()
+        && std::equal( J.rowStart(), J.rowStart() + n + 1, jacobian_.rowStart() )
+        && std::equal( J.columns(), J.columns() + J.nonzeros(), jacobian_.columns() );
+}
+
+
+
+// Forward substitution with the unit lower factor and backward substitution
+// with the upper factor, in the permuted numbering.
+void
+SparsePreconditioner::solve( const realtype * r, realtype * z )
+{
+    ODEITY_PROBE( "preconditioner solve" );
+
+    const int n = jacobian_.size();
+    realtype * const work = workspace_->data( workBuffer_ );
+
+    for ( int i = 0; i < n; i++ )
+        work[i] = r[permutation_[i]];
+
+    for ( int i = 0; i < n; i++ )
+    {
+        realtype sum = work[i];
+        for ( int k = factorStart_[i]; k < diagonal_[i]; k++ )
+            sum -= factor_[k]*work[factorColumns_[k]];
+        work[i] = sum;
+    }
+
+    for ( int i = n - 1; i >= 0; i-- )
+    {
+        realtype sum = work[i];
+        for ( int k = diagonal_[i] + 1; k < factorStart_[i + 1]; k++ )
+            sum -= factor_[k]*work[factorColumns_[k]];
+        work[i] = sum/factor_[diagonal_[i]];
+    }
+
+    for ( int i = 0; i < n; i++ )
+        z[permutation_[i]] = work[i];
+}
+
+
+
+// Symbolic factorization. The level of fill of an entry created by the
+// elimination of column k from row i is level(i,k) + level(k,j) + 1, the
+// entries of the matrix and the diagonal have level 0. The exact
+// factorization of the line blocks is the one with unlimited fill on the
+// block diagonal part of the matrix.
+void
+SparsePreconditioner::analyze( const int blockSize )
+{
+    const int n = jacobian_.size();
+    const int * const rowStart = jacobian_.rowStart();
+    const int * const columns = jacobian_.columns();
+
+    permutation_.resize( n );
+    for ( int i = 0; i < n; i++ )
+        permutation_[i] = i;
+    if ( type_ == incompleteLU && ordering_ == reverseCuthillMcKee )
+        orderReverseCuthillMcKee();
+
+    std::vector<int> inverse( n );
+    for ( int i = 0; i < n; i++ )
+        inverse[permutation_[i]] = i;
+
+    const int maxLevel = ( type_ == lineBlockJacobi ) ? n : fillLevel_;
+
+    factorStart_.assign( 1, 0 );
+    factorColumns_.clear();
+    diagonal_.resize( n );
+    std::vector<int> levels;
+
+    std::map<int,int> row;
+    for ( int i = 0; i < n; i++ )
+    {
+        const int original = permutation_[i];
+
+        row.clear();
+        row[i] = 0;
+        for ( int k = rowStart[original]; k < rowStart[original + 1]; k++ )
+        {
+            const int j = columns[k];
+            if ( type_ == lineBlockJacobi
+                    && ( j/blockSize != original/blockSize || std::abs( j - original ) > blockSize/2 ) )
+                continue;
+            row[inverse[j]] = 0;
+        }
+
+        // the entries created are to the right of k, so they are visited
+        // later in the same sweep
+        for ( std::map<int,int>::iterator it = row.begin(); it->first < i; ++it )
+        {
+            const int k = it->first;
+            for ( int m = diagonal_[k] + 1; m < factorStart_[k + 1]; m++ )
+            {
+                const int level = it->second + levels[m] + 1;
+                if ( level > maxLevel )
+                    continue;
+
+                std::map<int,int>::iterator entry = row.find( factorColumns_[m] );
+                if ( entry == row.end() )
+                    row[factorColumns_[m]] = level;
+                else if ( level < entry->second )
+                    entry->second = level;
+            }
+        }
+
+        for ( std::map<int,int>::const_iterator it = row.begin(); it != row.end(); ++it )
+        {
+            if ( it->first == i )
+                diagonal_[i] = factorColumns_.size();
+            factorColumns_.push_back( it->first );
+            levels.push_back( it->second );
+        }
+        factorStart_.push_back( factorColumns_.size() );
+    }
+
+    jacobianPositions_.resize( jacobian_.nonzeros() );
+    for ( int r = 0; r < n; r++ )
+    {
+        const int i = inverse[r];
+        const int * const begin = &factorColumns_[0] + factorStart_[i];
+        const int * const end = &factorColumns_[0] + factorStart_[i + 1];
+        for ( int k = rowStart[r]; k < rowStart[r + 1]; k++ )
+        {
+            const int * const position = std::lower_bound( begin, end, inverse[columns[k]] );
+            jacobianPositions_[k] = ( position != end && *position == inverse[columns[k]] )
+                ? position - &factorColumns_[0] : -1;
+        }
+    }
+
+    factor_.resize( factorColumns_.size() );
+    marker_.assign( n, -1 );
+}
+
+
+
+// orders nodes by their degree in the pattern
+class LowerDegree
+{
+    public:
+        explicit LowerDegree( const std::vector<int> & degree ) : degree_( degree ) {}
+
+        bool operator () ( const int i, const int j ) const
+        {
+            return degree_[i] < degree_[j];
+        }
+
+    private:
+        const std::vector<int> & degree_;
+};
+
+
+
+// Breadth-first numbering from a node of minimum degree, the neighbours of
+// a node in the order of increasing degree, reversed at the end. The
+// pattern of the Jacobian matrix of a stencil is symmetric.
+void
+SparsePreconditioner::orderReverseCuthillMcKee()
+{
+    const int n = jacobian_.size();
+    const int * const rowStart = jacobian_.rowStart();
+    const int * const columns = jacobian_.columns();
+
+    std::vector<int> degree( n );
+    for ( int i = 0; i < n; i++ )
+        degree[i] = rowStart[i + 1] - rowStart[i];
+
+    std::vector<bool> visited( n, false );
+    std::vector<int> order;
+    order.reserve( n );
+    std::vector<int> neighbours;
+
+    while ( int( order.size() ) < n )
+    {
+        int start = -1;
+        for ( int i = 0; i < n; i++ )
+            if ( not visited[i] && ( start < 0 || degree[i] < degree[start] ) )
+                start = i;
+
+        visited[start] = true;
+        order.push_back( start );
+        for ( unsigned int head = order.size() - 1; head < order.size(); head++ )
+        {
+            const int i = order[head];
+
+            neighbours.clear();
+            for ( int k = rowStart[i]; k < rowStart[i + 1]; k++ )
+                if ( not visited[columns[k]] )
+                {
+                    visited[columns[k]] = true;
+                    neighbours.push_back( columns[k] );
+                }
+            std::stable_sort( neighbours.begin(), neighbours.end(), LowerDegree( degree ) );
+            order.insert( order.end(), neighbours.begin(), neighbours.end() );
+        }
+    }
+
+    for ( int i = 0; i < n; i++ )
+        permutation_[i] = order[n - 1 - i];
+}
+
+
+
+// Incomplete LU factorization of P = I - gamma J on the pattern of the
+// factors, row by row (IKJ variant).
+int
+SparsePreconditioner::factorize( const realtype gamma )
+{
+    const int n = jacobian_.size();
+    const realtype * const values = jacobian_.values();
+
+    std::fill( factor_.begin(), factor_.end(), 0.0 );
+    for ( int i = 0; i < n; i++ )
+        factor_[diagonal_[i]] = 1.0;
+    for ( int k = 0; k < jacobian_.nonzeros(); k++ )
+        if ( jacobianPositions_[k] >= 0 )
+            factor_[jacobianPositions_[k]] -= gamma*values[k];
+
+    for ( int i = 0; i < n; i++ )
+    {
+        for ( int k = factorStart_[i]; k < factorStart_[i + 1]; k++ )
+            marker_[factorColumns_[k]] = k;
+
+        for ( int k = factorStart_[i]; k < diagonal_[i]; k++ )
+        {
+            const int j = factorColumns_[k];
+            factor_[k] /= factor_[diagonal_[j]];
+            for ( int m = diagonal_[j] + 1; m < factorStart_[j + 1]; m++ )
+            {
+                const int position = marker_[factorColumns_[m]];
+                if ( position >= 0 )
+                    factor_[position] -= factor_[k]*factor_[m];
+            }
+        }
+
+        for ( int k = factorStart_[i]; k < factorStart_[i + 1]; k++ )
+            marker_[factorColumns_[k]] = -1;
+
+        if ( factor_[diagonal_[i]] == 0.0 )
+            return 1;
+    }
+
+    factorizations_++;
+    return 0;
+}
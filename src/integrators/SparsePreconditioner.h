@@ -0,0 +1,118 @@
+#ifndef SPARSE_PRECONDITIONER_H
+#define SPARSE_PRECONDITIONER_H
+
+#include "../utils/SparseMatrix.h"
+
+#include <sundials/sundials_types.h>
+
+#include <vector>
+
+class ExplicitOde;
+class Workspace;
+template <typename T> class Vector;
+
+// Preconditioner P = I - gamma J for the Krylov solvers of CVODE, built
+// from the sparse Jacobian matrix of the problem, see
+// ExplicitOde::sparseJacobian(). Two kinds are available:
+//
+//  - incomplete LU factorization ILU(k), which keeps the fill-in of level
+//    at most k; ILU(0) has the pattern of the stencil. The unknowns can be
+//    renumbered by the reverse Cuthill-McKee ordering before.
+//
+//  - line block Jacobi, the exact LU factorization of the couplings along
+//    each grid line (ExplicitOde::lineBlockSize()). The couplings between
+//    the lines and the wrap-around of periodic lines are dropped.
+//
+// The Jacobian matrix is evaluated only when CVODE does not allow to reuse
+// the saved one (jok false). The pattern of the factors is computed at the
+// first setup and whenever the pattern of the Jacobian changes. In a distributed run the matrix is the diagonal block owned
+// by the process, so the preconditioner is block Jacobi across processes.
+// The solve works in a buffer of the workspace of the problem.
+class SparsePreconditioner
+{
+    public:
+
+        enum Type { incompleteLU, lineBlockJacobi };
+        enum Ordering { naturalOrdering, reverseCuthillMcKee };
+
+        SparsePreconditioner( const Type type, const int fillLevel, const Ordering ordering );
+
+        // returns 0 on success and 1 if a pivot vanished, which CVODE
+        // treats as recoverable
+        int setup( ExplicitOde & ode, const realtype t, const Vector<realtype> & y,
+                const Vector<realtype> & fy, const bool jok, bool & jacobianCurrent,
+                const realtype gamma );
+
+        // solves P z = r
+        void solve( const realtype * r, realtype * z );
+
+        long int jacobianEvaluations() const;
+        long int factorizations() const;
+        int factorNonzeros() const;
+
+        // for a new run, the pattern and the factors are kept
+        void resetCounters();
+
+    private:
+
+        Type type_;
+        int fillLevel_;
+        Ordering ordering_;
+        bool analyzed_;
+
+        SparseMatrix jacobian_;
+
+        // row i of the factors is row permutation_[i] of P; the unit lower
+        // factor L and the upper factor U share the pattern, the diagonal
+        // of row i is at diagonal_[i]
+        std::vector<int> permutation_;
+        std::vector<int> factorStart_;
+        std::vector<int> factorColumns_;
+        std::vector<int> diagonal_;
+        std::vector<realtype> factor_;
+
+        // position of each entry of the Jacobian in the factors, -1 if it
+        // is dropped
+        std::vector<int> jacobianPositions_;
+
+        Workspace * workspace_;
+        int workBuffer_;
+        std::vector<int> marker_;
+
+        long int jacobianEvaluations_;
+        long int factorizations_;
+
+        bool samePattern( const SparseMatrix & J ) const;
+        void analyze( const int blockSize );
+        void orderReverseCuthillMcKee();
+        int factorize( const realtype gamma );
+};
+
+
+
+inline
+long int
+SparsePreconditioner::jacobianEvaluations() const
+{
+    return jacobianEvaluations_;
+}
+
+
+
+inline
+long int
+SparsePreconditioner::factorizations() const
+{
+    return factorizations_;
+}
+
+
+
+inline
+int
+SparsePreconditioner::factorNonzeros() const
+{
+    return factorColumns_.size();
+}
+
+#endif // SPARSE_PRECONDITIONER_H
@@ -0,0 +1,287 @@
+#include "StabilizedRungeKuttaBase.h"
+#include "../odesystem/ExplicitOde.h"
+#include "../utils/LogStream.h"
+#include "../utils/MpiUtilities.h"
+#include "../utils/Profiler.h"
+
+#include <cmath>
+
+
+StabilizedRungeKuttaBase::StabilizedRungeKuttaBase( int orderError )
+  :
+    RungeKuttaBase( orderError ),
+    maxStage_( 2 ),
+    stages_( 0 ),
+    spectralRadius_( 0.0 ),
+    computeSpectralRadius_( true ),
+    jacobianAtT_( false ),
+    computeSRFlag_( 0 ),
+    maxIterations_( 50 )
+{}
+
+
+
+IntegratorStatsBase&
+StabilizedRungeKuttaBase::stats()
+{
+  return (IntegratorStatsBase&) stats_;
+}
+
+
+
+void StabilizedRungeKuttaBase::assignExplicitOde( ExplicitOde& odeProblem,
+    const realtype initialTime,
+    const Vector<realtype>& initialState )
+{
+  RungeKuttaBase::assignExplicitOde( odeProblem, initialTime, initialState );
+
+  stats_.reset();
+
+  fn_.reinit( odeProblem.numberOfEquations() );
+  fev_.reinit( odeProblem.numberOfEquations() );
+  temp1_.reinit( odeProblem.numberOfEquations() );
+  temp2_.reinit( odeProblem.numberOfEquations() );
+  eigenVector_.reinit( odeProblem.numberOfEquations() );
+
+  odeProblem.rhs( currentTime_, currentState_, fn_ );
+  stats_.incRhsEvaluations();
+
+  computeSpectralRadius_ = true;
+  jacobianAtT_ = false;
+}
+
+
+void StabilizedRungeKuttaBase::printInfo() const
+{
+  using namespace std;
+
+  RungeKuttaBase::printInfo();
+
+  logger << endl;
+  logger << "Concrete solver information" << endl;
+  logger << "~~~~~~~~~~~~~~~~~~~~~~~~~~~" << endl;
+  logger << "*Maximum number of stages*:: " << maxStage_ << endl;
+  logger << "*Maximum number of iterations for spectral radius computation*:: " << maxIterations_ << endl;
+  logger << "*Small number*:: " << small_
+    << " (if spectral radius is less than this quantity, it does not restrict the time step size)" << endl << endl;
+}
+
+
+
+void StabilizedRungeKuttaBase::initializeIntegration()
+{
+  if ( computeSpectralRadius_ )
+  {
+    estimateSpectralRadius();
+    jacobianAtT_ = true;
+  }
+
+  small_ = 1.0 / ( endTime_ - currentTime_ );
+}
+
+
+
+void StabilizedRungeKuttaBase::estimateInitialStepsize()
+{
+  realtype dt = endTime_ - currentTime_;
+
+  minStepsize_ = 10.0 * epsilon_ * dt;
+  stepsize_ = dt;
+  if ( spectralRadius_ * stepsize_ > 1.0 )
+    stepsize_ = 1.0 / spectralRadius_;
+
+  stepsize_ = std::max( stepsize_, minStepsize_ );
+  temp1_.equ( 1.0, currentState_, stepsize_, fn_ );
+  odeProblem_->rhs( currentTime_ + stepsize_, temp1_, temp2_ );
+  stats_.incRhsEvaluations();
+  temp2_.add( -1.0, fn_ );
+
+  realtype estimate = stepsize_ * globalRmsNorm( temp2_, weights_ );
+
+  if ( 0.1 * stepsize_ < dt * std::sqrt( estimate ) )
+    stepsize_ = std::max( 0.1 * stepsize_ / std::sqrt( estimate ) , minStepsize_ );
+  else
+    stepsize_ = dt;
+}
+
+
+
+void StabilizedRungeKuttaBase::estimateSpectralRadius()
+{
+  ODEITY_PROBE( "spectral radius" );
+
+  if ( stats_.getAcceptedSteps() == 0 )
+    eigenVector_ = fn_;
+
+  realtype yNorm = globalL2Norm( currentState_ );
+  realtype evNorm = globalL2Norm( eigenVector_ );
+  realtype dyNorm;
+
+  if ( yNorm != 0.0 && evNorm != 0.0 )
+  {
+    dyNorm = yNorm * sqrtEpsilon_;
+    eigenVector_.sadd( dyNorm / evNorm, 1.0, currentState_ );
+  }
+  else if ( yNorm != 0.0)
+  {
+    dyNorm = yNorm * sqrtEpsilon_;
+    eigenVector_.equ( 1.0, currentState_, sqrtEpsilon_, currentState_ );
+  }
+  else if ( evNorm != 0.0 )
+  {
+    dyNorm = epsilon_;
+    eigenVector_.scale( dyNorm / evNorm );
+  }
+  else
+  {
+    dyNorm = epsilon_;
+    eigenVector_ = dyNorm;
+  }
+
+  //--------------------------------------------
+  //  Now iterate with a nonlinear power method.
+  //--------------------------------------------
+  realtype sigma = 0.0;
+  realtype sigmal;
+  realtype dfNorm = 0.0;
+
+  int iter;
+  for ( iter = 1; iter <= maxIterations_; iter++ )
+  {
+    odeProblem_->rhs( currentTime_, eigenVector_, fev_ );
+    stats_.incRhsEvaluations();
+
+    dfNorm = 0.0;
+    fev_.add( -1.0, fn_ );
+    dfNorm = globalL2Norm( fev_ );
+
+    sigmal = sigma;
+    sigma = dfNorm/dyNorm;
+
+    //----------------------------------------------------------
+    //  sprad is a little bigger than the estimate sigma of the
+    //  spectral radius, so is more likely to be an upper bound.
+    //----------------------------------------------------------
+    spectralRadius_ = 1.2 * sigma;
+    if ( iter >= 2 && std::fabs( sigma - sigmal) <= std::max( sigma, small_) * 0.01 )
+    {
+      eigenVector_.add( -1.0, currentState_ );
+      ++stats_.nspraditers_;
+      break;
+      // return;
+    }
+    //--------------------------------------
+    //  The next v(*) is the change in f
+    //  scaled so that norm(v - yn) = dynrm.
+    //--------------------------------------
+    if ( dfNorm != 0.0 )
+      eigenVector_.equ( 1.0, currentState_, dyNorm/dfNorm, fev_);
+    else
+    {
+      //-------------------------------------------------------
+      //  The new v(*) degenerated to yn(*)--"randomly" perturb
+      //  current approximation to the eigenvector by changing
+      //  the sign of one component.
+      //-------------------------------------------------------
+      int index = 1 + ( iter % odeProblem_->numberOfEquations() );
+      eigenVector_(index) = currentState_(index)
+        - (eigenVector_(index) - currentState_(index));
+    }
+  }
+
+  AssertThrow( iter <= maxIterations_, ExcMaxIterExceededSR( maxIterations_ ) );
+}
+
+
+
+void StabilizedRungeKuttaBase::updateSpectralRadius()
+{
+  if ( computeSpectralRadius_ )
+  {
+    estimateSpectralRadius();
+    jacobianAtT_ = true;
+  }
+
+  last_ = false;
+  if ( 1.2 * stepsize_ > endTime_ - currentTime_ )
+  {
+    stepsize_ = endTime_ - currentTime_;
+    last_ = true;
+  }
+}
+
+
+
+void StabilizedRungeKuttaBase::newStepsizeAfterRejectedStep()
+{
+  stepsize_ = safety_ * stepsize_
+    / std::pow( newLocalErrorNorm_, 1.0/(realtype)( orderError_ + 1 ) );
+}
+
+
+
+void StabilizedRungeKuttaBase::handleRejectedStep()
+{
+  RungeKuttaBase::handleRejectedStep();
+
+  stats_.incRejectedSteps();
+  computeSpectralRadius_ = not jacobianAtT_; // if we have jacobian, do not compute it
+}
+
+
+
+void StabilizedRungeKuttaBase::newStepsizeAfterAcceptedStep()
+{
+  realtype temp1, temp2, factor = 10.0;
+  const realtype exponent = 1.0 / (realtype)( orderError_ + 1 );
+
+  if ( stats_.getAcceptedSteps() == 0 )
+  {
+    temp1 = std::pow( newLocalErrorNorm_, exponent );
+    if ( 0.8 < factor * temp1 )
+      factor = 0.8 / temp1;
+  }
+  else
+  {
+    temp1 = 0.8 * stepsize_ * std::pow( oldLocalErrorNorm_, exponent );
+    temp2 = oldStepsize_ * std::pow( newLocalErrorNorm_, 2.0 * exponent );
+    if ( temp1 < factor * temp2 )
+      factor = temp1 / temp2;
+  }
+  stepsize_ *= std::max( 0.1, factor);
+  stepsize_ = std::max( minStepsize_, stepsize_ );
+}
+
+
+
+void StabilizedRungeKuttaBase::completeStep()
+{
+  stats_.incAcceptedSteps();
+  // stats_.updateTimeStepsize( currentTime_ , stepsize_ );
+
+  RungeKuttaBase::completeStep();
+}
+
+
+
+void StabilizedRungeKuttaBase::prepareNextStep()
+{
+  RungeKuttaBase::prepareNextStep();
+
+  jacobianAtT_ = false; // we assume that jacobian is not constant
+  computeSpectralRadius_ = false;
+
+  computeSRFlag_ = ( computeSRFlag_ + 1 ) % 25;
+  if ( computeSRFlag_ == 0 )
+    computeSpectralRadius_ = not jacobianAtT_;
+
+  swap( fn_, temp1_ );
+}
+
+
+
+void
+StabilizedRungeKuttaBase::updateHistory()
+{
+  stats_.updateHistory( oldTime_, oldStepsize_, stages_ );
+}
@@ -0,0 +1,82 @@
+#ifndef STABILIZED_RUNGE_KUTTA_BASE_H
+#define STABILIZED_RUNGE_KUTTA_BASE_H
+
+#include "RungeKuttaBase.h"
+#include "IntegratorStats.h"
+
+class ExplicitOde;
+
+// Common part of the explicit stabilized Runge-Kutta methods (RKC, ROCK2,
+// ROCK4): estimation of the spectral radius of the Jacobian by a nonlinear
+// power method, the initial stepsize and the stepsize control. Derived
+// classes choose the number of stages in startStep() and compute the new
+// solution point together with f(newState_), which is stored in temp1_.
+class StabilizedRungeKuttaBase : public RungeKuttaBase
+{
+  public:
+    void assignExplicitOde( ExplicitOde& odeProblem,
+                            const realtype initialTime,
+                            const Vector<realtype>& initialState );
+
+    virtual void printInfo() const;
+    void setMaxSpecRadIterations( const int maxIterations );
+    int getMaxSpecRadIterations() const;
+    IntegratorStatsBase& stats();
+
+    DeclException1( ExcMaxIterExceededSR,
+        int,
+        << "Maximum number of iterations (" << arg1 << ") exceeded during "
+        "computation of the spectral radius of Jacobian " << std::endl );
+
+  protected:
+
+    int maxStage_;
+    int stages_;
+    realtype spectralRadius_;
+    bool computeSpectralRadius_;
+    bool jacobianAtT_;
+    int computeSRFlag_;
+    realtype small_;
+    int maxIterations_;
+
+    Vector<realtype> fn_;
+    Vector<realtype> fev_;
+    Vector<realtype> temp1_;
+    Vector<realtype> temp2_;
+    Vector<realtype> eigenVector_;
+
+    RungeKuttaChebyshevStats stats_;
+
+    StabilizedRungeKuttaBase( int orderError );
+
+    void initializeIntegration();
+    void estimateInitialStepsize();
+    void estimateSpectralRadius();
+    void updateSpectralRadius();
+    void newStepsizeAfterRejectedStep();
+    void handleRejectedStep();
+    void newStepsizeAfterAcceptedStep();
+    void completeStep();
+    void prepareNextStep();
+    void updateHistory();
+};
+
+
+
+inline
+void
+StabilizedRungeKuttaBase::setMaxSpecRadIterations( const int maxIterations )
+{
+  maxIterations_ = maxIterations;
+}
+
+
+
+inline
+int
+StabilizedRungeKuttaBase::getMaxSpecRadIterations() const
+{
+  return maxIterations_;
+}
+
+#endif // STABILIZED_RUNGE_KUTTA_BASE_H
@@ -0,0 +1,69 @@
+#include "StepHistory.h"
+#include "../utils/Exceptions.h"
+
+
+
+StepHistory::StepHistory()
+    :
+        buffer_( 0 ),
+        capacity_( 0 ),
+        size_( 0 )
+{}
+
+
+
+StepHistory::~StepHistory()
+{
+    close();
+}
+
+
+
+void
+StepHistory::open( const std::string & fileName, const unsigned int capacity )
+{
+    Assert( capacity > 0, ExcMessage( "The history buffer must hold at least one record" ) );
+
+    close();
+
+    file_.open( fileName.c_str(), std::ios::out | std::ios::binary | std::ios::trunc );
+    AssertThrow( file_, ExcMessage( "Cannot open the history file" ) );
+
+    const char magic[8] = { 'O', 'D', 'E', 'I', 'T', 'Y', 'S', 'H' };
+    const int header[2] = { 1, sizeof( Record ) };
+    file_.write( magic, sizeof( magic ) );
+    file_.write( reinterpret_cast<const char*>( header ), sizeof( header ) );
+
+    buffer_ = new Record[capacity];
+    capacity_ = capacity;
+    size_ = 0;
+}
+
+
+
+void
+StepHistory::close()
+{
+    if ( not isOpen() )
+        return;
+
+    flush();
+    file_.close();
+
+    delete[] buffer_;
+    buffer_ = 0;
+    capacity_ = 0;
+}
+
+
+
+void
+StepHistory::flush()
+{
+    if ( size_ == 0 )
+        return;
+
+    file_.write( reinterpret_cast<const char*>( buffer_ ), size_*sizeof( Record ) );
+    file_.flush();
+    size_ = 0;
+}
@@ -0,0 +1,80 @@
+#ifndef STEP_HISTORY_H
+#define STEP_HISTORY_H
+
+#include <sundials/sundials_types.h>
+
+#include <fstream>
+#include <string>
+
+// History of the accepted steps of an integrator in a binary file. The
+// records are collected in a preallocated buffer and written in bulk when
+// it is full, on flush() and when the history is closed, so that recording
+// a step costs only a few stores.
+//
+// The file starts with a 16 byte header: the magic "ODEITYSH", the format
+// version and the size of a record as 32-bit integers. Each record holds
+// the time reached by the step and its size as doubles, followed by a
+// 32-bit integer with the order of the CVODE method or the number of
+// stages of the stabilized Runge-Kutta methods (zero for the other methods)
+// and 32 bits of padding, all in the byte order of the machine.
+class StepHistory
+{
+    public:
+
+        struct Record
+        {
+            double time;
+            double stepsize;
+            int value;
+            int reserved;
+        };
+
+        static const unsigned int defaultCapacity = 65536;
+
+        StepHistory();
+        ~StepHistory();
+
+        void open( const std::string & fileName, const unsigned int capacity = defaultCapacity );
+        void close();
+        bool isOpen() const;
+
+        void record( const realtype time, const realtype stepsize, const int value );
+        void flush();
+
+    private:
+
+        std::ofstream file_;
+        Record * buffer_;
+        unsigned int capacity_;
+        unsigned int size_;
+
+        StepHistory( const StepHistory& );
+        StepHistory& operator = ( const StepHistory& );
+};
+
+
+
+inline
+void
+StepHistory::record( const realtype time, const realtype stepsize, const int value )
+{
+    if ( size_ == capacity_ )
+        flush();
+
+    Record & r = buffer_[size_++];
+    r.time = time;
+    r.stepsize = stepsize;
+    r.value = value;
+    r.reserved = 0;
+}
+
+
+
+inline
+bool
+StepHistory::isOpen() const
+{
+    return buffer_ != 0;
+}
+
+#endif // STEP_HISTORY_H
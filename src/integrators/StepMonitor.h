@@ -0,0 +1,18 @@
+#ifndef STEP_MONITOR_H
+#define STEP_MONITOR_H
+
+class OdeIntegratorBase;
+
+// Observer of the progress of an integration, notified by the integrator
+// after every accepted step. It is called often, so it should return
+// quickly in most calls.
+class StepMonitor
+{
+    public:
+
+        virtual ~StepMonitor() {}
+
+        virtual void stepTaken( OdeIntegratorBase & solver ) = 0;
+};
+
+#endif // STEP_MONITOR_H
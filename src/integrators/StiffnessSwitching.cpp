@@ -0,0 +1,343 @@
+#include "StiffnessSwitching.h"
+#include "CVode.h"
+#include "DormandPrince45.h"
+#include "RungeKutta23.h"
+#include "LowStorageRungeKutta23.h"
+#include "LowStorageRungeKutta34.h"
+#include "RungeKuttaMerson45.h"
+#include "../odesystem/ExplicitOde.h"
+#include "../utils/LogStream.h"
+#include "../utils/MpiUtilities.h"
+#include "../utils/Profiler.h"
+#include "../utils/Workspace.h"
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+
+
+OdeIntegratorBase * createStiffnessSwitchingSolver()
+{
+    return new StiffnessSwitching();
+}
+
+
+
+StiffnessSwitching::StiffnessSwitching()
+    :
+        nonStiffSolverName_( "CVodeAdams" ),
+        stiffSolverName_( "CVodeGMRES" ),
+        nonStiffSolver_( 0 ),
+        stiffSolver_( 0 ),
+        active_( 0 ),
+        startStiff_( true ),
+        checkInterval_( 0.0 ),
+        stiffThreshold_( 1.0 ),
+        nonStiffThreshold_( 0.2 ),
+        rejectionRatio_( 0.2 ),
+        maxIterations_( 20 ),
+        acceptedAtCheck_( 0 ),
+        rejectedAtCheck_( 0 ),
+        fyBuffer_( -1 ),
+        tempBuffer_( -1 )
+{
+    solverName_ = "Stiffness switching";
+
+    solverFactory_.registerCreator( "CVodeAdams", createCVodeAdamsSolver );
+    solverFactory_.registerCreator( "RK23", createRungeKutta23Solver );
+    solverFactory_.registerCreator( "RKM45", createRungeKuttaMerson45Solver );
+    solverFactory_.registerCreator( "DP45", createDormandPrince45Solver );
+    solverFactory_.registerCreator( "LSRK23", createLowStorageRungeKutta23Solver );
+    solverFactory_.registerCreator( "LSRK34", createLowStorageRungeKutta34Solver );
+    solverFactory_.registerCreator( "CVodeGMRES", createCVodeGMRESSolver );
+    solverFactory_.registerCreator( "CVodeBiCG", createCVodeBiCGSolver );
+    solverFactory_.registerCreator( "CVodeTFQMR", createCVodeTFQMRSolver );
+    solverFactory_.registerCreator( "CVodeBand", createCVodeBandSolver );
+    solverFactory_.registerCreator( "CVodeDense", createCVodeDenseSolver );
+
+    createSolvers();
+}
+
+
+
+StiffnessSwitching::~StiffnessSwitching()
+{
+    delete nonStiffSolver_;
+    delete stiffSolver_;
+}
+
+
+
+// Both solvers report their steps to this integrator, which also makes them
+// record the size of their last step.
+void
+StiffnessSwitching::createSolvers()
+{
+    delete nonStiffSolver_;
+    delete stiffSolver_;
+
+    nonStiffSolver_ = solverFactory_.createObject( nonStiffSolverName_ );
+    stiffSolver_ = solverFactory_.createObject( stiffSolverName_ );
+    nonStiffSolver_->setStepMonitor( this );
+    stiffSolver_->setStepMonitor( this );
+    active_ = 0;
+}
+
+
+
+void
+StiffnessSwitching::assignExplicitOde(
+        ExplicitOde& odeProblem,
+        const realtype initialTime,
+        const Vector<realtype> &initialState )
+{
+    OdeIntegratorBase::assignExplicitOde( odeProblem, initialTime, initialState );
+    stats_.reset();
+
+    const unsigned int n = odeProblem.numberOfEquations();
+    eigenVector_.reinit( n );
+    fyBuffer_ = odeProblem.workspace().request( "right hand side for the stiffness check", n,
+            Workspace::stiffnessCheck );
+    tempBuffer_ = odeProblem.workspace().request( "perturbed state for the stiffness check", n,
+            Workspace::stiffnessCheck );
+
+    activate( startStiff_ );
+}
+
+
+
+void
+StiffnessSwitching::activate( const bool stiff )
+{
+    if ( active_ != 0 )
+        stats_.endPeriod( active_->stats() );
+
+    active_ = stiff ? stiffSolver_ : nonStiffSolver_;
+    stats_.stiff_ = stiff;
+
+    active_->setRelativeTolerance( relTol_ );
+    active_->setAbsoluteTolerance( absTol_ );
+    active_->assignExplicitOde( *odeProblem_, currentTime_, currentState_ );
+
+    acceptedAtCheck_ = 0;
+    rejectedAtCheck_ = 0;
+}
+
+
+
+// If the non-stiff solver gives up inside an interval, e.g. CVODE after too
+// much work or repeated convergence failures, or an explicit method whose
+// step fell below the minimum, the stiff solver takes over from its last
+// accepted step. A failure of the stiff solver is passed on.
+void
+StiffnessSwitching::integrateTo( const realtype tOut )
+{
+    realtype tEnd;
+    do
+    {
+        tEnd = checkInterval_ > 0.0 ? std::min( tOut, currentTime_ + checkInterval_ ) : tOut;
+
+        try
+        {
+            active_->integrateTo( tEnd );
+        }
+        catch ( std::exception & )
+        {
+            if ( stiff() )
+                throw;
+
+            currentTime_ = active_->currentTime();
+            currentState_ = active_->currentState();
+            stats_.switchesToStiff_++;
+            activate( true );
+            active_->integrateTo( tEnd );
+        }
+        currentTime_ = tEnd;
+        currentState_ = active_->currentState();
+
+        checkStiffness();
+    }
+    while ( tEnd < tOut );
+}
+
+
+
+void
+StiffnessSwitching::checkStiffness()
+{
+    ODEITY_PROBE( "stiffness check" );
+
+    const IntegratorStatsBase & activeStats = active_->stats();
+    const long int accepted = activeStats.acceptedSteps() - acceptedAtCheck_;
+    const long int rejected = activeStats.rejectedSteps() - rejectedAtCheck_;
+    acceptedAtCheck_ = activeStats.acceptedSteps();
+    rejectedAtCheck_ = activeStats.rejectedSteps();
+
+    // the end was reached by interpolation, nothing new to judge
+    if ( accepted == 0 )
+        return;
+
+    const realtype ratio = estimateSpectralRadius()*activeStats.lastStepsize();
+    stats_.lastStiffnessRatio_ = ratio;
+
+    if ( stiff() )
+    {
+        if ( ratio < nonStiffThreshold_ )
+        {
+            stats_.switchesToNonStiff_++;
+            activate( false );
+        }
+    }
+    else if ( ratio > stiffThreshold_ || rejected > rejectionRatio_*accepted )
+    {
+        stats_.switchesToStiff_++;
+        activate( true );
+    }
+}
+
+
+
+// Nonlinear power method on f(t, y + v) - f(t, y) as in RKC, started from
+// the estimate of the eigenvector of the last check, or from f(t, y).
+realtype
+StiffnessSwitching::estimateSpectralRadius()
+{
+    const long int n = currentState_.size();
+    WorkspaceVector fy( odeProblem_->workspace().data( fyBuffer_ ), n );
+    WorkspaceVector temp( odeProblem_->workspace().data( tempBuffer_ ), n );
+
+    odeProblem_->rhs( currentTime_, currentState_, *fy );
+    stats_.spectralRadiusRhs_++;
+
+    if ( globalL2Norm( eigenVector_ ) == 0.0 )
+        eigenVector_ = *fy;
+    if ( globalL2Norm( eigenVector_ ) == 0.0 )
+        eigenVector_ = 1.0;
+
+    const realtype dyNorm = sqrtEpsilon_*std::max( globalL2Norm( currentState_ ), 1.0 );
+    realtype sigma = 0.0;
+
+    for ( int iter = 0; iter < maxIterations_; iter++ )
+    {
+        const realtype vNorm = globalL2Norm( eigenVector_ );
+        if ( vNorm == 0.0 )
+            break;
+
+        temp->equ( 1.0, currentState_, dyNorm/vNorm, eigenVector_ );
+        odeProblem_->rhs( currentTime_, *temp, eigenVector_ );
+        stats_.spectralRadiusRhs_++;
+        eigenVector_.add( -1.0, *fy );
+
+        const realtype sigmaOld = sigma;
+        sigma = globalL2Norm( eigenVector_ )/dyNorm;
+        if ( iter > 0 && std::fabs( sigma - sigmaOld ) <= 0.01*sigma )
+            break;
+    }
+
+    return 1.2*sigma;
+}
+
+
+
+IntegratorStatsBase&
+StiffnessSwitching::stats()
+{
+    stats_.active_ = active_ != 0 ? &active_->stats() : 0;
+    return stats_;
+}
+
+
+
+void
+StiffnessSwitching::updateHistory()
+{
+    const IntegratorStatsBase & activeStats = active_->stats();
+    stats_.updateTimeStepsize( active_->currentTime(), activeStats.lastStepsize(),
+            activeStats.lastStepValue() );
+}
+
+
+
+void
+StiffnessSwitching::stepTaken( OdeIntegratorBase & solver )
+{
+    currentTime_ = solver.currentTime();
+    if ( recordSteps() )
+        OdeIntegratorBase::stepTaken();
+}
+
+
+
+bool
+StiffnessSwitching::stiff() const
+{
+    return active_ == stiffSolver_;
+}
+
+
+
+void
+StiffnessSwitching::declareParameters( ParameterHandler & prm )
+{
+    OdeIntegratorBase::declareParameters( prm );
+
+    prm.enter_subsection( "ODE integrator" );
+    prm.enter_subsection( "Stiffness switching" );
+        prm.declare_entry( "non-stiff solver", "CVodeAdams",
+                Patterns::Selection("CVodeAdams|RK23|RKM45|DP45|LSRK23|LSRK34") );
+        prm.declare_entry( "stiff solver", "CVodeGMRES",
+                Patterns::Selection("CVodeGMRES|CVodeBiCG|CVodeTFQMR|CVodeBand|CVodeDense") );
+        prm.declare_entry( "start stiff", "true", Patterns::Bool() );
+        prm.declare_entry( "check interval", "0.0", Patterns::Double(),
+                "Time between the checks of stiffness, 0 checks at the output times only" );
+        prm.declare_entry( "stiff threshold", "1.0", Patterns::Double(),
+                "Spectral radius times step of the non-stiff solver above which the stiff one takes over" );
+        prm.declare_entry( "non-stiff threshold", "0.2", Patterns::Double(),
+                "Spectral radius times step of the stiff solver below which the non-stiff one takes over" );
+        prm.declare_entry( "rejection ratio", "0.2", Patterns::Double(),
+                "Rejected per accepted steps of the non-stiff solver above which the stiff one takes over" );
+        prm.declare_entry( "spectral radius iterations", "20", Patterns::Integer() );
+    prm.leave_subsection();
+    prm.leave_subsection();
+}
+
+
+
+void
+StiffnessSwitching::getParameters( ParameterHandler & prm )
+{
+    OdeIntegratorBase::getParameters( prm );
+
+    prm.enter_subsection( "ODE integrator" );
+    prm.enter_subsection( "Stiffness switching" );
+        nonStiffSolverName_ = prm.get( "non-stiff solver" );
+        stiffSolverName_ = prm.get( "stiff solver" );
+        startStiff_ = prm.get_bool( "start stiff" );
+        checkInterval_ = prm.get_double( "check interval" );
+        stiffThreshold_ = prm.get_double( "stiff threshold" );
+        nonStiffThreshold_ = prm.get_double( "non-stiff threshold" );
+        rejectionRatio_ = prm.get_double( "rejection ratio" );
+        maxIterations_ = prm.get_integer( "spectral radius iterations" );
+    prm.leave_subsection();
+    prm.leave_subsection();
+
+    createSolvers();
+    nonStiffSolver_->getParameters( prm );
+    stiffSolver_->getParameters( prm );
+}
+
+
+
+void
+StiffnessSwitching::printInfo() const
+{
+    OdeIntegratorBase::printInfo();
+
+    logger << "*Non-stiff solver*:: " << nonStiffSolverName_ << std::endl;
+    logger << "*Stiff solver*:: " << stiffSolverName_ << std::endl;
+    logger << "*Start stiff*:: " << startStiff_ << std::endl;
+    logger << "*Check interval*:: " << checkInterval_ << std::endl;
+    logger << "*Stiff threshold*:: " << stiffThreshold_ << std::endl;
+    logger << "*Non-stiff threshold*:: " << nonStiffThreshold_ << std::endl;
+    logger << "*Rejection ratio*:: " << rejectionRatio_ << std::endl;
+}
@@ -0,0 +1,96 @@
+#ifndef STIFFNESS_SWITCHING_H
+#define STIFFNESS_SWITCHING_H
+
+#include "OdeIntegratorBase.h"
+#include "IntegratorStats.h"
+#include "StepMonitor.h"
+#include "../utils/Factory.h"
+
+#include <string>
+
+// Integrates with a non-stiff solver (Adams or explicit Runge-Kutta) while
+// the problem is not stiff and with a stiff one (BDF) while it is. At every
+// output time, or after each check interval, the spectral radius rho of the
+// Jacobian is estimated by a nonlinear power method and compared with the
+// last step h of the active solver:
+//
+//  - the non-stiff solver is replaced if rho h exceeds the stiff threshold,
+//    i.e. its steps are limited by stability rather than accuracy, or if
+//    it rejected too many steps since the last check,
+//
+//  - the stiff solver is replaced if rho h drops below the non-stiff
+//    threshold, i.e. the non-stiff solver could take the same steps.
+//
+// The other solver restarts from the current state, which is as accurate as
+// the tolerances. The stiff solver also takes over, from the last accepted
+// step, if the non-stiff one fails inside an interval. The solvers take their
+// parameters from their own subsections. The stabilized methods RKC and ROCK
+// are not offered as non-stiff solvers: their stability regions grow with
+// the number of stages, so the thresholds on rho h do not apply to them.
+class StiffnessSwitching : public OdeIntegratorBase, public StepMonitor
+{
+    public:
+
+        StiffnessSwitching();
+        ~StiffnessSwitching();
+
+        void assignExplicitOde(
+                ExplicitOde& odeProblem,
+                const realtype initialTime,
+                const Vector<realtype> &initialState );
+
+        void integrateTo( const realtype tOut );
+        IntegratorStatsBase& stats();
+        void updateHistory();
+
+        // called by the active solver after each of its steps
+        void stepTaken( OdeIntegratorBase & solver );
+
+        bool stiff() const;
+
+        static void declareParameters( ParameterHandler & prm );
+        void getParameters( ParameterHandler & prm );
+
+        void printInfo() const;
+
+    private:
+
+        Factory<OdeIntegratorBase,std::string> solverFactory_;
+
+        std::string nonStiffSolverName_;
+        std::string stiffSolverName_;
+        OdeIntegratorBase * nonStiffSolver_;
+        OdeIntegratorBase * stiffSolver_;
+        OdeIntegratorBase * active_;
+
+        bool startStiff_;
+        realtype checkInterval_;
+        realtype stiffThreshold_;
+        realtype nonStiffThreshold_;
+        realtype rejectionRatio_;
+        int maxIterations_;
+
+        // counts of the active solver at the last check
+        long int acceptedAtCheck_;
+        long int rejectedAtCheck_;
+
+        // the eigenvector is kept from one check to the next, the right
+        // hand side and the perturbed state are in the workspace
+        Vector<realtype> eigenVector_;
+        int fyBuffer_;
+        int tempBuffer_;
+
+        StiffnessSwitchingStats stats_;
+
+        void createSolvers();
+        void activate( const bool stiff );
+        void checkStiffness();
+        realtype estimateSpectralRadius();
+
+        StiffnessSwitching( const StiffnessSwitching& );
+        StiffnessSwitching& operator = ( const StiffnessSwitching& );
+};
+
+OdeIntegratorBase * createStiffnessSwitchingSolver();
+
+#endif // STIFFNESS_SWITCHING_H
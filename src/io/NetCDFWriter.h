@@ -1,6 +1,7 @@
 #ifndef NETCDFWRITER_H
 #define NETCDFWRITER_H
 
+#include "ParallelNetCDFFile.h"
 #include "../odesystem/MolOdeSystem.h"
 #include "../utils/Vector.h"
 
@@ -34,6 +35,10 @@ class NetCDFWriter
     private:
 
         void prepareOutputDirectory();
+        void initializeParallelFile();
+
+        template<typename T>
+        bool writeParallelGlobalAtt( const std::string & name, const T & value );
 
         const MolOdeSystem<N> * odeSystem_;
         const OdeIntegratorBase * solver_;
@@ -52,6 +57,10 @@ class NetCDFWriter
         NcDim  *dims[N+1];
         std::vector<NcVar*> vars;
 
+        // with parallel NetCDF all processes write to the file
+        ParallelNetCDFFile * parallelFile_;
+        std::vector<int> parallelVars_;
+
         Vector<double> tmpStorage_;
 };
 
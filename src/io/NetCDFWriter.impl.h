@@ -10,6 +10,8 @@
 #include "../utils/JobIdentifier.h"
 #include "../utils/Utilities.h"
 #include "../utils/Exceptions.h"
+#include "../utils/MpiUtilities.h"
+#include "../utils/Profiler.h"
 
 
 
@@ -19,11 +21,17 @@ NetCDFWriter<N>::NetCDFWriter( const std::string & prefix, const std::string & f
     odeSystem_( 0 ),
     solver_( 0 ),
     err( NcError::silent_nonfatal ),
+    dataFile( 0 ),
     fileName_( filename ),
     prefix_( prefix ),
-    recCounter( 0 )
+    recCounter( 0 ),
+    parallelFile_( 0 )
 {
-    prepareOutputDirectory();
+    // in a distributed run process 0 creates the output directory, the job
+    // identifier in its name need not be the same on the other processes
+    if ( mpiRank() == 0 )
+        prepareOutputDirectory();
+    mpiBroadcast( dirName_ );
 }
 
 
@@ -35,6 +43,18 @@ NetCDFWriter<N>::initialize( const MolOdeSystem<N> * odeSystem, const OdeIntegra
     odeSystem_ = odeSystem;
     solver_ = solver;
 
+#ifdef ODEITY_WITH_PARALLEL_NETCDF
+    if ( mpiSize() > 1 )
+    {
+        initializeParallelFile();
+        return;
+    }
+#endif
+
+    // otherwise process 0 writes all output
+    if ( mpiRank() != 0 )
+        return;
+
     // open NetCDF file
     dataFile = new NcFile( (dirName_+fileName_).c_str(), NcFile::Replace );
     if ( dataFile == 0 || not dataFile->is_valid() )
@@ -51,7 +71,7 @@ NetCDFWriter<N>::initialize( const MolOdeSystem<N> * odeSystem, const OdeIntegra
         exit( 2 );
     // write other spatial dimensions
     for ( int i = 1; i < N+1; ++i )
-        if ( !( dims[i] = dataFile->add_dim( dimNames[i].c_str(), odeSystem_->grid()->dimension(i-1) ) ) )
+        if ( !( dims[i] = dataFile->add_dim( dimNames[i].c_str(), odeSystem_->grid()->globalDimension(i-1) ) ) )
             exit( 2 );
 
     // auxiliary dimensions for OpenDX fields
@@ -81,15 +101,15 @@ NetCDFWriter<N>::initialize( const MolOdeSystem<N> * odeSystem, const OdeIntegra
     float regPos[N][2];
     for ( int i = 0; i < N; ++i )
     {
-        regPos[i][0] = 0.0; // TODO: should be spatialStep/2.0 in case we use cell-centered scheme => add a method to RectangularGrid telling us if that is so?
         regPos[i][1] = odeSystem_->grid()->spatialStep(i);
+        regPos[i][0] = odeSystem_->grid()->isCellCentred() ? 0.5*regPos[i][1] : 0.0;
     }
     if ( ! pos->put( &regPos[0][0], N, 2 ) )
         exit( 2 );
 
     dataFile->sync();
 
-    tmpStorage_.reinit( odeSystem_->grid()->numberOfNodes() );
+    tmpStorage_.reinit( odeSystem_->grid()->numberOfGlobalNodes() );
 }
 
 
@@ -97,6 +117,19 @@ NetCDFWriter<N>::initialize( const MolOdeSystem<N> * odeSystem, const OdeIntegra
 template<int N>
 NetCDFWriter<N>::~NetCDFWriter()
 {
+#ifdef ODEITY_WITH_PARALLEL_NETCDF
+    if ( parallelFile_ )
+    {
+        time_t curTime = time( 0 );
+        tm * ltime = localtime( &curTime );
+        char timeStr[20];
+        strftime( timeStr, 20, "%F %T\0", ltime );
+
+        parallelFile_->putAttribute( NC_GLOBAL, "finished_datetime", std::string( timeStr ) );
+        delete parallelFile_;
+    }
+#endif
+
     if ( dataFile )
     {
         time_t curTime = time( 0 );
@@ -122,6 +155,11 @@ template<int N>
 void
 NetCDFWriter<N>::writeGlobalAtt( const std::string & name, ncbyte value )
 {
+    if ( writeParallelGlobalAtt( name, value ) )
+        return;
+    if ( mpiRank() != 0 )
+        return;
+
     Assert( dataFile != 0, ExcNotInitialized() );
 
     if ( ! dataFile->add_att( name.c_str(), value ) )
@@ -135,6 +173,11 @@ template<int N>
 void
 NetCDFWriter<N>::writeGlobalAtt( const std::string & name, char value )
 {
+    if ( writeParallelGlobalAtt( name, value ) )
+        return;
+    if ( mpiRank() != 0 )
+        return;
+
     Assert( dataFile != 0, ExcNotInitialized() );
 
     if ( ! dataFile->add_att( name.c_str(), value ) )
@@ -148,6 +191,11 @@ template<int N>
 void
 NetCDFWriter<N>::writeGlobalAtt( const std::string & name, short value )
 {
+    if ( writeParallelGlobalAtt( name, value ) )
+        return;
+    if ( mpiRank() != 0 )
+        return;
+
     Assert( dataFile != 0, ExcNotInitialized() );
 
     if ( ! dataFile->add_att( name.c_str(), value ) )
@@ -161,6 +209,11 @@ template<int N>
 void
 NetCDFWriter<N>::writeGlobalAtt( const std::string & name, int value )
 {
+    if ( writeParallelGlobalAtt( name, value ) )
+        return;
+    if ( mpiRank() != 0 )
+        return;
+
     Assert( dataFile != 0, ExcNotInitialized() );
 
     if ( ! dataFile->add_att( name.c_str(), value ) )
@@ -174,6 +227,11 @@ template<int N>
 void
 NetCDFWriter<N>::writeGlobalAtt( const std::string & name, float value )
 {
+    if ( writeParallelGlobalAtt( name, value ) )
+        return;
+    if ( mpiRank() != 0 )
+        return;
+
     Assert( dataFile != 0, ExcNotInitialized() );
 
     if ( ! dataFile->add_att( name.c_str(), value ) )
@@ -187,6 +245,11 @@ template<int N>
 void
 NetCDFWriter<N>::writeGlobalAtt( const std::string & name, double value )
 {
+    if ( writeParallelGlobalAtt( name, value ) )
+        return;
+    if ( mpiRank() != 0 )
+        return;
+
     Assert( dataFile != 0, ExcNotInitialized() );
 
     if ( ! dataFile->add_att( name.c_str(), value ) )
@@ -200,6 +263,11 @@ template<int N>
 void
 NetCDFWriter<N>::writeGlobalAtt( const std::string & name, const std::string & value )
 {
+    if ( writeParallelGlobalAtt( name, value ) )
+        return;
+    if ( mpiRank() != 0 )
+        return;
+
     Assert( dataFile != 0, ExcNotInitialized() );
 
     if ( ! dataFile->add_att( name.c_str(), value.c_str() ) )
@@ -213,9 +281,45 @@ template<int N>
 void
 NetCDFWriter<N>::writeTimeStep( )
 {
+    ODEITY_PROBE( "output" );
+
+#ifdef ODEITY_WITH_PARALLEL_NETCDF
+    // every process writes its slab of the time record
+    if ( parallelFile_ )
+    {
+        const RectangularGrid<N> & grid = *odeSystem_->grid();
+        std::vector<size_t> start( N+1 );
+        std::vector<size_t> count( N+1 );
+        start[0] = recCounter;
+        count[0] = 1;
+        for ( int i = 0; i < N; ++i )
+        {
+            start[i+1] = grid.globalOffset(i);
+            count[i+1] = grid.dimension(i);
+        }
+
+        parallelFile_->put( parallelVars_[0], start, count, solver_->currentState().data() );
+        parallelFile_->sync();
+        recCounter++;
+        return;
+    }
+#endif
+
+    // the slabs of the processes are contiguous in the node ordering, so
+    // gathering them in order of rank gives the whole state
+    const realtype * state = solver_->currentState().data();
+    if ( mpiSize() > 1 )
+    {
+        mpiGather( state, solver_->currentState().size(), tmpStorage_.data() );
+        state = tmpStorage_.data();
+    }
+
+    if ( mpiRank() != 0 )
+        return;
+
     Assert( dataFile != 0, ExcNotInitialized() );
 
-    if ( ! vars[0]->put_rec( solver_->currentState().data(), recCounter ) )
+    if ( ! vars[0]->put_rec( state, recCounter ) )
         exit( 2 );
 
     // TODO: make it generic for any number of components => need to implement
@@ -236,6 +340,65 @@ NetCDFWriter<N>::writeTimeStep( )
 
 
 
+// The same dimensions, variables and attributes as the file written by
+// process 0 in initialize(), in NetCDF-4 format.
+template<int N>
+void
+NetCDFWriter<N>::initializeParallelFile()
+{
+    parallelFile_ = new ParallelNetCDFFile( dirName_ + fileName_ );
+
+    const char * dimNames[] = { "xdim", "ydim", "zdim" };
+    std::vector<int> dimensions;
+    dimensions.push_back( parallelFile_->addDimension( "time", NC_UNLIMITED ) );
+    for ( int i = 0; i < N; ++i )
+        dimensions.push_back( parallelFile_->addDimension( dimNames[i], odeSystem_->grid()->globalDimension(i) ) );
+
+    std::vector<int> posDimensions( 2 );
+    posDimensions[1] = parallelFile_->addDimension( "ndelta", 2 );
+    posDimensions[0] = parallelFile_->addDimension( "ndim", N );
+    const int posVar = parallelFile_->addVariable( "pos", NC_FLOAT, posDimensions );
+
+    for ( int i = 0; i < odeSystem_->numberOfComponents(); ++i )
+    {
+        const int var = parallelFile_->addVariable( odeSystem_->componentName( i ), NC_DOUBLE, dimensions );
+        parallelFile_->putAttribute( var, "field", odeSystem_->componentName( i ) + std::string(", scalar, series") );
+        parallelFile_->putAttribute( var, "positions", std::string("pos, regular") );
+        parallelVars_.push_back( var );
+    }
+
+    float regPos[N][2];
+    for ( int i = 0; i < N; ++i )
+    {
+        regPos[i][1] = odeSystem_->grid()->spatialStep(i);
+        regPos[i][0] = odeSystem_->grid()->isCellCentred() ? 0.5*regPos[i][1] : 0.0;
+    }
+    parallelFile_->put( posVar, &regPos[0][0] );
+
+    parallelFile_->sync();
+}
+
+
+
+// Writes the attribute to the parallel file if there is one.
+template<int N>
+template<typename T>
+bool
+NetCDFWriter<N>::writeParallelGlobalAtt( const std::string & name, const T & value )
+{
+#ifdef ODEITY_WITH_PARALLEL_NETCDF
+    if ( parallelFile_ )
+    {
+        parallelFile_->putAttribute( NC_GLOBAL, name, value );
+        parallelFile_->sync();
+        return true;
+    }
+#endif
+    return false;
+}
+
+
+
 template<int N>
 void
 NetCDFWriter<N>::prepareOutputDirectory()
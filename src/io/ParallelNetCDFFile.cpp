@@ -0,0 +1,216 @@
+#ifdef ODEITY_WITH_PARALLEL_NETCDF
+
+#include "ParallelNetCDFFile.h"
+#include "../utils/MpiUtilities.h"
+
+#include <mpi.h>
+#include <netcdf_par.h>
+
+
+// Attribute value of process 0.
+template<typename T>
+static inline
+T
+fromFirstProcess( T value )
+{
+    mpiBroadcast( &value, sizeof( value ) );
+    return value;
+}
+
+
+
+ParallelNetCDFFile::ParallelNetCDFFile( const std::string & path )
+    :
+        ncid_( -1 ),
+        defineMode_( true )
+{
+    const int status = nc_create_par( path.c_str(), NC_NETCDF4 | NC_MPIIO | NC_CLOBBER,
+            mpiCommunicator(), MPI_INFO_NULL, &ncid_ );
+    AssertThrow( status == NC_NOERR, ExcNetCDFError( status ) );
+}
+
+
+
+ParallelNetCDFFile::~ParallelNetCDFFile()
+{
+    nc_close( ncid_ );
+}
+
+
+
+int
+ParallelNetCDFFile::addDimension( const std::string & name, const size_t length )
+{
+    define();
+
+    int dimension;
+    const int status = nc_def_dim( ncid_, name.c_str(), length, &dimension );
+    AssertThrow( status == NC_NOERR, ExcNetCDFError( status ) );
+    return dimension;
+}
+
+
+
+// The variables are accessed collectively, which is required for writing
+// records beyond the current length of the record dimension.
+int
+ParallelNetCDFFile::addVariable( const std::string & name, const nc_type type, const std::vector<int> & dimensions )
+{
+    define();
+
+    int variable;
+    int status = nc_def_var( ncid_, name.c_str(), type, dimensions.size(), &dimensions[0], &variable );
+    AssertThrow( status == NC_NOERR, ExcNetCDFError( status ) );
+    status = nc_var_par_access( ncid_, variable, NC_COLLECTIVE );
+    AssertThrow( status == NC_NOERR, ExcNetCDFError( status ) );
+    return variable;
+}
+
+
+
+void
+ParallelNetCDFFile::putAttribute( const int variable, const std::string & name, const signed char value )
+{
+    define();
+
+    const signed char v = fromFirstProcess( value );
+    const int status = nc_put_att_schar( ncid_, variable, name.c_str(), NC_BYTE, 1, &v );
+    AssertThrow( status == NC_NOERR, ExcNetCDFError( status ) );
+}
+
+
+
+void
+ParallelNetCDFFile::putAttribute( const int variable, const std::string & name, const char value )
+{
+    define();
+
+    const char v = fromFirstProcess( value );
+    const int status = nc_put_att_text( ncid_, variable, name.c_str(), 1, &v );
+    AssertThrow( status == NC_NOERR, ExcNetCDFError( status ) );
+}
+
+
+
+void
+ParallelNetCDFFile::putAttribute( const int variable, const std::string & name, const short value )
+{
+    define();
+
+    const short v = fromFirstProcess( value );
+    const int status = nc_put_att_short( ncid_, variable, name.c_str(), NC_SHORT, 1, &v );
+    AssertThrow( status == NC_NOERR, ExcNetCDFError( status ) );
+}
+
+
+
+void
+ParallelNetCDFFile::putAttribute( const int variable, const std::string & name, const int value )
+{
+    define();
+
+    const int v = fromFirstProcess( value );
+    const int status = nc_put_att_int( ncid_, variable, name.c_str(), NC_INT, 1, &v );
+    AssertThrow( status == NC_NOERR, ExcNetCDFError( status ) );
+}
+
+
+
+void
+ParallelNetCDFFile::putAttribute( const int variable, const std::string & name, const float value )
+{
+    define();
+
+    const float v = fromFirstProcess( value );
+    const int status = nc_put_att_float( ncid_, variable, name.c_str(), NC_FLOAT, 1, &v );
+    AssertThrow( status == NC_NOERR, ExcNetCDFError( status ) );
+}
+
+
+
+void
+ParallelNetCDFFile::putAttribute( const int variable, const std::string & name, const double value )
+{
+    define();
+
+    const double v = fromFirstProcess( value );
+    const int status = nc_put_att_double( ncid_, variable, name.c_str(), NC_DOUBLE, 1, &v );
+    AssertThrow( status == NC_NOERR, ExcNetCDFError( status ) );
+}
+
+
+
+void
+ParallelNetCDFFile::putAttribute( const int variable, const std::string & name, const std::string & value )
+{
+    define();
+
+    std::string v = value;
+    mpiBroadcast( v );
+    const int status = nc_put_att_text( ncid_, variable, name.c_str(), v.size(), v.c_str() );
+    AssertThrow( status == NC_NOERR, ExcNetCDFError( status ) );
+}
+
+
+
+void
+ParallelNetCDFFile::endDefinitions()
+{
+    if ( not defineMode_ )
+        return;
+
+    const int status = nc_enddef( ncid_ );
+    AssertThrow( status == NC_NOERR, ExcNetCDFError( status ) );
+    defineMode_ = false;
+}
+
+
+
+void
+ParallelNetCDFFile::put( const int variable, const float * data )
+{
+    endDefinitions();
+
+    const int status = nc_put_var_float( ncid_, variable, data );
+    AssertThrow( status == NC_NOERR, ExcNetCDFError( status ) );
+}
+
+
+
+void
+ParallelNetCDFFile::put( const int variable, const std::vector<size_t> & start,
+        const std::vector<size_t> & count, const double * data )
+{
+    endDefinitions();
+
+    const int status = nc_put_vara_double( ncid_, variable, &start[0], &count[0], data );
+    AssertThrow( status == NC_NOERR, ExcNetCDFError( status ) );
+}
+
+
+
+void
+ParallelNetCDFFile::sync()
+{
+    endDefinitions();
+
+    const int status = nc_sync( ncid_ );
+    AssertThrow( status == NC_NOERR, ExcNetCDFError( status ) );
+}
+
+
+
+// Attributes can be added after the data have been written, e.g. the
+// computational time at the end of the run.
+void
+ParallelNetCDFFile::define()
+{
+    if ( defineMode_ )
+        return;
+
+    const int status = nc_redef( ncid_ );
+    AssertThrow( status == NC_NOERR, ExcNetCDFError( status ) );
+    defineMode_ = true;
+}
+
+#endif // ODEITY_WITH_PARALLEL_NETCDF
@@ -0,0 +1,56 @@
+#ifndef PARALLEL_NETCDF_FILE_H
+#define PARALLEL_NETCDF_FILE_H
+
+#include "../utils/Exceptions.h"
+
+#include <netcdf.h>
+#include <string>
+#include <vector>
+
+// NetCDF-4 file written collectively by all processes of a distributed run
+// through MPI-IO (parallel HDF5). Every member function has to be called by
+// all processes. The metadata must be identical on all of them, so the
+// values of the attributes are taken from process 0. The class is
+// implemented only with parallel NetCDF support (ODEITY_WITH_PARALLEL_NETCDF).
+class ParallelNetCDFFile
+{
+    public:
+
+        ParallelNetCDFFile( const std::string & path );
+        ~ParallelNetCDFFile();
+
+        // length NC_UNLIMITED gives the record dimension
+        int addDimension( const std::string & name, const size_t length );
+        int addVariable( const std::string & name, const nc_type type, const std::vector<int> & dimensions );
+
+        // variable NC_GLOBAL gives a global attribute
+        void putAttribute( const int variable, const std::string & name, const signed char value );
+        void putAttribute( const int variable, const std::string & name, const char value );
+        void putAttribute( const int variable, const std::string & name, const short value );
+        void putAttribute( const int variable, const std::string & name, const int value );
+        void putAttribute( const int variable, const std::string & name, const float value );
+        void putAttribute( const int variable, const std::string & name, const double value );
+        void putAttribute( const int variable, const std::string & name, const std::string & value );
+
+        void endDefinitions();
+
+        // the whole variable, the same values on all processes
+        void put( const int variable, const float * data );
+        // the hyperslab of the variable from start of extents count, the
+        // hyperslabs of the processes usually do not overlap
+        void put( const int variable, const std::vector<size_t> & start,
+                const std::vector<size_t> & count, const double * data );
+
+        void sync();
+
+        DeclException1( ExcNetCDFError, int, << "NetCDF call failed with error code: " << arg1 );
+
+    private:
+
+        void define();
+
+        int ncid_;
+        bool defineMode_;
+};
+
+#endif // PARALLEL_NETCDF_FILE_H
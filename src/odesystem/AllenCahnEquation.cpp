@@ -1,7 +1,10 @@
 #include "AllenCahnEquation.h"
+#include "JacobianMatrix.h"
 #include "../geometry/RectangularGrid.h"
 #include "../utils/ParameterHandler.h"
+#include "../utils/Profiler.h"
 #include "../utils/Vector.h"
+#include "../utils/Workspace.h"
 
 #include <cmath>
 
@@ -11,49 +14,129 @@ AllenCahnEquation::AllenCahnEquation()
         MolOdeSystem<2>( false, 1 ),
         xi_( 1.0 ),
         xiSqrInv_( 1.0 ),
-        F_( 0.0 )
+        F_( 0.0 ),
+        uBuffer_( -1 ),
+        u_( 0 )
 {}
 
 
 
 int AllenCahnEquation::rhs( const realtype &t, const Vector<realtype> &Y, Vector<realtype> &Ydot )
 {
-    realtype u, ul, ur, uu, ud;
-    unsigned int xdim = grid_->dimension( xDim );
-    unsigned int ydim = grid_->dimension( yDim );
-    realtype hxInv2 = 2*grid_->spatialStepInv( xDim );
-    realtype hyInv2 = 2*grid_->spatialStepInv( yDim );
-    realtype hxPow2Inv = grid_->spatialStepPow2Inv( xDim );
-    realtype hyPow2Inv = grid_->spatialStepPow2Inv( yDim );
-    int index;
-    realtype gradNorm;
-    realtype dx, dy;
-
-    for ( unsigned int x = 0; x < xdim; x++ )
-        for ( unsigned int y = 0; y < ydim; y++ )
-        {
-            index = grid_->nodeIndex(x,y);
+    ODEITY_PROBE( "rhs" );
+
+    const unsigned int xdim = grid_->dimension( xDim );
+    const unsigned int g = grid_->ghostLayers;
+
+    u_ = workspace().data( uBuffer_ );
+    grid_->copyToPadded( Y.data(), u_ );
+
+    // the rows next to the ghost rows are computed after the exchange with
+    // the neighbouring processes completes, the others while it is underway
+    MpiRequests requests;
+    grid_->beginFillGhostLayers( u_, grid_->boundaryCondition(), requests );
+    rhsRows( g, xdim-g, Ydot.data() );
+    grid_->endFillGhostLayers( u_, grid_->boundaryCondition(), requests );
+    rhsRows( 0, g, Ydot.data() );
+    rhsRows( xdim-g, xdim, Ydot.data() );
+
+    return 0;
+}
 
-            u = Y(index);
-            ul = ( x == 0 ) ? Y(grid_->nodeIndex(1,y)) : Y(grid_->nodeIndex(x-1,y));
-            ur = ( x == xdim-1 ) ? Y(grid_->nodeIndex(xdim-2,y)) : Y(grid_->nodeIndex(x+1,y));
-            ud = ( y == 0 ) ? Y(grid_->nodeIndex(x,1)) : Y(grid_->nodeIndex(x,y-1));
-            uu = ( y == ydim-1 ) ? Y(grid_->nodeIndex(x,ydim-2)) : Y(grid_->nodeIndex(x,y+1));
 
-            dx = hxInv2*(ur-ul);
-            dy = hyInv2*(uu-ud);
-            gradNorm = std::sqrt(dx*dx + dy*dy);
 
-            Ydot(index) = hxPow2Inv*( ul - 2*u + ur ) + hyPow2Inv*( uu - 2*u + ud )
+void AllenCahnEquation::rhsRows( const unsigned int xBegin, const unsigned int xEnd, realtype * ydot ) const
+{
+    const int ydim = grid_->dimension( yDim );
+    const unsigned int rowLength = grid_->paddedDimension( yDim );
+    const realtype hxInv2 = 0.5*grid_->spatialStepInv( xDim );
+    const realtype hyInv2 = 0.5*grid_->spatialStepInv( yDim );
+    const realtype hxPow2Inv = grid_->spatialStepPow2Inv( xDim );
+    const realtype hyPow2Inv = grid_->spatialStepPow2Inv( yDim );
+
+    for ( unsigned int x = xBegin; x < xEnd; x++ )
+    {
+        const realtype * const uc = u_ + grid_->paddedNodeIndex(x,0);
+        const realtype * const ul = uc - rowLength;
+        const realtype * const ur = uc + rowLength;
+        realtype * const f = ydot + grid_->nodeIndex(x,0);
+
+#pragma omp simd
+        for ( int y = 0; y < ydim; y++ )
+        {
+            const realtype u = uc[y];
+            const realtype dx = hxInv2*(ur[y]-ul[y]);
+            const realtype dy = hyInv2*(uc[y+1]-uc[y-1]);
+            const realtype gradNorm = std::sqrt(dx*dx + dy*dy);
+
+            f[y] = hxPow2Inv*( ul[y] - 2*u + ur[y] ) + hyPow2Inv*( uc[y+1] - 2*u + uc[y-1] )
                 + xiSqrInv_*u*(1.0 - u)*(u + 1.0)
                 + F_*gradNorm;
         }
+    }
+}
+
+
+
+// Jacobian matrix of the five point discretization for the direct solvers.
+// The derivatives of the forcing term F|grad u| are taken as zero where the
+// gradient vanishes.
+int AllenCahnEquation::jacobianMatrix( const realtype t, const Vector<realtype>& Y,
+        const Vector<realtype>& fy, JacobianMatrix& J )
+{
+    ODEITY_PROBE( "Jacobian matrix" );
+
+    const int xdim = grid_->dimension( xDim );
+    const int ydim = grid_->dimension( yDim );
+    const int rowLength = grid_->paddedDimension( yDim );
+    const realtype hxInv2 = 0.5*grid_->spatialStepInv( xDim );
+    const realtype hyInv2 = 0.5*grid_->spatialStepInv( yDim );
+    const realtype hxPow2Inv = grid_->spatialStepPow2Inv( xDim );
+    const realtype hyPow2Inv = grid_->spatialStepPow2Inv( yDim );
+
+    u_ = workspace().data( uBuffer_ );
+    grid_->copyToPadded( Y.data(), u_ );
+    grid_->fillGhostLayers( u_, grid_->boundaryCondition() );
+
+    for ( int x = 0; x < xdim; x++ )
+        for ( int y = 0; y < ydim; y++ )
+        {
+            const realtype * const uc = u_ + grid_->paddedNodeIndex(x,y);
+            const realtype u = uc[0];
+            const realtype dx = hxInv2*(uc[rowLength]-uc[-rowLength]);
+            const realtype dy = hyInv2*(uc[1]-uc[-1]);
+            const realtype gradNorm = std::sqrt(dx*dx + dy*dy);
+            const realtype forcingX = ( gradNorm > 0.0 ) ? F_*hxInv2*dx/gradNorm : 0.0;
+            const realtype forcingY = ( gradNorm > 0.0 ) ? F_*hyInv2*dy/gradNorm : 0.0;
+            const int row = grid_->nodeIndex(x,y);
+
+            J( row, row ) += -2*hxPow2Inv - 2*hyPow2Inv + xiSqrInv_*(1.0 - 3*u*u);
+            addNeighbour( J, row, x-1, y, hxPow2Inv - forcingX );
+            addNeighbour( J, row, x+1, y, hxPow2Inv + forcingX );
+            addNeighbour( J, row, x, y-1, hyPow2Inv - forcingY );
+            addNeighbour( J, row, x, y+1, hyPow2Inv + forcingY );
+        }
 
     return 0;
 }
 
 
 
+// A neighbour outside the domain stands for the node inside it that its
+// ghost node mirrors. Under Dirichlet condition the ghost node holds 2g - u
+// of that node, so it enters with the opposite sign.
+void AllenCahnEquation::addNeighbour( JacobianMatrix& J, const int row, int x, int y, const realtype value ) const
+{
+    const BoundaryCondition bc = grid_->boundaryCondition();
+    const int xImage = grid_->boundaryImage( x, xDim, bc );
+    const int yImage = grid_->boundaryImage( y, yDim, bc );
+    const bool mirrored = xImage != x || yImage != y;
+
+    J( row, grid_->nodeIndex(xImage,yImage) ) += ( bc == dirichletBoundary && mirrored ) ? -value : value;
+}
+
+
+
 void AllenCahnEquation::printInfo() const
 {
     using namespace std;
@@ -97,3 +180,12 @@ void AllenCahnEquation::getParameters( ParameterHandler& prm )
 }
 
 
+
+void
+AllenCahnEquation::attachGrid( const RectangularGrid<2>& grid )
+{
+    MolOdeSystem<2>::attachGrid( grid );
+
+    uBuffer_ = workspace().request( "solution with ghost layers", grid_->numberOfPaddedNodes(),
+            Workspace::rhsEvaluation );
+}
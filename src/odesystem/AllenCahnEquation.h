@@ -2,6 +2,7 @@
 #define ALLEN_CAHN_EQUATION_H
 
 #include "MolOdeSystem.h"
+#include "../utils/Vector.h"
 
 class ParameterHandler;
 
@@ -12,6 +13,8 @@ class AllenCahnEquation : public MolOdeSystem<2>
         AllenCahnEquation();
 
         virtual int rhs( const realtype &t, const Vector<realtype> &Y, Vector<realtype> &Ydot );
+        int jacobianMatrix( const realtype t, const Vector<realtype>& Y,
+                const Vector<realtype>& fy, JacobianMatrix& J );
 
         realtype interfaceWidth() const;
         realtype forcingTerm() const;
@@ -20,6 +23,7 @@ class AllenCahnEquation : public MolOdeSystem<2>
         void printInfo() const;
         static void declareParameters( ParameterHandler& prm );
         void getParameters( ParameterHandler& prm );
+        void attachGrid( const RectangularGrid<2>& grid );
 
         std::string componentName( int i ) const { return std::string("phase_field"); }
 
@@ -27,6 +31,11 @@ class AllenCahnEquation : public MolOdeSystem<2>
 
         realtype xi_, xiSqrInv_;
         realtype F_;
+        int uBuffer_;
+        realtype * u_; // solution with ghost layers, in the workspace
+
+        void rhsRows( const unsigned int xBegin, const unsigned int xEnd, realtype * ydot ) const;
+        void addNeighbour( JacobianMatrix& J, const int row, int x, int y, const realtype value ) const;
 };
 
 
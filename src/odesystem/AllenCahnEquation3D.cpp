@@ -0,0 +1,159 @@
+#include "AllenCahnEquation3D.h"
+#include "GridBlocking3D.h"
+#include "../geometry/RectangularGrid.h"
+#include "../utils/ParameterHandler.h"
+#include "../utils/Profiler.h"
+#include "../utils/Vector.h"
+#include "../utils/LogStream.h"
+#include "../utils/Workspace.h"
+
+#include <algorithm>
+#include <cmath>
+
+
+AllenCahnEquation3D::AllenCahnEquation3D()
+    :
+        MolOdeSystem<3>( false, 1 ),
+        xi_( 1.0 ),
+        xiSqrInv_( 1.0 ),
+        F_( 0.0 ),
+        ghostPlanesBuffer_( -1 )
+{}
+
+
+
+int AllenCahnEquation3D::rhs( const realtype &t, const Vector<realtype> &Y, Vector<realtype> &Ydot )
+{
+    ODEITY_PROBE( "rhs" );
+
+    const unsigned int xdim = grid_->dimension( xDim );
+    const realtype * const u = Y.data();
+    realtype * const ydot = Ydot.data();
+    realtype * const ghostPlanes = workspace().data( ghostPlanesBuffer_ );
+
+    // the planes next to the ghost planes are computed after the exchange
+    // with the neighbouring processes completes, the others while it is
+    // underway
+    const realtype * uLower = 0;
+    const realtype * uUpper = 0;
+    MpiRequests requests;
+    beginGhostPlanes( *grid_, u, ghostPlanes, requests );
+    rhsPlanes( 1, xdim-1, u, uLower, uUpper, ydot );
+    endGhostPlanes( *grid_, u, ghostPlanes, requests, uLower, uUpper );
+    rhsPlanes( 0, 1, u, uLower, uUpper, ydot );
+    rhsPlanes( xdim-1, xdim, u, uLower, uUpper, ydot );
+
+    return 0;
+}
+
+
+
+// The x-planes from xBegin to xEnd-1, uLower and uUpper are the planes
+// adjacent to the slab (see endGhostPlanes()).
+void AllenCahnEquation3D::rhsPlanes( const unsigned int xBegin, const unsigned int xEnd,
+        const realtype * u, const realtype * uLower, const realtype * uUpper, realtype * ydot ) const
+{
+    const unsigned int xdim = grid_->dimension( xDim );
+    const unsigned int ydim = grid_->dimension( yDim );
+    const unsigned int zdim = grid_->dimension( zDim );
+    const unsigned int xBlocks = ( xEnd - xBegin + blockX3D - 1 ) / blockX3D;
+    const unsigned int yBlocks = ( ydim + blockY3D - 1 ) / blockY3D;
+
+#pragma omp parallel for collapse(2) schedule(static)
+    for ( unsigned int xb = 0; xb < xBlocks; xb++ )
+        for ( unsigned int yb = 0; yb < yBlocks; yb++ )
+        {
+            const unsigned int xTileEnd = std::min( xBegin + (xb+1)*blockX3D, xEnd );
+            const unsigned int yTileEnd = std::min( (yb+1)*blockY3D, ydim );
+
+            for ( unsigned int x = xBegin + xb*blockX3D; x < xTileEnd; x++ )
+                for ( unsigned int y = yb*blockY3D; y < yTileEnd; y++ )
+                {
+                    const unsigned int yd = neumannLower( y );
+                    const unsigned int yu = neumannUpper( y, ydim );
+                    const realtype * const ul = ( x == 0 ) ? uLower + grid_->nodeIndex(0,y,0) : u + grid_->nodeIndex(x-1,y,0);
+                    const realtype * const ur = ( x == xdim-1 ) ? uUpper + grid_->nodeIndex(0,y,0) : u + grid_->nodeIndex(x+1,y,0);
+
+                    rhsRow( u + grid_->nodeIndex(x,y,0), ul, ur,
+                            u + grid_->nodeIndex(x,yd,0), u + grid_->nodeIndex(x,yu,0),
+                            ydot + grid_->nodeIndex(x,y,0), zdim );
+                }
+        }
+}
+
+
+
+// One row of nodes along z, ul, ur, ud and uu are the neighbouring rows in x
+// and y.
+void AllenCahnEquation3D::rhsRow( const realtype * u, const realtype * ul, const realtype * ur,
+        const realtype * ud, const realtype * uu,
+        realtype * ydot, const unsigned int zdim ) const
+{
+    const realtype hxInv2 = 0.5*grid_->spatialStepInv( xDim );
+    const realtype hyInv2 = 0.5*grid_->spatialStepInv( yDim );
+    const realtype hzInv2 = 0.5*grid_->spatialStepInv( zDim );
+    const realtype hxPow2Inv = grid_->spatialStepPow2Inv( xDim );
+    const realtype hyPow2Inv = grid_->spatialStepPow2Inv( yDim );
+    const realtype hzPow2Inv = grid_->spatialStepPow2Inv( zDim );
+
+#pragma omp simd
+    for ( unsigned int z = 0; z < zdim; z++ )
+    {
+        const unsigned int zb = neumannLower( z );
+        const unsigned int zt = neumannUpper( z, zdim );
+        const realtype c = u[z];
+
+        const realtype dx = hxInv2*(ur[z]-ul[z]);
+        const realtype dy = hyInv2*(uu[z]-ud[z]);
+        const realtype dz = hzInv2*(u[zt]-u[zb]);
+        const realtype gradNorm = std::sqrt(dx*dx + dy*dy + dz*dz);
+
+        ydot[z] = hxPow2Inv*( ul[z] - 2*c + ur[z] ) + hyPow2Inv*( uu[z] - 2*c + ud[z] )
+            + hzPow2Inv*( u[zt] - 2*c + u[zb] )
+            + xiSqrInv_*c*(1.0 - c)*(c + 1.0)
+            + F_*gradNorm;
+    }
+}
+
+
+
+void AllenCahnEquation3D::printInfo() const
+{
+    using namespace std;
+
+    logger << endl;
+    logger << "Allen-Cahn equation (3D)" << endl;
+    logger << "------------------------" << endl;
+    logger << "*Interface width*:: " << xi_ << endl;
+    logger << "*Forcing term*:: " << F_ << endl;
+}
+
+
+
+void AllenCahnEquation3D::attachGrid( const RectangularGrid<3>& grid )
+{
+    MolOdeSystem<3>::attachGrid( grid );
+
+    ghostPlanesBuffer_ = workspace().request( "ghost planes",
+            2*grid_->dimension( yDim )*grid_->dimension( zDim ), Workspace::rhsEvaluation );
+    firstTouch_.attachGrid( *grid_ );
+}
+
+
+
+void AllenCahnEquation3D::getParameters( ParameterHandler& prm )
+{
+    AssertThrow( grid_->boundaryCondition() == neumannBoundary,
+            ExcMessage( "Only Neumann boundary condition is implemented in 3D" ) );
+
+    prm.enter_subsection("Allen-Cahn equation");
+
+    F_  = prm.get_double( "F" );
+    xi_ = prm.get_double( "xi" );
+    if ( xi_ < 0.0 )
+        xi_ = -xi_ * std::max( grid_->spatialStep( xDim ),
+                std::max( grid_->spatialStep( yDim ), grid_->spatialStep( zDim ) ) );
+    xiSqrInv_ = 1.0/(xi_*xi_);
+
+    prm.leave_subsection();
+}
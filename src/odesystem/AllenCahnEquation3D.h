@@ -0,0 +1,75 @@
+#ifndef ALLEN_CAHN_EQUATION_3D_H
+#define ALLEN_CAHN_EQUATION_3D_H
+
+#include "MolOdeSystem.h"
+#include "GridBlocking3D.h"
+#include "../utils/Vector.h"
+
+class ParameterHandler;
+
+// Allen-Cahn equation on a three-dimensional grid, discretized with the
+// 7-point Laplacian and homogeneous Neumann boundary conditions. The
+// parameters are read from the "Allen-Cahn equation" subsection declared by
+// AllenCahnEquation.
+class AllenCahnEquation3D : public MolOdeSystem<3>
+{
+    public:
+
+        AllenCahnEquation3D();
+
+        virtual int rhs( const realtype &t, const Vector<realtype> &Y, Vector<realtype> &Ydot );
+
+        realtype interfaceWidth() const;
+        realtype forcingTerm() const;
+
+        std::string name() const;
+        void printInfo() const;
+        void getParameters( ParameterHandler& prm );
+
+        std::string componentName( int i ) const { return std::string("phase_field"); }
+
+        void attachGrid( const RectangularGrid<3>& grid );
+
+    private:
+
+        realtype xi_, xiSqrInv_;
+        realtype F_;
+        int ghostPlanesBuffer_;
+        TiledFirstTouch3D firstTouch_;
+
+        void rhsRow( const realtype * u, const realtype * ul, const realtype * ur,
+                     const realtype * ud, const realtype * uu,
+                     realtype * ydot, const unsigned int zdim ) const;
+        void rhsPlanes( const unsigned int xBegin, const unsigned int xEnd,
+                        const realtype * u, const realtype * uLower, const realtype * uUpper,
+                        realtype * ydot ) const;
+};
+
+
+inline
+std::string
+AllenCahnEquation3D::name() const
+{
+    return "Allen-Cahn equation (3D)";
+}
+
+
+inline
+realtype
+AllenCahnEquation3D::interfaceWidth() const
+{
+    return xi_;
+}
+
+
+
+inline
+realtype
+AllenCahnEquation3D::forcingTerm() const
+{
+    return F_;
+}
+
+
+
+#endif // ALLEN_CAHN_EQUATION_3D_H
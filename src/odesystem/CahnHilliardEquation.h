@@ -28,15 +28,25 @@ class CahnHilliardEquation : public MolOdeSystem<2>
 
     void attachGrid( const RectangularGrid<2>& grid );
 
+  protected:
+
+    int stencilRadius() const { return 2; }
+
   private:
 
     realtype xi_, xiInv_, xiSqr_;
     realtype a_;
-    Vector<realtype> w_;
+    int uBuffer_;
+    realtype * u_; // solution with ghost layers, in the workspace
+    int wBuffer_;
+    realtype * w_; // chemical potential with ghost layers, in the workspace
 
     realtype f0( const realtype u );
     realtype f0deriv( const realtype u);
 
+    void chemicalPotentialRows( const unsigned int xBegin, const unsigned int xEnd );
+    void rhsRows( const unsigned int xBegin, const unsigned int xEnd, realtype * ydot );
+
 };
 
 
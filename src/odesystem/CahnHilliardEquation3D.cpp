@@ -0,0 +1,246 @@
+#include "CahnHilliardEquation3D.h"
+#include "GridBlocking3D.h"
+#include "../geometry/RectangularGrid.h"
+#include "../utils/ParameterHandler.h"
+#include "../utils/Profiler.h"
+#include "../utils/Vector.h"
+#include "../utils/LogStream.h"
+#include "../utils/Workspace.h"
+
+#include <algorithm>
+#include <cmath>
+
+
+CahnHilliardEquation3D::CahnHilliardEquation3D()
+    :
+        MolOdeSystem<3>( false, 1 ),
+        xi_( 1.0 ),
+        xiInv_( 1.0 ),
+        xiSqr_( 1.0 ),
+        a_( 1.0 ),
+        wBuffer_( -1 ),
+        uGhostPlanesBuffer_( -1 ),
+        wGhostPlanesBuffer_( -1 ),
+        w_( 0 )
+{}
+
+
+
+int
+CahnHilliardEquation3D::rhs( const realtype &t, const Vector<realtype> &Y, Vector<realtype> &Ydot )
+{
+    ODEITY_PROBE( "rhs" );
+
+    const unsigned int xdim = grid_->dimension( xDim );
+    w_ = workspace().data( wBuffer_ );
+    realtype * const uGhostPlanes = workspace().data( uGhostPlanesBuffer_ );
+    realtype * const wGhostPlanes = workspace().data( wGhostPlanesBuffer_ );
+    const realtype * const u = Y.data();
+    realtype * const w = w_;
+    realtype * const ydot = Ydot.data();
+
+    // The second sweep needs the chemical potential in the neighbouring
+    // planes, hence two sweeps. Both overlap the exchange of the planes next
+    // to the slab with the neighbouring processes: the first and the last
+    // plane are computed after it completes, the others while it is underway.
+    const realtype * uLower = 0;
+    const realtype * uUpper = 0;
+    const realtype * wLower = 0;
+    const realtype * wUpper = 0;
+    MpiRequests requests;
+
+    beginGhostPlanes( *grid_, u, uGhostPlanes, requests );
+    chemicalPotentialPlanes( 1, xdim-1, u, uLower, uUpper );
+    endGhostPlanes( *grid_, u, uGhostPlanes, requests, uLower, uUpper );
+    chemicalPotentialPlanes( 0, 1, u, uLower, uUpper );
+    chemicalPotentialPlanes( xdim-1, xdim, u, uLower, uUpper );
+
+    beginGhostPlanes( *grid_, w, wGhostPlanes, requests );
+    rhsPlanes( 1, xdim-1, wLower, wUpper, ydot );
+    endGhostPlanes( *grid_, w, wGhostPlanes, requests, wLower, wUpper );
+    rhsPlanes( 0, 1, wLower, wUpper, ydot );
+    rhsPlanes( xdim-1, xdim, wLower, wUpper, ydot );
+
+    return 0;
+}
+
+
+
+// Chemical potential in the x-planes from xBegin to xEnd-1, uLower and
+// uUpper are the planes adjacent to the slab (see endGhostPlanes()).
+void
+CahnHilliardEquation3D::chemicalPotentialPlanes( const unsigned int xBegin, const unsigned int xEnd,
+        const realtype * u, const realtype * uLower, const realtype * uUpper )
+{
+    const unsigned int xdim = grid_->dimension( xDim );
+    const unsigned int ydim = grid_->dimension( yDim );
+    const unsigned int zdim = grid_->dimension( zDim );
+    const unsigned int xBlocks = ( xEnd - xBegin + blockX3D - 1 ) / blockX3D;
+    const unsigned int yBlocks = ( ydim + blockY3D - 1 ) / blockY3D;
+    realtype * const w = w_;
+
+#pragma omp parallel for collapse(2) schedule(static)
+    for ( unsigned int xb = 0; xb < xBlocks; xb++ )
+        for ( unsigned int yb = 0; yb < yBlocks; yb++ )
+        {
+            const unsigned int xTileEnd = std::min( xBegin + (xb+1)*blockX3D, xEnd );
+            const unsigned int yTileEnd = std::min( (yb+1)*blockY3D, ydim );
+
+            for ( unsigned int x = xBegin + xb*blockX3D; x < xTileEnd; x++ )
+                for ( unsigned int y = yb*blockY3D; y < yTileEnd; y++ )
+                {
+                    const unsigned int yd = neumannLower( y );
+                    const unsigned int yu = neumannUpper( y, ydim );
+                    const realtype * const ul = ( x == 0 ) ? uLower + grid_->nodeIndex(0,y,0) : u + grid_->nodeIndex(x-1,y,0);
+                    const realtype * const ur = ( x == xdim-1 ) ? uUpper + grid_->nodeIndex(0,y,0) : u + grid_->nodeIndex(x+1,y,0);
+
+                    chemicalPotentialRow( u + grid_->nodeIndex(x,y,0), ul, ur,
+                            u + grid_->nodeIndex(x,yd,0), u + grid_->nodeIndex(x,yu,0),
+                            w + grid_->nodeIndex(x,y,0), zdim );
+                }
+        }
+}
+
+
+
+// Right hand side in the x-planes from xBegin to xEnd-1, wLower and wUpper
+// are the planes of the chemical potential adjacent to the slab.
+void
+CahnHilliardEquation3D::rhsPlanes( const unsigned int xBegin, const unsigned int xEnd,
+        const realtype * wLower, const realtype * wUpper, realtype * ydot ) const
+{
+    const unsigned int xdim = grid_->dimension( xDim );
+    const unsigned int ydim = grid_->dimension( yDim );
+    const unsigned int zdim = grid_->dimension( zDim );
+    const unsigned int xBlocks = ( xEnd - xBegin + blockX3D - 1 ) / blockX3D;
+    const unsigned int yBlocks = ( ydim + blockY3D - 1 ) / blockY3D;
+    const realtype * const w = w_;
+
+#pragma omp parallel for collapse(2) schedule(static)
+    for ( unsigned int xb = 0; xb < xBlocks; xb++ )
+        for ( unsigned int yb = 0; yb < yBlocks; yb++ )
+        {
+            const unsigned int xTileEnd = std::min( xBegin + (xb+1)*blockX3D, xEnd );
+            const unsigned int yTileEnd = std::min( (yb+1)*blockY3D, ydim );
+
+            for ( unsigned int x = xBegin + xb*blockX3D; x < xTileEnd; x++ )
+                for ( unsigned int y = yb*blockY3D; y < yTileEnd; y++ )
+                {
+                    const unsigned int yd = neumannLower( y );
+                    const unsigned int yu = neumannUpper( y, ydim );
+                    const realtype * const wl = ( x == 0 ) ? wLower + grid_->nodeIndex(0,y,0) : w + grid_->nodeIndex(x-1,y,0);
+                    const realtype * const wr = ( x == xdim-1 ) ? wUpper + grid_->nodeIndex(0,y,0) : w + grid_->nodeIndex(x+1,y,0);
+
+                    rhsRow( w + grid_->nodeIndex(x,y,0), wl, wr,
+                            w + grid_->nodeIndex(x,yd,0), w + grid_->nodeIndex(x,yu,0),
+                            ydot + grid_->nodeIndex(x,y,0), zdim );
+                }
+        }
+}
+
+
+
+inline
+realtype CahnHilliardEquation3D::f0( const realtype u ) const
+{
+    return a_*(u*u - 1.0)*u;
+}
+
+
+
+void
+CahnHilliardEquation3D::chemicalPotentialRow( const realtype * u, const realtype * ul, const realtype * ur,
+        const realtype * ud, const realtype * uu,
+        realtype * w, const unsigned int zdim ) const
+{
+    const realtype hxPow2Inv = grid_->spatialStepPow2Inv( xDim );
+    const realtype hyPow2Inv = grid_->spatialStepPow2Inv( yDim );
+    const realtype hzPow2Inv = grid_->spatialStepPow2Inv( zDim );
+
+#pragma omp simd
+    for ( unsigned int z = 0; z < zdim; z++ )
+    {
+        const unsigned int zb = neumannLower( z );
+        const unsigned int zt = neumannUpper( z, zdim );
+        const realtype c = u[z];
+
+        w[z] = - xiSqr_*(hxPow2Inv*( ul[z] - 2*c + ur[z] ) + hyPow2Inv*( uu[z] - 2*c + ud[z] )
+                + hzPow2Inv*( u[zt] - 2*c + u[zb] )) + f0(c);
+    }
+}
+
+
+
+void
+CahnHilliardEquation3D::rhsRow( const realtype * w, const realtype * wl, const realtype * wr,
+        const realtype * wd, const realtype * wu,
+        realtype * ydot, const unsigned int zdim ) const
+{
+    const realtype hxPow2Inv = grid_->spatialStepPow2Inv( xDim );
+    const realtype hyPow2Inv = grid_->spatialStepPow2Inv( yDim );
+    const realtype hzPow2Inv = grid_->spatialStepPow2Inv( zDim );
+
+#pragma omp simd
+    for ( unsigned int z = 0; z < zdim; z++ )
+    {
+        const unsigned int zb = neumannLower( z );
+        const unsigned int zt = neumannUpper( z, zdim );
+        const realtype c = w[z];
+
+        ydot[z] = xiInv_*(hxPow2Inv*( wl[z] - 2*c + wr[z] ) + hyPow2Inv*( wu[z] - 2*c + wd[z] )
+                + hzPow2Inv*( w[zt] - 2*c + w[zb] ));
+    }
+}
+
+
+
+void
+CahnHilliardEquation3D::printInfo( ) const
+{
+    using namespace std;
+
+    logger << endl;
+    logger << "Cahn-Hilliard equation (3D)" << endl;
+    logger << "---------------------------" << endl;
+    logger << "*Interface width*:: " << xi_ << endl;
+    logger << "*a*:: " << a_ << endl;
+}
+
+
+
+void
+CahnHilliardEquation3D::attachGrid( const RectangularGrid<3>& grid )
+{
+    MolOdeSystem<3>::attachGrid( grid );
+
+    const long int planes = 2*grid_->dimension( yDim )*grid_->dimension( zDim );
+    wBuffer_ = workspace().request( "chemical potential", grid_->numberOfNodes(),
+            Workspace::rhsEvaluation );
+    uGhostPlanesBuffer_ = workspace().request( "ghost planes of the solution", planes,
+            Workspace::rhsEvaluation );
+    wGhostPlanesBuffer_ = workspace().request( "ghost planes of the chemical potential", planes,
+            Workspace::rhsEvaluation );
+    firstTouch_.attachGrid( *grid_ );
+}
+
+
+
+void
+CahnHilliardEquation3D::getParameters( ParameterHandler& prm )
+{
+    AssertThrow( grid_->boundaryCondition() == neumannBoundary,
+            ExcMessage( "Only Neumann boundary condition is implemented in 3D" ) );
+
+    prm.enter_subsection("Cahn-Hilliard equation");
+
+    xi_ = prm.get_double( "xi" );
+    if ( xi_ < 0.0 )
+        xi_ = -xi_ * std::max( grid_->spatialStep( xDim ),
+                std::max( grid_->spatialStep( yDim ), grid_->spatialStep( zDim ) ) );
+    xiSqr_ = xi_*xi_;
+    xiInv_ = 1.0/xi_;
+
+    a_ = prm.get_double( "a" );
+
+    prm.leave_subsection();
+}
@@ -0,0 +1,87 @@
+#ifndef CAHN_HILLIARD_EQUATION_3D_H
+#define CAHN_HILLIARD_EQUATION_3D_H
+
+#include "MolOdeSystem.h"
+#include "GridBlocking3D.h"
+#include "../utils/Vector.h"
+
+class ParameterHandler;
+
+// Cahn-Hilliard equation with constant mobility on a three-dimensional grid.
+// The chemical potential is computed with the 7-point Laplacian and its
+// Laplacian is the right hand side, which amounts to a 25-point stencil for
+// the biharmonic term. Homogeneous Neumann boundary conditions. The
+// parameters are read from the "Cahn-Hilliard equation" subsection declared
+// by CahnHilliardEquation.
+class CahnHilliardEquation3D : public MolOdeSystem<3>
+{
+  public:
+
+    CahnHilliardEquation3D();
+
+    int rhs( const realtype &t, const Vector<realtype> &Y, Vector<realtype> &Ydot );
+
+    std::string name() const;
+    std::string componentName( int i ) const { return "phase_field"; }
+    realtype interfaceWidth() const;
+    realtype potentialCoefficient() const;
+
+    void printInfo() const;
+    void getParameters( ParameterHandler& prm );
+
+    void attachGrid( const RectangularGrid<3>& grid );
+
+  protected:
+
+    int stencilRadius() const { return 2; }
+
+  private:
+
+    realtype xi_, xiInv_, xiSqr_;
+    realtype a_;
+    int wBuffer_;
+    int uGhostPlanesBuffer_;
+    int wGhostPlanesBuffer_;
+    realtype * w_; // chemical potential, in the workspace
+    TiledFirstTouch3D firstTouch_;
+
+    realtype f0( const realtype u ) const;
+
+    void chemicalPotentialRow( const realtype * u, const realtype * ul, const realtype * ur,
+                               const realtype * ud, const realtype * uu,
+                               realtype * w, const unsigned int zdim ) const;
+    void rhsRow( const realtype * w, const realtype * wl, const realtype * wr,
+                 const realtype * wd, const realtype * wu,
+                 realtype * ydot, const unsigned int zdim ) const;
+    void chemicalPotentialPlanes( const unsigned int xBegin, const unsigned int xEnd,
+                                  const realtype * u, const realtype * uLower, const realtype * uUpper );
+    void rhsPlanes( const unsigned int xBegin, const unsigned int xEnd,
+                    const realtype * wLower, const realtype * wUpper, realtype * ydot ) const;
+};
+
+
+inline
+std::string
+CahnHilliardEquation3D::name() const
+{
+  return "Cahn-Hilliard equation with constant mobility (3D)";
+}
+
+
+inline
+realtype
+CahnHilliardEquation3D::interfaceWidth() const
+{
+  return xi_;
+}
+
+
+inline
+realtype
+CahnHilliardEquation3D::potentialCoefficient() const
+{
+    return a_;
+}
+
+
+#endif // CAHN_HILLIARD_EQUATION_3D_H
@@ -0,0 +1,225 @@
+#include "ColoredJacobian.h"
+#include "ExplicitOde.h"
+#include "../utils/Exceptions.h"
+#include "../utils/MpiUtilities.h"
+#include "../utils/Profiler.h"
+#include "../utils/Workspace.h"
+
+#include <algorithm>
+#include <cmath>
+
+
+ColoredJacobian::ColoredJacobian()
+    :
+        colorStart_( 1, 0 ),
+        workspace_( 0 ),
+        yPerturbedBuffer_( -1 ),
+        fPerturbedBuffer_( -1 )
+{}
+
+
+
+void
+ColoredJacobian::reinit( Workspace & workspace, const std::vector<int> & rowStart,
+        const std::vector<int> & columns, const std::vector<int> & colors )
+{
+    matrix_.reinit( rowStart, columns );
+
+    const int n = matrix_.size();
+
+    // transpose of the pattern: the entries are visited row by row, so the
+    // rows of each column come out sorted
+    columnStart_.assign( n + 1, 0 );
+    for ( unsigned int k = 0; k < columns.size(); k++ )
+        columnStart_[columns[k] + 1]++;
+    for ( int j = 0; j < n; j++ )
+        columnStart_[j + 1] += columnStart_[j];
+
+    columnRows_.resize( columns.size() );
+    columnPositions_.resize( columns.size() );
+    std::vector<int> next( columnStart_.begin(), columnStart_.end() - 1 );
+    for ( int i = 0; i < n; i++ )
+        for ( int k = rowStart[i]; k < rowStart[i + 1]; k++ )
+        {
+            const int l = next[columns[k]]++;
+            columnRows_[l] = i;
+            columnPositions_[l] = k;
+        }
+
+    // all processes have to agree on the proposal
+    std::vector<int> color( colors );
+    const bool valid = int( color.size() ) == n && isValidColoring( color );
+    if ( mpiMin( valid ? 1.0 : 0.0 ) == 0.0 )
+    {
+        colorGreedily( color );
+        if ( mpiSize() > 1 )
+            separateNeighbours( color );
+    }
+    groupColumns( color );
+
+    workspace_ = &workspace;
+    yPerturbedBuffer_ = workspace.request( "perturbed state", n, Workspace::jacobianAssembly );
+    fPerturbedBuffer_ = workspace.request( "right hand side of the perturbed state", n,
+            Workspace::jacobianAssembly );
+}
+
+
+
+// Columns of the same color must not share a row, i.e. the colors in each
+// row are distinct.
+bool
+ColoredJacobian::isValidColoring( const std::vector<int> & color ) const
+{
+    const int n = matrix_.size();
+    const int * const rowStart = matrix_.rowStart();
+    const int * const columns = matrix_.columns();
+
+    if ( n == 0 )
+        return false;
+
+    const int numColors = *std::max_element( color.begin(), color.end() ) + 1;
+    std::vector<int> taken( numColors, -1 );
+
+    for ( int i = 0; i < n; i++ )
+        for ( int k = rowStart[i]; k < rowStart[i + 1]; k++ )
+        {
+            const int c = color[columns[k]];
+            if ( c < 0 || taken[c] == i )
+                return false;
+            taken[c] = i;
+        }
+
+    return true;
+}
+
+
+
+// A column gets the smallest color not taken by a column sharing a row with
+// it. The colors taken are marked with the index of the column, so the marks
+// need not be cleared.
+void
+ColoredJacobian::colorGreedily( std::vector<int> & color ) const
+{
+    const int n = matrix_.size();
+    const int * const rowStart = matrix_.rowStart();
+    const int * const columns = matrix_.columns();
+
+    color.assign( n, -1 );
+    std::vector<int> taken;
+    int numColors = 0;
+
+    for ( int j = 0; j < n; j++ )
+    {
+        for ( int k = columnStart_[j]; k < columnStart_[j + 1]; k++ )
+        {
+            const int i = columnRows_[k];
+            for ( int l = rowStart[i]; l < rowStart[i + 1]; l++ )
+                if ( color[columns[l]] >= 0 )
+                    taken[color[columns[l]]] = j;
+        }
+
+        int c = 0;
+        while ( c < numColors && taken[c] == j )
+            c++;
+        if ( c == numColors )
+        {
+            taken.push_back( -1 );
+            numColors++;
+        }
+        color[j] = c;
+    }
+}
+
+
+
+// The processes are split into two groups by the parity of their rank, each
+// group perturbs its colors in rounds of its own. With an odd number of
+// processes the last one forms a third group, since with periodic boundary
+// condition it is a neighbour of the first one.
+void
+ColoredJacobian::separateNeighbours( std::vector<int> & color ) const
+{
+    const int n = matrix_.size();
+    const int size = mpiSize();
+    const int rank = mpiRank();
+
+    int numColors = n > 0 ? *std::max_element( color.begin(), color.end() ) + 1 : 0;
+    numColors = int( mpiMax( realtype( numColors ) ) );
+
+    const int group = ( size % 2 == 1 && rank == size - 1 ) ? 2 : rank % 2;
+    for ( int j = 0; j < n; j++ )
+        color[j] += group*numColors;
+}
+
+
+
+void
+ColoredJacobian::groupColumns( const std::vector<int> & color )
+{
+    const int n = matrix_.size();
+
+    // the right hand side is collective, every process takes the largest
+    // number of colors
+    int numColors = n > 0 ? *std::max_element( color.begin(), color.end() ) + 1 : 0;
+    numColors = int( mpiMax( realtype( numColors ) ) );
+
+    colorStart_.assign( numColors + 1, 0 );
+    for ( int j = 0; j < n; j++ )
+        colorStart_[color[j] + 1]++;
+    for ( int c = 0; c < numColors; c++ )
+        colorStart_[c + 1] += colorStart_[c];
+
+    colorColumns_.resize( n );
+    std::vector<int> next( colorStart_.begin(), colorStart_.end() - 1 );
+    for ( int j = 0; j < n; j++ )
+        colorColumns_[next[color[j]]++] = j;
+}
+
+
+
+// The increment of y_j is sqrt(unit roundoff) relative to |y_j|, but at
+// least to 1, the scale of the phase fields. The quotients take the
+// increment actually represented in floating point.
+void
+ColoredJacobian::assemble( ExplicitOde & ode, const realtype t, const Vector<realtype> & y,
+        const Vector<realtype> & fy )
+{
+    ODEITY_PROBE( "colored Jacobian" );
+
+    const int n = matrix_.size();
+    const realtype srur = std::sqrt( UNIT_ROUNDOFF );
+    const realtype * const y0 = y.data();
+    const realtype * const f0 = fy.data();
+    realtype * const yp = workspace_->data( yPerturbedBuffer_ );
+    realtype * const fp = workspace_->data( fPerturbedBuffer_ );
+    WorkspaceVector yPerturbed( yp, n );
+    WorkspaceVector fPerturbed( fp, n );
+    realtype * const values = matrix_.values();
+
+    Assert( int( y.size() ) == n, ExcMessage( "Vector does not match the Jacobian matrix" ) );
+
+    std::copy( y0, y0 + n, yp );
+
+    for ( int c = 0; c < numberOfColors(); c++ )
+    {
+        for ( int m = colorStart_[c]; m < colorStart_[c + 1]; m++ )
+        {
+            const int j = colorColumns_[m];
+            yp[j] += srur*std::max( std::fabs( y0[j] ), 1.0 );
+        }
+
+        ode.rhs( t, *yPerturbed, *fPerturbed );
+
+        for ( int m = colorStart_[c]; m < colorStart_[c + 1]; m++ )
+        {
+            const int j = colorColumns_[m];
+            const realtype incrementInv = 1.0/( yp[j] - y0[j] );
+            for ( int k = columnStart_[j]; k < columnStart_[j + 1]; k++ )
+            {
+                const int i = columnRows_[k];
+                values[columnPositions_[k]] = ( fp[i] - f0[i] )*incrementInv;
+            }
+            yp[j] = y0[j];
+        }
+    }
+}
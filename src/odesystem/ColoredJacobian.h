@@ -0,0 +1,92 @@
+#ifndef COLORED_JACOBIAN_H
+#define COLORED_JACOBIAN_H
+
+#include "../utils/SparseMatrix.h"
+#include "../utils/Vector.h"
+
+#include <vector>
+
+class ExplicitOde;
+class Workspace;
+
+// Sparse Jacobian matrix of an ExplicitOde approximated by forward
+// differences. Columns that have no row in common are grouped into colors
+// and perturbed together (Curtis, Powell and Reid), so the matrix takes one
+// evaluation of the right hand side per color, e.g. 5 for the five point
+// stencil, instead of one per equation. A coloring can be proposed, e.g.
+// one known to be optimal for the stencil; if it is not valid for the
+// pattern, or none is given, the colors are chosen greedily in the order
+// of the columns.
+//
+// In a distributed run the pattern holds the columns owned by the process,
+// the matrix is the diagonal block of the Jacobian. All processes evaluate
+// the right hand side the same number of times. The right hand side also
+// sees the columns perturbed by the neighbouring processes, so a proposed
+// coloring has to be valid for the whole Jacobian, e.g. be computed from
+// global indices; the check only covers the local pattern. The greedy
+// colors of neighbouring processes are not related, so with them the
+// neighbours perturb in different rounds. The neighbours of a process are
+// assumed to be the processes of the adjacent ranks, as with the slabs of
+// RectangularGrid.
+//
+// The perturbed state and its right hand side are buffers of the
+// workspace that live for the assembly.
+class ColoredJacobian
+{
+    public:
+
+        ColoredJacobian();
+
+        // sparsity pattern in CSR format, the diagonal has to be in it,
+        // and the proposed color of each column
+        void reinit( Workspace & workspace, const std::vector<int> & rowStart,
+                const std::vector<int> & columns, const std::vector<int> & colors = std::vector<int>() );
+
+        void assemble( ExplicitOde & ode, const realtype t, const Vector<realtype> & y,
+                const Vector<realtype> & fy );
+
+        const SparseMatrix & matrix() const;
+        int numberOfColors() const;
+
+    private:
+
+        SparseMatrix matrix_;
+
+        // columns of each color
+        std::vector<int> colorStart_;
+        std::vector<int> colorColumns_;
+
+        // rows of each column with the positions of the entries in matrix_
+        std::vector<int> columnStart_;
+        std::vector<int> columnRows_;
+        std::vector<int> columnPositions_;
+
+        Workspace * workspace_;
+        int yPerturbedBuffer_;
+        int fPerturbedBuffer_;
+
+        bool isValidColoring( const std::vector<int> & color ) const;
+        void colorGreedily( std::vector<int> & color ) const;
+        void separateNeighbours( std::vector<int> & color ) const;
+        void groupColumns( const std::vector<int> & color );
+};
+
+
+
+inline
+const SparseMatrix &
+ColoredJacobian::matrix() const
+{
+    return matrix_;
+}
+
+
+
+inline
+int
+ColoredJacobian::numberOfColors() const
+{
+    return colorStart_.size() - 1;
+}
+
+#endif // COLORED_JACOBIAN_H
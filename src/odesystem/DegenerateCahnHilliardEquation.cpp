@@ -1,9 +1,13 @@
 #include "DegenerateCahnHilliardEquation.h"
 #include "../geometry/RectangularGrid.h"
 #include "../utils/ParameterHandler.h"
+#include "../utils/Profiler.h"
 #include "../utils/Vector.h"
 #include "../utils/LogStream.h"
+#include "../utils/Workspace.h"
+#include "../utils/FastMath.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
@@ -15,97 +19,197 @@ DegenerateCahnHilliardEquation::DegenerateCahnHilliardEquation()
         xiPow2Inv_( 1.0 ),
         xiPow2_( 1.0 ),
         xiPowAlpha_( 1.0 ),
-        eps_( 10*std::numeric_limits<realtype>::epsilon() )
+        eps_( 10*std::numeric_limits<realtype>::epsilon() ),
+        epsInv_( 1.0/eps_ ),
+        logEps_( std::log( eps_ ) ),
+        fastLog_( false ),
+        uBuffer_( -1 ),
+        u_( 0 ),
+        wBuffer_( -1 ),
+        w_( 0 ),
+        mBuffer_( -1 ),
+        m_( 0 )
 {}
 
 
 
+// The three rows at either end of the slab have their own slots in the row
+// buffers because they are computed apart from the sweep over the interior
+// rows (and rows 0 and xdim-1 are also needed at the other end of the sweep
+// with periodic boundary condition), the interior rows rotate in three slots.
+// Rows -1 and xdim come from the neighbouring processes in a distributed run.
+static inline
+unsigned int
+rowSlot( const int x, const int xdim )
+{
+    if ( x <= 2 )
+        return x + 1;
+    if ( x >= xdim-3 )
+        return x - xdim + 7;
+    return 8 + x % 3;
+}
+
+
+
 int
 DegenerateCahnHilliardEquation::rhs( const realtype &t, const Vector<realtype> &Y, Vector<realtype> &Ydot )
 {
-    realtype u, ul, ur, uu, ud;
-    realtype ml, mr, mu, md;
-    unsigned int xdim = grid_->dimension( xDim );
-    unsigned int ydim = grid_->dimension( yDim );
-    realtype hxPow2Inv = grid_->spatialStepPow2Inv( xDim );
-    realtype hyPow2Inv = grid_->spatialStepPow2Inv( yDim );
-    unsigned int index, x, y;
-
-    // compute chemical potential
-    for ( x = 0; x < xdim; x++ )
-        for ( y = 0; y < ydim; y++ )
-        {
-            index = grid_->nodeIndex(x,y);
+    ODEITY_PROBE( "rhs" );
+
+    u_ = workspace().data( uBuffer_ );
+    w_ = workspace().data( wBuffer_ );
+    m_ = workspace().data( mBuffer_ );
+
+    const int xdim = grid_->dimension( xDim );
+    const unsigned int rowLength = grid_->paddedDimension( yDim );
+    const unsigned int g = grid_->ghostLayers;
+
+    grid_->copyToPadded( Y.data(), u_ );
+
+    // The grid is swept once along x. The chemical potential and the mobility
+    // of row x are kept in a few row buffers with ghost nodes (see rowSlot()),
+    // row x+1 is computed just before the divergence of row x needs it. The
+    // interior rows are swept while the ghost rows of u are exchanged with the
+    // neighbouring processes, rows 1 and xdim-2 while the first and the last
+    // row of the chemical potential and the mobility are.
+    realtype * const w = w_ + g;
+    realtype * const m = m_ + g;
+    realtype * const ydot = Ydot.data();
+
+    MpiRequests requests;
+    grid_->beginFillGhostLayers( u_, grid_->boundaryCondition(), requests );
+
+    for ( int x = 1; x <= std::min( 2, xdim-2 ); x++ )
+        chemicalPotentialRow( x, w + rowSlot(x,xdim)*rowLength, m + rowSlot(x,xdim)*rowLength );
+    for ( int x = 2; x <= xdim-3; x++ )
+    {
+        const int next = x+1;
+        chemicalPotentialRow( next, w + rowSlot(next,xdim)*rowLength, m + rowSlot(next,xdim)*rowLength );
+        rhsRow( x, ydot );
+    }
 
-            u = Y(index);
-            ul = ( x == 0 ) ? Y(grid_->nodeIndex(1,y)) : Y(grid_->nodeIndex(x-1,y));
-            ur = ( x == xdim-1 ) ? Y(grid_->nodeIndex(xdim-2,y)) : Y(grid_->nodeIndex(x+1,y));
-            ud = ( y == 0 ) ? Y(grid_->nodeIndex(x,1)) : Y(grid_->nodeIndex(x,y-1));
-            uu = ( y == ydim-1 ) ? Y(grid_->nodeIndex(x,ydim-2)) : Y(grid_->nodeIndex(x,y+1));
+    grid_->endFillGhostLayers( u_, grid_->boundaryCondition(), requests );
+
+    chemicalPotentialRow( 0, w + rowSlot(0,xdim)*rowLength, m + rowSlot(0,xdim)*rowLength );
+    chemicalPotentialRow( xdim-1, w + rowSlot(xdim-1,xdim)*rowLength, m + rowSlot(xdim-1,xdim)*rowLength );
+
+    MpiRequests wRequests, mRequests;
+    grid_->beginExchangeWithNeighbours( w_ + rowSlot(0,xdim)*rowLength, w_ + rowSlot(-1,xdim)*rowLength,
+            w_ + rowSlot(xdim-1,xdim)*rowLength, w_ + rowSlot(xdim,xdim)*rowLength, rowLength,
+            wRequests );
+    grid_->beginExchangeWithNeighbours( m_ + rowSlot(0,xdim)*rowLength, m_ + rowSlot(-1,xdim)*rowLength,
+            m_ + rowSlot(xdim-1,xdim)*rowLength, m_ + rowSlot(xdim,xdim)*rowLength, rowLength,
+            mRequests );
+
+    if ( xdim >= 3 )
+        rhsRow( 1, ydot );
+    if ( xdim >= 4 )
+        rhsRow( xdim-2, ydot );
+
+    grid_->endExchangeWithNeighbours( wRequests );
+    grid_->endExchangeWithNeighbours( mRequests );
+
+    rhsRow( 0, ydot );
+    rhsRow( xdim-1, ydot );
+
+    return 0;
+}
 
-            w_(index) = - xiPow2_*(hxPow2Inv*( ul - 2*u + ur ) + hyPow2Inv*( uu - 2*u + ud )) + f0(u);
-        }
 
-    // compute mobility M
 
-    for ( x = 0; x < xdim-1; x++ )
-        for ( y = 0; y < ydim; y++ )
+// Divergence of the flux M(u) grad(w) in the nodes of row x, the chemical
+// potential and the mobility of rows x-1 to x+1 must be in the row buffers.
+void
+DegenerateCahnHilliardEquation::rhsRow( const int x, realtype * ydot )
+{
+    const int xdim = grid_->dimension( xDim );
+    const int ydim = grid_->dimension( yDim );
+    const unsigned int rowLength = grid_->paddedDimension( yDim );
+    const unsigned int g = grid_->ghostLayers;
+    const BoundaryCondition bc = grid_->auxiliaryBoundaryCondition();
+    const realtype hxPow2Inv = grid_->spatialStepPow2Inv( xDim );
+    const realtype hyPow2Inv = grid_->spatialStepPow2Inv( yDim );
+
+    const realtype * const w = w_ + g;
+    const realtype * const m = m_ + g;
+
+    const int left = grid_->boundaryImage( x - 1, xDim, bc );
+    const int right = grid_->boundaryImage( x + 1, xDim, bc );
+
+    const realtype * const wc = w + rowSlot(x,xdim)*rowLength;
+    const realtype * const wl = w + rowSlot(left,xdim)*rowLength;
+    const realtype * const wr = w + rowSlot(right,xdim)*rowLength;
+    const realtype * const mc = m + rowSlot(x,xdim)*rowLength;
+    const realtype * const mlRow = m + rowSlot(left,xdim)*rowLength;
+    const realtype * const mrRow = m + rowSlot(right,xdim)*rowLength;
+    realtype * const f = ydot + grid_->nodeIndex(x,0);
+
+    // the mobility on the edges is the average of the nodal values
+#pragma omp simd
+    for ( int y = 0; y < ydim; y++ )
+    {
+        const realtype u = wc[y];
+        const realtype ml = 0.5*( mlRow[y] + mc[y] );
+        const realtype mr = 0.5*( mc[y] + mrRow[y] );
+        const realtype md = 0.5*( mc[y-1] + mc[y] );
+        const realtype mu = 0.5*( mc[y] + mc[y+1] );
+
+        f[y] = xiPow2Inv_*(
+                hxPow2Inv*( mr*(wr[y]-u) - ml*(u-wl[y]) ) +
+                hyPow2Inv*( mu*(wc[y+1]-u) - md*(u-wc[y-1]) ) );
+    }
+}
+
+
+
+// Chemical potential w = -xi^2 lap(u) + f0(u) and mobility M(u) in the nodes
+// of row x including the ghost nodes at its ends.
+void
+DegenerateCahnHilliardEquation::chemicalPotentialRow( const unsigned int x, realtype * w, realtype * m )
+{
+    const int ydim = grid_->dimension( yDim );
+    const unsigned int rowLength = grid_->paddedDimension( yDim );
+    const BoundaryCondition bc = grid_->auxiliaryBoundaryCondition();
+    const realtype hxPow2Inv = grid_->spatialStepPow2Inv( xDim );
+    const realtype hyPow2Inv = grid_->spatialStepPow2Inv( yDim );
+
+    const realtype * const uc = u_ + grid_->paddedNodeIndex(x,0);
+    const realtype * const ul = uc - rowLength;
+    const realtype * const ur = uc + rowLength;
+
+    if ( fastLog_ )
+    {
+#pragma omp simd
+        for ( int y = 0; y < ydim; y++ )
         {
-            mAvgX_(grid_->nodeIndex(x,y)) = 0.5*( M(Y(grid_->nodeIndex(x,y))) + M(Y(grid_->nodeIndex(x+1,y))) );
-            // mAvgX_(grid_->nodeIndex(x,y)) = M(0.5*( Y(grid_->nodeIndex(x,y)) + Y(grid_->nodeIndex(x+1,y)) ));
+            w[y] = f0Fast( uc[y] );
+            m[y] = M( uc[y] );
         }
-
-    for ( x = 0; x < xdim; x++ )
-        for ( y = 0; y < ydim-1; y++ )
+    }
+    else
+    {
+        for ( int y = 0; y < ydim; y++ )
         {
-            mAvgY_(grid_->nodeIndex(x,y)) = 0.5*( M(Y(grid_->nodeIndex(x,y))) + M(Y(grid_->nodeIndex(x,y+1))) );
-            // mAvgY_(grid_->nodeIndex(x,y)) = M(0.5*( Y(grid_->nodeIndex(x,y)) + Y(grid_->nodeIndex(x,y+1)) ));
+            w[y] = f0( uc[y] );
+            m[y] = M( uc[y] );
         }
+    }
 
-    // compute divergence of M times grad of chempot
+#pragma omp simd
+    for ( int y = 0; y < ydim; y++ )
+    {
+        const realtype u = uc[y];
 
-    for ( x = 0; x < xdim; x++ )
-        for ( y = 0; y < ydim; y++ )
-        {
-            index = grid_->nodeIndex(x,y);
-
-            u = w_(index);
-
-            if ( x != 0 ) {
-                ul = w_(grid_->nodeIndex(x-1,y));
-                ml = mAvgX_(grid_->nodeIndex(x-1,y));
-            } else {
-                ul = w_(grid_->nodeIndex(1,y));
-                ml = mAvgX_(grid_->nodeIndex(0,y));
-            }
-            if ( x != xdim-1 ) {
-                ur = w_(grid_->nodeIndex(x+1,y));
-                mr = mAvgX_(grid_->nodeIndex(x,y));
-            } else {
-                ur = w_(grid_->nodeIndex(xdim-2,y));
-                mr = mAvgX_(grid_->nodeIndex(x-1,y));
-            }
-            if ( y != 0 ) {
-                ud = w_(grid_->nodeIndex(x,y-1));
-                md = mAvgY_(grid_->nodeIndex(x,y-1));
-            } else {
-                ud = w_(grid_->nodeIndex(x,1));
-                md = mAvgY_(grid_->nodeIndex(x,0));
-            }
-            if ( y != xdim-1 ) {
-                uu = w_(grid_->nodeIndex(x,y+1));
-                mu = mAvgY_(grid_->nodeIndex(x,y));
-            } else {
-                uu = w_(grid_->nodeIndex(x,ydim-2));
-                mu = mAvgY_(grid_->nodeIndex(x,y-1));
-            }
-
-            Ydot(index) = xiPow2Inv_*(
-                    hxPow2Inv*( mr*(ur-u) - ml*(u-ul) ) +
-                    hyPow2Inv*( mu*(uu-u) - md*(u-ud) ) );
-        }
+        w[y] += - xiPow2_*(hxPow2Inv*( ul[y] - 2*u + ur[y] ) + hyPow2Inv*( uc[y+1] - 2*u + uc[y-1] ));
+    }
 
-    return 0;
+    for ( int k = 1; k <= (int)grid_->ghostLayers; k++ )
+    {
+        w[-k] = w[grid_->boundaryImage( -k, yDim, bc )];
+        w[ydim-1+k] = w[grid_->boundaryImage( ydim-1+k, yDim, bc )];
+        m[-k] = m[grid_->boundaryImage( -k, yDim, bc )];
+        m[ydim-1+k] = m[grid_->boundaryImage( ydim-1+k, yDim, bc )];
+    }
 }
 
 
@@ -115,19 +219,33 @@ realtype DegenerateCahnHilliardEquation::f0( const realtype u )
 {
     // return xiPowAlpha_*(log(1.0 + u) - log(1.0 - u)) - u;
 
-    static const double eps_inv = 1.0/eps_;
-    static const double lneps = log(eps_);
-
     if ( u >= 1.0 - eps_ )
-        return xiPowAlpha_*(1.0+log(1.0+u) - eps_inv*(1.0-u) - lneps) - u;
+        return xiPowAlpha_*(1.0+log(1.0+u) - epsInv_*(1.0-u) - logEps_) - u;
     else if ( u <= -1.0 + eps_ )
-        return xiPowAlpha_*(-1.0-log(1.0-u) + eps_inv*(1.0+u) + lneps) - u;
+        return xiPowAlpha_*(-1.0-log(1.0-u) + epsInv_*(1.0+u) + logEps_) - u;
     else
         return xiPowAlpha_*(log(1.0 + u) - log(1.0 - u)) - u;
 }
 
 
 
+// Same regularization as f0() written without branches: below eps the
+// logarithm is replaced by its tangent at eps, which is what the min()
+// terms add to log(eps). They are written as min(a,eps) - min(b,eps), the
+// eps cancelling, since GCC does not turn min(a-eps,0.0), which refers to a
+// temporary, into a conditional move and the loop would not vectorize.
+inline
+realtype DegenerateCahnHilliardEquation::f0Fast( const realtype u )
+{
+    const realtype a = 1.0 + u;
+    const realtype b = 1.0 - u;
+
+    return xiPowAlpha_*( fastLog( std::max(a,eps_) / std::max(b,eps_) )
+            + epsInv_*( std::min(a,eps_) - std::min(b,eps_) ) ) - u;
+}
+
+
+
 inline
 realtype DegenerateCahnHilliardEquation::M( const realtype u )
 {
@@ -152,6 +270,7 @@ DegenerateCahnHilliardEquation::printInfo( ) const
     logger << "*Exponent in log. free energy (alpha)*:: " << alpha_ << endl;
     logger << "*xi^alpha*:: " << 2.0*xiPowAlpha_ << endl;
     logger << "*Regularization parameter in log. free energy*:: " << eps_ << endl;
+    logger << "*Logarithm*:: " << ( fastLog_ ? "fast" : "libm" ) << endl;
     logger << "*Jacobian implemented*:: ";
     if ( hasJacobian() )
         logger << "true" << endl;
@@ -171,9 +290,13 @@ DegenerateCahnHilliardEquation::attachGrid( const RectangularGrid<2>& grid )
 {
     MolOdeSystem<2>::attachGrid( grid );
 
-    w_.reinit( grid_->numberOfNodes() );
-    mAvgY_.reinit( grid_->numberOfNodes() );
-    mAvgX_.reinit( grid_->numberOfNodes() );
+    // row buffers, see rhs()
+    uBuffer_ = workspace().request( "solution with ghost layers", grid_->numberOfPaddedNodes(),
+            Workspace::rhsEvaluation );
+    wBuffer_ = workspace().request( "chemical potential rows", 11*grid_->paddedDimension( yDim ),
+            Workspace::rhsEvaluation );
+    mBuffer_ = workspace().request( "mobility rows", 11*grid_->paddedDimension( yDim ),
+            Workspace::rhsEvaluation );
 }
 
 
@@ -187,6 +310,7 @@ DegenerateCahnHilliardEquation::declareParameters( ParameterHandler& prm )
     prm.declare_entry( "beta", "1.0", Patterns::Double(), "Mobility parameter" );
     prm.declare_entry( "alpha", "1.0", Patterns::Double(), "If positive, it is exponent in log. free energy, if negative, then -alpha is the quench temperature" );
     prm.declare_entry( "eps", "1.0e-3", Patterns::Double(), "Regularization parameter in log. free energy" );
+    prm.declare_entry( "logarithm", "libm", Patterns::Selection("libm|fast"), "Evaluation of the logarithm in the free energy, fast is a branch-free polynomial approximation (within one ulp) that vectorizes" );
 
     prm.leave_subsection();
 }
@@ -218,6 +342,10 @@ DegenerateCahnHilliardEquation::getParameters( ParameterHandler& prm )
     eps_ = prm.get_double( "eps" );
     if ( eps_ < 0.0 )
         eps_ = 10*std::numeric_limits<realtype>::epsilon();
+    epsInv_ = 1.0/eps_;
+    logEps_ = std::log( eps_ );
+
+    fastLog_ = ( prm.get( "logarithm" ) == "fast" );
 
     prm.leave_subsection();
 }
@@ -26,17 +26,28 @@ class DegenerateCahnHilliardEquation : public MolOdeSystem<2>
         void getParameters( ParameterHandler& prm );
         void attachGrid( const RectangularGrid<2>& grid );
 
+    protected:
+
+        int stencilRadius() const { return 2; }
+
     private:
 
         realtype xi_, xiPow2Inv_, xiPow2_;
         realtype xiPowAlpha_;
         realtype alpha_, beta_;
-        realtype eps_;
-        Vector<realtype> w_;
-        Vector<realtype> mAvgX_;
-        Vector<realtype> mAvgY_;
-
+        realtype eps_, epsInv_, logEps_;
+        bool fastLog_;
+        int uBuffer_;
+        realtype * u_; // solution with ghost layers, in the workspace
+        int wBuffer_;
+        realtype * w_; // chemical potential, five rows with ghost nodes, in the workspace
+        int mBuffer_;
+        realtype * m_; // mobility at the nodes, five rows with ghost nodes, in the workspace
+
+        void chemicalPotentialRow( const unsigned int x, realtype * w, realtype * m );
+        void rhsRow( const int x, realtype * ydot );
         realtype f0( const realtype u );
+        realtype f0Fast( const realtype u );
         realtype M( const realtype u );
 };
 
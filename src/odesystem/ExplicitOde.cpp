@@ -1,14 +1,25 @@
 #include "ExplicitOde.h"
 #include "../utils/Exceptions.h"
+#include "../utils/SparseMatrix.h"
+#include "../utils/Workspace.h"
 
 ExplicitOde::ExplicitOde( bool hasJacobian )
   :
     hasJacobian_( hasJacobian ),
-    useJacobian_( false )
+    useJacobian_( false ),
+    ownWorkspace_( new Workspace() ),
+    workspace_( ownWorkspace_ )
 {}
 
 
 
+ExplicitOde::~ExplicitOde()
+{
+  delete ownWorkspace_;
+}
+
+
+
 void ExplicitOde::setUseJacobian( bool useJac )
 {
     useJacobian_ = useJac && hasJacobian_;
@@ -39,3 +50,65 @@ int ExplicitOde::jacobian( const Vector<realtype>& v, Vector<realtype>& Jv,
 }
 
 
+
+void ExplicitOde::jacobianBandwidths( int& lower, int& upper ) const
+{
+  lower = numberOfEquations() - 1;
+  upper = numberOfEquations() - 1;
+}
+
+
+
+bool ExplicitOde::hasJacobianMatrix() const
+{
+  return false;
+}
+
+
+
+int ExplicitOde::jacobianMatrix( const realtype t, const Vector<realtype>& y,
+    const Vector<realtype>& fy, JacobianMatrix& J )
+{
+  Assert( false, ExcPureFunctionCalled() );
+
+  return 0;
+}
+
+
+
+bool ExplicitOde::hasSparseJacobian() const
+{
+  return false;
+}
+
+
+
+const SparseMatrix& ExplicitOde::sparseJacobian( const realtype t, const Vector<realtype>& y,
+    const Vector<realtype>& fy )
+{
+  Assert( false, ExcPureFunctionCalled() );
+
+  static const SparseMatrix empty;
+  return empty;
+}
+
+
+
+int ExplicitOde::lineBlockSize() const
+{
+  return numberOfEquations();
+}
+
+
+
+void ExplicitOde::attachWorkspace( Workspace& workspace )
+{
+  workspace_ = &workspace;
+}
+
+
+
+Workspace& ExplicitOde::workspace()
+{
+  return *workspace_;
+}
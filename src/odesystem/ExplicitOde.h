@@ -7,11 +7,15 @@
 
 // forward declaration of Vector
 template <typename T> class Vector;
+class JacobianMatrix;
+class SparseMatrix;
+class Workspace;
 
 class ExplicitOde : public OdeSystemBase
 {
   public:
     ExplicitOde( bool hasJacobian );
+    ~ExplicitOde();
 
     virtual int rhs( const realtype &t, const Vector<realtype> &y, Vector<realtype> &ydot ) = 0;
     bool useJacobian() const;
@@ -21,9 +25,40 @@ class ExplicitOde : public OdeSystemBase
         const realtype t, const Vector<realtype>& y, const Vector<realtype>& fy,
         const Vector<realtype>& tmp );
 
+    // Jacobian matrix for the direct linear solvers: its lower and upper
+    // bandwidths, those of a full matrix by default, and its assembly,
+    // which the problem may implement
+    virtual void jacobianBandwidths( int& lower, int& upper ) const;
+    virtual bool hasJacobianMatrix() const;
+    virtual int jacobianMatrix( const realtype t, const Vector<realtype>& y,
+        const Vector<realtype>& fy, JacobianMatrix& J );
+
+    // Jacobian matrix in compressed sparse row format, e.g. for
+    // preconditioners, if the problem knows its sparsity pattern
+    virtual bool hasSparseJacobian() const;
+    virtual const SparseMatrix& sparseJacobian( const realtype t, const Vector<realtype>& y,
+        const Vector<realtype>& fy );
+
+    // number of consecutive equations forming a line of the problem, e.g.
+    // of a grid, the blocks of line preconditioners; the whole system by
+    // default
+    virtual int lineBlockSize() const;
+
+    // scratch memory of the problem, its integrator and their helpers; the
+    // problem has its own unless one is attached, which has to be done
+    // before the problem requests its buffers (e.g. in attachGrid())
+    void attachWorkspace( Workspace& workspace );
+    Workspace& workspace();
+
   private:
     bool hasJacobian_;
     bool useJacobian_;
+
+    Workspace * ownWorkspace_;
+    Workspace * workspace_;
+
+    ExplicitOde( const ExplicitOde& );
+    ExplicitOde& operator = ( const ExplicitOde& );
 };
 
 
@@ -0,0 +1,160 @@
+#ifndef GRID_BLOCKING_3D_H
+#define GRID_BLOCKING_3D_H
+
+#include "../geometry/RectangularGrid.h"
+#include "../utils/AlignedMemory.h"
+
+// Helpers shared by the three-dimensional method of lines kernels. The grid
+// is traversed in tiles of blockX3D x blockY3D rows of nodes, a row runs
+// along z and is contiguous in memory. Inside a tile the x-planes are
+// visited in order, so the three planes touched by the 7-point stencil stay
+// in cache: with 256 nodes in z one plane of a tile takes 32 kB. The tiles
+// are distributed among the OpenMP threads.
+static const unsigned int blockX3D = 32;
+static const unsigned int blockY3D = 16;
+
+
+
+// Neighbours of node i on a grid line of n nodes with homogeneous Neumann
+// boundary condition, the missing neighbour is the mirror image of the one
+// inside the domain.
+inline
+unsigned int
+neumannLower( const unsigned int i )
+{
+    return ( i == 0 ) ? 1 : i-1;
+}
+
+
+
+inline
+unsigned int
+neumannUpper( const unsigned int i, const unsigned int n )
+{
+    return ( i == n-1 ) ? n-2 : i+1;
+}
+
+
+// Planes adjacent to the first and the last x-plane of the slab of field v
+// owned by this process: the planes of the neighbouring slabs, received to
+// ghost (two planes long), or the mirror images inside the domain at its
+// boundary. The exchange is started by beginGhostPlanes(), the planes 1 to
+// xdim-2 of the slab can be worked on until endGhostPlanes() returns them.
+inline
+void
+beginGhostPlanes( const RectangularGrid<3> & grid, const realtype * v, realtype * ghost,
+        MpiRequests & requests )
+{
+    const unsigned int xdim = grid.dimension( xDim );
+    const unsigned int planeSize = grid.dimension( yDim )*grid.dimension( zDim );
+
+    grid.beginExchangeWithNeighbours( v, ghost, v + grid.nodeIndex(xdim-1,0,0), ghost + planeSize,
+            planeSize, requests );
+}
+
+
+
+inline
+void
+endGhostPlanes( const RectangularGrid<3> & grid, const realtype * v, const realtype * ghost,
+        MpiRequests & requests, const realtype * & lower, const realtype * & upper )
+{
+    const unsigned int xdim = grid.dimension( xDim );
+    const unsigned int planeSize = grid.dimension( yDim )*grid.dimension( zDim );
+
+    grid.endExchangeWithNeighbours( requests );
+    lower = grid.hasLowerNeighbour() ? ghost : v + grid.nodeIndex(1,0,0);
+    upper = grid.hasUpperNeighbour() ? ghost + planeSize : v + grid.nodeIndex(xdim-2,0,0);
+}
+
+// First touch of the arrays of the size of the slab in the order of the
+// kernels: the planes 1 to xdim-2, then the first and the last plane, each
+// by a loop over the tiles with the same static schedule, so a thread
+// touches the rows it computes. The layout is used for later allocations
+// from attachGrid() until it is destroyed.
+class TiledFirstTouch3D : public FirstTouchLayout
+{
+    public:
+        TiledFirstTouch3D();
+        ~TiledFirstTouch3D();
+
+        void attachGrid( const RectangularGrid<3> & grid );
+        bool touch( realtype * data, const long int length ) const;
+
+    private:
+        const RectangularGrid<3> * grid_;
+
+        void touchPlanes( const unsigned int xBegin, const unsigned int xEnd, realtype * data ) const;
+
+        TiledFirstTouch3D( const TiledFirstTouch3D& );
+        TiledFirstTouch3D& operator = ( const TiledFirstTouch3D& );
+};
+
+
+
+inline
+TiledFirstTouch3D::TiledFirstTouch3D()
+    :
+        grid_( 0 )
+{}
+
+
+
+inline
+TiledFirstTouch3D::~TiledFirstTouch3D()
+{
+    if ( firstTouchLayout() == this )
+        setFirstTouchLayout( 0 );
+}
+
+
+
+inline
+void
+TiledFirstTouch3D::attachGrid( const RectangularGrid<3> & grid )
+{
+    grid_ = &grid;
+    setFirstTouchLayout( this );
+}
+
+
+
+inline
+bool
+TiledFirstTouch3D::touch( realtype * data, const long int length ) const
+{
+    if ( grid_ == 0 || length != (long int) grid_->numberOfNodes() )
+        return false;
+
+    const unsigned int xdim = grid_->dimension( xDim );
+    touchPlanes( 1, xdim-1, data );
+    touchPlanes( 0, 1, data );
+    touchPlanes( xdim-1, xdim, data );
+    return true;
+}
+
+
+
+inline
+void
+TiledFirstTouch3D::touchPlanes( const unsigned int xBegin, const unsigned int xEnd, realtype * data ) const
+{
+    const unsigned int ydim = grid_->dimension( yDim );
+    const unsigned int zdim = grid_->dimension( zDim );
+    const unsigned int xBlocks = ( xEnd - xBegin + blockX3D - 1 ) / blockX3D;
+    const unsigned int yBlocks = ( ydim + blockY3D - 1 ) / blockY3D;
+
+#pragma omp parallel for collapse(2) schedule(static)
+    for ( unsigned int xb = 0; xb < xBlocks; xb++ )
+        for ( unsigned int yb = 0; yb < yBlocks; yb++ )
+        {
+            const unsigned int xTileEnd = std::min( xBegin + (xb+1)*blockX3D, xEnd );
+            const unsigned int yTileEnd = std::min( (yb+1)*blockY3D, ydim );
+
+            for ( unsigned int x = xBegin + xb*blockX3D; x < xTileEnd; x++ )
+                for ( unsigned int y = yb*blockY3D; y < yTileEnd; y++ )
+                    std::fill( data + grid_->nodeIndex(x,y,0), data + grid_->nodeIndex(x,y,0) + zdim, 0.0 );
+        }
+}
+
+#endif // GRID_BLOCKING_3D_H
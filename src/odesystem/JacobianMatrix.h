@@ -0,0 +1,76 @@
+#ifndef JACOBIAN_MATRIX_H
+#define JACOBIAN_MATRIX_H
+
+#include "../utils/Exceptions.h"
+
+#include <sundials/sundials_direct.h>
+
+// Jacobian matrix df/dy handed to ExplicitOde::jacobianMatrix() by the
+// direct linear solvers of CVODE, either dense or banded. It is zero on
+// entry. The entries are accumulated with +=, since under Neumann
+// condition two neighbours of a node at the boundary can be the same node.
+class JacobianMatrix
+{
+    public:
+
+        explicit JacobianMatrix( DlsMat matrix );
+
+        int size() const;
+        bool isBanded() const;
+        bool inBand( const int i, const int j ) const;
+
+        realtype & operator () ( const int i, const int j );
+
+    private:
+
+        DlsMat matrix_;
+};
+
+
+
+inline
+JacobianMatrix::JacobianMatrix( DlsMat matrix )
+    :
+        matrix_( matrix )
+{}
+
+
+
+inline
+int
+JacobianMatrix::size() const
+{
+    return matrix_->N;
+}
+
+
+
+inline
+bool
+JacobianMatrix::isBanded() const
+{
+    return matrix_->type == SUNDIALS_BAND;
+}
+
+
+
+inline
+bool
+JacobianMatrix::inBand( const int i, const int j ) const
+{
+    return not isBanded() || ( j - i <= matrix_->mu && i - j <= matrix_->ml );
+}
+
+
+
+inline
+realtype &
+JacobianMatrix::operator () ( const int i, const int j )
+{
+    Assert( i >= 0 && i < size() && j >= 0 && j < size(), ExcMessage( "Jacobian entry out of range" ) );
+    Assert( inBand( i, j ), ExcMessage( "Jacobian entry outside the band" ) );
+
+    return isBanded() ? BAND_ELEM( matrix_, i, j ) : DENSE_ELEM( matrix_, i, j );
+}
+
+#endif // JACOBIAN_MATRIX_H
@@ -1,8 +1,10 @@
 #include "LoretiMarchEquation.h"
 #include "../geometry/RectangularGrid.h"
 #include "../utils/ParameterHandler.h"
+#include "../utils/Profiler.h"
 #include "../utils/Vector.h"
 #include "../utils/LogStream.h"
+#include "../utils/Workspace.h"
 
 #include <cmath>
 
@@ -15,7 +17,11 @@ LoretiMarchEquation::LoretiMarchEquation()
         xiSqr_( 1.0 ),
         twoOverXi_( 2.0 ),
         twoOverXiPow3_( 2.0 ),
-        a_( 1.0 )
+        a_( 1.0 ),
+        uBuffer_( -1 ),
+        u_( 0 ),
+        wBuffer_( -1 ),
+        w_( 0 )
 {}
 
 
@@ -23,48 +29,91 @@ LoretiMarchEquation::LoretiMarchEquation()
 int
 LoretiMarchEquation::rhs( const realtype &t, const Vector<realtype> &Y, Vector<realtype> &Ydot )
 {
-    realtype u, ul, ur, uu, ud, w, wl, wr, wd, wu;
-    unsigned int xdim = grid_->dimension( xDim );
-    unsigned int ydim = grid_->dimension( yDim );
-    realtype hxPow2Inv = grid_->spatialStepPow2Inv( xDim );
-    realtype hyPow2Inv = grid_->spatialStepPow2Inv( yDim );
-    unsigned int index, x, y;
-
-    for ( x = 0; x < xdim; x++ )
-        for ( y = 0; y < ydim; y++ )
-        {
-            index = grid_->nodeIndex(x,y);
+    ODEITY_PROBE( "rhs" );
 
-            u = Y(index);
-            ul = ( x == 0 ) ? Y(grid_->nodeIndex(1,y)) : Y(grid_->nodeIndex(x-1,y));
-            ur = ( x == xdim-1 ) ? Y(grid_->nodeIndex(xdim-2,y)) : Y(grid_->nodeIndex(x+1,y));
-            ud = ( y == 0 ) ? Y(grid_->nodeIndex(x,1)) : Y(grid_->nodeIndex(x,y-1));
-            uu = ( y == ydim-1 ) ? Y(grid_->nodeIndex(x,ydim-2)) : Y(grid_->nodeIndex(x,y+1));
+    u_ = workspace().data( uBuffer_ );
+    w_ = workspace().data( wBuffer_ );
 
-            w_(index) = - xiSqr_*(hxPow2Inv*( ul - 2*u + ur ) + hyPow2Inv*( uu - 2*u + ud )) + PsiDer(u);
-        }
+    const unsigned int xdim = grid_->dimension( xDim );
+    const unsigned int g = grid_->ghostLayers;
 
-    for ( x = 0; x < xdim; x++ )
-        for ( y = 0; y < ydim; y++ )
-        {
-            index = grid_->nodeIndex(x,y);
+    grid_->copyToPadded( Y.data(), u_ );
 
-            w = w_(index);
-            u = Y(index);
-            wl = ( x == 0 ) ? w_(grid_->nodeIndex(1,y)) : w_(grid_->nodeIndex(x-1,y));
-            wr = ( x == xdim-1 ) ? w_(grid_->nodeIndex(xdim-2,y)) : w_(grid_->nodeIndex(x+1,y));
-            wd = ( y == 0 ) ? w_(grid_->nodeIndex(x,1)) : w_(grid_->nodeIndex(x,y-1));
-            wu = ( y == ydim-1 ) ? w_(grid_->nodeIndex(x,ydim-2)) : w_(grid_->nodeIndex(x,y+1));
+    // Both sweeps overlap the exchange of the ghost rows with the
+    // neighbouring processes: the rows next to the ghost rows are computed
+    // after it completes, the others while it is underway.
+    MpiRequests requests;
+    grid_->beginFillGhostLayers( u_, grid_->boundaryCondition(), requests );
+    chemicalPotentialRows( g, xdim-g );
+    grid_->endFillGhostLayers( u_, grid_->boundaryCondition(), requests );
+    chemicalPotentialRows( 0, g );
+    chemicalPotentialRows( xdim-g, xdim );
 
-            Ydot(index) = twoOverXi_*(hxPow2Inv*( wl - 2*w + wr ) + hyPow2Inv*( wu - 2*w + wd ))
-                - xiInv_*w - twoOverXiPow3_ * PsiDerDer(u)*w;
-        }
+    grid_->beginFillGhostLayers( w_, grid_->auxiliaryBoundaryCondition(), requests );
+    rhsRows( g, xdim-g, Ydot.data() );
+    grid_->endFillGhostLayers( w_, grid_->auxiliaryBoundaryCondition(), requests );
+    rhsRows( 0, g, Ydot.data() );
+    rhsRows( xdim-g, xdim, Ydot.data() );
 
     return 0;
 }
 
 
 
+void
+LoretiMarchEquation::chemicalPotentialRows( const unsigned int xBegin, const unsigned int xEnd )
+{
+    const int ydim = grid_->dimension( yDim );
+    const unsigned int rowLength = grid_->paddedDimension( yDim );
+    const realtype hxPow2Inv = grid_->spatialStepPow2Inv( xDim );
+    const realtype hyPow2Inv = grid_->spatialStepPow2Inv( yDim );
+
+    for ( unsigned int x = xBegin; x < xEnd; x++ )
+    {
+        const realtype * const uc = u_ + grid_->paddedNodeIndex(x,0);
+        const realtype * const ul = uc - rowLength;
+        const realtype * const ur = uc + rowLength;
+        realtype * const w = w_ + grid_->paddedNodeIndex(x,0);
+
+#pragma omp simd
+        for ( int y = 0; y < ydim; y++ )
+        {
+            const realtype u = uc[y];
+            w[y] = - xiSqr_*(hxPow2Inv*( ul[y] - 2*u + ur[y] ) + hyPow2Inv*( uc[y+1] - 2*u + uc[y-1] )) + PsiDer(u);
+        }
+    }
+}
+
+
+
+void
+LoretiMarchEquation::rhsRows( const unsigned int xBegin, const unsigned int xEnd, realtype * ydot )
+{
+    const int ydim = grid_->dimension( yDim );
+    const unsigned int rowLength = grid_->paddedDimension( yDim );
+    const realtype hxPow2Inv = grid_->spatialStepPow2Inv( xDim );
+    const realtype hyPow2Inv = grid_->spatialStepPow2Inv( yDim );
+
+    for ( unsigned int x = xBegin; x < xEnd; x++ )
+    {
+        const realtype * const uc = u_ + grid_->paddedNodeIndex(x,0);
+        const realtype * const wc = w_ + grid_->paddedNodeIndex(x,0);
+        const realtype * const wl = wc - rowLength;
+        const realtype * const wr = wc + rowLength;
+        realtype * const f = ydot + grid_->nodeIndex(x,0);
+
+#pragma omp simd
+        for ( int y = 0; y < ydim; y++ )
+        {
+            const realtype w = wc[y];
+            f[y] = twoOverXi_*(hxPow2Inv*( wl[y] - 2*w + wr[y] ) + hyPow2Inv*( wc[y+1] - 2*w + wc[y-1] ))
+                - xiInv_*w - twoOverXiPow3_ * PsiDerDer(uc[y])*w;
+        }
+    }
+}
+
+
+
 inline
 realtype LoretiMarchEquation::PsiDer( const realtype u )
 {
@@ -100,7 +149,10 @@ LoretiMarchEquation::attachGrid( const RectangularGrid<2>& grid )
 {
     MolOdeSystem<2>::attachGrid( grid );
 
-    w_.reinit( grid_->numberOfNodes() );
+    uBuffer_ = workspace().request( "solution with ghost layers", grid_->numberOfPaddedNodes(),
+            Workspace::rhsEvaluation );
+    wBuffer_ = workspace().request( "chemical potential with ghost layers", grid_->numberOfPaddedNodes(),
+            Workspace::rhsEvaluation );
 }
 
 
@@ -25,15 +25,25 @@ class LoretiMarchEquation : public MolOdeSystem<2>
 
         void attachGrid( const RectangularGrid<2>& grid );
 
+    protected:
+
+        int stencilRadius() const { return 2; }
+
     private:
 
         realtype xi_, xiInv_, xiSqr_, twoOverXi_, twoOverXiPow3_;
         realtype a_;
-        Vector<realtype> w_;
+        int uBuffer_;
+        realtype * u_; // solution with ghost layers, in the workspace
+        int wBuffer_;
+        realtype * w_; // chemical potential with ghost layers, in the workspace
 
         realtype PsiDer( const realtype u);
         realtype PsiDerDer( const realtype u);
 
+        void chemicalPotentialRows( const unsigned int xBegin, const unsigned int xEnd );
+        void rhsRows( const unsigned int xBegin, const unsigned int xEnd, realtype * ydot );
+
 };
 
 
@@ -1,5 +1,11 @@
 #include "MolOdeSystem.h"
+#include "JacobianMatrix.h"
 #include "../geometry/RectangularGrid.h"
+#include "../utils/MpiUtilities.h"
+#include "../utils/SparseMatrix.h"
+
+#include <algorithm>
+#include <cstdlib>
 
 
 template<int dim>
@@ -10,6 +16,182 @@ MolOdeSystem<dim>::numberOfEquations() const
   return grid_->numberOfNodes();
 }
 
+// The nodes are numbered with x varying slowest, so the stencil reaches
+// stencilRadius() slices of constant x on either side, at any node of the
+// slice when the other directions are periodic. Periodicity in x couples
+// the first and the last slice, the matrix is then full.
+template<int dim>
+void
+MolOdeSystem<dim>::jacobianBandwidths( int& lower, int& upper ) const
+{
+  Assert( grid_ != 0, ExcNotInitialized() );
+
+  const int n = numberOfEquations();
+  const int sliceNodes = n / grid_->dimension( xDim );
+
+  if ( grid_->boundaryCondition() == periodicBoundary )
+    lower = upper = n - 1;
+  else
+    lower = upper = std::min( ( stencilRadius() + 1 )*sliceNodes - 1, n - 1 );
+}
+
+// A neighbour outside the domain is the node its ghost node mirrors, see
+// RectangularGrid::boundaryImage(), which under Dirichlet condition enters
+// with the opposite sign. Neighbours in the slab of another process are left
+// out.
+template<int dim>
+void
+MolOdeSystem<dim>::jacobianSparsity( std::vector<int>& rowStart, std::vector<int>& columns ) const
+{
+  Assert( grid_ != 0, ExcNotInitialized() );
+
+  const BoundaryCondition bc = grid_->boundaryCondition();
+  const int r = stencilRadius();
+
+  int n[3] = { 1, 1, 1 };
+  for ( int d = 0; d < dim; d++ )
+    n[d] = grid_->dimension( d );
+
+  std::vector<int> offsets;
+  for ( int ox = -r; ox <= r; ox++ )
+    for ( int oy = ( dim > 1 ? -r : 0 ); oy <= ( dim > 1 ? r : 0 ); oy++ )
+      for ( int oz = ( dim > 2 ? -r : 0 ); oz <= ( dim > 2 ? r : 0 ); oz++ )
+        if ( std::abs( ox ) + std::abs( oy ) + std::abs( oz ) <= r )
+        {
+          offsets.push_back( ox );
+          offsets.push_back( oy );
+          offsets.push_back( oz );
+        }
+
+  rowStart.assign( 1, 0 );
+  columns.clear();
+
+  std::vector<int> row;
+  for ( int x = 0; x < n[0]; x++ )
+    for ( int y = 0; y < n[1]; y++ )
+      for ( int z = 0; z < n[2]; z++ )
+      {
+        row.clear();
+        for ( unsigned int k = 0; k < offsets.size(); k += 3 )
+        {
+          int c[3] = { x + offsets[k], y + offsets[k+1], z + offsets[k+2] };
+          bool inside = true;
+          for ( int d = 0; d < dim; d++ )
+          {
+            if ( c[d] >= 0 && c[d] < n[d] )
+              continue;
+            c[d] = grid_->boundaryImage( c[d], d, bc );
+            inside = inside && c[d] >= 0 && c[d] < n[d];
+          }
+          if ( inside )
+            row.push_back( ( c[0]*n[1] + c[1] )*n[2] + c[2] );
+        }
+
+        std::sort( row.begin(), row.end() );
+        columns.insert( columns.end(), row.begin(), std::unique( row.begin(), row.end() ) );
+        rowStart.push_back( columns.size() );
+      }
+}
+
+// Coloring by a perfect code of the stencil: the color (x + a y + b z) mod m
+// differs at all nodes of any stencil, so the matrix takes as many colors
+// as the stencil has nodes. It exists in 1D and 2D and for the 7-point
+// stencil in 3D. The coloring breaks where periodicity wraps around a grid
+// whose dimension is not a multiple of the period, ColoredJacobian then
+// colors greedily.
+//
+// In a distributed run x is the global index, so that the stencils that
+// reach into the slab of a neighbouring process are colored consistently
+// as well: a column perturbed there never has the color of a column of
+// this process in the same row. The wrap in x lies between the first and
+// the last process, where ColoredJacobian cannot check it, so the coloring
+// is only proposed if it holds there.
+template<int dim>
+void
+MolOdeSystem<dim>::jacobianColoring( std::vector<int>& colors ) const
+{
+  const int r = stencilRadius();
+
+  int m, a = 0, b = 0;
+  if ( dim == 1 )
+    m = 2*r + 1;
+  else if ( dim == 2 )
+  {
+    m = 2*r*r + 2*r + 1;
+    a = 2*r + 1;
+  }
+  else if ( r == 1 )
+  {
+    m = 7;
+    a = 2;
+    b = 3;
+  }
+  else
+  {
+    colors.clear();
+    return;
+  }
+
+  if ( mpiSize() > 1 && grid_->boundaryCondition() == periodicBoundary
+      && grid_->globalDimension( xDim ) % m != 0 )
+  {
+    colors.clear();
+    return;
+  }
+
+  int n[3] = { 1, 1, 1 };
+  for ( int d = 0; d < dim; d++ )
+    n[d] = grid_->dimension( d );
+  const int offset = grid_->globalOffset( xDim );
+
+  colors.resize( numberOfEquations() );
+  for ( int x = 0; x < n[0]; x++ )
+    for ( int y = 0; y < n[1]; y++ )
+      for ( int z = 0; z < n[2]; z++ )
+        colors[( x*n[1] + y )*n[2] + z] = ( offset + x + a*y + b*z ) % m;
+}
+
+template<int dim>
+const SparseMatrix&
+MolOdeSystem<dim>::sparseJacobian( const realtype t, const Vector<realtype>& y,
+    const Vector<realtype>& fy )
+{
+  if ( not coloredJacobianReady_ )
+  {
+    std::vector<int> rowStart, columns, colors;
+    jacobianSparsity( rowStart, columns );
+    jacobianColoring( colors );
+    coloredJacobian_.reinit( workspace(), rowStart, columns, colors );
+    coloredJacobianReady_ = true;
+  }
+
+  coloredJacobian_.assemble( *this, t, y, fy );
+  return coloredJacobian_.matrix();
+}
+
+template<int dim>
+int
+MolOdeSystem<dim>::jacobianMatrix( const realtype t, const Vector<realtype>& y,
+    const Vector<realtype>& fy, JacobianMatrix& J )
+{
+  const SparseMatrix& A = sparseJacobian( t, y, fy );
+
+  for ( int i = 0; i < A.size(); i++ )
+    for ( int k = A.rowStart()[i]; k < A.rowStart()[i+1]; k++ )
+      J( i, A.columns()[k] ) = A.values()[k];
+
+  return 0;
+}
+
+// nodes along the last direction, which are numbered consecutively
+template<int dim>
+int
+MolOdeSystem<dim>::lineBlockSize() const
+{
+  Assert( grid_ != 0, ExcNotInitialized() );
+  return grid_->dimension( dim-1 );
+}
+
 template class MolOdeSystem<1>;
 template class MolOdeSystem<2>;
 template class MolOdeSystem<3>;
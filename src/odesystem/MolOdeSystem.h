@@ -2,8 +2,11 @@
 #define MOL_ODE_SYSTEM_H
 
 #include "ExplicitOde.h"
+#include "ColoredJacobian.h"
 #include "../utils/Exceptions.h"
 
+#include <vector>
+
 template<int dim> class RectangularGrid;
 class ParameterHandler;
 
@@ -24,11 +27,36 @@ class MolOdeSystem : public ExplicitOde
     virtual void printInfo() const = 0;
     virtual void getParameters( ParameterHandler& prm ) = 0;
 
+    // The Jacobian matrix is approximated by colored finite differences on
+    // the sparsity pattern of the stencil, unless an equation assembles it
+    // itself. The pattern holds the nodes within stencilRadius() in the
+    // 1-norm of the grid indices.
+    void jacobianSparsity( std::vector<int>& rowStart, std::vector<int>& columns ) const;
+    void jacobianBandwidths( int& lower, int& upper ) const;
+    bool hasSparseJacobian() const { return true; }
+    const SparseMatrix& sparseJacobian( const realtype t, const Vector<realtype>& y,
+        const Vector<realtype>& fy );
+    int lineBlockSize() const;
+    bool hasJacobianMatrix() const { return true; }
+    int jacobianMatrix( const realtype t, const Vector<realtype>& y,
+        const Vector<realtype>& fy, JacobianMatrix& J );
+
   protected:
 
+    // number of neighbours the stencil of the right hand side reaches in
+    // each direction, 2 for the fourth order equations
+    virtual int stencilRadius() const { return 1; }
+
+    void jacobianColoring( std::vector<int>& colors ) const;
+
     const RectangularGrid<dim>* grid_;
     int numComponents_;
 
+  private:
+
+    ColoredJacobian coloredJacobian_;
+    bool coloredJacobianReady_;
+
 };
 
 
@@ -39,7 +67,8 @@ MolOdeSystem<dim>::MolOdeSystem( bool hasJacobian, int numComponents )
   :
     ExplicitOde( hasJacobian ),
     grid_( 0 ),
-    numComponents_( numComponents )
+    numComponents_( numComponents ),
+    coloredJacobianReady_( false )
 {}
 
 
@@ -50,6 +79,7 @@ void
 MolOdeSystem<dim>::attachGrid( const RectangularGrid<dim>& grid )
 {
   grid_ = &grid;
+  coloredJacobianReady_ = false;
 }
 
 #endif // MOD_ODE_SYSTEM_H
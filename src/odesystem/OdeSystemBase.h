@@ -8,6 +8,7 @@ class OdeSystemBase
 
     public:
         OdeSystemBase() {}
+        virtual ~OdeSystemBase() {}
 
         virtual int numberOfEquations() const = 0;
         virtual std::string name() const = 0;
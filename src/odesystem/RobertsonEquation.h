@@ -2,17 +2,53 @@
 #define ROBERTSON_EQUATION_H
 
 #include "ExplicitOde.h"
+#include "JacobianMatrix.h"
+#include "../utils/Vector.h"
 
 class RobertsonEquation : public ExplicitOde
 {
     public:
         RobertsonEquation() : ExplicitOde( 3 ) {}
 
+        static const int equations = 3;
+        static const int parameters = 3;
+
+        int numberOfEquations() const { return equations; }
+        std::string name() const { return "Robertson equation"; }
+
+        // the right hand side on plain arrays with component i at y[i*s],
+        // shared with the ensemble integrators; p holds the rate constants
+        // k1, k2, k3
+        static void evaluate( const realtype t, const realtype * y, realtype * ydot,
+                const realtype * p, const int s = 1 )
+        {
+            ydot[0] = -p[0] * y[0] + p[s] * y[s] * y[2*s];
+            ydot[2*s] = p[2*s] * y[s] * y[s];
+            ydot[s] = -ydot[0] - ydot[2*s];
+        }
+
         virtual int rhs( const realtype &t,  const Vector<realtype> &y, Vector<realtype> &ydot )
         {
-            ydot(0) = -0.04e0 * y(0) + 1.0e4 * y(1) * y(2);
-            ydot(1) = -y(0) - y(2);
-            ydot(2) = 3.0e7 * y(1) * y(1);
+            const realtype rates[3] = { 0.04e0, 1.0e4, 3.0e7 };
+            evaluate( t, y.data(), ydot.data(), rates );
+
+            return 0;
+        }
+
+        bool hasJacobianMatrix() const { return true; }
+
+        virtual int jacobianMatrix( const realtype t, const Vector<realtype> &y,
+                const Vector<realtype> &fy, JacobianMatrix &J )
+        {
+            const realtype rates[3] = { 0.04e0, 1.0e4, 3.0e7 };
+            const realtype * const u = y.data();
+
+            J(0,0) = -rates[0];
+            J(0,1) = rates[1] * u[2];
+            J(0,2) = rates[1] * u[1];
+            J(2,1) = 2 * rates[2] * u[1];
+            for ( int j = 0; j < 3; j++ )
+                J(1,j) = -J(0,j) - J(2,j);
 
             return 0;
         }
@@ -2,6 +2,7 @@
 #define TEST_SYSTEM_01_H
 
 #include "ExplicitOde.h"
+#include "../utils/Vector.h"
 
 // fortex1.html
 // initial condition y(0) = 0.0
@@ -10,9 +11,20 @@ class TestSystem01 : public ExplicitOde
     public:
         TestSystem01() : ExplicitOde( 1 ) {}
 
+        static const int equations = 1;
+        static const int parameters = 0;
+
+        // the right hand side on plain arrays with component i at y[i*s],
+        // shared with the ensemble integrators
+        static void evaluate( const realtype t, const realtype * y, realtype * ydot,
+                const realtype * p, const int s = 1 )
+        {
+            ydot[0] = -2.0 * t * y[0] + 4.0 * t;
+        }
+
         virtual int rhs( const realtype &t,  const Vector<realtype> &y, Vector<realtype> &ydot )
         {
-            ydot(0) = -2.0 * t * y(0) + 4.0 * t;
+            evaluate( t, y.data(), ydot.data(), 0 );
 
             return 0;
         }
@@ -2,6 +2,7 @@
 #define TEST_SYSTEM_02_H
 
 #include "ExplicitOde.h"
+#include "../utils/Vector.h"
 
 // non-stiff DETEST B1
 class TestSystem02 : public ExplicitOde {
@@ -10,10 +11,21 @@ public:
   : ExplicitOde( 2 )
   {}
 
+  static const int equations = 2;
+  static const int parameters = 0;
+
+  // the right hand side on plain arrays with component i at y[i*s],
+  // shared with the ensemble integrators
+  static void evaluate( const realtype t, const realtype * y, realtype * ydot,
+          const realtype * p, const int s = 1 )
+  {
+    ydot[0] = 2.0 * ( y[0] - y[0] * y[s] );
+    ydot[s] = -( y[s] - y[0] * y[s] );
+  }
+
   virtual int rhs( const realtype &t,  const Vector<realtype> &y, Vector<realtype> &ydot )
   {
-    ydot(0) = 2.0 * ( y(0) - y(0) * y(1) );
-    ydot(1) = -( y(1) - y(0) * y(1) );
+    evaluate( t, y.data(), ydot.data(), 0 );
 
     return 0;
   }
@@ -2,6 +2,7 @@
 #define TEST_SYSTEM_03_H
 
 #include "ExplicitOde.h"
+#include "../utils/Vector.h"
 
 // Behind and Beyond the MATLAB ODE Suite
 // van der pool oscillator
@@ -12,10 +13,21 @@ public:
   : ExplicitOde( 2 )
   {}
 
+  static const int equations = 2;
+  static const int parameters = 0;
+
+  // the right hand side on plain arrays with component i at y[i*s],
+  // shared with the ensemble integrators
+  static void evaluate( const realtype t, const realtype * y, realtype * ydot,
+          const realtype * p, const int s = 1 )
+  {
+    ydot[0] = y[s];
+    ydot[s] = y[s]*(1.0-y[0]*y[0]) - y[0];
+  }
+
   virtual int rhs( const realtype &t,  const Vector<realtype> &y, Vector<realtype> &ydot )
   {
-    ydot(0) = y(1);
-    ydot(1) = y(1)*(1.0-y(0)*y(0)) - y(0);
+    evaluate( t, y.data(), ydot.data(), 0 );
 
     return 0;
   }
@@ -2,6 +2,7 @@
 #define TEST_SYSTEM_04_H
 
 #include "ExplicitOde.h"
+#include "../utils/Vector.h"
 
 // fortex2.html
 // initial condition y(*) = 0.0
@@ -12,10 +13,21 @@ public:
   : ExplicitOde( 2 )
   {}
 
+  static const int equations = 2;
+  static const int parameters = 0;
+
+  // the right hand side on plain arrays with component i at y[i*s],
+  // shared with the ensemble integrators
+  static void evaluate( const realtype t, const realtype * y, realtype * ydot,
+          const realtype * p, const int s = 1 )
+  {
+    ydot[0] = y[s] + t;
+    ydot[s] = y[0] + 1;
+  }
+
   virtual int rhs( const realtype &t,  const Vector<realtype> &y, Vector<realtype> &ydot )
   {
-    ydot(0) = y(1) + t;
-    ydot(1) = y(0) + 1;
+    evaluate( t, y.data(), ydot.data(), 0 );
 
     return 0;
   }
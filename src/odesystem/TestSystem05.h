@@ -2,6 +2,7 @@
 #define TEST_SYSTEM_05_H
 
 #include "ExplicitOde.h"
+#include "../utils/Vector.h"
 
 // Stiff DETEST A3
 // initial condition y(*) = 1.0
@@ -11,12 +12,23 @@ public:
   : ExplicitOde( 4 )
   {}
 
+  static const int equations = 4;
+  static const int parameters = 0;
+
+  // the right hand side on plain arrays with component i at y[i*s],
+  // shared with the ensemble integrators
+  static void evaluate( const realtype t, const realtype * y, realtype * ydot,
+          const realtype * p, const int s = 1 )
+  {
+    ydot[0] = -1.0e4 * y[0] + 1.0e2 * y[s] - 1.0e1 * y[2*s] + y[3*s];
+    ydot[s] = -1.0e3 * y[s] + 1.0e1 * y[2*s] - 1.0e1 * y[3*s];
+    ydot[2*s] = -y[2*s] + 1.0e1 * y[3*s];
+    ydot[3*s] = -1.0e-1 * y[3*s];
+  }
+
   virtual int rhs( const realtype &t,  const Vector<realtype> &y, Vector<realtype> &ydot )
   {
-    ydot(0) = -1.0e4 * y(0) + 1.0e2 * y(1) - 1.0e1 * y(2) + y(3);
-    ydot(1) = -1.0e3 * y(1) + 1.0e1 * y(2) - 1.0e1 * y(3);
-    ydot(2) = -y(2) + 1.0e1 * y(3);
-    ydot(3) = -1.0e-1 * y(3);
+    evaluate( t, y.data(), ydot.data(), 0 );
 
     return 0;
   }
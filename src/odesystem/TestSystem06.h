@@ -2,6 +2,9 @@
 #define TEST_SYSTEM_06_H
 
 #include "ExplicitOde.h"
+#include "../utils/Vector.h"
+
+#include <cmath>
 
 // Matlab ODE Suite - chm6ode
 // initial condition y(*) = 0.0
@@ -11,13 +14,24 @@ public:
   : ExplicitOde( 4 )
   {}
 
+  static const int equations = 4;
+  static const int parameters = 0;
+
+  // the right hand side on plain arrays with component i at y[i*s],
+  // shared with the ensemble integrators
+  static void evaluate( const realtype t, const realtype * y, realtype * ydot,
+          const realtype * p, const int s = 1 )
+  {
+    realtype K = std::pow(M_E, 20.7 - 1500.0/y[0] );
+    ydot[0] = 1.3 * (y[2*s]-y[0]) + 10400.0 * K * y[s];
+    ydot[s] = 1880.0 * (y[3*s] - y[s]*(1+K));
+    ydot[2*s] = 1752.0 - 269.0 * y[2*s] + 267.0 * y[0];
+    ydot[3*s] = 0.1 + 320.0 * y[s] - 321.0 * y[3*s];
+  }
+
   virtual int rhs( const realtype &t,  const Vector<realtype> &y, Vector<realtype> &ydot )
   {
-    realtype K = std::pow(M_E, 20.7 - 1500.0/y(0) );
-    ydot(0) = 1.3 * (y(2)-y(0)) + 10400.0 * K * y(1);
-    ydot(1) = 1880.0 * (y(3) - y(1)*(1+K));
-    ydot(2) = 1752.0 - 269.0 * y(2) + 267.0 * y(0);
-    ydot(3) = 0.1 + 320.0 * y(1) - 321.0 * y(3);
+    evaluate( t, y.data(), ydot.data(), 0 );
 
     return 0;
   }
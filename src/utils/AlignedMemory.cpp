@@ -0,0 +1,95 @@
+#include "AlignedMemory.h"
+#include "Exceptions.h"
+
+#include <sys/mman.h>
+
+#include <cstdlib>
+
+
+static const std::size_t cacheLineSize = 64;
+static const std::size_t hugePageSize = 2 << 20;
+
+static bool hugePages = false;
+static bool firstTouch = true;
+static const FirstTouchLayout * layout = 0;
+
+
+
+void
+setHugePages( const bool enable )
+{
+    hugePages = enable;
+}
+
+
+
+void
+setFirstTouch( const bool enable )
+{
+    firstTouch = enable;
+}
+
+
+
+void
+setFirstTouchLayout( const FirstTouchLayout * newLayout )
+{
+    layout = newLayout;
+}
+
+
+
+const FirstTouchLayout *
+firstTouchLayout()
+{
+    return layout;
+}
+
+
+
+// A huge page array is rounded up to whole huge pages, so that its last
+// page can be backed by a huge page as well.
+realtype *
+allocateAligned( const long int length )
+{
+    std::size_t bytes = length*sizeof( realtype );
+    std::size_t alignment = cacheLineSize;
+    if ( hugePages && bytes >= hugePageSize )
+    {
+        alignment = hugePageSize;
+        bytes = ( bytes + hugePageSize - 1 )/hugePageSize*hugePageSize;
+    }
+
+    void * memory = 0;
+    if ( posix_memalign( &memory, alignment, bytes > 0 ? bytes : alignment ) != 0 )
+        throw ExcOutOfMemory();
+
+#ifdef MADV_HUGEPAGE
+    // only advice, the kernel may have transparent huge pages disabled
+    if ( alignment == hugePageSize )
+        madvise( memory, bytes, MADV_HUGEPAGE );
+#endif
+
+    realtype * const data = static_cast<realtype *>( memory );
+    if ( not firstTouch )
+    {
+        for ( long int i = 0; i < length; i++ )
+            data[i] = 0.0;
+    }
+    else if ( layout == 0 || not layout->touch( data, length ) )
+    {
+#pragma omp parallel for schedule(static)
+        for ( long int i = 0; i < length; i++ )
+            data[i] = 0.0;
+    }
+
+    return data;
+}
+
+
+
+void
+freeAligned( realtype * data )
+{
+    free( data );
+}
@@ -0,0 +1,47 @@
+#ifndef ALIGNED_MEMORY_H
+#define ALIGNED_MEMORY_H
+
+#include <sundials/sundials_types.h>
+
+// Allocation of the data of state and work vectors. The arrays start at a
+// multiple of 64 bytes, a cache line and the widest SIMD register, so the
+// vector kernels need no peeling. Two options apply to later allocations:
+//
+//  - huge pages: arrays of at least 2 MB are aligned to 2 MB and marked
+//    for transparent huge pages, which cuts the misses of the TLB on large
+//    states; without support in the kernel they get normal pages.
+//
+//  - first touch: the array is zeroed by the OpenMP threads, so on a NUMA
+//    machine each page is placed on the node of the thread that works on
+//    it in the threaded kernels. A problem whose kernels visit its arrays in
+//    another order than a flat loop with a static schedule, such as the
+//    tiled 3D equations, sets a FirstTouchLayout describing it. Otherwise,
+//    and for arrays of other lengths, e.g. the workspace, the flat loop is
+//    only an approximation; the 2D kernels are not threaded at all, there
+//    it merely spreads the pages over the nodes.
+
+void setHugePages( const bool enable );
+void setFirstTouch( const bool enable );
+
+
+
+// Order in which the threaded kernels of a problem visit its arrays.
+class FirstTouchLayout
+{
+    public:
+        virtual ~FirstTouchLayout() {}
+
+        // zeroes the array in that order by the OpenMP threads, returns
+        // false if the kernels do not use arrays of this length
+        virtual bool touch( realtype * data, const long int length ) const = 0;
+};
+
+// the layout used by later allocations, none (0) by default
+void setFirstTouchLayout( const FirstTouchLayout * layout );
+const FirstTouchLayout * firstTouchLayout();
+
+// the array is zeroed, throws ExcOutOfMemory if it cannot be allocated
+realtype * allocateAligned( const long int length );
+void freeAligned( realtype * data );
+
+#endif // ALIGNED_MEMORY_H
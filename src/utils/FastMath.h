@@ -0,0 +1,56 @@
+#ifndef FAST_MATH_H
+#define FAST_MATH_H
+
+#include <sundials/sundials_types.h>
+
+#include <cstring>
+
+// Natural logarithm for positive, normal double precision arguments.
+//
+// The argument is split as x = 2^k m with sqrt(2)/2 <= m < sqrt(2) by
+// manipulating the bits directly, and log(m) = log(1+f) is approximated by
+// the minimax polynomial of fdlibm's e_log.c, which keeps the error below
+// one ulp. There are no table lookups, calls or data dependent branches, so
+// loops calling fastLog() vectorize, e.g. with GCC 12 and -march=x86-64-v3
+// (AVX2), which -fopt-info-vec reports. Zero, negative, subnormal, infinite
+// and NaN arguments are not handled.
+inline
+realtype fastLog( const realtype x )
+{
+    static const double ln2Hi = 6.93147180369123816490e-01;
+    static const double ln2Lo = 1.90821492927058770002e-10;
+    static const double Lg1 = 6.666666666666735130e-01;
+    static const double Lg2 = 3.999999999940941908e-01;
+    static const double Lg3 = 2.857142874366239149e-01;
+    static const double Lg4 = 2.222219843214978396e-01;
+    static const double Lg5 = 1.818357216161805012e-01;
+    static const double Lg6 = 1.531383769920937332e-01;
+    static const double Lg7 = 1.479819860511658591e-01;
+
+    // move the mantissa to [sqrt(2)/2, sqrt(2)) by choosing the exponent
+    // relative to the bit pattern of sqrt(2)/2. The bits are unsigned and
+    // biased so that the exponent comes out of a logical shift, and it is
+    // converted from a 32-bit integer: AVX2 has neither arithmetic 64-bit
+    // shifts nor conversions of 64-bit integers to double.
+    unsigned long long bits;
+    std::memcpy( &bits, &x, sizeof( bits ) );
+    const unsigned long long ix = bits - 0x3fe6a09e667f3bcdULL + 0x3ff0000000000000ULL;
+    const int k = (int)( ix >> 52 ) - 0x3ff;
+    bits = ( ix & 0x000fffffffffffffULL ) + 0x3fe6a09e667f3bcdULL;
+
+    double m;
+    std::memcpy( &m, &bits, sizeof( m ) );
+    const double f = m - 1.0;
+    const double dk = (double) k;
+    const double s = f / ( 2.0 + f );
+    const double z = s * s;
+    const double w = z * z;
+    const double t1 = w * ( Lg2 + w * ( Lg4 + w * Lg6 ) );
+    const double t2 = z * ( Lg1 + w * ( Lg3 + w * ( Lg5 + w * Lg7 ) ) );
+    const double r = t2 + t1;
+    const double hfsq = 0.5 * f * f;
+
+    return dk * ln2Hi - ( ( hfsq - ( s * ( hfsq + r ) + dk * ln2Lo ) ) - f );
+}
+
+#endif // FAST_MATH_H
@@ -0,0 +1,262 @@
+#include "MpiUtilities.h"
+#include "Exceptions.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+
+void
+mpiInitialize( int * argc, char *** argv )
+{
+#ifdef ODEITY_WITH_MPI
+    int initialized;
+    MPI_Initialized( &initialized );
+    if ( not initialized )
+    {
+        // the threaded kernels call MPI from the master thread only
+        int provided;
+        const int ierr = MPI_Init_thread( argc, argv, MPI_THREAD_FUNNELED, &provided );
+        AssertThrow( ierr == MPI_SUCCESS, ExcMessage("MPI_Init_thread failed") );
+    }
+#endif
+}
+
+
+
+void
+mpiFinalize()
+{
+#ifdef ODEITY_WITH_MPI
+    int finalized;
+    MPI_Finalized( &finalized );
+    if ( not finalized )
+        MPI_Finalize();
+#endif
+}
+
+
+
+int
+mpiRank()
+{
+#ifdef ODEITY_WITH_MPI
+    int rank;
+    MPI_Comm_rank( mpiCommunicator(), &rank );
+    return rank;
+#else
+    return 0;
+#endif
+}
+
+
+
+int
+mpiSize()
+{
+#ifdef ODEITY_WITH_MPI
+    int size;
+    MPI_Comm_size( mpiCommunicator(), &size );
+    return size;
+#else
+    return 1;
+#endif
+}
+
+
+
+realtype
+mpiSum( const realtype value )
+{
+#ifdef ODEITY_WITH_MPI
+    realtype sum;
+    MPI_Allreduce( const_cast<realtype*>( &value ), &sum, 1, MPI_DOUBLE, MPI_SUM, mpiCommunicator() );
+    return sum;
+#else
+    return value;
+#endif
+}
+
+
+
+long int
+mpiSum( const long int value )
+{
+#ifdef ODEITY_WITH_MPI
+    long int sum;
+    MPI_Allreduce( const_cast<long int*>( &value ), &sum, 1, MPI_LONG, MPI_SUM, mpiCommunicator() );
+    return sum;
+#else
+    return value;
+#endif
+}
+
+
+
+realtype
+mpiMax( const realtype value )
+{
+#ifdef ODEITY_WITH_MPI
+    realtype max;
+    MPI_Allreduce( const_cast<realtype*>( &value ), &max, 1, MPI_DOUBLE, MPI_MAX, mpiCommunicator() );
+    return max;
+#else
+    return value;
+#endif
+}
+
+
+
+realtype
+mpiMin( const realtype value )
+{
+#ifdef ODEITY_WITH_MPI
+    realtype min;
+    MPI_Allreduce( const_cast<realtype*>( &value ), &min, 1, MPI_DOUBLE, MPI_MIN, mpiCommunicator() );
+    return min;
+#else
+    return value;
+#endif
+}
+
+
+
+// The local norms are combined from the sums of squares, with one process
+// the local norm is returned as is so that serial results do not change.
+realtype
+globalRmsNorm( const Vector<realtype> & v, const Vector<realtype> & w )
+{
+    const realtype localNorm = v.rms_norm( w );
+    if ( mpiSize() == 1 )
+        return localNorm;
+
+    const realtype sumSqr = mpiSum( localNorm*localNorm*v.size() );
+    const long int n = mpiSum( (long int) v.size() );
+    return std::sqrt( sumSqr / n );
+}
+
+
+
+realtype
+globalL2Norm( const Vector<realtype> & v )
+{
+    const realtype localNorm = v.l2_norm();
+    if ( mpiSize() == 1 )
+        return localNorm;
+
+    return std::sqrt( mpiSum( localNorm*localNorm ) );
+}
+
+
+
+void
+mpiExchange( const int lower, const realtype * sendLower, realtype * recvLower,
+        const int upper, const realtype * sendUpper, realtype * recvUpper,
+        const unsigned int count )
+{
+    MpiRequests requests;
+    mpiStartExchange( lower, sendLower, recvLower, upper, sendUpper, recvUpper, count, requests );
+    mpiFinishExchange( requests );
+}
+
+
+
+MpiRequests::MpiRequests()
+{
+#ifdef ODEITY_WITH_MPI
+    for ( int i = 0; i < 4; i++ )
+        request[i] = MPI_REQUEST_NULL;
+#endif
+}
+
+
+
+void
+mpiStartExchange( const int lower, const realtype * sendLower, realtype * recvLower,
+        const int upper, const realtype * sendUpper, realtype * recvUpper,
+        const unsigned int count, MpiRequests & requests )
+{
+#ifdef ODEITY_WITH_MPI
+    const int lowerRank = ( lower < 0 ) ? MPI_PROC_NULL : lower;
+    const int upperRank = ( upper < 0 ) ? MPI_PROC_NULL : upper;
+
+    // data going up are tagged 0, data going down 1
+    MPI_Irecv( recvLower, count, MPI_DOUBLE, lowerRank, 0, mpiCommunicator(), &requests.request[0] );
+    MPI_Irecv( recvUpper, count, MPI_DOUBLE, upperRank, 1, mpiCommunicator(), &requests.request[1] );
+    MPI_Isend( const_cast<realtype*>( sendUpper ), count, MPI_DOUBLE, upperRank, 0,
+            mpiCommunicator(), &requests.request[2] );
+    MPI_Isend( const_cast<realtype*>( sendLower ), count, MPI_DOUBLE, lowerRank, 1,
+            mpiCommunicator(), &requests.request[3] );
+#else
+    Assert( lower < 0 && upper < 0, ExcMessage("No neighbours without MPI") );
+#endif
+}
+
+
+
+void
+mpiFinishExchange( MpiRequests & requests )
+{
+#ifdef ODEITY_WITH_MPI
+    MPI_Waitall( 4, requests.request, MPI_STATUSES_IGNORE );
+#endif
+}
+
+
+
+void
+mpiGather( const realtype * local, const unsigned int count, realtype * global )
+{
+#ifdef ODEITY_WITH_MPI
+    const int size = mpiSize();
+    std::vector<int> counts( size );
+    std::vector<int> displacements( size, 0 );
+    int localCount = count;
+
+    MPI_Gather( &localCount, 1, MPI_INT, &counts[0], 1, MPI_INT, 0, mpiCommunicator() );
+    for ( int i = 1; i < size; i++ )
+        displacements[i] = displacements[i-1] + counts[i-1];
+
+    MPI_Gatherv( const_cast<realtype*>( local ), localCount, MPI_DOUBLE,
+            global, &counts[0], &displacements[0], MPI_DOUBLE, 0, mpiCommunicator() );
+#else
+    std::copy( local, local + count, global );
+#endif
+}
+
+
+
+void
+mpiBroadcast( void * data, const unsigned int size )
+{
+#ifdef ODEITY_WITH_MPI
+    MPI_Bcast( data, size, MPI_BYTE, 0, mpiCommunicator() );
+#endif
+}
+
+
+
+void
+mpiBroadcast( std::string & value )
+{
+#ifdef ODEITY_WITH_MPI
+    unsigned int length = value.size();
+    mpiBroadcast( &length, sizeof( length ) );
+
+    std::vector<char> buffer( value.begin(), value.end() );
+    buffer.resize( length );
+    if ( length > 0 )
+        mpiBroadcast( &buffer[0], length );
+    value.assign( buffer.begin(), buffer.end() );
+#endif
+}
+
+
+
+#ifdef ODEITY_WITH_MPI
+MPI_Comm
+mpiCommunicator()
+{
+    return MPI_COMM_WORLD;
+}
+#endif
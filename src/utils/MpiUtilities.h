@@ -0,0 +1,74 @@
+#ifndef MPI_UTILITIES_H
+#define MPI_UTILITIES_H
+
+#include "Vector.h"
+
+#include <sundials/sundials_types.h>
+
+#include <string>
+
+#ifdef ODEITY_WITH_MPI
+#include <mpi.h>
+#endif
+
+// Thin layer over the few MPI operations needed by a distributed run. The
+// grid is split among the processes of MPI_COMM_WORLD, each process stores
+// its part of the solution vector. Odeity built without MPI behaves as a
+// single process: the reductions return their argument and there are no
+// neighbours to exchange data with.
+
+void mpiInitialize( int * argc, char *** argv );
+void mpiFinalize();
+
+int mpiRank();
+int mpiSize();
+
+realtype mpiSum( const realtype value );
+long int mpiSum( const long int value );
+realtype mpiMax( const realtype value );
+realtype mpiMin( const realtype value );
+
+// Norms of a vector whose parts are stored on the processes. With one
+// process they are the norms of the Vector class.
+realtype globalRmsNorm( const Vector<realtype> & v, const Vector<realtype> & w );
+realtype globalL2Norm( const Vector<realtype> & v );
+
+// Sends count values from sendLower to the process lower and from
+// sendUpper to the process upper and receives count values from them to
+// recvLower and recvUpper, respectively. A negative rank means there is no
+// neighbour on that side and nothing is exchanged with it.
+void mpiExchange( const int lower, const realtype * sendLower, realtype * recvLower,
+        const int upper, const realtype * sendUpper, realtype * recvUpper,
+        const unsigned int count );
+
+// Requests of a non-blocking exchange with the neighbouring processes.
+struct MpiRequests
+{
+    MpiRequests();
+
+#ifdef ODEITY_WITH_MPI
+    MPI_Request request[4];
+#endif
+};
+
+// Non-blocking variant of mpiExchange(): the buffers must not be touched
+// until mpiFinishExchange() returns, work that does not need them can be
+// done in between.
+void mpiStartExchange( const int lower, const realtype * sendLower, realtype * recvLower,
+        const int upper, const realtype * sendUpper, realtype * recvUpper,
+        const unsigned int count, MpiRequests & requests );
+void mpiFinishExchange( MpiRequests & requests );
+
+// Sends size bytes at data, or a string, from process 0 to all the others.
+void mpiBroadcast( void * data, const unsigned int size );
+void mpiBroadcast( std::string & value );
+
+// Collects the parts of a vector stored on the processes in order of their
+// rank into global, which is significant only on process 0.
+void mpiGather( const realtype * local, const unsigned int count, realtype * global );
+
+#ifdef ODEITY_WITH_MPI
+MPI_Comm mpiCommunicator();
+#endif
+
+#endif // MPI_UTILITIES_H
@@ -11,8 +11,13 @@
 #include "../integrators/DormandPrince45.h"
 #include "../integrators/RungeKuttaMerson45.h"
 #include "../integrators/RungeKutta23.h"
+#include "../integrators/LowStorageRungeKutta23.h"
+#include "../integrators/LowStorageRungeKutta34.h"
 #include "../integrators/RungeKuttaChebyshev.h"
+#include "../integrators/Rock2.h"
+#include "../integrators/Rock4.h"
 #include "../integrators/CVode.h"
+#include "../integrators/StiffnessSwitching.h"
 #include "../integrators/IntegratorStats.h"
 #include "../io/NetCDFWriter.h"
 #include "../odesystem/AllenCahnEquation.h"
@@ -21,21 +26,26 @@
 #include "../odesystem/LoretiMarchEquation.h"
 
 #include "OdeityApplication.h"
+#include "AlignedMemory.h"
 #include "JobIdentifier.h"
 #include "ProgressDisplay.h"
 #include "Timer.h"
 #include "LogStream.h"
+#include "MpiUtilities.h"
+#include "Profiler.h"
 
 #include <iostream>
 #include <iomanip>
 #include <fstream>
 
-OdeityApplication::OdeityApplication( int argc, char ** argv )
+template<int dim>
+OdeityApplication<dim>::OdeityApplication( int argc, char ** argv )
     :
         writer( 0 ),
         molProblem( 0 ),
         finalTime( 1.0 ),
         numOutputPoints( 10 ),
+        statusInterval_( 10.0 ),
         precond( false ),
         saveHistory( false ),
         saveResults( true ),
@@ -43,6 +53,8 @@ OdeityApplication::OdeityApplication( int argc, char ** argv )
         initialCondition( 0 ),
         solver( 0 )
 {
+    mpiInitialize( &argc, &argv );
+
     // parse command line parameters
     // TODO: better message and usage printing
     AssertThrow( argc == 2, ExcMessage("Parameter file name expected on command line") );
@@ -59,41 +71,59 @@ OdeityApplication::OdeityApplication( int argc, char ** argv )
 
 
 
-OdeityApplication::~OdeityApplication()
+template<int dim>
+OdeityApplication<dim>::~OdeityApplication()
 {
     delete initialCondition;
     delete solver;
     delete molProblem;
     delete writer;
+
+    mpiFinalize();
 }
 
 
 
+template<int dim>
 void
-OdeityApplication::initialize()
+OdeityApplication<dim>::initialize()
 {
     getParameters();
 
-    writer = new NetCDFWriter<2>( computationName_, "data.nc" );
+    writer = new NetCDFWriter<dim>( computationName_, "data.nc" );
 
-    // make a copy of the parameters for later reference in the output directory
+    // in a distributed run the files are written by process 0
+    if ( mpiRank() == 0 )
     {
-        std::ofstream prmFile( std::string(writer->outputPath() + configFileName_).c_str() );
-        prm.print_parameters( prmFile, ParameterHandler::Text );
+        // make a copy of the parameters for later reference in the output directory
+        {
+            std::ofstream prmFile( std::string(writer->outputPath() + configFileName_).c_str() );
+            prm.print_parameters( prmFile, ParameterHandler::Text );
+        }
+
+        // open log file and attach it to the log stream
+        {
+            std::string reportFileName = writer->outputPath() + "report.log";
+            logFile.open( reportFileName.c_str() );
+            logger.attach( logFile );
+        }
     }
 
-    // open log file and attach it to the log stream
+    // initial condition on the part of the grid owned by this process
+    initialState.reinit( grid.numberOfNodes() );
+    if ( dim == 2 )
     {
-        std::string reportFileName = writer->outputPath() + "report.log";
-        logFile.open( reportFileName.c_str() );
-        logger.attach( logFile );
+        for( unsigned int i = 0; i < grid.dimension( xDim ); i++ )
+            for( unsigned int j = 0; j < grid.dimension( yDim ); j++ )
+                initialState( grid.nodeIndex(i,j) ) = (*initialCondition)( grid(i,j) );
+    }
+    if ( dim == 3 )
+    {
+        for( unsigned int i = 0; i < grid.dimension( xDim ); i++ )
+            for( unsigned int j = 0; j < grid.dimension( yDim ); j++ )
+                for( unsigned int k = 0; k < grid.dimension( zDim ); k++ )
+                    initialState( grid.nodeIndex(i,j,k) ) = (*initialCondition)( grid(i,j,k) );
     }
-
-    // initial condition
-    initialState.reinit( grid.numberOfNodes() );
-    for( unsigned int i = 0; i < grid.dimension( xDim ); i++ )
-        for( unsigned int j = 0; j < grid.dimension( yDim ); j++ )
-            initialState( grid.nodeIndex(i,j) ) = (*initialCondition)( grid(i,j) );
 
     solver->setSaveHistory( saveHistory );
     solver->assignExplicitOde( *molProblem, 0.0, initialState );
@@ -102,27 +132,44 @@ OdeityApplication::initialize()
     writeGlobalAttributes();
     writer->writeTimeStep();
 
-    if ( solver->saveHistory() )
+    if ( solver->saveHistory() && mpiRank() == 0 )
+    {
+        history_.open( writer->outputPath() + "history.bin" );
+        solver->stats().setHistory( history_ );
+    }
+
+    // the progress of long computations can be watched with odeity-status
+    if ( statusInterval_ > 0.0 && mpiRank() == 0 )
     {
-        historyFile_.open( std::string( writer->outputPath() + "history.dat").c_str() );
-        solver->stats().setHistoryFile( historyFile_ );
+        status_.open( writer->outputPath() + "status", finalTime, statusInterval_ );
+        solver->setStepMonitor( &status_ );
     }
 
 }
 
 
 
+template<int dim>
 void
-OdeityApplication::declareParameters()
+OdeityApplication<dim>::declareParameters()
 {
     prm.declare_entry( "computation name", "", Patterns::Anything() );
     prm.declare_entry( "final time", "10.0", Patterns::Double() );
     prm.declare_entry( "number of output points", "1", Patterns::Integer() );
     prm.declare_entry( "save results", "true", Patterns::Bool() );
     prm.declare_entry( "save history", "false", Patterns::Bool() );
-    prm.declare_entry( "solver", "CVodeGMRES", Patterns::Selection("CVodeGMRES|CVodeBiCG|CVodeTFQMR|RK23|RKM45|DP45|RKC") );
+    prm.declare_entry( "status interval", "10.0", Patterns::Double(),
+            "Seconds between the updates of the status file in the output directory, 0 disables it" );
+    prm.declare_entry( "huge pages", "false", Patterns::Bool(),
+            "Back the large work vectors of CVODE by transparent huge pages" );
+    prm.declare_entry( "first touch", "true", Patterns::Bool(),
+            "Initialize the work vectors of CVODE by the OpenMP threads that use them" );
+    prm.declare_entry( "solver", "CVodeGMRES", Patterns::Selection("CVodeGMRES|CVodeBiCG|CVodeTFQMR|CVodeBand|CVodeDense|CVodeAdams|RK23|RKM45|DP45|LSRK23|LSRK34|RKC|ROCK2|ROCK4|Switching") );
 
     CVodeSpils::declareParameters( prm );
+    CVodeDls::declareParameters( prm );
+    CVodeAdams::declareParameters( prm );
+    StiffnessSwitching::declareParameters( prm );
     RungeKuttaBase::declareParameters( prm );
 
     AllenCahnEquation::declareParameters( prm );
@@ -131,23 +178,28 @@ OdeityApplication::declareParameters()
     LoretiMarchEquation::declareParameters( prm );
 
     prm.enter_subsection( "Initial condition" );
-        prm.declare_entry( "type", "Wavy circle", Patterns::Selection("Wavy circle|Random|Zero|Sinc|Matheval|Two-scale sine|Rectangle|Two rectangles|Zig-zag") );
+        // the remaining initial conditions are implemented only in 2D
+        if ( dim == 2 )
+            prm.declare_entry( "type", "Wavy circle", Patterns::Selection("Wavy circle|Random|Zero|Sinc|Matheval|Two-scale sine|Rectangle|Two rectangles|Zig-zag") );
+        else
+            prm.declare_entry( "type", "Random", Patterns::Selection("Random|Zero|Sinc|Matheval") );
         WavyCircleFunction::declareParameters( prm );
-        RandomFunction<2>::declareParameters( prm );
-        MathevalFunction<2>::declareParameters( prm );
+        RandomFunction<dim>::declareParameters( prm );
+        MathevalFunction<dim>::declareParameters( prm );
         TwoScaleSineFunction::declareParameters( prm );
         RectangleFunction::declareParameters( prm );
         TwoRectanglesFunction::declareParameters( prm );
     prm.leave_subsection();
 
-    RectangularGrid<2>::declareParameters( prm );
-    RectangularDomain<2>::declareParameters( prm );
+    RectangularGrid<dim>::declareParameters( prm );
+    RectangularDomain<dim>::declareParameters( prm );
 }
 
 
 
+template<int dim>
 void
-OdeityApplication::getParameters()
+OdeityApplication<dim>::getParameters()
 {
     prm.read_input( configFileName_ );
 
@@ -156,8 +208,9 @@ OdeityApplication::getParameters()
     numOutputPoints = prm.get_integer("number of output points");
     saveResults = prm.get_bool( "save results" );
     saveHistory = prm.get_bool("save history");
-    if ( saveHistory )
-        numOutputPoints = 1;
+    statusInterval_ = prm.get_double( "status interval" );
+    setHugePages( prm.get_bool( "huge pages" ) );
+    setFirstTouch( prm.get_bool( "first touch" ) );
 
     solver = solverFactory.createObject( prm.get("solver") );
     solver->getParameters( prm );
@@ -174,32 +227,53 @@ OdeityApplication::getParameters()
     grid.getParameters( prm );
     grid.update();
 
+    // the equation requests its scratch buffers when the grid is attached
     molProblem = createMolProblem();
+    molProblem->attachWorkspace( workspace_ );
     molProblem->attachGrid( grid );
     molProblem->getParameters( prm );
 }
 
 
 
+template<int dim>
 int
-OdeityApplication::run()
+OdeityApplication<dim>::run()
 {
-    printHeader();
+    if ( mpiRank() == 0 )
+        printHeader();
     ProgressDisplay progDisp( numOutputPoints, std::cerr );
     Timer timer;
     realtype dt = finalTime / numOutputPoints;
     timer.start();
     for ( int i = 1; i <= numOutputPoints; i++)
     {
-        solver->integrateTo( i*dt );
+        {
+            ODEITY_PROBE( "integrate" );
+            solver->integrateTo( i*dt );
+        }
         if ( saveResults )
             writer->writeTimeStep();
+        if ( history_.isOpen() )
+            history_.flush();
         ++progDisp;
     }
     timer.stop();
+    status_.publish( *solver, true );
 
-    solver->stats().printInfo();
-    logger << std::endl << "*Computational time*:: " << timer() << " seconds" << std::endl;
+    if ( mpiRank() == 0 )
+    {
+        solver->stats().printInfo();
+        workspace_.printPlan();
+        logger << std::endl << "*Computational time*:: " << timer() << " seconds" << std::endl;
+
+#ifdef ODEITY_WITH_INSTRUMENTATION
+        // the profile of process 0, next to the output data
+        profiler.printInfo();
+        std::ofstream profileFile( std::string( writer->outputPath() + "profile.json" ).c_str() );
+        profiler.writeJson( profileFile );
+#endif
+    }
 
     writer->writeGlobalAtt( "computational_time", timer() );
     writer->writeGlobalAtt( "jobid", jobid() );
@@ -209,8 +283,9 @@ OdeityApplication::run()
 
 
 
+template<int dim>
 void
-OdeityApplication::printHeader()
+OdeityApplication<dim>::printHeader()
 {
     using namespace std;
 
@@ -241,7 +316,8 @@ OdeityApplication::printHeader()
 
 
 
-void OdeityApplication::writeGlobalAttributes()
+template<int dim>
+void OdeityApplication<dim>::writeGlobalAttributes()
 {
     writer->writeGlobalAtt( "creator", "ODEity" );
     writer->writeGlobalAtt( "program", programName_ );
@@ -253,7 +329,8 @@ void OdeityApplication::writeGlobalAttributes()
 
 
 
-void OdeityApplication::registerInitialConditions()
+template<>
+void OdeityApplication<2>::registerInitialConditions()
 {
     initCondFactory.registerCreator( "Wavy circle", createWavyCircleFunction );
     initCondFactory.registerCreator( "Zero", createZeroFunction );
@@ -268,14 +345,38 @@ void OdeityApplication::registerInitialConditions()
 
 
 
-void OdeityApplication::registerOdeSolvers()
+template<>
+void OdeityApplication<3>::registerInitialConditions()
+{
+    initCondFactory.registerCreator( "Zero", createZeroFunction );
+    initCondFactory.registerCreator( "Random", createRandomFunction );
+    initCondFactory.registerCreator( "Sinc", createSincFunction );
+    initCondFactory.registerCreator( "Matheval", createMathevalFunction );
+}
+
+
+
+template<int dim>
+void OdeityApplication<dim>::registerOdeSolvers()
 {
     solverFactory.registerCreator( "CVodeGMRES", createCVodeGMRESSolver );
     solverFactory.registerCreator( "CVodeBiCG", createCVodeBiCGSolver );
     solverFactory.registerCreator( "CVodeTFQMR", createCVodeTFQMRSolver );
+    solverFactory.registerCreator( "CVodeBand", createCVodeBandSolver );
+    solverFactory.registerCreator( "CVodeDense", createCVodeDenseSolver );
+    solverFactory.registerCreator( "CVodeAdams", createCVodeAdamsSolver );
     solverFactory.registerCreator( "RK23", createRungeKutta23Solver );
     solverFactory.registerCreator( "RKM45", createRungeKuttaMerson45Solver );
     solverFactory.registerCreator( "DP45", createDormandPrince45Solver );
+    solverFactory.registerCreator( "LSRK23", createLowStorageRungeKutta23Solver );
+    solverFactory.registerCreator( "LSRK34", createLowStorageRungeKutta34Solver );
     solverFactory.registerCreator( "RKC", createRungeKuttaChebyshevSolver );
+    solverFactory.registerCreator( "ROCK2", createRock2Solver );
+    solverFactory.registerCreator( "ROCK4", createRock4Solver );
+    solverFactory.registerCreator( "Switching", createStiffnessSwitchingSolver );
 }
 
+
+
+template class OdeityApplication<2>;
+template class OdeityApplication<3>;
@@ -4,10 +4,13 @@
 #include "../functions/Function.h"
 #include "../geometry/RectangularDomain.h"
 #include "../geometry/RectangularGrid.h"
+#include "../integrators/StepHistory.h"
 #include "../io/NetCDFWriter.h"
 #include "../odesystem/MolOdeSystem.h"
 #include "Factory.h"
 #include "ParameterHandler.h"
+#include "StatusFile.h"
+#include "Workspace.h"
 #include "Vector.h"
 
 #include <string>
@@ -15,6 +18,9 @@
 
 class OdeIntegratorBase;
 
+// Driver of a method of lines computation on a dim-dimensional rectangular
+// grid. Explicitly instantiated for dim = 2 and 3 in OdeityApplication.cpp.
+template<int dim>
 class OdeityApplication
 {
     public:
@@ -27,12 +33,12 @@ class OdeityApplication
     protected:
 
         OdeityApplication( int argc, char * argv[] );
-        virtual MolOdeSystem<2>* createMolProblem() const = 0;
+        virtual MolOdeSystem<dim>* createMolProblem() const = 0;
         virtual void writeGlobalAttributes();
 
         ParameterHandler prm;
-        NetCDFWriter<2> * writer;
-        MolOdeSystem<2>* molProblem;
+        NetCDFWriter<dim> * writer;
+        MolOdeSystem<dim>* molProblem;
 
     private:
 
@@ -40,22 +46,25 @@ class OdeityApplication
         std::string computationName_;
         std::string programName_;
 
-        RectangularDomain<2> domain;
-        RectangularGrid<2> grid;
+        RectangularDomain<dim> domain;
+        RectangularGrid<dim> grid;
 
         realtype finalTime;
         int numOutputPoints;
+        double statusInterval_;
         bool precond, saveHistory, saveResults, useJacobian;
 
         Vector<realtype> initialState;
-        Function<2> * initialCondition;
-        Factory<Function<2>,std::string> initCondFactory;
+        Function<dim> * initialCondition;
+        Factory<Function<dim>,std::string> initCondFactory;
 
         OdeIntegratorBase * solver;
         Factory<OdeIntegratorBase,std::string> solverFactory;
 
         std::ofstream logFile;
-        std::ofstream historyFile_;
+        StepHistory history_;
+        StatusFile status_;
+        Workspace workspace_;
 
         void printHeader();
 
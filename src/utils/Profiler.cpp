@@ -0,0 +1,167 @@
+#include "Profiler.h"
+#include "LogStream.h"
+
+#include <cstring>
+#include <ctime>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+#include <string>
+
+
+Profiler profiler;
+
+
+
+Profiler::Node::Node( const char * name, Node * parent )
+    :
+        name_( name ),
+        parent_( parent ),
+        calls_( 0 ),
+        wallTime_( 0.0 )
+{}
+
+
+
+Profiler::Node::~Node()
+{
+    for ( unsigned int i = 0; i < children_.size(); i++ )
+        delete children_[i];
+}
+
+
+
+// The names are literals, comparing the pointers finds the child in most
+// cases, the string comparison covers literals merged differently by the
+// compiler.
+Profiler::Node *
+Profiler::Node::child( const char * name )
+{
+    for ( unsigned int i = 0; i < children_.size(); i++ )
+        if ( children_[i]->name_ == name )
+            return children_[i];
+    for ( unsigned int i = 0; i < children_.size(); i++ )
+        if ( std::strcmp( children_[i]->name_, name ) == 0 )
+            return children_[i];
+
+    children_.push_back( new Node( name, this ) );
+    return children_.back();
+}
+
+
+
+Profiler::Profiler()
+    :
+        root_( "total", 0 ),
+        current_( &root_ ),
+        startTime_( wallClock() )
+{
+    root_.calls_ = 1;
+}
+
+
+
+Profiler::Node *
+Profiler::enter( const char * name )
+{
+    current_ = current_->child( name );
+    return current_;
+}
+
+
+
+void
+Profiler::leave( Node * node, const double wallTime )
+{
+    node->calls_++;
+    node->wallTime_ += wallTime;
+    current_ = node->parent_;
+}
+
+
+
+double
+Profiler::wallClock()
+{
+    timespec now;
+    clock_gettime( CLOCK_MONOTONIC, &now );
+    return now.tv_sec + 1e-9*now.tv_nsec;
+}
+
+
+
+static void
+printNode( const Profiler::Node & node, const double totalTime, const int depth )
+{
+    using namespace std;
+
+    ostringstream line;
+    line << left << setw( 34 ) << string( 2*depth, ' ' ) + node.name_ << right
+        << setw( 12 ) << node.calls_
+        << setw( 14 ) << fixed << setprecision( 3 ) << node.wallTime_
+        << setw( 8 ) << setprecision( 1 ) << 100.0*node.wallTime_/totalTime;
+    logger << line.str() << endl;
+
+    for ( unsigned int i = 0; i < node.children_.size(); i++ )
+        printNode( *node.children_[i], totalTime, depth + 1 );
+}
+
+
+
+void
+Profiler::printInfo() const
+{
+    using namespace std;
+
+    const double totalTime = wallClock() - startTime_;
+
+    logger << endl;
+    logger << "Profile" << endl;
+    logger << "-------" << endl;
+    logger << endl;
+    logger << "[frame=\"topbot\",grid=\"rows\"]" << endl;
+    logger << "`---------------------------------'-----------'-------------'-------" << endl;
+    logger << "Probe                                   Calls   Wall time [s]     %" << endl;
+    logger << "--------------------------------------------------------------------" << endl;
+    for ( unsigned int i = 0; i < root_.children_.size(); i++ )
+        printNode( *root_.children_[i], totalTime, 0 );
+    logger << "--------------------------------------------------------------------" << endl;
+    logger << "*Profiled wall time*:: " << totalTime << " seconds" << endl;
+}
+
+
+
+static void
+writeJsonNode( std::ostream & out, const Profiler::Node & node, const double wallTime,
+        const int depth )
+{
+    const std::string indent( 2*depth, ' ' );
+
+    out << indent << "{ \"name\": \"" << node.name_ << "\", \"calls\": " << node.calls_
+        << ", \"wall_time\": " << wallTime << ", \"children\": [";
+    if ( node.children_.empty() )
+    {
+        out << "] }";
+        return;
+    }
+
+    out << std::endl;
+    for ( unsigned int i = 0; i < node.children_.size(); i++ )
+    {
+        writeJsonNode( out, *node.children_[i], node.children_[i]->wallTime_, depth + 1 );
+        out << ( i+1 < node.children_.size() ? "," : "" ) << std::endl;
+    }
+    out << indent << "] }";
+}
+
+
+
+// The root node stands for the whole run up to now.
+void
+Profiler::writeJson( std::ostream & out ) const
+{
+    const std::streamsize precision = out.precision( 9 );
+    writeJsonNode( out, root_, wallClock() - startTime_, 0 );
+    out << std::endl;
+    out.precision( precision );
+}
@@ -0,0 +1,102 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <iosfwd>
+#include <vector>
+
+// Hierarchical wall time and call counts of instrumented regions of code.
+// A region is instrumented by placing
+//
+//     ODEITY_PROBE( "rhs" );
+//
+// at the beginning of a block, it is timed until the end of the block. The
+// probes nest: a probe entered while another one is active is recorded as
+// its child, so the same region reached along different paths (e.g. the
+// right hand side called by the integrator or by the spectral radius
+// estimate) is reported separately. The name has to be a string literal.
+// Probes must not be placed inside OpenMP parallel regions.
+//
+// Without ODEITY_WITH_INSTRUMENTATION the probes compile to nothing.
+class Profiler
+{
+    public:
+
+        class Node
+        {
+            public:
+
+                Node( const char * name, Node * parent );
+                ~Node();
+
+                Node * child( const char * name );
+
+                const char * name_;
+                Node * parent_;
+                std::vector<Node*> children_;
+                long int calls_;
+                double wallTime_;
+
+            private:
+
+                Node( const Node& );
+                Node& operator = ( const Node& );
+        };
+
+        Profiler();
+
+        Node * enter( const char * name );
+        void leave( Node * node, const double wallTime );
+
+        // report, a table in the log and a JSON document
+        void printInfo() const;
+        void writeJson( std::ostream & out ) const;
+
+        static double wallClock();
+
+    private:
+
+        Node root_;
+        Node * current_;
+        double startTime_;
+
+        Profiler( const Profiler& );
+        Profiler& operator = ( const Profiler& );
+};
+
+extern Profiler profiler;
+
+
+
+class ScopedProbe
+{
+    public:
+
+        explicit ScopedProbe( const char * name )
+            :
+                node_( profiler.enter( name ) ),
+                startTime_( Profiler::wallClock() )
+        {}
+
+        ~ScopedProbe()
+        {
+            profiler.leave( node_, Profiler::wallClock() - startTime_ );
+        }
+
+    private:
+
+        Profiler::Node * node_;
+        double startTime_;
+
+        ScopedProbe( const ScopedProbe& );
+        ScopedProbe& operator = ( const ScopedProbe& );
+};
+
+
+
+#ifdef ODEITY_WITH_INSTRUMENTATION
+#define ODEITY_PROBE( name ) ScopedProbe odeityProbe_( name )
+#else
+#define ODEITY_PROBE( name )
+#endif
+
+#endif // PROFILER_H
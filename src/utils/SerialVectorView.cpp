@@ -0,0 +1,22 @@
+#include "SerialVectorView.h"
+
+
+SerialVectorView::SerialVectorView( realtype * data, const long int length )
+{
+    content_.length = length;
+    content_.own_data = FALSE;
+    content_.data = data;
+    header_.content = &content_;
+    header_.ops = serialOperations();
+}
+
+
+
+// The operations of the serial N_Vector, taken from an empty one that is
+// created at the first call and kept.
+N_Vector_Ops
+SerialVectorView::serialOperations()
+{
+    static const N_Vector emptyVector = N_VNewEmpty_Serial( 0 );
+    return emptyVector->ops;
+}
@@ -0,0 +1,31 @@
+#ifndef SERIAL_VECTOR_VIEW_H
+#define SERIAL_VECTOR_VIEW_H
+
+#include <nvector/nvector_serial.h>
+#include <sundials/sundials_types.h>
+
+// Serial N_Vector on memory owned by someone else, e.g. a workspace buffer
+// or the local part of a parallel N_Vector. The header and the content of
+// the N_Vector live in the object, typically on the stack, so making one
+// allocates nothing. It must not outlive the memory and must not be passed
+// to N_VDestroy().
+class SerialVectorView
+{
+    public:
+
+        SerialVectorView( realtype * data, const long int length );
+
+        operator N_Vector () { return &header_; }
+
+    private:
+
+        struct _generic_N_Vector header_;
+        struct _N_VectorContent_Serial content_;
+
+        static N_Vector_Ops serialOperations();
+
+        SerialVectorView( const SerialVectorView& );
+        SerialVectorView& operator = ( const SerialVectorView& );
+};
+
+#endif // SERIAL_VECTOR_VIEW_H
@@ -0,0 +1,53 @@
+#include "SparseMatrix.h"
+#include "Exceptions.h"
+
+#include <algorithm>
+
+
+SparseMatrix::SparseMatrix()
+    :
+        rowStart_( 1, 0 )
+{}
+
+
+
+void
+SparseMatrix::reinit( const std::vector<int> & rowStart, const std::vector<int> & columns )
+{
+    Assert( not rowStart.empty() && rowStart.back() == int( columns.size() ),
+            ExcMessage( "Row starts do not match the column indices" ) );
+
+    rowStart_ = rowStart;
+    columns_ = columns;
+    values_.assign( columns.size(), 0.0 );
+}
+
+
+
+int
+SparseMatrix::find( const int i, const int j ) const
+{
+    Assert( i >= 0 && i < size(), ExcIndexRange( i, 0, size() ) );
+
+    const int * const begin = &columns_[0] + rowStart_[i];
+    const int * const end = &columns_[0] + rowStart_[i+1];
+    const int * const k = std::lower_bound( begin, end, j );
+
+    return ( k != end && *k == j ) ? k - &columns_[0] : -1;
+}
+
+
+
+void
+SparseMatrix::vmult( const realtype * x, realtype * y ) const
+{
+    const int n = size();
+
+    for ( int i = 0; i < n; i++ )
+    {
+        realtype sum = 0.0;
+        for ( int k = rowStart_[i]; k < rowStart_[i+1]; k++ )
+            sum += values_[k]*x[columns_[k]];
+        y[i] = sum;
+    }
+}
@@ -0,0 +1,98 @@
+#ifndef SPARSE_MATRIX_H
+#define SPARSE_MATRIX_H
+
+#include <sundials/sundials_types.h>
+
+#include <vector>
+
+// Square matrix in compressed sparse row (CSR) format. The entries of row i
+// are at the positions rowStart()[i] to rowStart()[i+1]-1 of columns() and
+// values(), sorted by column. The sparsity pattern is set once by reinit(),
+// the values are then overwritten in place.
+class SparseMatrix
+{
+    public:
+
+        SparseMatrix();
+
+        // pattern given by the row starts and the column indices, which
+        // are sorted within each row; the values are set to zero
+        void reinit( const std::vector<int> & rowStart, const std::vector<int> & columns );
+
+        int size() const;
+        int nonzeros() const;
+
+        const int * rowStart() const;
+        const int * columns() const;
+        const realtype * values() const;
+        realtype * values();
+
+        // position of the entry (i,j) in columns() and values(), -1 if it is
+        // not in the pattern
+        int find( const int i, const int j ) const;
+
+        // y = A x
+        void vmult( const realtype * x, realtype * y ) const;
+
+    private:
+
+        std::vector<int> rowStart_;
+        std::vector<int> columns_;
+        std::vector<realtype> values_;
+};
+
+
+
+inline
+int
+SparseMatrix::size() const
+{
+    return rowStart_.empty() ? 0 : rowStart_.size() - 1;
+}
+
+
+
+inline
+int
+SparseMatrix::nonzeros() const
+{
+    return columns_.size();
+}
+
+
+
+inline
+const int *
+SparseMatrix::rowStart() const
+{
+    return &rowStart_[0];
+}
+
+
+
+inline
+const int *
+SparseMatrix::columns() const
+{
+    return &columns_[0];
+}
+
+
+
+inline
+const realtype *
+SparseMatrix::values() const
+{
+    return &values_[0];
+}
+
+
+
+inline
+realtype *
+SparseMatrix::values()
+{
+    return &values_[0];
+}
+
+#endif // SPARSE_MATRIX_H
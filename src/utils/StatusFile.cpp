@@ -0,0 +1,186 @@
+#include "StatusFile.h"
+#include "Exceptions.h"
+#include "Profiler.h"
+#include "../integrators/IntegratorStats.h"
+#include "../integrators/OdeIntegratorBase.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+
+
+static const char statusMagic[8] = { 'O', 'D', 'E', 'I', 'T', 'Y', 'S', 'T' };
+
+
+
+StatusFile::StatusFile()
+    :
+        record_( 0 ),
+        interval_( 0.0 ),
+        startTime_( 0.0 ),
+        lastUpdate_( 0.0 ),
+        lastTime_( 0.0 ),
+        lastSteps_( 0 ),
+        lastRhsEvaluations_( 0 )
+{}
+
+
+
+StatusFile::~StatusFile()
+{
+    close();
+}
+
+
+
+void
+StatusFile::open( const std::string & fileName, const realtype finalTime, const double interval )
+{
+    close();
+
+    const int fd = ::open( fileName.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644 );
+    AssertThrow( fd >= 0, ExcMessage( "Cannot create the status file" ) );
+    if ( ftruncate( fd, sizeof( StatusRecord ) ) != 0 )
+    {
+        ::close( fd );
+        AssertThrow( false, ExcMessage( "Cannot create the status file" ) );
+    }
+
+    void * mapping = mmap( 0, sizeof( StatusRecord ), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+    ::close( fd );
+    AssertThrow( mapping != MAP_FAILED, ExcMessage( "Cannot map the status file" ) );
+
+    record_ = static_cast<StatusRecord*>( mapping );
+    std::memcpy( record_->magic, statusMagic, sizeof( statusMagic ) );
+    record_->version = version;
+    record_->processId = getpid();
+    record_->sequence = 0;
+    record_->finished = 0;
+    record_->stepValue = 0;
+    record_->reserved = 0;
+    record_->wallTime = 0.0;
+    record_->time = 0.0;
+    record_->finalTime = finalTime;
+    record_->stepsize = 0.0;
+    record_->stepsPerSecond = 0.0;
+    record_->rhsEvaluationsPerSecond = 0.0;
+    record_->eta = -1.0;
+    record_->steps = 0;
+    record_->rhsEvaluations = 0;
+
+    interval_ = interval;
+    startTime_ = lastUpdate_ = Profiler::wallClock();
+    lastTime_ = 0.0;
+    lastSteps_ = lastRhsEvaluations_ = 0;
+}
+
+
+
+void
+StatusFile::close()
+{
+    if ( not isOpen() )
+        return;
+
+    munmap( record_, sizeof( StatusRecord ) );
+    record_ = 0;
+}
+
+
+
+void
+StatusFile::stepTaken( OdeIntegratorBase & solver )
+{
+    if ( isOpen() && Profiler::wallClock() - lastUpdate_ >= interval_ )
+        publish( solver );
+}
+
+
+
+void
+StatusFile::publish( OdeIntegratorBase & solver, const bool finished )
+{
+    if ( not isOpen() )
+        return;
+
+    const IntegratorStatsBase & stats = solver.stats();
+    const double now = Profiler::wallClock();
+    const double elapsed = now - lastUpdate_;
+    const realtype time = solver.currentTime();
+    const long int steps = stats.acceptedSteps();
+    const long int rhsEvaluations = stats.rhsEvaluations();
+
+    record_->sequence++;
+    __sync_synchronize();
+
+    record_->finished = finished;
+    record_->stepValue = stats.lastStepValue();
+    record_->wallTime = now - startTime_;
+    record_->time = time;
+    record_->stepsize = stats.lastStepsize();
+    if ( elapsed > 0.0 )
+    {
+        record_->stepsPerSecond = ( steps - lastSteps_ ) / elapsed;
+        record_->rhsEvaluationsPerSecond = ( rhsEvaluations - lastRhsEvaluations_ ) / elapsed;
+        const double rate = ( time - lastTime_ ) / elapsed;
+        record_->eta = rate > 0.0 ? ( record_->finalTime - time ) / rate : -1.0;
+    }
+    if ( finished )
+        record_->eta = 0.0;
+    record_->steps = steps;
+    record_->rhsEvaluations = rhsEvaluations;
+
+    __sync_synchronize();
+    record_->sequence++;
+
+    lastUpdate_ = now;
+    lastTime_ = time;
+    lastSteps_ = steps;
+    lastRhsEvaluations_ = rhsEvaluations;
+}
+
+
+
+// The record is copied until the sequence number is even and unchanged by
+// the copy, i.e. no update was in progress.
+bool
+StatusFile::read( const std::string & fileName, StatusRecord & status )
+{
+    const int fd = ::open( fileName.c_str(), O_RDONLY );
+    if ( fd < 0 )
+        return false;
+
+    struct stat fileStatus;
+    if ( fstat( fd, &fileStatus ) != 0 || fileStatus.st_size < (off_t) sizeof( StatusRecord ) )
+    {
+        ::close( fd );
+        return false;
+    }
+
+    void * mapping = mmap( 0, sizeof( StatusRecord ), PROT_READ, MAP_SHARED, fd, 0 );
+    ::close( fd );
+    if ( mapping == MAP_FAILED )
+        return false;
+
+    const StatusRecord * record = static_cast<const StatusRecord*>( mapping );
+    bool valid = false;
+    for ( int attempt = 0; attempt < 1000 && not valid; attempt++ )
+    {
+        const unsigned int sequence = record->sequence;
+        __sync_synchronize();
+        if ( sequence % 2 == 1 )
+            continue;
+
+        std::memcpy( &status, (const void*) record, sizeof( StatusRecord ) );
+
+        __sync_synchronize();
+        valid = record->sequence == sequence;
+    }
+    munmap( mapping, sizeof( StatusRecord ) );
+
+    return valid && std::memcmp( status.magic, statusMagic, sizeof( statusMagic ) ) == 0
+        && status.version == version;
+}
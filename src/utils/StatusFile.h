@@ -0,0 +1,83 @@
+#ifndef STATUS_FILE_H
+#define STATUS_FILE_H
+
+#include "../integrators/StepMonitor.h"
+
+#include <sundials/sundials_types.h>
+
+#include <string>
+
+// Compact status of a running computation. The rates are averages over the
+// time since the previous update.
+struct StatusRecord
+{
+    char magic[8];                      // "ODEITYST"
+    int version;
+    int processId;
+    volatile unsigned int sequence;     // odd while the record is updated
+    int finished;
+    int stepValue;                      // CVODE order or RKC/ROCK stages
+    int reserved;
+    double wallTime;                    // seconds since the start
+    double time;
+    double finalTime;
+    double stepsize;
+    double stepsPerSecond;
+    double rhsEvaluationsPerSecond;
+    double eta;                         // seconds, negative if unknown
+    long int steps;
+    long int rhsEvaluations;
+};
+
+
+
+// Publishes the status of an integration in a memory-mapped file, so that
+// it can be watched while the computation runs for days. Attached to the
+// integrator as its step monitor, it updates the record at most once per
+// interval of wall time. An update only stores to memory shared with the
+// page cache, it never waits for the disk or for a reader. Readers see a
+// consistent record through the sequence number (a seqlock), see read().
+class StatusFile : public StepMonitor
+{
+    public:
+
+        StatusFile();
+        ~StatusFile();
+
+        void open( const std::string & fileName, const realtype finalTime, const double interval );
+        void close();
+        bool isOpen() const;
+
+        void stepTaken( OdeIntegratorBase & solver );
+        // updates the record now, e.g. at the end of the computation
+        void publish( OdeIntegratorBase & solver, const bool finished = false );
+
+        // copy of the record in the file, false if there is no valid record
+        static bool read( const std::string & fileName, StatusRecord & status );
+
+        static const int version = 1;
+
+    private:
+
+        StatusRecord * record_;
+        double interval_;
+        double startTime_;
+        double lastUpdate_;
+        realtype lastTime_;
+        long int lastSteps_;
+        long int lastRhsEvaluations_;
+
+        StatusFile( const StatusFile& );
+        StatusFile& operator = ( const StatusFile& );
+};
+
+
+
+inline
+bool
+StatusFile::isOpen() const
+{
+    return record_ != 0;
+}
+
+#endif // STATUS_FILE_H
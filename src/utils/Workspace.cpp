@@ -0,0 +1,168 @@
+#include "Workspace.h"
+#include "AlignedMemory.h"
+#include "Exceptions.h"
+#include "LogStream.h"
+
+#include <algorithm>
+
+
+// buffers start at cache lines, i.e. at multiples of 8 doubles
+static const long int bufferAlignment = 8;
+
+static const char * const lifetimeNames[] =
+{
+    "right hand side", "Jacobian assembly", "stiffness check", "preconditioner solve"
+};
+
+
+
+Workspace::Workspace()
+    :
+        memory_( 0 ),
+        peakLength_( 0 ),
+        planned_( false )
+{}
+
+
+
+Workspace::~Workspace()
+{
+    freeAligned( memory_ );
+}
+
+
+
+int
+Workspace::request( const std::string & name, const long int length, const Lifetime lifetime )
+{
+    Assert( length >= 0, ExcMessage( "Negative length of a workspace buffer" ) );
+
+    unsigned int i = 0;
+    while ( i < buffers_.size() && buffers_[i].name != name )
+        i++;
+    if ( i == buffers_.size() )
+    {
+        buffers_.push_back( Buffer() );
+        buffers_[i].name = name;
+    }
+
+    buffers_[i].length = length;
+    buffers_[i].lifetime = lifetime;
+    buffers_[i].offset = 0;
+    planned_ = false;
+
+    return i;
+}
+
+
+
+bool
+Workspace::overlap( const Lifetime a, const Lifetime b )
+{
+    if ( a == b )
+        return true;
+    if ( a == rhsEvaluation )
+        return b == jacobianAssembly || b == stiffnessCheck;
+    if ( b == rhsEvaluation )
+        return a == jacobianAssembly || a == stiffnessCheck;
+    return false;
+}
+
+
+
+// First fit from the longest buffer down: a buffer goes to the lowest
+// offset where it does not collide with a placed buffer whose lifetime
+// overlaps with its own, which is 0 or the end of one of those.
+void
+Workspace::plan()
+{
+    const int n = buffers_.size();
+    std::vector< std::pair<long int,int> > order( n );
+    for ( int i = 0; i < n; i++ )
+        order[i] = std::make_pair( -buffers_[i].length, i );
+    std::sort( order.begin(), order.end() );
+
+    std::vector<int> placed;
+    peakLength_ = 0;
+    for ( int k = 0; k < n; k++ )
+    {
+        Buffer & b = buffers_[order[k].second];
+        const long int length = ( b.length + bufferAlignment - 1 )/bufferAlignment*bufferAlignment;
+
+        std::vector<long int> candidates( 1, 0 );
+        for ( unsigned int m = 0; m < placed.size(); m++ )
+        {
+            const Buffer & p = buffers_[placed[m]];
+            if ( overlap( b.lifetime, p.lifetime ) )
+                candidates.push_back( p.offset + ( p.length + bufferAlignment - 1 )/bufferAlignment*bufferAlignment );
+        }
+        std::sort( candidates.begin(), candidates.end() );
+
+        for ( unsigned int c = 0; c < candidates.size(); c++ )
+        {
+            bool fits = true;
+            for ( unsigned int m = 0; m < placed.size() && fits; m++ )
+            {
+                const Buffer & p = buffers_[placed[m]];
+                fits = not overlap( b.lifetime, p.lifetime )
+                    || candidates[c] + length <= p.offset || p.offset + p.length <= candidates[c];
+            }
+            if ( fits )
+            {
+                b.offset = candidates[c];
+                break;
+            }
+        }
+
+        placed.push_back( order[k].second );
+        peakLength_ = std::max( peakLength_, b.offset + length );
+    }
+
+    freeAligned( memory_ );
+    memory_ = allocateAligned( peakLength_ );
+    planned_ = true;
+}
+
+
+
+long int
+Workspace::requestedLength() const
+{
+    long int length = 0;
+    for ( unsigned int i = 0; i < buffers_.size(); i++ )
+        length += buffers_[i].length;
+    return length;
+}
+
+
+
+long int
+Workspace::peakLength() const
+{
+    return peakLength_;
+}
+
+
+
+void
+Workspace::printPlan() const
+{
+    const realtype megabyte = 1024.0*1024.0/sizeof( realtype );
+
+    logger << std::endl;
+    logger << "Workspace" << std::endl;
+    logger << "---------" << std::endl;
+    for ( unsigned int i = 0; i < buffers_.size(); i++ )
+        logger << "*" << buffers_[i].name << "*:: " << buffers_[i].length << " values at "
+            << buffers_[i].offset << ", " << lifetimeNames[buffers_[i].lifetime] << std::endl;
+    logger << "*Requested memory*:: " << requestedLength()/megabyte << " MB" << std::endl;
+    logger << "*Peak memory*:: " << peakLength()/megabyte << " MB" << std::endl;
+}
+
+
+
+WorkspaceVector::WorkspaceVector( realtype * data, const long int length )
+    :
+        view_( data, length ),
+        vector_( view_ )
+{}
@@ -0,0 +1,109 @@
+#ifndef WORKSPACE_H
+#define WORKSPACE_H
+
+#include "SerialVectorView.h"
+#include "Vector.h"
+
+#include <sundials/sundials_types.h>
+
+#include <string>
+#include <vector>
+
+// Scratch memory shared by an equation, the integrator solving it and their
+// helpers. Each of them requests its buffers up front with a length and a
+// lifetime, the part of the computation over which the contents must
+// survive. Buffers whose lifetimes never overlap share memory, the others
+// are laid out next to each other, so the workspace needs only as much as
+// the largest set of buffers that are used at once. The right hand side is
+// evaluated within the assembly of a Jacobian matrix and within a stiffness
+// check, so its buffers overlap with theirs; all other lifetimes exclude
+// each other.
+//
+// The memory is planned and allocated at the first access after a
+// request and may move then, so the clients keep the handles of their
+// buffers and ask for the addresses when they start to use them.
+class Workspace
+{
+    public:
+
+        enum Lifetime
+        {
+            rhsEvaluation,          // one evaluation of the right hand side or
+                                    // of a Jacobian-vector product
+            jacobianAssembly,       // assembly of a Jacobian matrix
+            stiffnessCheck,         // estimate of the spectral radius
+            preconditionerSolve     // one solve with a preconditioner
+        };
+
+        Workspace();
+        ~Workspace();
+
+        // returns the handle of the buffer; a request with the name of an
+        // earlier one replaces it
+        int request( const std::string & name, const long int length, const Lifetime lifetime );
+
+        realtype * data( const int buffer );
+
+        // in numbers of values, after the plan
+        long int requestedLength() const;
+        long int peakLength() const;
+
+        void printPlan() const;
+
+    private:
+
+        struct Buffer
+        {
+            std::string name;
+            long int length;
+            Lifetime lifetime;
+            long int offset;
+        };
+
+        std::vector<Buffer> buffers_;
+        realtype * memory_;
+        long int peakLength_;
+        bool planned_;
+
+        static bool overlap( const Lifetime a, const Lifetime b );
+        void plan();
+
+        Workspace( const Workspace& );
+        Workspace& operator = ( const Workspace& );
+};
+
+
+
+// Vector on the memory of a buffer, for the functions that take a Vector.
+// The serial N_Vector it is made from is a SerialVectorView in the object,
+// so nothing is allocated.
+class WorkspaceVector
+{
+    public:
+
+        WorkspaceVector( realtype * data, const long int length );
+
+        Vector<realtype> & operator * () { return vector_; }
+        Vector<realtype> * operator -> () { return &vector_; }
+
+    private:
+
+        SerialVectorView view_;
+        Vector<realtype> vector_;
+
+        WorkspaceVector( const WorkspaceVector& );
+        WorkspaceVector& operator = ( const WorkspaceVector& );
+};
+
+
+
+inline
+realtype *
+Workspace::data( const int buffer )
+{
+    if ( not planned_ )
+        plan();
+    return memory_ + buffers_[buffer].offset;
+}
+
+#endif // WORKSPACE_H
@@ -0,0 +1,237 @@
+// Counts the heap allocations in the functions CVODE calls on every step:
+// the right hand side, the local right hand side of the BBD preconditioner
+// and the Jacobian-vector product, on the Cahn-Hilliard equation. The
+// N_Vectors are wrapped without allocating and the equation takes its
+// buffers from its workspace, so once the first calls have set everything
+// up none of them may allocate. Allocations are counted by replacing the
+// global operator new and, with glibc, malloc, calloc and realloc.
+//
+//     allocations
+//
+// Exits with a nonzero status if a call allocated memory. On one process
+// only, since the MPI library may allocate in the halo exchange.
+
+#include <geometry/RectangularDomain.h>
+#include <geometry/RectangularGrid.h>
+#include <integrators/CVode.h>
+#include <odesystem/CahnHilliardEquation.h>
+#include <utils/MpiUtilities.h>
+#include <utils/ParameterHandler.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+
+using namespace std;
+
+static const unsigned int xdim = 32;
+static const unsigned int ydim = 24;
+static const int numCalls = 10;
+
+static bool counting = false;
+static unsigned long allocations = 0;
+
+
+
+void * operator new( size_t size )
+{
+    if ( counting )
+        allocations++;
+    void * p = malloc( size > 0 ? size : 1 );
+    if ( p == 0 )
+        throw bad_alloc();
+    return p;
+}
+
+
+
+void * operator new[]( size_t size )
+{
+    return operator new( size );
+}
+
+
+
+void operator delete( void * p ) throw()
+{
+    free( p );
+}
+
+
+
+void operator delete[]( void * p ) throw()
+{
+    free( p );
+}
+
+
+
+#ifdef __GLIBC__
+// The allocations of C code, e.g. of N_VNewEmpty_Serial(), pass the
+// allocator of the C library.
+extern "C" void * __libc_malloc( size_t size );
+extern "C" void * __libc_calloc( size_t count, size_t size );
+extern "C" void * __libc_realloc( void * p, size_t size );
+
+extern "C"
+void * malloc( size_t size )
+{
+    if ( counting )
+        allocations++;
+    return __libc_malloc( size );
+}
+
+
+
+extern "C"
+void * calloc( size_t count, size_t size )
+{
+    if ( counting )
+        allocations++;
+    return __libc_calloc( count, size );
+}
+
+
+
+extern "C"
+void * realloc( void * p, size_t size )
+{
+    if ( counting )
+        allocations++;
+    return __libc_realloc( p, size );
+}
+#endif
+
+
+
+static N_Vector
+newVector( const unsigned int length, const unsigned int globalLength )
+{
+#ifdef ODEITY_WITH_MPI
+    return N_VNew_Parallel( MPI_COMM_WORLD, length, globalLength );
+#else
+    return N_VNew_Serial( length );
+#endif
+}
+
+
+
+static void
+destroyVector( N_Vector v )
+{
+#ifdef ODEITY_WITH_MPI
+    N_VDestroy_Parallel( v );
+#else
+    N_VDestroy_Serial( v );
+#endif
+}
+
+
+
+// Allocations of numCalls calls of each function after the first ones.
+static bool
+check( const string & name, int (*call)( N_Vector *, void * ), N_Vector * vectors, void * data )
+{
+    call( vectors, data );
+
+    allocations = 0;
+    counting = true;
+    for ( int k = 0; k < numCalls; k++ )
+        call( vectors, data );
+    counting = false;
+
+    const bool ok = allocations == 0;
+    cout << name << ": " << allocations << " allocations in " << numCalls << " calls"
+        << ( ok ? "" : "  FAILED" ) << endl;
+    return ok;
+}
+
+
+
+static int
+callRhs( N_Vector * v, void * data )
+{
+    return ExplicitOdeRhs( 0.0, v[0], v[1], data );
+}
+
+
+
+static int
+callLocalRhs( N_Vector * v, void * data )
+{
+    return ExplicitOdeLocalRhs( xdim*ydim, 0.0, v[0], v[1], data );
+}
+
+
+
+static int
+callJacobian( N_Vector * v, void * data )
+{
+    return ExplicitOdeJacobian( v[2], v[3], 0.0, v[0], v[1], data, v[4] );
+}
+
+
+
+int main( int argc, char * argv[] )
+{
+    mpiInitialize( &argc, &argv );
+
+    if ( mpiSize() > 1 )
+    {
+        if ( mpiRank() == 0 )
+            cerr << "allocations runs on one process" << endl;
+        mpiFinalize();
+        return 1;
+    }
+
+    ParameterHandler prm;
+    CahnHilliardEquation::declareParameters( prm );
+    RectangularGrid<2>::declareParameters( prm );
+    RectangularDomain<2>::declareParameters( prm );
+
+    RectangularDomain<2> domain;
+    RectangularGrid<2> grid;
+    grid.attachToRectangularDomain( domain );
+    grid.getParameters( prm );
+    grid.setDimension( xdim, ydim );
+    grid.update();
+
+    CahnHilliardEquation equation;
+    equation.attachGrid( grid );
+    equation.getParameters( prm );
+
+    // y, fy, v, Jv and tmp
+    const unsigned int n = grid.numberOfNodes();
+    N_Vector vectors[5];
+    for ( int i = 0; i < 5; i++ )
+        vectors[i] = newVector( n, n );
+
+    realtype * const y = N_VGetArrayPointer( vectors[0] );
+    realtype * const v = N_VGetArrayPointer( vectors[2] );
+    for ( unsigned int i = 0; i < xdim; i++ )
+        for ( unsigned int j = 0; j < ydim; j++ )
+        {
+            const Point<2> p = grid( i, j );
+            y[grid.nodeIndex( i, j )] = 0.9*cos( 2*M_PI*p(0) )*cos( 4*M_PI*p(1) );
+            v[grid.nodeIndex( i, j )] = sin( 2*M_PI*p(0) + M_PI*p(1) );
+        }
+
+    CVodeUserData data;
+    data.ode = &equation;
+    data.preconditioner = 0;
+
+    ExplicitOdeRhs( 0.0, vectors[0], vectors[1], &data );
+
+    bool passed = check( "right hand side", callRhs, vectors, &data );
+    passed = check( "local right hand side", callLocalRhs, vectors, &data ) && passed;
+    passed = check( "Jacobian-vector product", callJacobian, vectors, &data ) && passed;
+
+    for ( int i = 0; i < 5; i++ )
+        destroyVector( vectors[i] );
+
+    mpiFinalize();
+
+    return passed ? 0 : 1;
+}
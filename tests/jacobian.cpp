@@ -0,0 +1,155 @@
+// Compares the sparse Jacobians of the 2D equations assembled by colored
+// differences with differences taken column by column, under each boundary
+// condition and on a grid whose dimensions are not multiples of the number
+// of colors. Run on several processes it checks the diagonal block of each
+// slab, in particular the rows next to the slab boundaries, where the right
+// hand side also sees the columns perturbed by the neighbouring processes.
+//
+//     jacobian
+//     mpirun -np 3 jacobian
+//
+// Exits with a nonzero status if an entry differs or if a column by column
+// difference falls outside the sparsity pattern.
+
+#include <geometry/RectangularDomain.h>
+#include <geometry/RectangularGrid.h>
+#include <odesystem/AllenCahnEquation.h>
+#include <odesystem/CahnHilliardEquation.h>
+#include <odesystem/DegenerateCahnHilliardEquation.h>
+#include <utils/MpiUtilities.h>
+#include <utils/ParameterHandler.h>
+#include <utils/SparseMatrix.h>
+#include <utils/Vector.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+
+
+using namespace std;
+
+static const unsigned int xdim = 23;
+static const unsigned int ydim = 17;
+
+
+
+// Largest difference between the colored Jacobian and the column by column
+// one relative to the largest entry, over all processes.
+template<class Equation>
+static realtype
+compare( ParameterHandler & prm, const BoundaryCondition bc )
+{
+    RectangularDomain<2> domain;
+    RectangularGrid<2> grid;
+    grid.attachToRectangularDomain( domain );
+    grid.getParameters( prm );
+    grid.setDimension( xdim, ydim );
+    grid.setBoundaryCondition( bc, 0.5 );
+    grid.update();
+
+    Equation equation;
+    equation.attachGrid( grid );
+    equation.getParameters( prm );
+
+    const int n = grid.numberOfNodes();
+    Vector<realtype> y( n ), fy( n ), yp( n ), fp( n );
+    for ( unsigned int i = 0; i < grid.dimension( xDim ); i++ )
+        for ( unsigned int j = 0; j < grid.dimension( yDim ); j++ )
+        {
+            const Point<2> p = grid( i, j );
+            y( grid.nodeIndex( i, j ) ) = 0.9*cos( 2*M_PI*p(0) )*cos( 4*M_PI*p(1) );
+        }
+
+    equation.rhs( 0.0, y, fy );
+    const SparseMatrix & J = equation.sparseJacobian( 0.0, y, fy );
+
+    realtype scale = 0.0;
+    for ( int k = 0; k < J.rowStart()[n]; k++ )
+        scale = max( scale, fabs( J.values()[k] ) );
+    scale = mpiMax( scale );
+
+    // the same increments as ColoredJacobian
+    const realtype srur = sqrt( UNIT_ROUNDOFF );
+    const unsigned int offset = grid.globalOffset( xDim );
+    realtype error = 0.0;
+    yp = y;
+
+    // every process evaluates the right hand side for every global column,
+    // the process owning it perturbs it
+    for ( unsigned int gx = 0; gx < grid.globalDimension( xDim ); gx++ )
+        for ( unsigned int gy = 0; gy < ydim; gy++ )
+        {
+            const bool local = gx >= offset && gx < offset + grid.dimension( xDim );
+            const int j = local ? grid.nodeIndex( gx - offset, gy ) : -1;
+            if ( local )
+                yp( j ) += srur*max( fabs( y( j ) ), 1.0 );
+
+            equation.rhs( 0.0, yp, fp );
+
+            if ( not local )
+                continue;
+
+            const realtype incrementInv = 1.0/( yp( j ) - y( j ) );
+            for ( int i = 0; i < n; i++ )
+            {
+                const realtype reference = ( fp( i ) - fy( i ) )*incrementInv;
+                const int * const begin = J.columns() + J.rowStart()[i];
+                const int * const end = J.columns() + J.rowStart()[i + 1];
+                const int * const entry = lower_bound( begin, end, j );
+                const realtype colored = ( entry != end && *entry == j ) ?
+                    J.values()[entry - J.columns()] : 0.0;
+                error = max( error, fabs( colored - reference ) );
+            }
+            yp( j ) = y( j );
+        }
+
+    return mpiMax( error )/scale;
+}
+
+
+
+template<class Equation>
+static bool
+check( ParameterHandler & prm, const string & name )
+{
+    const BoundaryCondition conditions[] = { neumannBoundary, periodicBoundary, dirichletBoundary };
+    const char * const conditionNames[] = { "Neumann", "periodic", "Dirichlet" };
+
+    bool passed = true;
+    for ( int c = 0; c < 3; c++ )
+    {
+        const realtype error = compare<Equation>( prm, conditions[c] );
+        const bool ok = error < 1.0e-8;
+        if ( mpiRank() == 0 )
+            cout << name << ", " << conditionNames[c] << ": relative difference " << error
+                << ( ok ? "" : "  FAILED" ) << endl;
+        passed = passed && ok;
+    }
+    return passed;
+}
+
+
+
+int main( int argc, char * argv[] )
+{
+    mpiInitialize( &argc, &argv );
+
+    ParameterHandler prm;
+    AllenCahnEquation::declareParameters( prm );
+    CahnHilliardEquation::declareParameters( prm );
+    DegenerateCahnHilliardEquation::declareParameters( prm );
+    RectangularGrid<2>::declareParameters( prm );
+    RectangularDomain<2>::declareParameters( prm );
+
+    if ( mpiRank() == 0 )
+        cout << "Processes: " << mpiSize() << endl;
+
+    bool passed = check<AllenCahnEquation>( prm, "Allen-Cahn" );
+    passed = check<CahnHilliardEquation>( prm, "Cahn-Hilliard" ) && passed;
+    passed = check<DegenerateCahnHilliardEquation>( prm, "degenerate Cahn-Hilliard" ) && passed;
+
+    mpiFinalize();
+
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,105 @@
+// Prints the status of a running computation from the status file in its
+// output directory.
+//
+//     odeity-status <status file> [--watch <seconds>]
+//
+// With --watch the status is printed repeatedly until the computation
+// finishes or its process is gone.
+
+#include <utils/StatusFile.h>
+
+#include <signal.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+
+using namespace std;
+
+
+
+static string
+formatDuration( const double seconds )
+{
+    if ( seconds < 0.0 )
+        return "unknown";
+
+    const long int s = (long int)( seconds + 0.5 );
+    ostringstream out;
+    if ( s >= 86400 )
+        out << s / 86400 << "d ";
+    out << setfill( '0' ) << setw( 2 ) << s / 3600 % 24 << ":"
+        << setw( 2 ) << s / 60 % 60 << ":" << setw( 2 ) << s % 60;
+    return out.str();
+}
+
+
+
+static bool
+processRunning( const int pid )
+{
+    return kill( pid, 0 ) == 0 || errno == EPERM;
+}
+
+
+
+static void
+printStatus( const StatusRecord & status )
+{
+    const bool running = not status.finished && processRunning( status.processId );
+
+    cout << "*State*:: " << ( status.finished ? "finished" : running ? "running" : "stopped" )
+        << " (process " << status.processId << ")" << endl;
+    cout << "*Simulated time*:: " << status.time << " of " << status.finalTime;
+    if ( status.finalTime > 0.0 )
+        cout << " (" << fixed << setprecision( 1 ) << 100.0*status.time/status.finalTime << " %)";
+    cout.unsetf( ios::floatfield );
+    cout << setprecision( 6 ) << endl;
+    cout << "*Wall time*:: " << formatDuration( status.wallTime ) << endl;
+    cout << "*Steps*:: " << status.steps << " (" << status.stepsPerSecond << " per second)" << endl;
+    cout << "*RHS evaluations*:: " << status.rhsEvaluations
+        << " (" << status.rhsEvaluationsPerSecond << " per second)" << endl;
+    cout << "*Step size*:: " << status.stepsize << endl;
+    if ( status.stepValue != 0 )
+        cout << "*Order or stages*:: " << status.stepValue << endl;
+    cout << "*ETA*:: " << ( running ? formatDuration( status.eta ) : "-" ) << endl;
+}
+
+
+
+int main( int argc, char * argv[] )
+{
+    int watch = 0;
+    if ( argc == 4 && strcmp( argv[2], "--watch" ) == 0 )
+        watch = atoi( argv[3] );
+    else if ( argc != 2 )
+    {
+        cerr << "Usage: " << argv[0] << " <status file> [--watch <seconds>]" << endl;
+        return EXIT_FAILURE;
+    }
+
+    for ( ;; )
+    {
+        StatusRecord status;
+        if ( not StatusFile::read( argv[1], status ) )
+        {
+            cerr << "No valid status in " << argv[1] << endl;
+            return EXIT_FAILURE;
+        }
+
+        printStatus( status );
+        if ( watch <= 0 || status.finished || not processRunning( status.processId ) )
+            break;
+
+        cout << endl;
+        sleep( watch );
+    }
+
+    return EXIT_SUCCESS;
+}